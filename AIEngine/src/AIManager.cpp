@@ -1,8 +1,8 @@
 #include <algorithm>
+#include <chrono>
 #include "UrchinCommon.h"
 
 #include "AIManager.h"
-#include "path/pathfinding/PathfindingAStar.h"
 
 namespace urchin
 {
@@ -15,9 +15,16 @@ namespace urchin
             aiSimulationStopper(false),
             timeStep(0),
             paused(true),
-            navMeshGenerator(new NavMeshGenerator())
+            navMeshGenerator(new NavMeshGenerator()),
+            threadPool(new ThreadPool(ConfigService::instance()->getUnsignedIntValue("parallelProcessing.aiWorkerThreads"))),
+            pathCache(new PathCache(ConfigService::instance()->getUnsignedIntValue("pathfinding.pathCacheSize"))),
+            polygonGraph(new PolygonGraph()),
+            pathRequestsProcessor(new PathRequestsProcessor(threadPool, pathCache, polygonGraph,
+                    ConfigService::instance()->getFloatValue("pathfinding.pathRequestsTimeBudget")))
     {
         NumericalCheck::instance()->perform();
+
+        navMeshGenerator->setThreadPool(threadPool);
     }
 
     AIManager::~AIManager()
@@ -33,6 +40,10 @@ namespace urchin
         copiedPathRequests.clear();
         pathRequests.clear();
 
+        delete pathRequestsProcessor;
+        delete polygonGraph;
+        delete pathCache;
+        delete threadPool;
         delete navMeshGenerator;
 
         Profiler::getInstance("ai")->log();
@@ -43,6 +54,14 @@ namespace urchin
         return navMeshGenerator;
     }
 
+    /**
+     * @return Cache of the path corridors: can be used to monitor the cache hit rate
+     */
+    const PathCache *AIManager::getPathCache() const
+    {
+        return pathCache;
+    }
+
     void AIManager::addEntity(const std::shared_ptr<AIEntity> &aiEntity)
     {
         aiWorld.addEntity(aiEntity);
@@ -53,6 +72,18 @@ namespace urchin
         aiWorld.removeEntity(aiEntity);
     }
 
+    /**
+     * Generate the navigation mesh of the current AI world and save it in a baked file. The baked file can be restored at map loading
+     * with NavMeshGenerator::setBakedNavMesh().
+     * @param filename Absolute path of the baked navigation mesh file
+     */
+    void AIManager::bakeNavMesh(const std::string &filename)
+    {
+        std::lock_guard<std::mutex> lock(generateMutex);
+
+        navMeshGenerator->bake(aiWorld, filename);
+    }
+
     void AIManager::addPathRequest(const std::shared_ptr<PathRequest> &pathRequest)
     {
         std::lock_guard<std::mutex> lock(mutex);
@@ -186,13 +217,13 @@ namespace urchin
         //AI execution
         if (!paused)
         {
-            std::shared_ptr<NavMesh> navMesh = navMeshGenerator->generate(aiWorld);
-
-            PathfindingAStar pathfindingAStar(navMesh);
-            for (auto &pathRequest : copiedPathRequests)
+            std::shared_ptr<const NavMesh> navMesh;
             {
-                pathRequest->setPath(pathfindingAStar.findPath(pathRequest->getStartPoint(), pathRequest->getEndPoint()));
+                std::lock_guard<std::mutex> lock(generateMutex);
+                navMesh = navMeshGenerator->generate(aiWorld);
             }
+
+            pathRequestsProcessor->process(navMesh, copiedPathRequests);
         }
     }
 
@@ -10,8 +10,11 @@
 #include "input/AIWorld.h"
 #include "input/AIEntity.h"
 #include "path/PathRequest.h"
+#include "path/PathRequestsProcessor.h"
 #include "path/navmesh/NavMeshGenerator.h"
 #include "path/navmesh/model/output/NavMesh.h"
+#include "path/pathfinding/PathCache.h"
+#include "path/pathfinding/hierarchical/PolygonGraph.h"
 
 namespace urchin
 {
@@ -23,10 +26,13 @@ namespace urchin
             ~AIManager();
 
             NavMeshGenerator *getNavMeshGenerator() const;
+            const PathCache *getPathCache() const;
 
             void addEntity(const std::shared_ptr<AIEntity> &);
             void removeEntity(const std::shared_ptr<AIEntity> &);
 
+            void bakeNavMesh(const std::string &);
+
             void addPathRequest(const std::shared_ptr<PathRequest> &);
             void removePathRequest(const std::shared_ptr<PathRequest> &);
 
@@ -47,6 +53,7 @@ namespace urchin
             static std::exception_ptr aiThreadExceptionPtr;
 
             mutable std::mutex mutex;
+            std::mutex generateMutex;
             float timeStep;
             bool paused;
 
@@ -54,6 +61,11 @@ namespace urchin
             AIWorld aiWorld;
             std::vector<std::shared_ptr<PathRequest>> pathRequests;
             std::vector<std::shared_ptr<PathRequest>> copiedPathRequests;
+
+            ThreadPool *threadPool;
+            PathCache *pathCache;
+            PolygonGraph *polygonGraph;
+            PathRequestsProcessor *pathRequestsProcessor;
     };
 
 }
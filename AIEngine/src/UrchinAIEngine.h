@@ -14,6 +14,9 @@
 #include "path/navmesh/model/output/NavPolygon.h"
 #include "path/navmesh/model/output/NavPolygonEdge.h"
 #include "path/navmesh/model/output/NavTriangle.h"
+#include "path/navmesh/model/output/NavTriangleGrid.h"
+#include "path/navmesh/model/output/CompiledNavElements.h"
+#include "path/navmesh/model/output/CompiledNavMesh.h"
 #include "path/navmesh/model/output/NavLink.h"
 #include "path/navmesh/triangulation/MonotonePolygonAlgorithm.h"
 #include "path/navmesh/triangulation/MonotonePolygon.h"
@@ -23,10 +26,18 @@
 #include "path/navmesh/csg/CSGPolygon.h"
 #include "path/navmesh/polytope/services/TerrainObstacleService.h"
 #include "path/navmesh/link/EdgeLinkDetection.h"
+#include "path/navmesh/bake/BakedNavMesh.h"
+#include "path/navmesh/bake/NavMeshBakeService.h"
 #include "path/pathfinding/FunnelAlgorithm.h"
 #include "path/pathfinding/PathPortal.h"
+#include "path/pathfinding/PathNodeHeap.h"
+#include "path/pathfinding/PathCache.h"
+#include "path/pathfinding/hierarchical/PolygonTrianglesDistance.h"
+#include "path/pathfinding/hierarchical/PolygonGraph.h"
+#include "path/pathfinding/hierarchical/PolygonCorridorFinder.h"
 #include "path/pathfinding/PathfindingAStar.h"
 #include "path/PathRequest.h"
+#include "path/PathRequestsProcessor.h"
 #include "path/PathPoint.h"
 
 #include "character/AICharacter.h"
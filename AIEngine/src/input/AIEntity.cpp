@@ -1,7 +1,6 @@
 #include <utility>
 
 #include "AIEntity.h"
-#include "path/navmesh/model/NavObject.h"
 
 namespace urchin
 {
@@ -50,19 +49,4 @@ namespace urchin
         return bIsObstacleCandidate;
     }
 
-    void AIEntity::addNavObject(const std::shared_ptr<NavObject> &navObject)
-    {
-        navObjects.push_back(navObject);
-    }
-
-    const std::vector<std::shared_ptr<NavObject>> &AIEntity::getNavObjects() const
-    {
-        return navObjects;
-    }
-
-    void AIEntity::removeAllNavObjects()
-    {
-        navObjects.clear();
-    }
-
 }
@@ -9,8 +9,6 @@
 namespace urchin
 {
 
-    class NavObject;
-
     class AIEntity
     {
         public:
@@ -33,10 +31,6 @@ namespace urchin
             Transform<float> getTransform() const;
             bool isObstacleCandidate() const;
 
-            void addNavObject(const std::shared_ptr<NavObject> &);
-            const std::vector<std::shared_ptr<NavObject>> &getNavObjects() const;
-            void removeAllNavObjects();
-
         private:
             mutable std::mutex mutex;
             std::atomic_bool bToRebuild;
@@ -44,8 +38,6 @@ namespace urchin
             std::string name;
             Transform<float> transform;
             bool bIsObstacleCandidate;
-
-            std::vector<std::shared_ptr<NavObject>> navObjects;
     };
 
 }
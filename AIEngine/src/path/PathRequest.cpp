@@ -5,6 +5,8 @@ namespace urchin
     PathRequest::PathRequest(const Point3<float> &startPoint, const Point3<float> &endPoint) :
             startPoint(startPoint),
             endPoint(endPoint),
+            priority(0),
+            lastProcessingUpdate(0),
             bIsPathReady(false)
     {
 
@@ -20,6 +22,32 @@ namespace urchin
         return endPoint;
     }
 
+    /**
+     * @param priority Requests with a higher priority are computed first when the time budget of an AI update doesn't allow to compute all requests
+     */
+    void PathRequest::setPriority(int priority)
+    {
+        this->priority.store(priority, std::memory_order_relaxed);
+    }
+
+    int PathRequest::getPriority() const
+    {
+        return priority.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @param lastProcessingUpdate AI update number which has computed the path. Managed by the AI manager.
+     */
+    void PathRequest::setLastProcessingUpdate(unsigned int lastProcessingUpdate)
+    {
+        this->lastProcessingUpdate = lastProcessingUpdate;
+    }
+
+    unsigned int PathRequest::getLastProcessingUpdate() const
+    {
+        return lastProcessingUpdate;
+    }
+
     void PathRequest::setPath(const std::vector<PathPoint> &path)
     {
         {
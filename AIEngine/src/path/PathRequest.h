@@ -18,6 +18,12 @@ namespace urchin
             const Point3<float> &getStartPoint() const;
             const Point3<float> &getEndPoint() const;
 
+            void setPriority(int);
+            int getPriority() const;
+
+            void setLastProcessingUpdate(unsigned int);
+            unsigned int getLastProcessingUpdate() const;
+
             void setPath(const std::vector<PathPoint> &);
             std::vector<PathPoint> getPath() const;
             bool isPathReady() const;
@@ -25,6 +31,8 @@ namespace urchin
         private:
             Point3<float> startPoint;
             Point3<float> endPoint;
+            std::atomic_int priority;
+            unsigned int lastProcessingUpdate;
 
             mutable std::mutex mutex;
             std::atomic_bool bIsPathReady;
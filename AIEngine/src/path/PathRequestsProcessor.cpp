@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+#include "PathRequestsProcessor.h"
+
+namespace urchin
+{
+
+    /**
+     * @param timeBudget Time budget of one update expressed in milliseconds. At least one request is computed by update whatever the
+     * time budget.
+     */
+    PathRequestsProcessor::PathRequestsProcessor(ThreadPool *threadPool, PathCache *pathCache, PolygonGraph *polygonGraph, float timeBudget) :
+            threadPool(threadPool),
+            pathCache(pathCache),
+            polygonGraph(polygonGraph),
+            timeBudget(timeBudget),
+            updateNumber(0)
+    {
+        if(timeBudget <= 0.0f)
+        {
+            throw std::invalid_argument("Path requests time budget must be strictly positive: " + std::to_string(timeBudget));
+        }
+    }
+
+    /**
+     * Compute the path requests on the navigation mesh (not modified during the computation)
+     * @param pathRequests [in,out] Path requests to compute. They are sorted by computation order.
+     */
+    void PathRequestsProcessor::process(const std::shared_ptr<const NavMesh> &navMesh, std::vector<std::shared_ptr<PathRequest>> &pathRequests)
+    {
+        ScopeProfiler profiler("ai", "pathRequests");
+
+        updateNumber++;
+        updatePathfinding(navMesh);
+
+        sortPathRequests(pathRequests);
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(static_cast<long>(timeBudget * 1000.0f));
+        std::atomic_size_t nextRequestIndex(0);
+        threadPool->parallelFor(pathfindingAStars.size(), 1, [this, deadline, &pathRequests, &nextRequestIndex](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
+            {
+                PathfindingAStar *pathfindingAStar = pathfindingAStars[i].get();
+                while(true)
+                {
+                    std::size_t requestIndex = nextRequestIndex.fetch_add(1, std::memory_order_relaxed);
+                    if(requestIndex >= pathRequests.size() || (requestIndex > 0 && std::chrono::steady_clock::now() >= deadline))
+                    { //first request is always computed: requests cannot be starved by a too small time budget
+                        break;
+                    }
+
+                    const std::shared_ptr<PathRequest> &pathRequest = pathRequests[requestIndex];
+                    pathRequest->setPath(pathfindingAStar->findPath(pathRequest->getStartPoint(), pathRequest->getEndPoint()));
+                    pathRequest->setLastProcessingUpdate(updateNumber);
+                }
+            }
+        });
+    }
+
+    /**
+     * Sort the path requests by priority and then by least recently computed first. Priorities can be modified by another thread:
+     * they are copied before the sort to keep a consistent order.
+     */
+    void PathRequestsProcessor::sortPathRequests(std::vector<std::shared_ptr<PathRequest>> &pathRequests)
+    {
+        sortedPathRequests.clear();
+        for(auto &pathRequest : pathRequests)
+        {
+            sortedPathRequests.push_back({pathRequest->getPriority(), pathRequest->getLastProcessingUpdate(), std::move(pathRequest)});
+        }
+
+        std::stable_sort(sortedPathRequests.begin(), sortedPathRequests.end(), [](const SortedPathRequest &r1, const SortedPathRequest &r2) {
+            if(r1.priority != r2.priority)
+            {
+                return r1.priority > r2.priority;
+            }
+            return r1.lastProcessingUpdate < r2.lastProcessingUpdate;
+        });
+
+        for(std::size_t i=0; i<sortedPathRequests.size(); ++i)
+        {
+            pathRequests[i] = std::move(sortedPathRequests[i].pathRequest);
+        }
+        sortedPathRequests.clear();
+    }
+
+    void PathRequestsProcessor::updatePathfinding(const std::shared_ptr<const NavMesh> &navMesh)
+    {
+        if(pathfindingAStars.empty())
+        {
+            for(unsigned int i=0; i<threadPool->getNumberThreads(); ++i)
+            {
+                pathfindingAStars.push_back(std::make_unique<PathfindingAStar>(navMesh));
+                pathfindingAStars.back()->setPathCache(pathCache);
+                pathfindingAStars.back()->setPolygonGraph(polygonGraph);
+            }
+        }else if(navMesh != pathfindingNavMesh)
+        { //new navigation mesh version: search buffers are kept
+            for(auto &pathfindingAStar : pathfindingAStars)
+            {
+                pathfindingAStar->setNavMesh(navMesh);
+            }
+        }
+        pathfindingNavMesh = navMesh;
+        pathCache->refresh(*navMesh);
+        polygonGraph->refresh(*navMesh);
+    }
+
+}
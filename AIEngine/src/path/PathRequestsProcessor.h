@@ -0,0 +1,52 @@
+#ifndef URCHINENGINE_PATHREQUESTSPROCESSOR_H
+#define URCHINENGINE_PATHREQUESTSPROCESSOR_H
+
+#include <memory>
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "path/PathRequest.h"
+#include "path/navmesh/model/output/NavMesh.h"
+#include "path/pathfinding/PathfindingAStar.h"
+#include "path/pathfinding/PathCache.h"
+#include "path/pathfinding/hierarchical/PolygonGraph.h"
+
+namespace urchin
+{
+
+    /**
+     * Compute the path requests in parallel in a time budget. Requests are computed by priority and then by least recently computed
+     * first. Requests not computed in the time budget are carried over to the next update.
+     */
+    class PathRequestsProcessor
+    {
+        public:
+            PathRequestsProcessor(ThreadPool *, PathCache *, PolygonGraph *, float);
+
+            void process(const std::shared_ptr<const NavMesh> &, std::vector<std::shared_ptr<PathRequest>> &);
+
+        private:
+            struct SortedPathRequest
+            {
+                int priority;
+                unsigned int lastProcessingUpdate;
+                std::shared_ptr<PathRequest> pathRequest;
+            };
+
+            void sortPathRequests(std::vector<std::shared_ptr<PathRequest>> &);
+            void updatePathfinding(const std::shared_ptr<const NavMesh> &);
+
+            ThreadPool *threadPool;
+            PathCache *pathCache;
+            PolygonGraph *polygonGraph;
+            const float timeBudget;
+
+            std::vector<SortedPathRequest> sortedPathRequests;
+            std::shared_ptr<const NavMesh> pathfindingNavMesh;
+            std::vector<std::unique_ptr<PathfindingAStar>> pathfindingAStars; //one path finding by thread
+            unsigned int updateNumber;
+    };
+
+}
+
+#endif
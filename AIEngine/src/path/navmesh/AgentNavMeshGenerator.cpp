@@ -0,0 +1,842 @@
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <numeric>
+#include <functional>
+
+#include "AgentNavMeshGenerator.h"
+#include "input/AIObject.h"
+#include "input/AITerrain.h"
+#include "path/navmesh/polytope/PolytopePlaneSurface.h"
+#include "path/navmesh/polytope/PolytopeBuilder.h"
+#include "path/navmesh/polytope/aabbtree/NavObjectAABBNodeData.h"
+#include "path/navmesh/csg/PolygonsUnion.h"
+#include "path/navmesh/csg/PolygonsSubtraction.h"
+#include "path/navmesh/link/EdgeLinkDetection.h"
+#include "path/navmesh/bake/NavMeshBakeService.h"
+
+#define OBSTACLE_REDUCE_SIZE 0.0002f
+
+namespace urchin
+{
+
+    //Debug parameters
+    bool DEBUG_EXPORT_NAV_MESH = false;
+
+    /**
+     * @param tiledMode Indicates if the walkable surfaces are split into tiles (see NavMeshGenerator::setTiledMode())
+     */
+    AgentNavMeshGenerator::AgentNavMeshGenerator(std::shared_ptr<NavMeshAgent> navMeshAgent, bool tiledMode) :
+            polygonMinDotProductThreshold(std::cos(AngleConverter<float>::toRadian(ConfigService::instance()->getFloatValue("navMesh.polygonRemoveAngleThresholdInDegree")))),
+            polygonMergePointsDistanceThreshold(ConfigService::instance()->getFloatValue("navMesh.polygonMergePointsDistanceThreshold")),
+            tiledMode(tiledMode),
+            navMeshAgent(std::move(navMeshAgent)),
+            navMesh(std::make_shared<NavMesh>()),
+            threadPool(nullptr),
+            generated(false),
+            navigationObjects(AABBTree<std::shared_ptr<NavObject>>(ConfigService::instance()->getFloatValue("navMesh.polytopeAabbTreeFatMargin")))
+    {
+        float navigationObjectsJumpMargin = this->navMeshAgent->getJumpDistance() / 2.0f;
+        float navigationObjectsMargin = std::max(navigationObjectsJumpMargin, ConfigService::instance()->getFloatValue("navMesh.polytopeAabbTreeFatMargin"));
+        navigationObjects.updateFatMargin(navigationObjectsMargin);
+    }
+
+    const std::shared_ptr<NavMeshAgent> &AgentNavMeshGenerator::getNavMeshAgent() const
+    {
+        return navMeshAgent;
+    }
+
+    /**
+     * @param threadPool Thread pool used to build the expanded polytopes and the navigation polygons in parallel. Null to generate
+     * the navigation mesh on the calling thread only.
+     */
+    void AgentNavMeshGenerator::setThreadPool(ThreadPool *threadPool)
+    {
+        this->threadPool = threadPool;
+    }
+
+    /**
+     * @return True when the navigation mesh has been generated at least once: next generations only require the changes of the AI world
+     */
+    bool AgentNavMeshGenerator::isGenerated() const
+    {
+        return generated;
+    }
+
+    /**
+     * @return Last generated navigation mesh. The navigation mesh is an immutable snapshot: it can be read while a new version is generated.
+     */
+    std::shared_ptr<const NavMesh> AgentNavMeshGenerator::getLastGeneratedNavMesh() const
+    {
+        std::lock_guard<std::mutex> lock(navMeshMutex);
+
+        return navMesh;
+    }
+
+    /**
+     * @param bakedNavMesh Baked navigation mesh restored by the next generation when it has been baked from the same AI world and agent.
+     * The generation continues incrementally from the restored navigation mesh.
+     */
+    void AgentNavMeshGenerator::setBakedNavMesh(std::shared_ptr<const BakedNavMesh> bakedNavMesh)
+    {
+        std::lock_guard<std::mutex> lock(navMeshMutex);
+
+        this->bakedNavMesh = std::move(bakedNavMesh);
+    }
+
+    /**
+     * See '_doc' for an algorithm overview
+     * @param aiWorldChanges Changes since the previous generation. All the entities of the AI world must be built by the first generation.
+     */
+    std::shared_ptr<const NavMesh> AgentNavMeshGenerator::generate(const AIWorld &aiWorld, const AIWorldChanges &aiWorldChanges)
+    {
+        ScopeProfiler scopeProfiler("ai", "navMeshGenerate");
+
+        updateExpandedPolytopes(aiWorldChanges);
+        prepareNavObjectsToUpdate();
+        if(!restoreBakedNavMesh(aiWorld))
+        {
+            deleteNavLinks();
+            updateNavPolygons();
+            createNavLinks();
+        }
+        updateNavMesh();
+        generated = true;
+
+        if(DEBUG_EXPORT_NAV_MESH)
+        {
+            navMesh->svgMeshExport(std::string(std::getenv("HOME")) + "/navMesh/navMesh" + std::to_string(navMesh->getUpdateId()) + ".html");
+        }
+
+        return navMesh;
+    }
+
+    void AgentNavMeshGenerator::updateExpandedPolytopes(const AIWorldChanges &aiWorldChanges)
+    {
+        ScopeProfiler scopeProfiler("ai", "upExpandPoly");
+
+        newOrMovingNavObjectsToRefresh.clear();
+        affectedNavObjectsToRefresh.clear();
+        changedNavPolygonIds.clear();
+        changedObstacleBoxes.clear();
+
+        for(const auto &aiEntityToRemove : aiWorldChanges.entitiesToRemove)
+        {
+            removeNavObject(aiEntityToRemove);
+        }
+
+        //expanded polytopes of the entities are independent: they are built in parallel
+        const auto &entitiesToBuild = aiWorldChanges.entitiesToBuild;
+        entitiesExpandedPolytopes.resize(entitiesToBuild.size());
+        parallelFor(threadPool, entitiesToBuild.size(), 1, [this, &entitiesToBuild](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
+            {
+                entitiesExpandedPolytopes[i] = buildExpandedPolytopes(entitiesToBuild[i].first, *entitiesToBuild[i].second);
+            }
+        });
+
+        for(std::size_t i=0; i<entitiesToBuild.size(); ++i)
+        {
+            for(auto &expandedPolytope : entitiesExpandedPolytopes[i])
+            {
+                addNavObject(entitiesToBuild[i].first, std::move(expandedPolytope));
+            }
+        }
+        entitiesExpandedPolytopes.clear();
+    }
+
+    std::vector<std::unique_ptr<Polytope>> AgentNavMeshGenerator::buildExpandedPolytopes(const std::shared_ptr<AIEntity> &aiEntity,
+            const EntityGeometry &entityGeometry) const
+    {
+        if(aiEntity->getType()==AIEntity::OBJECT)
+        {
+            auto aiObject = std::dynamic_pointer_cast<AIObject>(aiEntity);
+            return PolytopeBuilder::instance()->buildExpandedPolytopes(aiObject, entityGeometry, navMeshAgent);
+        }else if(aiEntity->getType()==AIEntity::TERRAIN)
+        {
+            auto aiTerrain = std::dynamic_pointer_cast<AITerrain>(aiEntity);
+            return PolytopeBuilder::instance()->buildExpandedPolytope(aiTerrain, entityGeometry, navMeshAgent);
+        }
+        return {};
+    }
+
+    void AgentNavMeshGenerator::addNavObject(const std::shared_ptr<AIEntity> &aiEntity, const std::shared_ptr<Polytope>& expandedPolytope)
+    {
+        auto navObject = std::make_shared<NavObject>(expandedPolytope);
+        newOrMovingNavObjectsToRefresh.insert(navObject);
+
+        if(expandedPolytope->isWalkableCandidate())
+        {
+            for(std::size_t surfaceIndex=0; surfaceIndex<expandedPolytope->getSurfaces().size(); ++surfaceIndex)
+            {
+                const std::shared_ptr<PolytopeSurface> &polytopeSurface = expandedPolytope->getSurface(surfaceIndex);
+                if(polytopeSurface->isWalkable())
+                {
+                    navObject->addWalkableSurface(polytopeSurface);
+                }
+            }
+        }
+
+        if(expandedPolytope->isObstacleCandidate())
+        {
+            changedObstacleBoxes.push_back(expandedPolytope->getAABBox());
+        }
+
+        navigationObjects.addObject(new NavObjectAABBNodeData(navObject));
+        entitiesNavObjects[aiEntity].push_back(navObject);
+    }
+
+    void AgentNavMeshGenerator::removeNavObject(const std::shared_ptr<AIEntity> &aiEntity)
+    {
+        auto itFind = entitiesNavObjects.find(aiEntity);
+        if(itFind == entitiesNavObjects.end())
+        {
+            return;
+        }
+
+        for(const auto &navObject : itFind->second)
+        {
+            const std::vector<std::weak_ptr<NavObject>> &nearObjects = navObject->retrieveNearObjects();
+            for(const auto &nearObject : nearObjects)
+            {
+                #ifndef NDEBUG
+                    assert(!nearObject.expired());
+                #endif
+                affectedNavObjectsToRefresh.insert(nearObject.lock());
+            }
+
+            for(const auto &navPolygon : navObject->getNavPolygons())
+            {
+                changedNavPolygonIds.push_back(navPolygon->getId());
+            }
+            if(navObject->getExpandedPolytope()->isObstacleCandidate())
+            {
+                changedObstacleBoxes.push_back(navObject->getExpandedPolytope()->getAABBox());
+            }
+            removeCachedFootprints(navObject->getExpandedPolytope());
+            navigationObjects.removeObject(navObject);
+        }
+        entitiesNavObjects.erase(itFind);
+    }
+
+    void AgentNavMeshGenerator::prepareNavObjectsToUpdate()
+    {
+        ScopeProfiler scopeProfiler("ai", "prepNavObjects");
+
+        navObjectsToRefresh.clear();
+        partialNavObjectsToRefresh.clear();
+        navObjectsLinksToRefresh.clear();
+
+        for(const auto &navObject : newOrMovingNavObjectsToRefresh)
+        {
+            updateNearObjects(navObject);
+
+            for(const auto &nearObject : navObject->retrieveNearObjects())
+            {
+                std::shared_ptr<NavObject> sharedPtrNearObject = nearObject.lock();
+                if(newOrMovingNavObjectsToRefresh.count(sharedPtrNearObject) == 0)
+                {
+                    affectedNavObjectsToRefresh.insert(sharedPtrNearObject);
+                }
+            }
+        }
+
+        for(const auto &navObject : affectedNavObjectsToRefresh)
+        {
+            updateNearObjects(navObject);
+        }
+
+        if(tiledMode)
+        { //affected NavObjects keep the tiles not touched by a changed obstacle
+            for(auto it = affectedNavObjectsToRefresh.begin(); it != affectedNavObjectsToRefresh.end();)
+            {
+                std::vector<std::size_t> touchedWalkableSurfaces = findTouchedWalkableSurfaces(*it);
+                if(touchedWalkableSurfaces.size() != (*it)->getWalkableSurfaces().size())
+                {
+                    partialNavObjectsToRefresh.emplace(*it, std::move(touchedWalkableSurfaces));
+                    it = affectedNavObjectsToRefresh.erase(it);
+                }else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        for(const auto &navObject : affectedNavObjectsToRefresh)
+        {
+            addNavObjectsLinksToRefresh(navObject);
+        }
+        for(const auto &partialNavObject : partialNavObjectsToRefresh)
+        {
+            if(!partialNavObject.second.empty())
+            {
+                addNavObjectsLinksToRefresh(partialNavObject.first);
+            }
+        }
+
+        navObjectsToRefresh.merge(newOrMovingNavObjectsToRefresh);
+        navObjectsToRefresh.merge(affectedNavObjectsToRefresh);
+    }
+
+    /**
+     * @return Indices of the walkable surfaces (tiles) of the NavObject touched by a changed obstacle
+     */
+    std::vector<std::size_t> AgentNavMeshGenerator::findTouchedWalkableSurfaces(const std::shared_ptr<NavObject> &navObject) const
+    {
+        std::vector<std::size_t> touchedWalkableSurfaces;
+        for(std::size_t walkableSurfaceIndex = 0; walkableSurfaceIndex < navObject->getWalkableSurfaces().size(); ++walkableSurfaceIndex)
+        {
+            const AABBox<float> &walkableSurfaceBox = navObject->getWalkableSurfaces()[walkableSurfaceIndex]->getAABBox();
+            for(const auto &changedObstacleBox : changedObstacleBoxes)
+            {
+                if(changedObstacleBox.collideWithAABBox(walkableSurfaceBox))
+                {
+                    touchedWalkableSurfaces.push_back(walkableSurfaceIndex);
+                    break;
+                }
+            }
+        }
+        return touchedWalkableSurfaces;
+    }
+
+    /**
+     * When navigation polygons of a NavObject are refreshed (deleted & created): we recreate existing links of the other NavObjects
+     * toward this NavObject
+     */
+    void AgentNavMeshGenerator::addNavObjectsLinksToRefresh(const std::shared_ptr<NavObject> &navObject)
+    {
+        for(const auto &relinkNavObject : navObject->retrieveNearObjects())
+        {
+            std::shared_ptr<NavObject> sharedPtrRelinkNavObject = relinkNavObject.lock();
+            if(affectedNavObjectsToRefresh.count(sharedPtrRelinkNavObject) == 0 && newOrMovingNavObjectsToRefresh.count(sharedPtrRelinkNavObject) == 0
+                    && partialNavObjectsToRefresh.count(sharedPtrRelinkNavObject) == 0)
+            {
+                navObjectsLinksToRefresh.insert(std::make_pair(sharedPtrRelinkNavObject, navObject));
+            }
+        }
+    }
+
+    void AgentNavMeshGenerator::updateNearObjects(const std::shared_ptr<NavObject> &navObject)
+    {
+        nearObjects.clear();
+        navigationObjects.aabboxQuery(navObject->getExpandedPolytope()->getAABBox(), nearObjects);
+
+        navObject->removeAllNearObjects();
+        for (const auto &nearObject : nearObjects)
+        {
+            if (nearObject->getExpandedPolytope()->getName() != navObject->getExpandedPolytope()->getName())
+            {
+                navObject->addNearObject(nearObject);
+            }
+        }
+    }
+
+    /**
+     * Restore the navigation polygons and links from the baked navigation mesh when all the navigation objects are new and when the AI world
+     * didn't change since the bake
+     * @return True when the navigation polygons have been restored
+     */
+    bool AgentNavMeshGenerator::restoreBakedNavMesh(const AIWorld &aiWorld)
+    {
+        std::shared_ptr<const BakedNavMesh> bakedNavMeshToRestore;
+        {
+            std::lock_guard<std::mutex> lock(navMeshMutex);
+            bakedNavMeshToRestore = std::move(bakedNavMesh);
+            bakedNavMesh.reset();
+        }
+        if(!bakedNavMeshToRestore)
+        {
+            return false;
+        }
+
+        ScopeProfiler scopeProfiler("ai", "restoreBaked");
+
+        allNavObjects.clear();
+        navigationObjects.getAllNodeObjects(allNavObjects);
+        NavMeshBakeService navMeshBakeService;
+        if(allNavObjects.size() != navObjectsToRefresh.size()
+                || bakedNavMeshToRestore->getWorldKey() != navMeshBakeService.computeWorldKey(aiWorld.getEntities(), *navMeshAgent, tiledMode))
+        {
+            Logger::logger().logInfo("Baked navigation mesh ignored: AI world changed since the bake");
+            return false;
+        }
+
+        std::map<std::string, std::pair<std::shared_ptr<NavObject>, std::size_t>> walkableSurfaces;
+        std::map<std::string, std::shared_ptr<const NavTopography>> navTopographies;
+        for(const auto &navObject : navObjectsToRefresh)
+        {
+            for(std::size_t walkableSurfaceIndex = 0; walkableSurfaceIndex < navObject->getWalkableSurfaces().size(); ++walkableSurfaceIndex)
+            {
+                const std::shared_ptr<PolytopeSurface> &walkableSurface = navObject->getWalkableSurfaces()[walkableSurfaceIndex];
+                std::string walkableSurfaceName = computeWalkableSurfaceName(walkableSurface);
+                walkableSurfaces.emplace(walkableSurfaceName, std::make_pair(navObject, walkableSurfaceIndex));
+                navTopographies.emplace(walkableSurfaceName, walkableSurface->getNavTopography());
+            }
+        }
+        for(std::uint32_t polygonIndex = 0; polygonIndex < bakedNavMeshToRestore->getPolygonsCount(); ++polygonIndex)
+        {
+            std::string walkableSurfaceName = bakedNavMeshToRestore->getWalkableSurfaceName(bakedNavMeshToRestore->getPolygon(polygonIndex));
+            if(walkableSurfaces.find(walkableSurfaceName) == walkableSurfaces.end())
+            {
+                Logger::logger().logInfo("Baked navigation mesh ignored: walkable surface " + walkableSurfaceName + " not found in AI world");
+                return false;
+            }
+        }
+
+        std::map<std::string, std::vector<std::shared_ptr<NavPolygon>>> walkableSurfacesNavPolygons;
+        for(auto &navPolygon : navMeshBakeService.restoreNavPolygons(*bakedNavMeshToRestore, navTopographies))
+        {
+            walkableSurfacesNavPolygons[navPolygon->getWalkableSurfaceName()].push_back(std::move(navPolygon));
+        }
+        for(auto &walkableSurfaceNavPolygons : walkableSurfacesNavPolygons)
+        {
+            const auto &walkableSurface = walkableSurfaces.at(walkableSurfaceNavPolygons.first);
+            walkableSurface.first->setWalkableSurfaceNavPolygons(walkableSurface.second, std::move(walkableSurfaceNavPolygons.second));
+        }
+
+        return true;
+    }
+
+    std::string AgentNavMeshGenerator::computeWalkableSurfaceName(const std::shared_ptr<PolytopeSurface> &walkableSurface)
+    {
+        return walkableSurface->getPolytope()->getName() + "[" + std::to_string(walkableSurface->getSurfacePosition()) + "]";
+    }
+
+    void AgentNavMeshGenerator::updateNavPolygons()
+    {
+        ScopeProfiler scopeProfiler("ai", "upNavPolygons");
+
+        walkableSurfaceTasks.clear();
+        for(const auto &navObject : navObjectsToRefresh)
+        {
+            for(const auto &navPolygon : navObject->getNavPolygons())
+            {
+                changedNavPolygonIds.push_back(navPolygon->getId());
+            }
+            navObject->removeAllNavPolygons();
+
+            for(std::size_t walkableSurfaceIndex = 0; walkableSurfaceIndex < navObject->getWalkableSurfaces().size(); ++walkableSurfaceIndex)
+            {
+                addWalkableSurfaceTask(navObject, walkableSurfaceIndex);
+            }
+        }
+        for(const auto &partialNavObject : partialNavObjectsToRefresh)
+        {
+            for(std::size_t walkableSurfaceIndex : partialNavObject.second)
+            {
+                for(const auto &navPolygon : partialNavObject.first->getWalkableSurfaceNavPolygons(walkableSurfaceIndex))
+                {
+                    changedNavPolygonIds.push_back(navPolygon->getId());
+                }
+                addWalkableSurfaceTask(partialNavObject.first, walkableSurfaceIndex);
+            }
+        }
+
+        //walkable surfaces are independent: obstacles, subtraction, triangulation and elevation are computed in parallel
+        parallelFor(threadPool, walkableSurfaceTasks.size(), 1, [this](std::size_t beginIndex, std::size_t endIndex) {
+            NavPolygonsScratch scratch;
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
+            {
+                WalkableSurfaceTask &task = walkableSurfaceTasks[i];
+                task.navPolygons = createNavigationPolygons(task.nearObjects, task.walkableSurface, scratch);
+            }
+        });
+
+        for(auto &task : walkableSurfaceTasks)
+        {
+            task.navObject->setWalkableSurfaceNavPolygons(task.walkableSurfaceIndex, std::move(task.navPolygons));
+        }
+        walkableSurfaceTasks.clear();
+    }
+
+    void AgentNavMeshGenerator::addWalkableSurfaceTask(const std::shared_ptr<NavObject> &navObject, std::size_t walkableSurfaceIndex)
+    {
+        std::vector<std::shared_ptr<NavObject>> nearObjects;
+        for(const auto &nearObject : navObject->retrieveNearObjects())
+        {
+            nearObjects.push_back(nearObject.lock());
+        }
+        walkableSurfaceTasks.push_back({navObject, walkableSurfaceIndex, navObject->getWalkableSurfaces()[walkableSurfaceIndex], std::move(nearObjects), {}});
+    }
+
+    /**
+     * This method is executed in parallel: it must not modify the generator state
+     */
+    std::vector<std::shared_ptr<NavPolygon>> AgentNavMeshGenerator::createNavigationPolygons(const std::vector<std::shared_ptr<NavObject>> &nearObjects,
+            const std::shared_ptr<PolytopeSurface> &walkableSurface, NavPolygonsScratch &scratch) const
+    {
+        std::string walkableName = computeWalkableSurfaceName(walkableSurface);
+        scratch.walkablePolygons.clear();
+        scratch.walkablePolygons.emplace_back(CSGPolygon<float>(walkableName, walkableSurface->getOutlineCwPoints()));
+        std::vector<CSGPolygon<float>> obstaclePolygons = determineObstacles(nearObjects, walkableSurface, scratch);
+
+        applyObstaclesOnWalkablePolygon(obstaclePolygons, scratch);
+
+        bool uniqueWalkableSurface = scratch.walkablePolygons.size() == 1;
+        std::vector<std::shared_ptr<NavPolygon>> navPolygons;
+        navPolygons.reserve(scratch.walkablePolygons.size());
+        for(auto &walkablePolygon : scratch.walkablePolygons)
+        {
+            //simplify polygon to improve performance and avoid degenerated walkable face
+            walkablePolygon.simplify(polygonMinDotProductThreshold, polygonMergePointsDistanceThreshold);
+            if(walkablePolygon.getCwPoints().size() > 2)
+            {
+                std::shared_ptr<NavPolygon> navPolygon = createNavigationPolygon(walkablePolygon, walkableSurface, uniqueWalkableSurface, scratch);
+                navPolygon->setWalkableSurfaceName(walkableName);
+                navPolygons.push_back(navPolygon);
+            }
+        }
+
+        return navPolygons;
+    }
+
+    std::vector<CSGPolygon<float>> AgentNavMeshGenerator::determineObstacles(const std::vector<std::shared_ptr<NavObject>> &nearObjects,
+            const std::shared_ptr<PolytopeSurface> &walkableSurface, NavPolygonsScratch &scratch) const
+    {
+        const std::vector<CSGPolygon<float>> &selfObstaclePolygons = walkableSurface->getSelfObstacles();
+
+        scratch.holePolygons.clear();
+        for(const auto &selfObstaclePolygon : selfObstaclePolygons)
+        {
+            scratch.holePolygons.emplace_back(selfObstaclePolygon);
+        }
+
+        for (const auto &nearObject : nearObjects)
+        {
+            const std::shared_ptr<Polytope> &nearExpandedPolytope = nearObject->getExpandedPolytope();
+
+            if (nearExpandedPolytope->isObstacleCandidate() && nearExpandedPolytope->getAABBox().collideWithAABBox(walkableSurface->getAABBox()))
+            {
+                CSGPolygon<float> footprintPolygon = retrievePolytopeFootprint(nearExpandedPolytope, walkableSurface, scratch.footprintPoints);
+                if (footprintPolygon.getCwPoints().size() >= 3)
+                {
+                    scratch.holePolygons.push_back(std::move(footprintPolygon));
+                }
+            }
+        }
+
+        return PolygonsUnion<float>::instance()->unionPolygons(scratch.holePolygons, scratch.unionPaths);
+    }
+
+    /**
+     * @return Simplified footprint of the polytope on the walkable surface. Footprints are cached: an expanded polytope and its surfaces
+     * are immutable and are rebuilt when the AI entity changes.
+     */
+    CSGPolygon<float> AgentNavMeshGenerator::retrievePolytopeFootprint(const std::shared_ptr<Polytope> &polytopeObstacle, const std::shared_ptr<PolytopeSurface> &walkableSurface,
+            std::vector<Point2<float>> &footprintPoints) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(footprintsCacheMutex);
+            auto itPolytope = footprintsCache.find(polytopeObstacle.get());
+            if(itPolytope != footprintsCache.end())
+            {
+                auto itFootprint = itPolytope->second.find(walkableSurface.get());
+                if(itFootprint != itPolytope->second.end())
+                {
+                    return itFootprint->second;
+                }
+            }
+        }
+
+        CSGPolygon<float> footprintPolygon = computePolytopeFootprint(polytopeObstacle, walkableSurface, footprintPoints);
+        if (footprintPolygon.getCwPoints().size() >= 3)
+        {
+            footprintPolygon.simplify(polygonMinDotProductThreshold, polygonMergePointsDistanceThreshold);
+        }
+
+        std::lock_guard<std::mutex> lock(footprintsCacheMutex);
+        footprintsCache[polytopeObstacle.get()].emplace(walkableSurface.get(), footprintPolygon);
+        return footprintPolygon;
+    }
+
+    CSGPolygon<float> AgentNavMeshGenerator::computePolytopeFootprint(const std::shared_ptr<Polytope> &polytopeObstacle, const std::shared_ptr<PolytopeSurface> &walkableSurface,
+            std::vector<Point2<float>> &footprintPoints) const
+    {
+        footprintPoints.clear();
+        Plane<float> walkablePlane = walkableSurface->getPlane(polytopeObstacle->getXZRectangle());
+
+        for(const auto &polytopeSurface : polytopeObstacle->getSurfaces())
+        {
+            if(auto *polytopePlaneSurface = dynamic_cast<PolytopePlaneSurface *>(polytopeSurface.get()))
+            {
+                for (std::size_t i = 0, previousI = polytopePlaneSurface->getCcwPoints().size() - 1; i < polytopePlaneSurface->getCcwPoints().size(); previousI = i++)
+                {
+                    float distance1 = walkablePlane.distance(polytopePlaneSurface->getCcwPoints()[previousI]);
+                    float distance2 = walkablePlane.distance(polytopePlaneSurface->getCcwPoints()[i]);
+                    if (std::signbit(distance1) != std::signbit(distance2))
+                    {
+                        Line3D<float> polytopeEdgeLine(polytopePlaneSurface->getCcwPoints()[previousI], polytopePlaneSurface->getCcwPoints()[i]);
+                        Point3<float> intersectionPoint = walkablePlane.intersectPoint(polytopeEdgeLine);
+                        footprintPoints.emplace_back(Point2<float>(intersectionPoint.X, -intersectionPoint.Z));
+                    }
+                }
+            }else
+            {
+                throw std::runtime_error("Unsupported type of surface as obstacle: " + std::string(typeid(polytopeSurface.get()).name()));
+            }
+        }
+
+        if(footprintPoints.size() < 3)
+        { //no footprint: return empty polygon
+            return CSGPolygon<float>("", {});
+        }
+
+        ConvexHull2D<float> footprintConvexHull(footprintPoints);
+        std::vector<Point2<float>> cwPoints(footprintConvexHull.getPoints());
+        std::reverse(cwPoints.begin(), cwPoints.end());
+        return CSGPolygon<float>(polytopeObstacle->getName(), std::move(cwPoints));
+    }
+
+    /**
+     * Remove the footprints of the polytope and the footprints on its surfaces: addresses of a removed polytope and its surfaces can be
+     * reused by the new polytopes.
+     */
+    void AgentNavMeshGenerator::removeCachedFootprints(const std::shared_ptr<Polytope> &expandedPolytope)
+    {
+        std::lock_guard<std::mutex> lock(footprintsCacheMutex);
+
+        footprintsCache.erase(expandedPolytope.get());
+        if(expandedPolytope->isWalkableCandidate())
+        {
+            for(auto &footprintsByPolytope : footprintsCache)
+            {
+                for(const auto &polytopeSurface : expandedPolytope->getSurfaces())
+                {
+                    footprintsByPolytope.second.erase(polytopeSurface.get());
+                }
+            }
+        }
+    }
+
+    void AgentNavMeshGenerator::applyObstaclesOnWalkablePolygon(std::vector<CSGPolygon<float>> &obstaclePolygons, NavPolygonsScratch &scratch) const
+    {
+        std::vector<CSGPolygon<float>> &walkablePolygons = scratch.walkablePolygons;
+        assert(walkablePolygons.size() == 1);
+        scratch.obstaclesInsideWalkablePolygon.clear();
+
+        for(auto &obstaclePolygon : obstaclePolygons)
+        {
+            obstaclePolygon.simplify(polygonMinDotProductThreshold, polygonMergePointsDistanceThreshold);
+            if (obstaclePolygon.getCwPoints().size() > 2)
+            {
+                auto walkablePolygonsCounter = static_cast<int>(walkablePolygons.size());
+                while (walkablePolygonsCounter-- != 0)
+                {
+                    const CSGPolygon<float> &walkablePolygon = walkablePolygons[0];
+
+                    bool obstacleInsideWalkable;
+                    std::vector<CSGPolygon<float>> subtractedPolygons = PolygonsSubtraction<float>::instance()->subtractPolygons(
+                            walkablePolygon, obstaclePolygon, obstacleInsideWalkable);
+
+                    //replace 'walkablePolygon' by 'subtractedPolygons'
+                    walkablePolygons.erase(walkablePolygons.begin());
+                    for (auto &subtractedPolygon : subtractedPolygons)
+                    {
+                        walkablePolygons.emplace_back(std::move(subtractedPolygon));
+                    }
+
+                    if (obstacleInsideWalkable)
+                    {
+                        //slightly reduce the obstacle to prevent it from touching others obstacles or the walkable face (not supported by triangulation)
+                        obstaclePolygon.expand(-OBSTACLE_REDUCE_SIZE);
+                        scratch.obstaclesInsideWalkablePolygon.emplace_back(obstaclePolygon);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<NavPolygon> AgentNavMeshGenerator::createNavigationPolygon(CSGPolygon<float> &walkablePolygon, const std::shared_ptr<PolytopeSurface> &walkableSurface,
+            bool uniqueWalkableSurface, const NavPolygonsScratch &scratch) const
+    {
+        std::string navPolygonName = "<" + walkablePolygon.getName() + ">";
+        std::vector<Point2<float>> walkablePolygonPoints = walkablePolygon.getCwPoints();
+        std::reverse(walkablePolygonPoints.begin(), walkablePolygonPoints.end()); //CW to CCW
+        TriangulationAlgorithm triangulation(std::move(walkablePolygonPoints), walkablePolygon.getName());
+
+        for(const auto &obstacleInsideWalkablePolygon : scratch.obstaclesInsideWalkablePolygon)
+        {
+            if(uniqueWalkableSurface || walkablePolygon.pointInsideOrOnPolygon(obstacleInsideWalkablePolygon.getCwPoints()[0]))
+            { //obstacle fully inside walkable polygon
+                triangulation.addHolePoints(obstacleInsideWalkablePolygon.getCwPoints(), obstacleInsideWalkablePolygon.getName());
+                navPolygonName += " - <" + obstacleInsideWalkablePolygon.getName() + ">";
+            }
+        }
+
+        std::vector<Point3<float>> points = elevateTriangulatedPoints(triangulation, walkableSurface);
+        std::shared_ptr<NavPolygon> navPolygon = std::make_shared<NavPolygon>(navPolygonName, std::move(points), walkableSurface->getNavTopography());
+        navPolygon->addTriangles(triangulation.triangulate(), navPolygon);
+
+        return navPolygon;
+    }
+
+    std::vector<Point3<float>> AgentNavMeshGenerator::elevateTriangulatedPoints(const TriangulationAlgorithm &triangulation, const std::shared_ptr<PolytopeSurface> &walkableSurface) const
+    {
+        std::vector<Point3<float>> elevatedPoints;
+        elevatedPoints.reserve(triangulation.getAllPointsSize());
+
+        for(const auto &walkablePoint : triangulation.getPolygonPoints())
+        {
+            elevatedPoints.push_back(walkableSurface->computeRealPoint(walkablePoint, navMeshAgent));
+        }
+
+        for(std::size_t holeIndex=0; holeIndex<triangulation.getHolesSize(); ++holeIndex)
+        {
+            const std::vector<Point2<float>> &holePoints = triangulation.getHolePoints(holeIndex);
+            for(const auto &holePoint : holePoints)
+            {
+                elevatedPoints.push_back(walkableSurface->computeRealPoint(holePoint, navMeshAgent));
+            }
+        }
+
+        return elevatedPoints;
+    }
+
+    void AgentNavMeshGenerator::deleteNavLinks()
+    {
+        ScopeProfiler scopeProfiler("ai", "delNavLinks");
+
+        for(const auto &navObjectLinksToRefresh : navObjectsLinksToRefresh)
+        {
+            for (const auto &sourceNavPolygon : navObjectLinksToRefresh.first->getNavPolygons())
+            {
+                changedNavPolygonIds.push_back(sourceNavPolygon->getId());
+                for (const auto &targetNavPolygon : navObjectLinksToRefresh.second->getNavPolygons())
+                {
+                    sourceNavPolygon->removeLinksTo(targetNavPolygon);
+                }
+            }
+        }
+
+        for(const auto &partialNavObject : partialNavObjectsToRefresh)
+        { //links of the kept tiles are recreated: they can target the refreshed tiles and the refreshed near objects
+            for(const auto &navPolygon : partialNavObject.first->getNavPolygons())
+            {
+                changedNavPolygonIds.push_back(navPolygon->getId());
+                navPolygon->removeExternalLinks();
+            }
+        }
+    }
+
+    void AgentNavMeshGenerator::createNavLinks()
+    {
+        ScopeProfiler scopeProfiler("ai", "creNavLinks");
+
+        for(const auto &sourceNavObject : navObjectsToRefresh)
+        {
+            createNavLinks(sourceNavObject);
+        }
+        for(const auto &partialNavObject : partialNavObjectsToRefresh)
+        {
+            createNavLinks(partialNavObject.first);
+        }
+
+        for(const auto &navObjectLinksToRefresh : navObjectsLinksToRefresh)
+        {
+            for(const auto &sourceNavPolygon : navObjectLinksToRefresh.first->getNavPolygons())
+            {
+                for (const auto &sourceExternalEdge : sourceNavPolygon->retrieveExternalEdges())
+                {
+                    createNavLinks(sourceExternalEdge, navObjectLinksToRefresh.second);
+                }
+            }
+        }
+    }
+
+    void AgentNavMeshGenerator::createNavLinks(const std::shared_ptr<NavObject> &sourceNavObject) const
+    {
+        for(const auto &sourceNavPolygon : sourceNavObject->getNavPolygons())
+        {
+            for(const auto &sourceExternalEdge : sourceNavPolygon->retrieveExternalEdges())
+            {
+                for(const auto &targetNavObject : sourceNavObject->retrieveNearObjects())
+                {
+                    createNavLinks(sourceExternalEdge, targetNavObject.lock());
+                }
+
+                if(tiledMode)
+                { //stitch the tiles of the walkable surfaces
+                    createNavLinks(sourceExternalEdge, sourceNavObject);
+                }
+            }
+        }
+    }
+
+    void AgentNavMeshGenerator::createNavLinks(const NavPolygonEdge &sourceExternalEdge, const std::shared_ptr<NavObject> &targetNavObject) const
+    {
+        EdgeLinkDetection edgeLinkDetection(navMeshAgent->getJumpDistance());
+        LineSegment3D<float> sourceEdge = sourceExternalEdge.triangle->computeEdge(sourceExternalEdge.edgeIndex);
+        const NavPolygon *sourceNavPolygon = sourceExternalEdge.triangle->getNavPolygon().get();
+
+        for(const auto &targetNavPolygon : targetNavObject->getNavPolygons())
+        {
+            if(targetNavPolygon.get() == sourceNavPolygon)
+            {
+                continue;
+            }
+
+            for(const auto &targetExternalEdge : targetNavPolygon->retrieveExternalEdges())
+            {
+                LineSegment3D<float> targetEdge = targetExternalEdge.triangle->computeEdge(targetExternalEdge.edgeIndex);
+
+                EdgeLinkResult edgeLinkResult = edgeLinkDetection.detectLink(sourceEdge, targetEdge);
+                if(edgeLinkResult.hasEdgesLink())
+                {
+                    auto *navLinkConstraint = new NavLinkConstraint(edgeLinkResult.getLinkStartRange(), edgeLinkResult.getLinkEndRange(), targetExternalEdge.edgeIndex);
+                    if (edgeLinkResult.isJumpLink())
+                    {
+                        sourceExternalEdge.triangle->addJumpLink(sourceExternalEdge.edgeIndex, targetExternalEdge.triangle, navLinkConstraint);
+                    } else
+                    {
+                        sourceExternalEdge.triangle->addJoinPolygonsLink(sourceExternalEdge.edgeIndex, targetExternalEdge.triangle, navLinkConstraint);
+                    }
+                }
+            }
+        }
+    }
+
+    void AgentNavMeshGenerator::updateNavMesh()
+    {
+        allNavPolygons.clear();
+
+        allNavObjects.clear();
+        navigationObjects.getAllNodeObjects(allNavObjects);
+
+        for(const auto &navObject : allNavObjects)
+        {
+            const std::vector<std::shared_ptr<NavPolygon>> &navPolygons = navObject->getNavPolygons();
+            allNavPolygons.insert(allNavPolygons.end(), navPolygons.begin(), navPolygons.end());
+        }
+
+        if(isNavMeshUnchanged())
+        { //keep the current version: readers don't have to refresh their data
+            return;
+        }
+
+        //new version sharing the unchanged polygons with the current version
+        auto newNavMesh = std::make_shared<NavMesh>(*navMesh);
+        newNavMesh->copyAllPolygons(allNavPolygons, changedNavPolygonIds);
+
+        std::lock_guard<std::mutex> lock(navMeshMutex);
+        navMesh = std::move(newNavMesh);
+    }
+
+    bool AgentNavMeshGenerator::isNavMeshUnchanged() const
+    {
+        if(!changedNavPolygonIds.empty() || allNavPolygons.size() != navMesh->getPolygons().size())
+        {
+            return false;
+        }
+
+        for(std::size_t i=0; i<allNavPolygons.size(); ++i)
+        {
+            if(allNavPolygons[i]->getId() != navMesh->getPolygons()[i]->getId())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,137 @@
+#ifndef URCHINENGINE_AGENTNAVMESHGENERATOR_H
+#define URCHINENGINE_AGENTNAVMESHGENERATOR_H
+
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <set>
+#include <map>
+#include "UrchinCommon.h"
+
+#include "input/AIWorld.h"
+#include "path/navmesh/model/NavObject.h"
+#include "path/navmesh/model/output/NavMeshAgent.h"
+#include "path/navmesh/model/output/NavMesh.h"
+#include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/polytope/Polytope.h"
+#include "path/navmesh/polytope/PolytopeSurface.h"
+#include "path/navmesh/polytope/EntityGeometry.h"
+#include "path/navmesh/csg/CSGPolygon.h"
+#include "path/navmesh/triangulation/TriangulationAlgorithm.h"
+#include "path/navmesh/bake/BakedNavMesh.h"
+
+namespace urchin
+{
+
+    /**
+     * Changes of the AI world since the previous generation of an agent navigation mesh
+     */
+    struct AIWorldChanges
+    {
+        std::vector<std::shared_ptr<AIEntity>> entitiesToRemove; //removed entities and entities to rebuild
+        std::vector<std::pair<std::shared_ptr<AIEntity>, std::shared_ptr<const EntityGeometry>>> entitiesToBuild; //new entities and entities to rebuild
+    };
+
+    /**
+     * Generator of the navigation mesh of one agent. The agent independent geometry of the entities is provided by the NavMeshGenerator.
+     */
+    class AgentNavMeshGenerator
+    {
+        public:
+            AgentNavMeshGenerator(std::shared_ptr<NavMeshAgent>, bool);
+
+            const std::shared_ptr<NavMeshAgent> &getNavMeshAgent() const;
+            void setThreadPool(ThreadPool *);
+
+            bool isGenerated() const;
+            std::shared_ptr<const NavMesh> generate(const AIWorld &, const AIWorldChanges &);
+            std::shared_ptr<const NavMesh> getLastGeneratedNavMesh() const;
+
+            void setBakedNavMesh(std::shared_ptr<const BakedNavMesh>);
+
+        private:
+            struct WalkableSurfaceTask
+            {
+                std::shared_ptr<NavObject> navObject;
+                std::size_t walkableSurfaceIndex;
+                std::shared_ptr<PolytopeSurface> walkableSurface;
+                std::vector<std::shared_ptr<NavObject>> nearObjects;
+                std::vector<std::shared_ptr<NavPolygon>> navPolygons; //result of the task
+            };
+
+            struct NavPolygonsScratch //buffers of a thread creating navigation polygons
+            {
+                std::vector<CSGPolygon<float>> walkablePolygons;
+                std::vector<CSGPolygon<float>> obstaclesInsideWalkablePolygon;
+                std::vector<CSGPolygon<float>> holePolygons;
+                std::vector<Point2<float>> footprintPoints;
+                ClipperLib::Paths unionPaths;
+            };
+
+            void updateExpandedPolytopes(const AIWorldChanges &);
+            std::vector<std::unique_ptr<Polytope>> buildExpandedPolytopes(const std::shared_ptr<AIEntity> &, const EntityGeometry &) const;
+            void addNavObject(const std::shared_ptr<AIEntity> &, const std::shared_ptr<Polytope> &);
+            void removeNavObject(const std::shared_ptr<AIEntity> &);
+
+            void prepareNavObjectsToUpdate();
+            std::vector<std::size_t> findTouchedWalkableSurfaces(const std::shared_ptr<NavObject> &) const;
+            void addNavObjectsLinksToRefresh(const std::shared_ptr<NavObject> &);
+            void updateNearObjects(const std::shared_ptr<NavObject> &);
+
+            bool restoreBakedNavMesh(const AIWorld &);
+            static std::string computeWalkableSurfaceName(const std::shared_ptr<PolytopeSurface> &);
+
+            void updateNavPolygons();
+            void addWalkableSurfaceTask(const std::shared_ptr<NavObject> &, std::size_t);
+            std::vector<std::shared_ptr<NavPolygon>> createNavigationPolygons(const std::vector<std::shared_ptr<NavObject>> &, const std::shared_ptr<PolytopeSurface> &,
+                    NavPolygonsScratch &) const;
+            std::vector<CSGPolygon<float>> determineObstacles(const std::vector<std::shared_ptr<NavObject>> &, const std::shared_ptr<PolytopeSurface> &,
+                    NavPolygonsScratch &) const;
+            CSGPolygon<float> retrievePolytopeFootprint(const std::shared_ptr<Polytope> &, const std::shared_ptr<PolytopeSurface> &, std::vector<Point2<float>> &) const;
+            CSGPolygon<float> computePolytopeFootprint(const std::shared_ptr<Polytope> &, const std::shared_ptr<PolytopeSurface> &, std::vector<Point2<float>> &) const;
+            void removeCachedFootprints(const std::shared_ptr<Polytope> &);
+            void applyObstaclesOnWalkablePolygon(std::vector<CSGPolygon<float>> &, NavPolygonsScratch &) const;
+            std::shared_ptr<NavPolygon> createNavigationPolygon(CSGPolygon<float> &, const std::shared_ptr<PolytopeSurface> &, bool, const NavPolygonsScratch &) const;
+            std::vector<Point3<float>> elevateTriangulatedPoints(const TriangulationAlgorithm &, const std::shared_ptr<PolytopeSurface> &) const;
+
+            void deleteNavLinks();
+            void createNavLinks();
+            void createNavLinks(const std::shared_ptr<NavObject> &) const;
+            void createNavLinks(const NavPolygonEdge &, const std::shared_ptr<NavObject> &) const;
+
+            void updateNavMesh();
+            bool isNavMeshUnchanged() const;
+
+            const float polygonMinDotProductThreshold;
+            const float polygonMergePointsDistanceThreshold;
+            const bool tiledMode;
+
+            mutable std::mutex navMeshMutex;
+            const std::shared_ptr<NavMeshAgent> navMeshAgent;
+            std::shared_ptr<const NavMesh> navMesh;
+            std::shared_ptr<const BakedNavMesh> bakedNavMesh;
+            ThreadPool *threadPool;
+            bool generated;
+
+            AABBTree<std::shared_ptr<NavObject>> navigationObjects;
+            std::set<std::shared_ptr<NavObject>> newOrMovingNavObjectsToRefresh, affectedNavObjectsToRefresh;
+            std::set<std::shared_ptr<NavObject>> navObjectsToRefresh;
+            std::map<std::shared_ptr<NavObject>, std::vector<std::size_t>> partialNavObjectsToRefresh; //walkable surfaces to refresh by NavObject
+            std::vector<AABBox<float>> changedObstacleBoxes;
+            std::set<std::pair<std::shared_ptr<NavObject>, std::shared_ptr<NavObject>>> navObjectsLinksToRefresh;
+            std::vector<std::shared_ptr<NavObject>> nearObjects;
+            std::map<std::shared_ptr<AIEntity>, std::vector<std::shared_ptr<NavObject>>> entitiesNavObjects;
+            std::vector<std::vector<std::unique_ptr<Polytope>>> entitiesExpandedPolytopes;
+            std::vector<WalkableSurfaceTask> walkableSurfaceTasks;
+
+            mutable std::mutex footprintsCacheMutex;
+            mutable std::map<const Polytope *, std::map<const PolytopeSurface *, CSGPolygon<float>>> footprintsCache; //footprint by obstacle polytope and walkable surface
+
+            std::vector<std::shared_ptr<NavObject>> allNavObjects;
+            std::vector<std::shared_ptr<NavPolygon>> allNavPolygons;
+            std::vector<unsigned int> changedNavPolygonIds;
+    };
+
+}
+
+#endif
@@ -1,508 +1,283 @@
-#include <cmath>
 #include <algorithm>
-#include <string>
-#include <numeric>
+#include <stdexcept>
 
 #include "NavMeshGenerator.h"
 #include "input/AIObject.h"
 #include "input/AITerrain.h"
-#include "path/navmesh/polytope/PolytopePlaneSurface.h"
 #include "path/navmesh/polytope/PolytopeBuilder.h"
-#include "path/navmesh/polytope/aabbtree/NavObjectAABBNodeData.h"
-#include "path/navmesh/csg/PolygonsUnion.h"
-#include "path/navmesh/csg/PolygonsSubtraction.h"
-#include "path/navmesh/link/EdgeLinkDetection.h"
-
-#define OBSTACLE_REDUCE_SIZE 0.0002f
+#include "path/navmesh/bake/NavMeshBakeService.h"
 
 namespace urchin
 {
 
-    //Debug parameters
-    bool DEBUG_EXPORT_NAV_MESH = false;
-
     NavMeshGenerator::NavMeshGenerator() :
-            polygonMinDotProductThreshold(std::cos(AngleConverter<float>::toRadian(ConfigService::instance()->getFloatValue("navMesh.polygonRemoveAngleThresholdInDegree")))),
-            polygonMergePointsDistanceThreshold(ConfigService::instance()->getFloatValue("navMesh.polygonMergePointsDistanceThreshold")),
-            navMeshAgent(std::make_shared<NavMeshAgent>()),
-            navMesh(std::make_shared<NavMesh>()),
-            needFullRefresh(false),
-            navigationObjects(AABBTree<std::shared_ptr<NavObject>>(ConfigService::instance()->getFloatValue("navMesh.polytopeAabbTreeFatMargin")))
+            threadPool(nullptr),
+            tiledMode(ConfigService::instance()->getBoolValue("navMesh.tiledMode")),
+            rebuildAllEntities(false)
     {
-
+        agentGenerators.push_back(createAgentGenerator(std::make_shared<NavMeshAgent>()));
     }
 
+    /**
+     * Replace all the agents by the provided agent. The navigation mesh of the agent is fully generated by the next generation.
+     */
     void NavMeshGenerator::setNavMeshAgent(std::shared_ptr<NavMeshAgent> navMeshAgent)
     {
-        std::lock_guard<std::mutex> lock(navMeshMutex);
-
-        this->navMeshAgent = std::move(navMeshAgent);
-        this->needFullRefresh.store(true, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        float navigationObjectsJumpMargin = this->navMeshAgent->getJumpDistance() / 2.0f;
-        float navigationObjectsMargin = std::max(navigationObjectsJumpMargin, ConfigService::instance()->getFloatValue("navMesh.polytopeAabbTreeFatMargin"));
-        this->navigationObjects.updateFatMargin(navigationObjectsMargin);
+        agentGenerators.clear();
+        agentGenerators.push_back(createAgentGenerator(std::move(navMeshAgent)));
     }
 
-    const std::shared_ptr<NavMeshAgent> &NavMeshGenerator::getNavMeshAgent() const
-    {
-        return navMeshAgent;
-    }
-
-    NavMesh NavMeshGenerator::copyLastGeneratedNavMesh() const
+    /**
+     * Add an agent for which a navigation mesh is generated. The navigation mesh of the agent is fully generated by the next generation.
+     */
+    void NavMeshGenerator::addNavMeshAgent(std::shared_ptr<NavMeshAgent> navMeshAgent)
     {
-        std::lock_guard<std::mutex> lock(navMeshMutex);
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        return NavMesh(*navMesh);
+        agentGenerators.push_back(createAgentGenerator(std::move(navMeshAgent)));
     }
 
     /**
-     * See '_doc' for an algorithm overview
+     * @return Primary agent
      */
-    std::shared_ptr<NavMesh> NavMeshGenerator::generate(AIWorld &aiWorld)
+    std::shared_ptr<NavMeshAgent> NavMeshGenerator::getNavMeshAgent() const
     {
-        ScopeProfiler scopeProfiler("ai", "navMeshGenerate");
-
-        updateExpandedPolytopes(aiWorld);
-        prepareNavObjectsToUpdate();
-        deleteNavLinks();
-        updateNavPolygons();
-        createNavLinks();
-        updateNavMesh();
-
-        if(DEBUG_EXPORT_NAV_MESH)
-        {
-            navMesh->svgMeshExport(std::string(std::getenv("HOME")) + "/navMesh/navMesh" + std::to_string(navMesh->getUpdateId()) + ".html");
-        }
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        return navMesh;
+        return agentGenerators[0]->getNavMeshAgent();
     }
 
-    void NavMeshGenerator::updateExpandedPolytopes(AIWorld &aiWorld)
+    std::vector<std::shared_ptr<NavMeshAgent>> NavMeshGenerator::getNavMeshAgents() const
     {
-        ScopeProfiler scopeProfiler("ai", "upExpandPoly");
-
-        newOrMovingNavObjectsToRefresh.clear();
-        affectedNavObjectsToRefresh.clear();
-
-        for(auto &aiObjectToRemove : aiWorld.getEntitiesToRemoveAndReset())
-        {
-            removeNavObject(aiObjectToRemove);
-        }
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        bool refreshAllEntities = needFullRefresh.exchange(false, std::memory_order_relaxed);
-        for(auto &aiEntity : aiWorld.getEntities())
+        std::vector<std::shared_ptr<NavMeshAgent>> navMeshAgents;
+        navMeshAgents.reserve(agentGenerators.size());
+        for(const auto &agentGenerator : agentGenerators)
         {
-            if(aiEntity->isToRebuild() || refreshAllEntities)
-            {
-                removeNavObject(aiEntity);
-                aiEntity->removeAllNavObjects();
-
-                if(aiEntity->getType()==AIEntity::OBJECT)
-                {
-                    auto aiObject = std::dynamic_pointer_cast<AIObject>(aiEntity);
-                    std::vector<std::unique_ptr<Polytope>> objectExpandedPolytopes = PolytopeBuilder::instance()->buildExpandedPolytopes(aiObject, navMeshAgent);
-                    for (auto &objectExpandedPolytope : objectExpandedPolytopes)
-                    {
-                        addNavObject(aiObject, std::move(objectExpandedPolytope));
-                    }
-                }else if(aiEntity->getType()==AIEntity::TERRAIN)
-                {
-                    auto aiTerrain = std::dynamic_pointer_cast<AITerrain>(aiEntity);
-                    std::vector<std::unique_ptr<Polytope>> terrainExpandedPolytopes = PolytopeBuilder::instance()->buildExpandedPolytope(aiTerrain, navMeshAgent);
-                    for (auto &terrainExpandedPolytope : terrainExpandedPolytopes)
-                    {
-                        addNavObject(aiTerrain, std::move(terrainExpandedPolytope));
-                    }
-                }
-
-                aiEntity->markRebuilt();
-            }
+            navMeshAgents.push_back(agentGenerator->getNavMeshAgent());
         }
+        return navMeshAgents;
     }
 
-    void NavMeshGenerator::addNavObject(const std::shared_ptr<AIEntity> &aiEntity, const std::shared_ptr<Polytope>& expandedPolytope)
+    /**
+     * @param threadPool Thread pool used to build the geometry of the entities, the expanded polytopes and the navigation polygons in parallel.
+     * Null to generate the navigation meshes on the calling thread only.
+     */
+    void NavMeshGenerator::setThreadPool(ThreadPool *threadPool)
     {
-        auto navObject = std::make_shared<NavObject>(expandedPolytope);
-        newOrMovingNavObjectsToRefresh.insert(navObject);
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        if(expandedPolytope->isWalkableCandidate())
+        this->threadPool = threadPool;
+        for(const auto &agentGenerator : agentGenerators)
         {
-            for(std::size_t surfaceIndex=0; surfaceIndex<expandedPolytope->getSurfaces().size(); ++surfaceIndex)
-            {
-                const std::shared_ptr<PolytopeSurface> &polytopeSurface = expandedPolytope->getSurface(surfaceIndex);
-                if(polytopeSurface->isWalkable())
-                {
-                    navObject->addWalkableSurface(polytopeSurface);
-                }
-            }
+            agentGenerator->setThreadPool(threadPool);
         }
-
-        navigationObjects.addObject(new NavObjectAABBNodeData(navObject));
-        aiEntity->addNavObject(navObject);
     }
 
-    void NavMeshGenerator::removeNavObject(const std::shared_ptr<AIEntity> &aiEntity)
+    /**
+     * Define if the walkable surfaces are split into tiles. In tiled mode, a changed obstacle only regenerates the tiles that it touches.
+     * The navigation meshes are fully generated by the next generation. This method must not be executed in parallel of generate().
+     * @param tiledMode Tiled mode. Default value is defined by the property 'navMesh.tiledMode'.
+     */
+    void NavMeshGenerator::setTiledMode(bool tiledMode)
     {
-        for(const auto &navObject : aiEntity->getNavObjects())
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
+
+        if(this->tiledMode != tiledMode)
         {
-            const std::vector<std::weak_ptr<NavObject>> &nearObjects = navObject->retrieveNearObjects();
-            for(const auto &nearObject : nearObjects)
+            this->tiledMode = tiledMode;
+            this->rebuildAllEntities = true;
+            for(auto &agentGenerator : agentGenerators)
             {
-                #ifndef NDEBUG
-                    assert(!nearObject.expired());
-                #endif
-                affectedNavObjectsToRefresh.insert(nearObject.lock());
+                agentGenerator = createAgentGenerator(agentGenerator->getNavMeshAgent());
             }
-
-            navigationObjects.removeObject(navObject);
         }
     }
 
-    void NavMeshGenerator::prepareNavObjectsToUpdate()
+    bool NavMeshGenerator::isTiledMode() const
     {
-        ScopeProfiler scopeProfiler("ai", "prepNavObjects");
-
-        navObjectsToRefresh.clear();
-        navObjectsLinksToRefresh.clear();
-
-        for(const auto &navObject : newOrMovingNavObjectsToRefresh)
-        {
-            updateNearObjects(navObject);
-
-            for(const auto &nearObject : navObject->retrieveNearObjects())
-            {
-                std::shared_ptr<NavObject> sharedPtrNearObject = nearObject.lock();
-                if(newOrMovingNavObjectsToRefresh.count(sharedPtrNearObject) == 0)
-                {
-                    affectedNavObjectsToRefresh.insert(sharedPtrNearObject);
-                }
-            }
-        }
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        for(const auto &navObject : affectedNavObjectsToRefresh)
-        {
-            updateNearObjects(navObject);
-
-            //when an affected NavObject is refreshed (deleted & created): we recreate existing links toward this NavObject:
-            for(const auto &relinkNavObject : navObject->retrieveNearObjects())
-            {
-                std::shared_ptr<NavObject> sharedPtrRelinkNavObject = relinkNavObject.lock();
-                if(affectedNavObjectsToRefresh.count(sharedPtrRelinkNavObject) == 0 && newOrMovingNavObjectsToRefresh.count(sharedPtrRelinkNavObject) == 0)
-                {
-                    navObjectsLinksToRefresh.insert(std::make_pair(sharedPtrRelinkNavObject, navObject));
-                }
-            }
-        }
-
-        navObjectsToRefresh.merge(newOrMovingNavObjectsToRefresh);
-        navObjectsToRefresh.merge(affectedNavObjectsToRefresh);
+        return tiledMode;
     }
 
-    void NavMeshGenerator::updateNearObjects(const std::shared_ptr<NavObject> &navObject)
+    /**
+     * @return Last generated navigation mesh of the primary agent
+     */
+    std::shared_ptr<const NavMesh> NavMeshGenerator::getLastGeneratedNavMesh() const
     {
-        nearObjects.clear();
-        navigationObjects.aabboxQuery(navObject->getExpandedPolytope()->getAABBox(), nearObjects);
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        navObject->removeAllNearObjects();
-        for (const auto &nearObject : nearObjects)
-        {
-            if (nearObject->getExpandedPolytope()->getName() != navObject->getExpandedPolytope()->getName())
-            {
-                navObject->addNearObject(nearObject);
-            }
-        }
+        return agentGenerators[0]->getLastGeneratedNavMesh();
     }
 
-    void NavMeshGenerator::updateNavPolygons()
+    /**
+     * @return Last generated navigation mesh of the agent. The navigation mesh is an immutable snapshot: it can be read while a new version
+     * is generated.
+     */
+    std::shared_ptr<const NavMesh> NavMeshGenerator::getLastGeneratedNavMesh(const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
     {
-        ScopeProfiler scopeProfiler("ai", "upNavPolygons");
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        for(const auto &navObject : navObjectsToRefresh)
+        for(const auto &agentGenerator : agentGenerators)
         {
-            navObject->removeAllNavPolygons();
-            for(const auto &walkableSurface : navObject->getWalkableSurfaces())
+            if(agentGenerator->getNavMeshAgent() == navMeshAgent)
             {
-                std::vector<std::shared_ptr<NavPolygon>> navPolygons = createNavigationPolygons(navObject, walkableSurface);
-                navObject->addNavPolygons(navPolygons);
+                return agentGenerator->getLastGeneratedNavMesh();
             }
         }
+        throw std::invalid_argument("Navigation mesh agent not defined in the navigation mesh generator");
     }
 
-    std::vector<std::shared_ptr<NavPolygon>> NavMeshGenerator::createNavigationPolygons(const std::shared_ptr<NavObject> &navObject,
-            const std::shared_ptr<PolytopeSurface> &walkableSurface)
+    /**
+     * @param bakedNavMesh Baked navigation mesh of the primary agent restored by the next generation when it has been baked from the same
+     * AI world and agent. The generation continues incrementally from the restored navigation mesh.
+     */
+    void NavMeshGenerator::setBakedNavMesh(std::shared_ptr<const BakedNavMesh> bakedNavMesh)
     {
-        ScopeProfiler scopeProfiler("ai", "createNavPolys");
-
-        std::string walkableName = walkableSurface->getPolytope()->getName() + "[" + std::to_string(walkableSurface->getSurfacePosition()) + "]";
-        walkablePolygons.clear();
-        walkablePolygons.emplace_back(CSGPolygon<float>(walkableName, walkableSurface->getOutlineCwPoints()));
-        std::vector<CSGPolygon<float>> &obstaclePolygons = determineObstacles(navObject, walkableSurface);
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        applyObstaclesOnWalkablePolygon(obstaclePolygons);
-
-        bool uniqueWalkableSurface = walkablePolygons.size() == 1;
-        std::vector<std::shared_ptr<NavPolygon>> navPolygons;
-        navPolygons.reserve(walkablePolygons.size());
-        for(auto &walkablePolygon : walkablePolygons)
-        {
-            //simplify polygon to improve performance and avoid degenerated walkable face
-            walkablePolygon.simplify(polygonMinDotProductThreshold, polygonMergePointsDistanceThreshold);
-            if(walkablePolygon.getCwPoints().size() > 2)
-            {
-                std::shared_ptr<NavPolygon> navPolygon = createNavigationPolygon(walkablePolygon, walkableSurface, uniqueWalkableSurface);
-                navPolygons.push_back(navPolygon);
-            }
-        }
-
-        return navPolygons;
+        this->bakedNavMesh = std::move(bakedNavMesh);
     }
 
-    std::vector<CSGPolygon<float>> &NavMeshGenerator::determineObstacles(const std::shared_ptr<NavObject> &navObject,
-            const std::shared_ptr<PolytopeSurface> &walkableSurface) const
+    /**
+     * Generate the navigation meshes and save the navigation mesh of the primary agent in a baked file (see BakedNavMesh). This method
+     * must not be executed in parallel of generate().
+     * @param filename Absolute path of the baked navigation mesh file
+     */
+    void NavMeshGenerator::bake(AIWorld &aiWorld, const std::string &filename)
     {
-        ScopeProfiler scopeProfiler("ai", "getObstacles");
-
-        const std::vector<CSGPolygon<float>> &selfObstaclePolygons = walkableSurface->getSelfObstacles();
+        std::shared_ptr<const NavMesh> generatedNavMesh = generate(aiWorld);
 
-        holePolygons.clear();
-        for(const auto &selfObstaclePolygon : selfObstaclePolygons)
-        {
-            holePolygons.emplace_back(selfObstaclePolygon);
-        }
-
-        for (const auto &nearObject : navObject->retrieveNearObjects())
-        {
-            const std::shared_ptr<Polytope> &nearExpandedPolytope = nearObject.lock()->getExpandedPolytope();
-
-            if (nearExpandedPolytope->isObstacleCandidate() && nearExpandedPolytope->getAABBox().collideWithAABBox(walkableSurface->getAABBox()))
-            {
-                CSGPolygon<float> footprintPolygon = computePolytopeFootprint(nearExpandedPolytope, walkableSurface);
-                if (footprintPolygon.getCwPoints().size() >= 3)
-                {
-                    footprintPolygon.simplify(polygonMinDotProductThreshold, polygonMergePointsDistanceThreshold);
-                    holePolygons.push_back(std::move(footprintPolygon));
-                }
-            }
-        }
-
-        return PolygonsUnion<float>::instance()->unionPolygons(holePolygons);
+        NavMeshBakeService navMeshBakeService;
+        navMeshBakeService.writeBakedNavMesh(filename, navMeshBakeService.computeWorldKey(aiWorld.getEntities(), *getNavMeshAgent(), isTiledMode()),
+                *generatedNavMesh);
     }
 
-    CSGPolygon<float> NavMeshGenerator::computePolytopeFootprint(const std::shared_ptr<Polytope> &polytopeObstacle, const std::shared_ptr<PolytopeSurface> &walkableSurface) const
+    /**
+     * See '_doc' for an algorithm overview
+     * @return Navigation mesh of the primary agent
+     */
+    std::shared_ptr<const NavMesh> NavMeshGenerator::generate(AIWorld &aiWorld)
     {
-        footprintPoints.clear();
-        Plane<float> walkablePlane = walkableSurface->getPlane(polytopeObstacle->getXZRectangle());
+        updateEntitiesGeometry(aiWorld);
 
-        for(const auto &polytopeSurface : polytopeObstacle->getSurfaces())
+        std::vector<std::shared_ptr<AgentNavMeshGenerator>> agentGeneratorsToUpdate = retrieveAgentGeneratorsToUpdate();
+        for(const auto &agentGenerator : agentGeneratorsToUpdate)
         {
-            if(auto *polytopePlaneSurface = dynamic_cast<PolytopePlaneSurface *>(polytopeSurface.get()))
+            if(agentGenerator->isGenerated())
             {
-                for (std::size_t i = 0, previousI = polytopePlaneSurface->getCcwPoints().size() - 1; i < polytopePlaneSurface->getCcwPoints().size(); previousI = i++)
-                {
-                    float distance1 = walkablePlane.distance(polytopePlaneSurface->getCcwPoints()[previousI]);
-                    float distance2 = walkablePlane.distance(polytopePlaneSurface->getCcwPoints()[i]);
-                    if (std::signbit(distance1) != std::signbit(distance2))
-                    {
-                        Line3D<float> polytopeEdgeLine(polytopePlaneSurface->getCcwPoints()[previousI], polytopePlaneSurface->getCcwPoints()[i]);
-                        Point3<float> intersectionPoint = walkablePlane.intersectPoint(polytopeEdgeLine);
-                        footprintPoints.emplace_back(Point2<float>(intersectionPoint.X, -intersectionPoint.Z));
-                    }
-                }
+                agentGenerator->generate(aiWorld, aiWorldChanges);
             }else
-            {
-                throw std::runtime_error("Unsupported type of surface as obstacle: " + std::string(typeid(polytopeSurface.get()).name()));
+            { //new agent: all the entities are built from their shared geometry
+                agentGenerator->generate(aiWorld, computeAllEntitiesChanges());
             }
         }
+        aiWorldChanges.entitiesToRemove.clear();
+        aiWorldChanges.entitiesToBuild.clear();
 
-        if(footprintPoints.size() < 3)
-        { //no footprint: return empty polygon
-            return CSGPolygon<float>("", {});
-        }
-
-        ConvexHull2D<float> footprintConvexHull(footprintPoints);
-        std::vector<Point2<float>> cwPoints(footprintConvexHull.getPoints());
-        std::reverse(cwPoints.begin(), cwPoints.end());
-        return CSGPolygon<float>(polytopeObstacle->getName(), std::move(cwPoints));
+        return agentGeneratorsToUpdate[0]->getLastGeneratedNavMesh();
     }
 
-    void NavMeshGenerator::applyObstaclesOnWalkablePolygon(std::vector<CSGPolygon<float>> &obstaclePolygons)
+    /**
+     * @return Copy of the agent generators. The baked navigation mesh is handed to the primary agent generator.
+     */
+    std::vector<std::shared_ptr<AgentNavMeshGenerator>> NavMeshGenerator::retrieveAgentGeneratorsToUpdate()
     {
-        ScopeProfiler scopeProfiler("ai", "subObstacles");
+        std::lock_guard<std::mutex> lock(agentGeneratorsMutex);
 
-        assert(walkablePolygons.size() == 1);
-        obstaclesInsideWalkablePolygon.clear();
-
-        for(auto &obstaclePolygon : obstaclePolygons)
+        if(bakedNavMesh)
         {
-            obstaclePolygon.simplify(polygonMinDotProductThreshold, polygonMergePointsDistanceThreshold);
-            if (obstaclePolygon.getCwPoints().size() > 2)
-            {
-                auto walkablePolygonsCounter = static_cast<int>(walkablePolygons.size());
-                while (walkablePolygonsCounter-- != 0)
-                {
-                    const CSGPolygon<float> &walkablePolygon = walkablePolygons[0];
-
-                    bool obstacleInsideWalkable;
-                    const std::vector<CSGPolygon<float>> &subtractedPolygons = PolygonsSubtraction<float>::instance()->subtractPolygons(
-                            walkablePolygon, obstaclePolygon, obstacleInsideWalkable);
-
-                    //replace 'walkablePolygon' by 'subtractedPolygons'
-                    walkablePolygons.erase(walkablePolygons.begin());
-                    for (auto &subtractedPolygon : subtractedPolygons)
-                    {
-                        walkablePolygons.emplace_back(subtractedPolygon);
-                    }
-
-                    if (obstacleInsideWalkable)
-                    {
-                        //slightly reduce the obstacle to prevent it from touching others obstacles or the walkable face (not supported by triangulation)
-                        obstaclePolygon.expand(-OBSTACLE_REDUCE_SIZE);
-                        obstaclesInsideWalkablePolygon.emplace_back(obstaclePolygon);
-                        break;
-                    }
-                }
-            }
+            agentGenerators[0]->setBakedNavMesh(std::move(bakedNavMesh));
+            bakedNavMesh.reset();
         }
+        return agentGenerators;
     }
 
-    std::shared_ptr<NavPolygon> NavMeshGenerator::createNavigationPolygon(CSGPolygon<float> &walkablePolygon, const std::shared_ptr<PolytopeSurface> &walkableSurface, bool uniqueWalkableSurface) const
+    std::shared_ptr<AgentNavMeshGenerator> NavMeshGenerator::createAgentGenerator(std::shared_ptr<NavMeshAgent> navMeshAgent) const
     {
-        ScopeProfiler scopeProfiler("ai", "createNavPoly");
-
-        navPolygonName = "<" + walkablePolygon.getName() + ">";
-        std::vector<Point2<float>> walkablePolygonPoints = walkablePolygon.getCwPoints();
-        std::reverse(walkablePolygonPoints.begin(), walkablePolygonPoints.end()); //CW to CCW
-        TriangulationAlgorithm triangulation(std::move(walkablePolygonPoints), walkablePolygon.getName());
-
-        for(const auto &obstacleInsideWalkablePolygon : obstaclesInsideWalkablePolygon)
-        {
-            if(uniqueWalkableSurface || walkablePolygon.pointInsideOrOnPolygon(obstacleInsideWalkablePolygon.getCwPoints()[0]))
-            { //obstacle fully inside walkable polygon
-                triangulation.addHolePoints(obstacleInsideWalkablePolygon.getCwPoints(), obstacleInsideWalkablePolygon.getName());
-                navPolygonName += " - <" + obstacleInsideWalkablePolygon.getName() + ">";
-            }
-        }
-
-        std::vector<Point3<float>> points = elevateTriangulatedPoints(triangulation, walkableSurface);
-        std::shared_ptr<NavPolygon> navPolygon = std::make_shared<NavPolygon>(navPolygonName, std::move(points), walkableSurface->getNavTopography());
-        navPolygon->addTriangles(triangulation.triangulate(), navPolygon);
-
-        return navPolygon;
+        auto agentGenerator = std::make_shared<AgentNavMeshGenerator>(std::move(navMeshAgent), tiledMode);
+        agentGenerator->setThreadPool(threadPool);
+        return agentGenerator;
     }
 
-    std::vector<Point3<float>> NavMeshGenerator::elevateTriangulatedPoints(const TriangulationAlgorithm &triangulation, const std::shared_ptr<PolytopeSurface> &walkableSurface) const
+    /**
+     * Build the agent independent geometry of the new and moved entities. The changes are stored for the agent generators.
+     */
+    void NavMeshGenerator::updateEntitiesGeometry(AIWorld &aiWorld)
     {
-        ScopeProfiler scopeProfiler("ai", "elevateTriPoint");
-
-        std::vector<Point3<float>> elevatedPoints;
-        elevatedPoints.reserve(triangulation.getAllPointsSize());
+        ScopeProfiler scopeProfiler("ai", "upGeometry");
 
-        for(const auto &walkablePoint : triangulation.getPolygonPoints())
+        for(auto &aiEntityToRemove : aiWorld.getEntitiesToRemoveAndReset())
         {
-            elevatedPoints.push_back(walkableSurface->computeRealPoint(walkablePoint, navMeshAgent));
+            entitiesGeometry.erase(aiEntityToRemove);
+            aiWorldChanges.entitiesToRemove.push_back(aiEntityToRemove);
         }
 
-        for(std::size_t holeIndex=0; holeIndex<triangulation.getHolesSize(); ++holeIndex)
+        aiEntities = aiWorld.getEntities();
+        entitiesToRebuild.clear();
+        for(const auto &aiEntity : aiEntities)
         {
-            const std::vector<Point2<float>> &holePoints = triangulation.getHolePoints(holeIndex);
-            for(const auto &holePoint : holePoints)
+            if(aiEntity->isToRebuild() || rebuildAllEntities)
             {
-                elevatedPoints.push_back(walkableSurface->computeRealPoint(holePoint, navMeshAgent));
+                entitiesToRebuild.push_back(aiEntity);
             }
         }
 
-        return elevatedPoints;
-    }
-
-    void NavMeshGenerator::deleteNavLinks()
-    {
-        ScopeProfiler scopeProfiler("ai", "delNavLinks");
-
-        for(const auto &navObjectLinksToRefresh : navObjectsLinksToRefresh)
-        {
-            for (const auto &sourceNavPolygon : navObjectLinksToRefresh.first->getNavPolygons())
+        //geometries of the entities are independent: they are built in parallel
+        entitiesRebuiltGeometry.resize(entitiesToRebuild.size());
+        parallelFor(threadPool, entitiesToRebuild.size(), 1, [this](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
             {
-                for (const auto &targetNavPolygon : navObjectLinksToRefresh.second->getNavPolygons())
-                {
-                    sourceNavPolygon->removeLinksTo(targetNavPolygon);
-                }
+                entitiesRebuiltGeometry[i] = buildGeometry(entitiesToRebuild[i], tiledMode);
             }
+        });
+
+        for(std::size_t i=0; i<entitiesToRebuild.size(); ++i)
+        {
+            std::shared_ptr<const EntityGeometry> entityGeometry = std::move(entitiesRebuiltGeometry[i]);
+            entitiesGeometry[entitiesToRebuild[i]] = entityGeometry;
+            aiWorldChanges.entitiesToRemove.push_back(entitiesToRebuild[i]);
+            aiWorldChanges.entitiesToBuild.emplace_back(entitiesToRebuild[i], std::move(entityGeometry));
+            entitiesToRebuild[i]->markRebuilt();
         }
+        entitiesRebuiltGeometry.clear();
+        rebuildAllEntities = false;
     }
 
-    void NavMeshGenerator::createNavLinks()
+    std::unique_ptr<EntityGeometry> NavMeshGenerator::buildGeometry(const std::shared_ptr<AIEntity> &aiEntity, bool tiledMode)
     {
-        ScopeProfiler scopeProfiler("ai", "creNavLinks");
-
-        for(const auto &sourceNavObject : navObjectsToRefresh)
+        if(aiEntity->getType()==AIEntity::OBJECT)
         {
-            for(const auto &sourceNavPolygon : sourceNavObject->getNavPolygons())
-            {
-                for(const auto &sourceExternalEdge : sourceNavPolygon->retrieveExternalEdges())
-                {
-                    for(const auto &targetNavObject : sourceNavObject->retrieveNearObjects())
-                    {
-                        createNavLinks(sourceExternalEdge, targetNavObject.lock());
-                    }
-                }
-            }
-        }
-
-        for(const auto &navObjectLinksToRefresh : navObjectsLinksToRefresh)
+            auto aiObject = std::dynamic_pointer_cast<AIObject>(aiEntity);
+            return PolytopeBuilder::instance()->buildGeometry(aiObject, tiledMode);
+        }else if(aiEntity->getType()==AIEntity::TERRAIN)
         {
-            for(const auto &sourceNavPolygon : navObjectLinksToRefresh.first->getNavPolygons())
-            {
-                for (const auto &sourceExternalEdge : sourceNavPolygon->retrieveExternalEdges())
-                {
-                    createNavLinks(sourceExternalEdge, navObjectLinksToRefresh.second);
-                }
-            }
+            auto aiTerrain = std::dynamic_pointer_cast<AITerrain>(aiEntity);
+            return PolytopeBuilder::instance()->buildGeometry(aiTerrain, tiledMode);
         }
+        return std::make_unique<EntityGeometry>();
     }
 
-    void NavMeshGenerator::createNavLinks(const NavPolygonEdge &sourceExternalEdge, const std::shared_ptr<NavObject> &targetNavObject) const
+    /**
+     * @return Changes building all the entities of the AI world in the same order as the AI world
+     */
+    AIWorldChanges NavMeshGenerator::computeAllEntitiesChanges() const
     {
-        EdgeLinkDetection edgeLinkDetection(navMeshAgent->getJumpDistance());
-        LineSegment3D<float> sourceEdge = sourceExternalEdge.triangle->computeEdge(sourceExternalEdge.edgeIndex);
-
-        for(const auto &targetNavPolygon : targetNavObject->getNavPolygons())
+        AIWorldChanges allEntitiesChanges;
+        allEntitiesChanges.entitiesToBuild.reserve(aiEntities.size());
+        for(const auto &aiEntity : aiEntities)
         {
-            for(const auto &targetExternalEdge : targetNavPolygon->retrieveExternalEdges())
+            auto itFind = entitiesGeometry.find(aiEntity);
+            if(itFind != entitiesGeometry.end())
             {
-                LineSegment3D<float> targetEdge = targetExternalEdge.triangle->computeEdge(targetExternalEdge.edgeIndex);
-
-                EdgeLinkResult edgeLinkResult = edgeLinkDetection.detectLink(sourceEdge, targetEdge);
-                if(edgeLinkResult.hasEdgesLink())
-                {
-                    auto *navLinkConstraint = new NavLinkConstraint(edgeLinkResult.getLinkStartRange(), edgeLinkResult.getLinkEndRange(), targetExternalEdge.edgeIndex);
-                    if (edgeLinkResult.isJumpLink())
-                    {
-                        sourceExternalEdge.triangle->addJumpLink(sourceExternalEdge.edgeIndex, targetExternalEdge.triangle, navLinkConstraint);
-                    } else
-                    {
-                        sourceExternalEdge.triangle->addJoinPolygonsLink(sourceExternalEdge.edgeIndex, targetExternalEdge.triangle, navLinkConstraint);
-                    }
-                }
+                allEntitiesChanges.entitiesToBuild.emplace_back(aiEntity, itFind->second);
             }
         }
-    }
-
-    void NavMeshGenerator::updateNavMesh()
-    {
-        allNavPolygons.clear();
-
-        allNavObjects.clear();
-        navigationObjects.getAllNodeObjects(allNavObjects);
-
-        for(const auto &navObject : allNavObjects)
-        {
-            const std::vector<std::shared_ptr<NavPolygon>> &navPolygons = navObject->getNavPolygons();
-            allNavPolygons.insert(allNavPolygons.end(), navPolygons.begin(), navPolygons.end());
-        }
-
-        std::lock_guard<std::mutex> lock(navMeshMutex);
-        navMesh->copyAllPolygons(allNavPolygons);
+        return allEntitiesChanges;
     }
 
 }
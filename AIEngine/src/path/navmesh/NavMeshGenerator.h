@@ -4,78 +4,65 @@
 #include <memory>
 #include <vector>
 #include <mutex>
-#include <atomic>
-#include <set>
+#include <map>
 #include "UrchinCommon.h"
 
 #include "input/AIWorld.h"
-#include "path/navmesh/model/NavObject.h"
+#include "path/navmesh/AgentNavMeshGenerator.h"
 #include "path/navmesh/model/output/NavMeshAgent.h"
 #include "path/navmesh/model/output/NavMesh.h"
-#include "path/navmesh/model/output/NavPolygon.h"
-#include "path/navmesh/polytope/Polytope.h"
-#include "path/navmesh/polytope/PolytopeSurface.h"
-#include "path/navmesh/csg/CSGPolygon.h"
-#include "path/navmesh/triangulation/TriangulationAlgorithm.h"
+#include "path/navmesh/polytope/EntityGeometry.h"
+#include "path/navmesh/bake/BakedNavMesh.h"
 
 namespace urchin
 {
 
+    /**
+     * Generate the navigation meshes of several agents. The agent independent geometry of the entities (shapes in world space, terrain
+     * splits, terrain obstacles and topography) is built once and shared by the agents: only the expansion, the navigation polygons and
+     * the links are computed for each agent.
+     * The first agent is the primary agent: it is the agent used by the methods without agent parameter.
+     */
     class NavMeshGenerator
     {
         public:
             NavMeshGenerator();
 
             void setNavMeshAgent(std::shared_ptr<NavMeshAgent>);
-            const std::shared_ptr<NavMeshAgent> &getNavMeshAgent() const;
+            void addNavMeshAgent(std::shared_ptr<NavMeshAgent>);
+            std::shared_ptr<NavMeshAgent> getNavMeshAgent() const;
+            std::vector<std::shared_ptr<NavMeshAgent>> getNavMeshAgents() const;
+            void setThreadPool(ThreadPool *);
+            void setTiledMode(bool);
+            bool isTiledMode() const;
 
-            std::shared_ptr<NavMesh> generate(AIWorld &);
-            NavMesh copyLastGeneratedNavMesh() const;
+            std::shared_ptr<const NavMesh> generate(AIWorld &);
+            std::shared_ptr<const NavMesh> getLastGeneratedNavMesh() const;
+            std::shared_ptr<const NavMesh> getLastGeneratedNavMesh(const std::shared_ptr<NavMeshAgent> &) const;
 
-        private:
-            void updateExpandedPolytopes(AIWorld &);
-            void addNavObject(const std::shared_ptr<AIEntity> &, const std::shared_ptr<Polytope> &);
-            void removeNavObject(const std::shared_ptr<AIEntity> &);
-
-            void prepareNavObjectsToUpdate();
-            void updateNearObjects(const std::shared_ptr<NavObject> &);
-
-            void updateNavPolygons();
-            std::vector<std::shared_ptr<NavPolygon>> createNavigationPolygons(const std::shared_ptr<NavObject> &, const std::shared_ptr<PolytopeSurface> &);
-            std::vector<CSGPolygon<float>> &determineObstacles(const std::shared_ptr<NavObject> &, const std::shared_ptr<PolytopeSurface> &) const;
-            CSGPolygon<float> computePolytopeFootprint(const std::shared_ptr<Polytope> &, const std::shared_ptr<PolytopeSurface> &) const;
-            void applyObstaclesOnWalkablePolygon(std::vector<CSGPolygon<float>> &);
-            std::shared_ptr<NavPolygon> createNavigationPolygon(CSGPolygon<float> &, const std::shared_ptr<PolytopeSurface> &, bool) const;
-            std::vector<Point3<float>> elevateTriangulatedPoints(const TriangulationAlgorithm &, const std::shared_ptr<PolytopeSurface> &) const;
-
-            void deleteNavLinks();
-            void createNavLinks();
-            void createNavLinks(const NavPolygonEdge &, const std::shared_ptr<NavObject> &) const;
-
-            void updateNavMesh();
+            void setBakedNavMesh(std::shared_ptr<const BakedNavMesh>);
+            void bake(AIWorld &, const std::string &);
 
-            const float polygonMinDotProductThreshold;
-            const float polygonMergePointsDistanceThreshold;
-
-            mutable std::mutex navMeshMutex;
-            std::shared_ptr<NavMeshAgent> navMeshAgent;
-            std::shared_ptr<NavMesh> navMesh;
-            std::atomic_bool needFullRefresh;
-
-            AABBTree<std::shared_ptr<NavObject>> navigationObjects;
-            std::set<std::shared_ptr<NavObject>> newOrMovingNavObjectsToRefresh, affectedNavObjectsToRefresh;
-            std::set<std::shared_ptr<NavObject>> navObjectsToRefresh;
-            std::set<std::pair<std::shared_ptr<NavObject>, std::shared_ptr<NavObject>>> navObjectsLinksToRefresh;
-            std::vector<CSGPolygon<float>> walkablePolygons;
-            mutable std::vector<std::shared_ptr<NavObject>> nearObjects;
-
-            std::vector<CSGPolygon<float>> obstaclesInsideWalkablePolygon;
-            mutable std::vector<CSGPolygon<float>> holePolygons;
-            mutable std::vector<Point2<float>> footprintPoints;
-            mutable std::string navPolygonName;
-
-            std::vector<std::shared_ptr<NavObject>> allNavObjects;
-            std::vector<std::shared_ptr<NavPolygon>> allNavPolygons;
+        private:
+            std::vector<std::shared_ptr<AgentNavMeshGenerator>> retrieveAgentGeneratorsToUpdate();
+            std::shared_ptr<AgentNavMeshGenerator> createAgentGenerator(std::shared_ptr<NavMeshAgent>) const;
+
+            void updateEntitiesGeometry(AIWorld &);
+            static std::unique_ptr<EntityGeometry> buildGeometry(const std::shared_ptr<AIEntity> &, bool);
+            AIWorldChanges computeAllEntitiesChanges() const;
+
+            mutable std::mutex agentGeneratorsMutex;
+            std::vector<std::shared_ptr<AgentNavMeshGenerator>> agentGenerators; //first generator is the primary agent generator
+            std::shared_ptr<const BakedNavMesh> bakedNavMesh;
+            ThreadPool *threadPool;
+            bool tiledMode;
+            bool rebuildAllEntities;
+
+            std::map<std::shared_ptr<AIEntity>, std::shared_ptr<const EntityGeometry>> entitiesGeometry;
+            AIWorldChanges aiWorldChanges;
+            std::vector<std::shared_ptr<AIEntity>> aiEntities;
+            std::vector<std::shared_ptr<AIEntity>> entitiesToRebuild;
+            std::vector<std::unique_ptr<EntityGeometry>> entitiesRebuiltGeometry;
     };
 
 }
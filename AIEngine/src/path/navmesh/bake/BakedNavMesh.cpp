@@ -0,0 +1,169 @@
+#include <stdexcept>
+#include <cstring>
+#include <cassert>
+
+#include "BakedNavMesh.h"
+#include "path/navmesh/model/output/NavLink.h"
+
+namespace urchin
+{
+
+    /**
+     * @param filename Absolute path of the baked navigation mesh file
+     */
+    BakedNavMesh::BakedNavMesh(const std::string &filename) :
+            filename(filename),
+            file(std::make_unique<MemoryMappedFile>(filename)),
+            header(nullptr),
+            polygons(nullptr),
+            vertices(nullptr),
+            triangles(nullptr),
+            links(nullptr),
+            names(nullptr)
+    {
+        header = validateHeader();
+
+        const char *content = file->getData() + sizeof(BakedNavMeshHeader);
+        polygons = reinterpret_cast<const BakedNavPolygon *>(content);
+        vertices = reinterpret_cast<const BakedNavVertex *>(polygons + header->polygonsCount);
+        triangles = reinterpret_cast<const BakedNavTriangle *>(vertices + header->verticesCount);
+        links = reinterpret_cast<const BakedNavLink *>(triangles + header->trianglesCount);
+        names = reinterpret_cast<const char *>(links + header->linksCount);
+
+        validateContent();
+    }
+
+    /**
+     * @return MD5 of the AI world and navigation mesh settings used to bake the navigation mesh
+     */
+    std::string BakedNavMesh::getWorldKey() const
+    {
+        return std::string(header->worldKey, BAKED_NAV_MESH_MD5_SIZE);
+    }
+
+    std::uint32_t BakedNavMesh::getPolygonsCount() const
+    {
+        return header->polygonsCount;
+    }
+
+    const BakedNavPolygon &BakedNavMesh::getPolygon(std::uint32_t polygonIndex) const
+    {
+        assert(polygonIndex < header->polygonsCount);
+        return polygons[polygonIndex];
+    }
+
+    std::string BakedNavMesh::getPolygonName(const BakedNavPolygon &polygon) const
+    {
+        return std::string(names + polygon.nameOffset, polygon.nameSize);
+    }
+
+    std::string BakedNavMesh::getWalkableSurfaceName(const BakedNavPolygon &polygon) const
+    {
+        return std::string(names + polygon.walkableSurfaceNameOffset, polygon.walkableSurfaceNameSize);
+    }
+
+    const BakedNavVertex &BakedNavMesh::getVertex(std::uint32_t vertexIndex) const
+    {
+        assert(vertexIndex < header->verticesCount);
+        return vertices[vertexIndex];
+    }
+
+    std::uint32_t BakedNavMesh::getTrianglesCount() const
+    {
+        return header->trianglesCount;
+    }
+
+    const BakedNavTriangle &BakedNavMesh::getTriangle(std::uint32_t triangleIndex) const
+    {
+        assert(triangleIndex < header->trianglesCount);
+        return triangles[triangleIndex];
+    }
+
+    const BakedNavLink &BakedNavMesh::getLink(std::uint32_t linkIndex) const
+    {
+        assert(linkIndex < header->linksCount);
+        return links[linkIndex];
+    }
+
+    const BakedNavMeshHeader *BakedNavMesh::validateHeader() const
+    {
+        if(file->getSize() < sizeof(BakedNavMeshHeader))
+        {
+            throw std::runtime_error("Baked navigation mesh file too small: " + filename);
+        }
+
+        const auto *fileHeader = reinterpret_cast<const BakedNavMeshHeader *>(file->getData());
+        if(std::memcmp(fileHeader->magic, BAKED_NAV_MESH_MAGIC, sizeof(BAKED_NAV_MESH_MAGIC)) != 0)
+        {
+            throw std::runtime_error("File is not a baked navigation mesh: " + filename);
+        }
+        if(fileHeader->version != BAKED_NAV_MESH_VERSION)
+        {
+            throw std::runtime_error("Unsupported version " + std::to_string(fileHeader->version) + " of baked navigation mesh: " + filename);
+        }
+
+        std::uint64_t expectedSize = sizeof(BakedNavMeshHeader)
+                + static_cast<std::uint64_t>(fileHeader->polygonsCount) * sizeof(BakedNavPolygon)
+                + static_cast<std::uint64_t>(fileHeader->verticesCount) * sizeof(BakedNavVertex)
+                + static_cast<std::uint64_t>(fileHeader->trianglesCount) * sizeof(BakedNavTriangle)
+                + static_cast<std::uint64_t>(fileHeader->linksCount) * sizeof(BakedNavLink)
+                + fileHeader->namesSize;
+        if(expectedSize != file->getSize())
+        {
+            throw std::runtime_error("Baked navigation mesh file truncated: " + filename);
+        }
+
+        return fileHeader;
+    }
+
+    void BakedNavMesh::validateContent() const
+    {
+        //MD5 implementation doesn't modify the memory: const cast is safe on the read only mapped file
+        auto *content = reinterpret_cast<BYTE *>(const_cast<char *>(file->getData() + sizeof(BakedNavMeshHeader)));
+        std::string checksum = MD5().digestMemory(content, static_cast<int>(file->getSize() - sizeof(BakedNavMeshHeader)));
+        if(checksum != std::string(header->checksum, BAKED_NAV_MESH_MD5_SIZE))
+        {
+            throw std::runtime_error("Baked navigation mesh file corrupted (invalid checksum): " + filename);
+        }
+
+        for(std::uint32_t polygonIndex = 0; polygonIndex < header->polygonsCount; ++polygonIndex)
+        {
+            const BakedNavPolygon &polygon = polygons[polygonIndex];
+            checkName(polygon.nameOffset, polygon.nameSize);
+            checkName(polygon.walkableSurfaceNameOffset, polygon.walkableSurfaceNameSize);
+            if(static_cast<std::uint64_t>(polygon.firstVertex) + polygon.verticesCount > header->verticesCount
+                    || static_cast<std::uint64_t>(polygon.firstTriangle) + polygon.trianglesCount > header->trianglesCount)
+            {
+                throw std::runtime_error("Invalid polygon " + std::to_string(polygonIndex) + " in baked navigation mesh: " + filename);
+            }
+
+            for(std::uint32_t triangleIndex = polygon.firstTriangle; triangleIndex < polygon.firstTriangle + polygon.trianglesCount; ++triangleIndex)
+            {
+                const BakedNavTriangle &triangle = triangles[triangleIndex];
+                if(triangle.indices[0] >= polygon.verticesCount || triangle.indices[1] >= polygon.verticesCount || triangle.indices[2] >= polygon.verticesCount
+                        || static_cast<std::uint64_t>(triangle.firstLink) + triangle.linksCount > header->linksCount)
+                {
+                    throw std::runtime_error("Invalid triangle " + std::to_string(triangleIndex) + " in baked navigation mesh: " + filename);
+                }
+            }
+        }
+
+        for(std::uint32_t linkIndex = 0; linkIndex < header->linksCount; ++linkIndex)
+        {
+            const BakedNavLink &link = links[linkIndex];
+            if(link.targetTriangle >= header->trianglesCount || link.linkType > NavLinkType::JUMP || link.sourceEdgeIndex > 2 || link.targetEdgeIndex > 2)
+            {
+                throw std::runtime_error("Invalid link " + std::to_string(linkIndex) + " in baked navigation mesh: " + filename);
+            }
+        }
+    }
+
+    void BakedNavMesh::checkName(std::uint32_t nameOffset, std::uint32_t nameSize) const
+    {
+        if(static_cast<std::uint64_t>(nameOffset) + nameSize > header->namesSize)
+        {
+            throw std::runtime_error("Invalid name in baked navigation mesh: " + filename);
+        }
+    }
+
+}
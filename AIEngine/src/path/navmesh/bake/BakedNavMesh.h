@@ -0,0 +1,52 @@
+#ifndef URCHINENGINE_BAKEDNAVMESH_H
+#define URCHINENGINE_BAKEDNAVMESH_H
+
+#include <string>
+#include <memory>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/bake/BakedNavMeshFormat.h"
+
+namespace urchin
+{
+
+    /**
+     * Navigation mesh baked in a file. The file is mapped in memory and validated on construction: an exception is thrown when the
+     * file is truncated, corrupted or built with another format version.
+     */
+    class BakedNavMesh
+    {
+        public:
+            explicit BakedNavMesh(const std::string &);
+
+            std::string getWorldKey() const;
+
+            std::uint32_t getPolygonsCount() const;
+            const BakedNavPolygon &getPolygon(std::uint32_t) const;
+            std::string getPolygonName(const BakedNavPolygon &) const;
+            std::string getWalkableSurfaceName(const BakedNavPolygon &) const;
+
+            const BakedNavVertex &getVertex(std::uint32_t) const;
+            std::uint32_t getTrianglesCount() const;
+            const BakedNavTriangle &getTriangle(std::uint32_t) const;
+            const BakedNavLink &getLink(std::uint32_t) const;
+
+        private:
+            const BakedNavMeshHeader *validateHeader() const;
+            void validateContent() const;
+            void checkName(std::uint32_t, std::uint32_t) const;
+
+            std::string filename;
+            std::unique_ptr<MemoryMappedFile> file;
+
+            const BakedNavMeshHeader *header;
+            const BakedNavPolygon *polygons;
+            const BakedNavVertex *vertices;
+            const BakedNavTriangle *triangles;
+            const BakedNavLink *links;
+            const char *names;
+    };
+
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef URCHINENGINE_BAKEDNAVMESHFORMAT_H
+#define URCHINENGINE_BAKEDNAVMESHFORMAT_H
+
+#include <cstdint>
+
+namespace urchin
+{
+
+    /**
+     * Binary format of a baked navigation mesh file: the header is followed by the arrays of polygons, vertices, triangles, links and by
+     * the characters of the names. All records are made of 32 bits values: the arrays can be read directly from the file mapped in memory.
+     */
+    constexpr char BAKED_NAV_MESH_MAGIC[4] = {'U', 'N', 'A', 'V'};
+    constexpr std::uint32_t BAKED_NAV_MESH_VERSION = 1;
+    constexpr std::uint32_t BAKED_NAV_MESH_MD5_SIZE = 32;
+
+    struct BakedNavMeshHeader
+    {
+        char magic[4];
+        std::uint32_t version;
+        char worldKey[BAKED_NAV_MESH_MD5_SIZE]; //MD5 of the AI world and navigation mesh settings (see NavMeshBakeService::computeWorldKey())
+        char checksum[BAKED_NAV_MESH_MD5_SIZE]; //MD5 of the content following the header
+        std::uint32_t polygonsCount;
+        std::uint32_t verticesCount;
+        std::uint32_t trianglesCount;
+        std::uint32_t linksCount;
+        std::uint32_t namesSize;
+        std::uint32_t reserved;
+    };
+
+    struct BakedNavPolygon
+    {
+        std::uint32_t nameOffset;
+        std::uint32_t nameSize;
+        std::uint32_t walkableSurfaceNameOffset;
+        std::uint32_t walkableSurfaceNameSize;
+        std::uint32_t firstVertex;
+        std::uint32_t verticesCount;
+        std::uint32_t firstTriangle;
+        std::uint32_t trianglesCount;
+    };
+
+    struct BakedNavVertex
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    struct BakedNavTriangle
+    {
+        std::uint32_t indices[3]; //vertex indices in the polygon
+        std::uint32_t firstLink;
+        std::uint32_t linksCount;
+    };
+
+    struct BakedNavLink
+    {
+        std::uint32_t targetTriangle;
+        std::uint32_t linkType;
+        std::uint32_t sourceEdgeIndex;
+        std::uint32_t targetEdgeIndex; //only relevant for join polygons and jump links
+        float sourceEdgeLinkStartRange;
+        float sourceEdgeLinkEndRange;
+    };
+
+    static_assert(sizeof(BakedNavMeshHeader) % 8 == 0, "Header size must keep the arrays aligned");
+    static_assert(sizeof(BakedNavPolygon) == 8 * sizeof(std::uint32_t), "Unexpected padding in baked polygon");
+    static_assert(sizeof(BakedNavVertex) == 3 * sizeof(float), "Unexpected padding in baked vertex");
+    static_assert(sizeof(BakedNavTriangle) == 5 * sizeof(std::uint32_t), "Unexpected padding in baked triangle");
+    static_assert(sizeof(BakedNavLink) == 6 * sizeof(std::uint32_t), "Unexpected padding in baked link");
+
+}
+
+#endif
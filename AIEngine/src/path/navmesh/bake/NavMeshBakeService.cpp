@@ -0,0 +1,296 @@
+#include <fstream>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "NavMeshBakeService.h"
+#include "input/AIObject.h"
+#include "input/AITerrain.h"
+
+namespace urchin
+{
+
+    /**
+     * @param tiledMode Tiled mode of the navigation mesh generator
+     * @return MD5 of the entities and navigation mesh settings: the baked navigation mesh is valid only for the same key
+     */
+    std::string NavMeshBakeService::computeWorldKey(const std::vector<std::shared_ptr<AIEntity>> &aiEntities, const NavMeshAgent &navMeshAgent,
+            bool tiledMode) const
+    {
+        std::vector<char> keyData;
+        appendValue(keyData, BAKED_NAV_MESH_VERSION);
+
+        for(const char *floatProperty : {"navMesh.polytopeMaxSize", "navMesh.tileSize", "navMesh.polygonMergePointsDistanceThreshold",
+                "navMesh.polygonRemoveAngleThresholdInDegree", "navMesh.terrainMaxWalkableSlopeInDegree", "navMesh.terrainObstacleSimplificationError",
+                "navMesh.edgeLinkMinLength", "navMesh.edgeLinkEqualityDistanceThreshold"})
+        {
+            appendValue(keyData, ConfigService::instance()->getFloatValue(floatProperty));
+        }
+        appendValue(keyData, tiledMode);
+
+        appendValue(keyData, navMeshAgent.getAgentHeight());
+        appendValue(keyData, navMeshAgent.getAgentRadius());
+        appendValue(keyData, navMeshAgent.getMaxSlope());
+        appendValue(keyData, navMeshAgent.getJumpDistance());
+
+        for(const auto &aiEntity : aiEntities)
+        {
+            appendEntityKey(keyData, *aiEntity);
+        }
+
+        return MD5().digestMemory(reinterpret_cast<BYTE *>(keyData.data()), static_cast<int>(keyData.size()));
+    }
+
+    void NavMeshBakeService::appendEntityKey(std::vector<char> &keyData, const AIEntity &aiEntity) const
+    {
+        appendValue(keyData, aiEntity.getType());
+        appendString(keyData, aiEntity.getName());
+        appendValue(keyData, aiEntity.isObstacleCandidate());
+
+        Transform<float> transform = aiEntity.getTransform();
+        appendValue(keyData, transform.getPosition());
+        appendValue(keyData, transform.getOrientation());
+        appendValue(keyData, transform.getScale());
+
+        if(aiEntity.getType() == AIEntity::OBJECT)
+        {
+            const auto &aiObject = dynamic_cast<const AIObject &>(aiEntity);
+            for(const auto &aiShape : aiObject.getShapes())
+            {
+                Transform<float> localTransform = aiShape->hasLocalTransform() ? aiShape->getLocalTransform() : Transform<float>();
+                std::unique_ptr<ConvexObject3D<float>> localObject = aiShape->getShape()->toConvexObject(localTransform);
+                for(unsigned int x = 0; x < SHAPE_KEY_DIRECTIONS; ++x)
+                {
+                    for(unsigned int y = 0; y < SHAPE_KEY_DIRECTIONS; ++y)
+                    {
+                        for(unsigned int z = 0; z < SHAPE_KEY_DIRECTIONS; ++z)
+                        {
+                            Vector3<float> direction((float)x - 1.0f, (float)y - 1.0f, (float)z - 1.0f);
+                            appendValue(keyData, localObject->getSupportPoint(direction));
+                        }
+                    }
+                }
+            }
+        }else if(aiEntity.getType() == AIEntity::TERRAIN)
+        {
+            const auto &aiTerrain = dynamic_cast<const AITerrain &>(aiEntity);
+            appendValue(keyData, aiTerrain.getXLength());
+            appendValue(keyData, aiTerrain.getZLength());
+            for(const auto &localVertex : aiTerrain.getLocalVertices())
+            {
+                appendValue(keyData, localVertex);
+            }
+        }
+    }
+
+    template<class T> void NavMeshBakeService::appendValue(std::vector<char> &keyData, const T &value) const
+    {
+        const auto *valueData = reinterpret_cast<const char *>(&value);
+        keyData.insert(keyData.end(), valueData, valueData + sizeof(T));
+    }
+
+    void NavMeshBakeService::appendString(std::vector<char> &keyData, const std::string &value) const
+    {
+        appendValue(keyData, value.size());
+        keyData.insert(keyData.end(), value.begin(), value.end());
+    }
+
+    /**
+     * @param filename Absolute path of the baked navigation mesh file
+     * @param worldKey Key of the AI world from which the navigation mesh is generated (see computeWorldKey())
+     */
+    void NavMeshBakeService::writeBakedNavMesh(const std::string &filename, const std::string &worldKey, const NavMesh &navMesh) const
+    {
+        const std::vector<std::shared_ptr<NavPolygon>> &navPolygons = navMesh.getPolygons();
+
+        std::vector<BakedNavPolygon> polygons;
+        std::vector<BakedNavVertex> vertices;
+        std::vector<BakedNavTriangle> triangles;
+        std::vector<BakedNavLink> links;
+        std::string names;
+
+        std::unordered_map<unsigned int, std::uint32_t> firstTriangleByPolygonId;
+        std::uint32_t trianglesCount = 0;
+        for(const auto &navPolygon : navPolygons)
+        {
+            firstTriangleByPolygonId[navPolygon->getId()] = trianglesCount;
+            trianglesCount += static_cast<std::uint32_t>(navPolygon->getTriangles().size());
+        }
+
+        polygons.reserve(navPolygons.size());
+        triangles.reserve(trianglesCount);
+        for(std::size_t polygonIndex = 0; polygonIndex < navPolygons.size(); ++polygonIndex)
+        {
+            const std::shared_ptr<NavPolygon> &navPolygon = navPolygons[polygonIndex];
+
+            BakedNavPolygon polygon = {};
+            polygon.nameOffset = addName(names, navPolygon->getName());
+            polygon.nameSize = static_cast<std::uint32_t>(navPolygon->getName().size());
+            polygon.walkableSurfaceNameOffset = addName(names, navPolygon->getWalkableSurfaceName());
+            polygon.walkableSurfaceNameSize = static_cast<std::uint32_t>(navPolygon->getWalkableSurfaceName().size());
+            polygon.firstVertex = static_cast<std::uint32_t>(vertices.size());
+            polygon.verticesCount = static_cast<std::uint32_t>(navPolygon->getPoints().size());
+            polygon.firstTriangle = static_cast<std::uint32_t>(triangles.size());
+            polygon.trianglesCount = static_cast<std::uint32_t>(navPolygon->getTriangles().size());
+            polygons.push_back(polygon);
+
+            for(const auto &point : navPolygon->getPoints())
+            {
+                vertices.push_back({point.X, point.Y, point.Z});
+            }
+
+            for(std::size_t triangleIndex = 0; triangleIndex < navPolygon->getTriangles().size(); ++triangleIndex)
+            {
+                const std::shared_ptr<NavTriangle> &navTriangle = navPolygon->getTriangle(triangleIndex);
+                const std::vector<std::shared_ptr<NavLink>> &navLinks = navMesh.getTriangleLinks(polygonIndex, triangleIndex);
+
+                BakedNavTriangle triangle = {};
+                for(std::size_t i = 0; i < 3; ++i)
+                {
+                    triangle.indices[i] = static_cast<std::uint32_t>(navTriangle->getIndex(i));
+                }
+                triangle.firstLink = static_cast<std::uint32_t>(links.size());
+                triangle.linksCount = static_cast<std::uint32_t>(navLinks.size());
+                triangles.push_back(triangle);
+
+                for(const auto &navLink : navLinks)
+                {
+                    const std::shared_ptr<NavTriangle> &targetTriangle = navLink->getTargetTriangle();
+
+                    BakedNavLink link = {};
+                    link.targetTriangle = firstTriangleByPolygonId.at(targetTriangle->getNavPolygon()->getId())
+                            + static_cast<std::uint32_t>(targetTriangle->getPolygonTriangleIndex());
+                    link.linkType = navLink->getLinkType();
+                    link.sourceEdgeIndex = navLink->getSourceEdgeIndex();
+                    if(navLink->getLinkType() != NavLinkType::STANDARD)
+                    {
+                        link.targetEdgeIndex = static_cast<std::uint32_t>(navLink->getLinkConstraint()->getTargetEdgeIndex());
+                        link.sourceEdgeLinkStartRange = navLink->getLinkConstraint()->getSourceEdgeLinkStartRange();
+                        link.sourceEdgeLinkEndRange = navLink->getLinkConstraint()->getSourceEdgeLinkEndRange();
+                    }
+                    links.push_back(link);
+                }
+            }
+        }
+
+        std::vector<char> content;
+        content.reserve(polygons.size() * sizeof(BakedNavPolygon) + vertices.size() * sizeof(BakedNavVertex)
+                + triangles.size() * sizeof(BakedNavTriangle) + links.size() * sizeof(BakedNavLink) + names.size());
+        content.insert(content.end(), reinterpret_cast<const char *>(polygons.data()), reinterpret_cast<const char *>(polygons.data() + polygons.size()));
+        content.insert(content.end(), reinterpret_cast<const char *>(vertices.data()), reinterpret_cast<const char *>(vertices.data() + vertices.size()));
+        content.insert(content.end(), reinterpret_cast<const char *>(triangles.data()), reinterpret_cast<const char *>(triangles.data() + triangles.size()));
+        content.insert(content.end(), reinterpret_cast<const char *>(links.data()), reinterpret_cast<const char *>(links.data() + links.size()));
+        content.insert(content.end(), names.begin(), names.end());
+
+        BakedNavMeshHeader header = {};
+        std::memcpy(header.magic, BAKED_NAV_MESH_MAGIC, sizeof(BAKED_NAV_MESH_MAGIC));
+        header.version = BAKED_NAV_MESH_VERSION;
+        std::memcpy(header.worldKey, worldKey.c_str(), std::min(worldKey.size(), sizeof(header.worldKey)));
+        std::string checksum = MD5().digestMemory(reinterpret_cast<BYTE *>(content.data()), static_cast<int>(content.size()));
+        std::memcpy(header.checksum, checksum.c_str(), sizeof(header.checksum));
+        header.polygonsCount = static_cast<std::uint32_t>(polygons.size());
+        header.verticesCount = static_cast<std::uint32_t>(vertices.size());
+        header.trianglesCount = static_cast<std::uint32_t>(triangles.size());
+        header.linksCount = static_cast<std::uint32_t>(links.size());
+        header.namesSize = static_cast<std::uint32_t>(names.size());
+
+        std::ofstream file;
+        file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!file.is_open())
+        {
+            throw std::runtime_error("Unable to open file: " + filename);
+        }
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        file.close();
+    }
+
+    std::uint32_t NavMeshBakeService::addName(std::string &names, const std::string &name) const
+    {
+        auto nameOffset = static_cast<std::uint32_t>(names.size());
+        names += name;
+        return nameOffset;
+    }
+
+    /**
+     * @param navTopographies Topography by walkable surface name of the AI world
+     * @return Polygons of the baked navigation mesh with their triangles and links
+     */
+    std::vector<std::shared_ptr<NavPolygon>> NavMeshBakeService::restoreNavPolygons(const BakedNavMesh &bakedNavMesh,
+            const std::map<std::string, std::shared_ptr<const NavTopography>> &navTopographies) const
+    {
+        std::vector<std::shared_ptr<NavPolygon>> navPolygons;
+        navPolygons.reserve(bakedNavMesh.getPolygonsCount());
+        std::vector<std::shared_ptr<NavTriangle>> navTriangles(bakedNavMesh.getTrianglesCount()); //triangles by index of the baked navigation mesh
+
+        for(std::uint32_t polygonIndex = 0; polygonIndex < bakedNavMesh.getPolygonsCount(); ++polygonIndex)
+        {
+            const BakedNavPolygon &polygon = bakedNavMesh.getPolygon(polygonIndex);
+            std::string walkableSurfaceName = bakedNavMesh.getWalkableSurfaceName(polygon);
+            auto itTopography = navTopographies.find(walkableSurfaceName);
+            if(itTopography == navTopographies.end())
+            {
+                throw std::runtime_error("Walkable surface " + walkableSurfaceName + " of baked navigation mesh not found in AI world");
+            }
+
+            std::vector<Point3<float>> points;
+            points.reserve(polygon.verticesCount);
+            for(std::uint32_t vertexIndex = polygon.firstVertex; vertexIndex < polygon.firstVertex + polygon.verticesCount; ++vertexIndex)
+            {
+                const BakedNavVertex &vertex = bakedNavMesh.getVertex(vertexIndex);
+                points.emplace_back(Point3<float>(vertex.x, vertex.y, vertex.z));
+            }
+
+            auto navPolygon = std::make_shared<NavPolygon>(bakedNavMesh.getPolygonName(polygon), std::move(points), itTopography->second);
+            navPolygon->setWalkableSurfaceName(walkableSurfaceName);
+
+            std::vector<std::shared_ptr<NavTriangle>> triangles;
+            triangles.reserve(polygon.trianglesCount);
+            for(std::uint32_t triangleIndex = polygon.firstTriangle; triangleIndex < polygon.firstTriangle + polygon.trianglesCount; ++triangleIndex)
+            {
+                const BakedNavTriangle &triangle = bakedNavMesh.getTriangle(triangleIndex);
+                triangles.push_back(std::make_shared<NavTriangle>(triangle.indices[0], triangle.indices[1], triangle.indices[2]));
+                navTriangles[triangleIndex] = triangles.back();
+            }
+            navPolygon->addTriangles(triangles, navPolygon);
+
+            navPolygons.push_back(navPolygon);
+        }
+
+        for(std::uint32_t polygonIndex = 0; polygonIndex < bakedNavMesh.getPolygonsCount(); ++polygonIndex)
+        {
+            const BakedNavPolygon &polygon = bakedNavMesh.getPolygon(polygonIndex);
+            for(std::uint32_t triangleIndex = polygon.firstTriangle; triangleIndex < polygon.firstTriangle + polygon.trianglesCount; ++triangleIndex)
+            {
+                const BakedNavTriangle &triangle = bakedNavMesh.getTriangle(triangleIndex);
+                for(std::uint32_t linkIndex = triangle.firstLink; linkIndex < triangle.firstLink + triangle.linksCount; ++linkIndex)
+                {
+                    const BakedNavLink &link = bakedNavMesh.getLink(linkIndex);
+                    if(!navTriangles[link.targetTriangle])
+                    {
+                        throw std::runtime_error("Link toward a triangle without polygon in baked navigation mesh: " + std::to_string(linkIndex));
+                    }
+
+                    const std::shared_ptr<NavTriangle> &targetTriangle = navTriangles[link.targetTriangle];
+                    if(link.linkType == NavLinkType::STANDARD)
+                    {
+                        navTriangles[triangleIndex]->addStandardLink(link.sourceEdgeIndex, targetTriangle);
+                    }else
+                    {
+                        auto *navLinkConstraint = new NavLinkConstraint(link.sourceEdgeLinkStartRange, link.sourceEdgeLinkEndRange, (float)link.targetEdgeIndex);
+                        if(link.linkType == NavLinkType::JUMP)
+                        {
+                            navTriangles[triangleIndex]->addJumpLink(link.sourceEdgeIndex, targetTriangle, navLinkConstraint);
+                        }else
+                        {
+                            navTriangles[triangleIndex]->addJoinPolygonsLink(link.sourceEdgeIndex, targetTriangle, navLinkConstraint);
+                        }
+                    }
+                }
+            }
+        }
+
+        return navPolygons;
+    }
+
+}
@@ -0,0 +1,42 @@
+#ifndef URCHINENGINE_NAVMESHBAKESERVICE_H
+#define URCHINENGINE_NAVMESHBAKESERVICE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include "UrchinCommon.h"
+
+#include "input/AIEntity.h"
+#include "path/navmesh/bake/BakedNavMesh.h"
+#include "path/navmesh/model/output/NavMesh.h"
+#include "path/navmesh/model/output/NavMeshAgent.h"
+#include "path/navmesh/model/output/NavPolygon.h"
+
+namespace urchin
+{
+
+    /**
+     * Save a navigation mesh in a baked file and restore its polygons: a baked navigation mesh avoids the generation from scratch at
+     * map loading
+     */
+    class NavMeshBakeService
+    {
+        public:
+            std::string computeWorldKey(const std::vector<std::shared_ptr<AIEntity>> &, const NavMeshAgent &, bool) const;
+
+            void writeBakedNavMesh(const std::string &, const std::string &, const NavMesh &) const;
+            std::vector<std::shared_ptr<NavPolygon>> restoreNavPolygons(const BakedNavMesh &, const std::map<std::string, std::shared_ptr<const NavTopography>> &) const;
+
+        private:
+            void appendEntityKey(std::vector<char> &, const AIEntity &) const;
+            template<class T> void appendValue(std::vector<char> &, const T &) const;
+            void appendString(std::vector<char> &, const std::string &) const;
+            std::uint32_t addName(std::string &, const std::string &) const;
+
+            static constexpr unsigned int SHAPE_KEY_DIRECTIONS = 3; //support points on 3x3x3 directions identify a convex shape
+    };
+
+}
+
+#endif
@@ -15,18 +15,7 @@ namespace urchin
     template<class T> CSGPolygonPath::CSGPolygonPath(const CSGPolygon<T> &polygon) :
         name(polygon.getName())
     {
-        path.reserve(polygon.getCwPoints().size());
-
-        for(const auto &point : polygon.getCwPoints())
-        {
-            if(typeid(long long)==typeid(T))
-            {
-                path.emplace_back(ClipperLib::IntPoint(point.X, point.Y));
-            }else
-            {
-                path.emplace_back(ClipperLib::IntPoint(Converter::toLongLong(point.X), Converter::toLongLong(point.Y)));
-            }
-        }
+        toPath(polygon, path);
     }
 
     template<class T> CSGPolygon<T> CSGPolygonPath::toCSGPolygon() const
@@ -48,6 +37,27 @@ namespace urchin
         return CSGPolygon<T>(name, std::move(cwPoints));
     }
 
+    /**
+     * Convert the polygon points into a path of integer points
+     * @param path [out] Path replaced by the polygon points. Capacity of the path is reused.
+     */
+    template<class T> void CSGPolygonPath::toPath(const CSGPolygon<T> &polygon, ClipperLib::Path &path)
+    {
+        path.clear();
+        path.reserve(polygon.getCwPoints().size());
+
+        for(const auto &point : polygon.getCwPoints())
+        {
+            if(typeid(long long)==typeid(T))
+            {
+                path.emplace_back(ClipperLib::IntPoint(point.X, point.Y));
+            }else
+            {
+                path.emplace_back(ClipperLib::IntPoint(Converter::toLongLong(point.X), Converter::toLongLong(point.Y)));
+            }
+        }
+    }
+
     const ClipperLib::Path &CSGPolygonPath::getPath() const
     {
         return path;
@@ -61,8 +71,10 @@ namespace urchin
     //explicit template
     template CSGPolygonPath::CSGPolygonPath(const CSGPolygon<float> &);
     template class CSGPolygon<float> CSGPolygonPath::toCSGPolygon<float>() const;
+    template void CSGPolygonPath::toPath<float>(const CSGPolygon<float> &, ClipperLib::Path &);
 
     template CSGPolygonPath::CSGPolygonPath(const CSGPolygon<long long> &);
     template class CSGPolygon<long long> CSGPolygonPath::toCSGPolygon<long long>() const;
+    template void CSGPolygonPath::toPath<long long>(const CSGPolygon<long long> &, ClipperLib::Path &);
 
 }
@@ -14,6 +14,7 @@ namespace urchin
             template<class T> explicit CSGPolygonPath(const CSGPolygon<T> &);
 
             template<class T> CSGPolygon<T> toCSGPolygon() const;
+            template<class T> static void toPath(const CSGPolygon<T> &, ClipperLib::Path &);
 
             const ClipperLib::Path &getPath() const;
             const std::string &getName() const;
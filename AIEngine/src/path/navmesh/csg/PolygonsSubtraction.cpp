@@ -6,7 +6,7 @@
 namespace urchin
 {
 
-    template<class T> const std::vector<CSGPolygon<T>> &PolygonsSubtraction<T>::subtractPolygons(const CSGPolygon<T> &minuendPolygon, const CSGPolygon<T> &subtrahendPolygon) const
+    template<class T> std::vector<CSGPolygon<T>> PolygonsSubtraction<T>::subtractPolygons(const CSGPolygon<T> &minuendPolygon, const CSGPolygon<T> &subtrahendPolygon) const
     {
         bool subtrahendInside;
         return subtractPolygons(minuendPolygon, subtrahendPolygon, subtrahendInside);
@@ -15,11 +15,12 @@ namespace urchin
     /**
      * Perform a subtraction of polygons.
      * When subtrahendPolygon is totally included in minuendPolygon: the original minuendPolygon is returned without hole.
+     * This method is thread-safe.
      * @param subtrahendInside True when subtrahendPolygon is totally included in minuendPolygon.
      */
-    template<class T> const std::vector<CSGPolygon<T>> &PolygonsSubtraction<T>::subtractPolygons(const CSGPolygon<T> &minuendPolygon, const CSGPolygon<T> &subtrahendPolygon, bool &subtrahendInside) const
+    template<class T> std::vector<CSGPolygon<T>> PolygonsSubtraction<T>::subtractPolygons(const CSGPolygon<T> &minuendPolygon, const CSGPolygon<T> &subtrahendPolygon, bool &subtrahendInside) const
     {
-        subtractedPolygons.clear();
+        std::vector<CSGPolygon<T>> subtractedPolygons;
 
         CSGPolygonPath minuendPolygonPath(minuendPolygon);
         CSGPolygonPath subtrahendPolygonPath(subtrahendPolygon);
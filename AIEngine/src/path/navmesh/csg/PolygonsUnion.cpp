@@ -1,4 +1,7 @@
 #include <stdexcept>
+#include <algorithm>
+#include <numeric>
+#include <limits>
 
 #include "PolygonsUnion.h"
 
@@ -8,77 +11,181 @@ namespace urchin
     /**
        * Perform an union of polygons.
        * When polygons cannot be put together because there is no contact: there are returned apart.
+       * This method is thread-safe.
        */
-    template<class T> std::vector<CSGPolygon<T>> &PolygonsUnion<T>::unionPolygons(const std::vector<CSGPolygon<T>> &polygons) const
+    template<class T> std::vector<CSGPolygon<T>> PolygonsUnion<T>::unionPolygons(const std::vector<CSGPolygon<T>> &polygons) const
     {
-        mergedPolygons.clear();
+        ClipperLib::Paths polygonPaths;
+        return unionPolygons(polygons, polygonPaths);
+    }
 
-        allPolygonPaths.clear();
-        for(const auto &polygon : polygons)
+    /**
+     * Perform an union of polygons in one clipper execution. Resulting polygons are sorted by the index of their first input polygon.
+     * This method is thread-safe.
+     * @param polygonPaths [out] Buffer of the integer paths: capacity of the paths is reused between the calls
+     */
+    template<class T> std::vector<CSGPolygon<T>> PolygonsUnion<T>::unionPolygons(const std::vector<CSGPolygon<T>> &polygons, ClipperLib::Paths &polygonPaths) const
+    {
+        if(polygons.size() <= 1)
         {
-            allPolygonPaths.emplace_back(CSGPolygonPath(polygon));
+            return polygons;
         }
 
-        while(!allPolygonPaths.empty())
+        polygonPaths.resize(polygons.size());
+        for(std::size_t i=0; i<polygons.size(); ++i)
         {
-            bool isPolygonsMerged = false;
-            for(std::size_t i=1; i<allPolygonPaths.size(); ++i)
-            {
-                const std::vector<CSGPolygonPath> &result = unionTwoPolygonPaths(allPolygonPaths[0], allPolygonPaths[i]);
-                if(result.empty())
-                {
-                    logInputData(polygons, "Empty result returned after two polygons union." , Logger::ERROR);
-                    mergedPolygons.clear();
-                    return mergedPolygons;
-                }
-                if(result.size()==1)
-                {
-                    isPolygonsMerged = true;
-
-                    VectorEraser::erase(allPolygonPaths, i);
-                    VectorEraser::erase(allPolygonPaths, 0);
-
-                    allPolygonPaths.emplace_back(result[0]);
-                    break;
-                }
+            CSGPolygonPath::toPath(polygons[i], polygonPaths[i]);
+            if(!ClipperLib::Orientation(polygonPaths[i]))
+            { //same orientation for all paths: overlapping areas are added by the non-zero fill type
+                ClipperLib::ReversePath(polygonPaths[i]);
             }
-            if(!isPolygonsMerged)
+        }
+
+        ClipperLib::Clipper clipper;
+        clipper.ReverseSolution(true);
+        clipper.StrictlySimple(true); //slow but avoid duplicate points
+        clipper.AddPaths(polygonPaths, ClipperLib::ptSubject, true);
+
+        ClipperLib::PolyTree solution;
+        clipper.Execute(ClipperLib::ctUnion, solution, ClipperLib::pftNonZero, ClipperLib::pftNonZero);
+        ClipperLib::PolyNodes outerContours = retrieveOuterContours(solution);
+        if(outerContours.empty())
+        {
+            logInputData(polygons, "Empty result returned after polygons union." , Logger::ERROR);
+            return {};
+        }
+
+        std::vector<ClipperLib::IntRect> contoursBounds = computeBounds(outerContours);
+        std::vector<std::vector<std::size_t>> contoursPolygonIndices(outerContours.size());
+        for(std::size_t i=0; i<polygons.size(); ++i)
+        {
+            std::size_t contourIndex = findContainingContour(polygonPaths[i], outerContours, contoursBounds, outerContours.size());
+            if(contourIndex < outerContours.size())
             {
-                mergedPolygons.push_back(allPolygonPaths[0].template toCSGPolygon<T>());
-                VectorEraser::erase(allPolygonPaths, 0);
+                contoursPolygonIndices[contourIndex].push_back(i);
             }
         }
 
+        std::vector<std::size_t> sortedContourIndices(outerContours.size());
+        std::iota(sortedContourIndices.begin(), sortedContourIndices.end(), 0);
+        std::stable_sort(sortedContourIndices.begin(), sortedContourIndices.end(), [&contoursPolygonIndices](std::size_t index1, std::size_t index2) {
+            std::size_t firstPolygonIndex1 = contoursPolygonIndices[index1].empty() ? std::numeric_limits<std::size_t>::max() : contoursPolygonIndices[index1][0];
+            std::size_t firstPolygonIndex2 = contoursPolygonIndices[index2].empty() ? std::numeric_limits<std::size_t>::max() : contoursPolygonIndices[index2][0];
+            return firstPolygonIndex1 < firstPolygonIndex2;
+        });
+
+        std::vector<CSGPolygon<T>> mergedPolygons;
+        mergedPolygons.reserve(outerContours.size());
+        for(std::size_t contourIndex : sortedContourIndices)
+        {
+            std::string unionName = computeUnionName(polygons, contoursPolygonIndices[contourIndex]);
+            mergedPolygons.push_back(CSGPolygonPath(outerContours[contourIndex]->Contour, unionName).template toCSGPolygon<T>());
+        }
+
         return mergedPolygons;
     }
 
-    template<class T> const std::vector<CSGPolygonPath> &PolygonsUnion<T>::unionTwoPolygonPaths(const CSGPolygonPath &polygon1, const CSGPolygonPath &polygon2) const
+    /**
+     * @return Outer contours of the union. Holes of the union and contours located inside the holes are ignored.
+     */
+    template<class T> ClipperLib::PolyNodes PolygonsUnion<T>::retrieveOuterContours(ClipperLib::PolyTree &solution) const
     {
-        ClipperLib::Clipper clipper;
-        clipper.ReverseSolution(true);
-        clipper.StrictlySimple(true); //slow but avoid duplicate points
-        clipper.AddPath(polygon1.getPath(), ClipperLib::ptSubject, true);
-        clipper.AddPath(polygon2.getPath(), ClipperLib::ptClip, true);
+        //nesting of the poly tree is not reliable with strictly simple option: all outer contours are collected
+        ClipperLib::PolyNodes allOuterContours;
+        for(ClipperLib::PolyNode *polyNode = solution.GetFirst(); polyNode != nullptr; polyNode = polyNode->GetNext())
+        {
+            assert(!polyNode->IsOpen());
+            if(!polyNode->IsHole())
+            {
+                allOuterContours.push_back(polyNode);
+            }
+        }
 
-        ClipperLib::PolyTree solution;
-        clipper.Execute(ClipperLib::ctUnion, solution, ClipperLib::pftEvenOdd, ClipperLib::pftEvenOdd);
+        std::vector<ClipperLib::IntRect> allContoursBounds = computeBounds(allOuterContours);
+        ClipperLib::PolyNodes outerContours;
+        outerContours.reserve(allOuterContours.size());
+        for(std::size_t i=0; i<allOuterContours.size(); ++i)
+        {
+            if(findContainingContour(allOuterContours[i]->Contour, allOuterContours, allContoursBounds, i) == allOuterContours.size())
+            {
+                outerContours.push_back(allOuterContours[i]);
+            }
+        }
+
+        return outerContours;
+    }
 
-        twoPolygonUnions.clear();
+    template<class T> std::vector<ClipperLib::IntRect> PolygonsUnion<T>::computeBounds(const ClipperLib::PolyNodes &contours) const
+    {
+        std::vector<ClipperLib::IntRect> contoursBounds;
+        contoursBounds.reserve(contours.size());
 
-        if(solution.Childs.size()==1)
+        for(const auto *contour : contours)
         {
-            assert(!solution.Childs[0]->IsOpen());
-            assert(!solution.Childs[0]->IsHole());
+            ClipperLib::IntRect bounds = {std::numeric_limits<ClipperLib::cInt>::max(), std::numeric_limits<ClipperLib::cInt>::max(),
+                                          std::numeric_limits<ClipperLib::cInt>::lowest(), std::numeric_limits<ClipperLib::cInt>::lowest()};
+            for(const auto &point : contour->Contour)
+            {
+                bounds.left = std::min(bounds.left, point.X);
+                bounds.top = std::min(bounds.top, point.Y);
+                bounds.right = std::max(bounds.right, point.X);
+                bounds.bottom = std::max(bounds.bottom, point.Y);
+            }
+            contoursBounds.push_back(bounds);
+        }
 
-            std::string unionName = "{" + polygon1.getName() + "} ∪ {" + polygon2.getName() + "}";
-            twoPolygonUnions.emplace_back(CSGPolygonPath(solution.Childs[0]->Contour, unionName));
-        }else if(solution.Childs.size()==2)
+        return contoursBounds;
+    }
+
+    /**
+     * @param excludedContourIndex Index of a contour to ignore. Number of contours can be provided to not exclude any contour.
+     * @return Index of the first contour containing all the points of the path (points on the contour included). Number of contours is
+     * returned when no contour found.
+     */
+    template<class T> std::size_t PolygonsUnion<T>::findContainingContour(const ClipperLib::Path &path, const ClipperLib::PolyNodes &contours,
+            const std::vector<ClipperLib::IntRect> &contoursBounds, std::size_t excludedContourIndex) const
+    {
+        for(std::size_t contourIndex=0; contourIndex<contours.size(); ++contourIndex)
         {
-            twoPolygonUnions.emplace_back(CSGPolygonPath(solution.Childs[0]->Contour, polygon1.getName()));
-            twoPolygonUnions.emplace_back(CSGPolygonPath(solution.Childs[1]->Contour, polygon2.getName()));
+            if(contourIndex != excludedContourIndex && isInsideContour(path, contours[contourIndex]->Contour, contoursBounds[contourIndex]))
+            {
+                return contourIndex;
+            }
         }
 
-        return twoPolygonUnions;
+        return contours.size();
+    }
+
+    template<class T> bool PolygonsUnion<T>::isInsideContour(const ClipperLib::Path &path, const ClipperLib::Path &contour, const ClipperLib::IntRect &contourBounds) const
+    {
+        for(const auto &point : path)
+        {
+            if(point.X < contourBounds.left || point.X > contourBounds.right || point.Y < contourBounds.top || point.Y > contourBounds.bottom
+                    || ClipperLib::PointInPolygon(point, contour) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class T> std::string PolygonsUnion<T>::computeUnionName(const std::vector<CSGPolygon<T>> &polygons, const std::vector<std::size_t> &polygonIndices) const
+    {
+        if(polygonIndices.size() == 1)
+        {
+            return polygons[polygonIndices[0]].getName();
+        }
+
+        std::string unionName;
+        for(std::size_t i=0; i<polygonIndices.size(); ++i)
+        {
+            if(i != 0)
+            {
+                unionName += " ∪ ";
+            }
+            unionName += "{" + polygons[polygonIndices[i]].getName() + "}";
+        }
+        return unionName;
     }
 
     template<class T> void PolygonsUnion<T>::logInputData(const std::vector<CSGPolygon<T>> &polygons, const std::string &message,
@@ -15,19 +15,20 @@ namespace urchin
         public:
             friend class Singleton<PolygonsUnion<T>>;
 
-            std::vector<CSGPolygon<T>> &unionPolygons(const std::vector<CSGPolygon<T>> &) const;
+            std::vector<CSGPolygon<T>> unionPolygons(const std::vector<CSGPolygon<T>> &) const;
+            std::vector<CSGPolygon<T>> unionPolygons(const std::vector<CSGPolygon<T>> &, ClipperLib::Paths &) const;
 
         private:
             PolygonsUnion() = default;
             ~PolygonsUnion() override = default;
 
-            const std::vector<CSGPolygonPath> &unionTwoPolygonPaths(const CSGPolygonPath &, const CSGPolygonPath &) const;
+            ClipperLib::PolyNodes retrieveOuterContours(ClipperLib::PolyTree &) const;
+            std::vector<ClipperLib::IntRect> computeBounds(const ClipperLib::PolyNodes &) const;
+            std::size_t findContainingContour(const ClipperLib::Path &, const ClipperLib::PolyNodes &, const std::vector<ClipperLib::IntRect> &, std::size_t) const;
+            bool isInsideContour(const ClipperLib::Path &, const ClipperLib::Path &, const ClipperLib::IntRect &) const;
+            std::string computeUnionName(const std::vector<CSGPolygon<T>> &, const std::vector<std::size_t> &) const;
 
             void logInputData(const std::vector<CSGPolygon<T>> &, const std::string &, Logger::CriticalityLevel) const;
-
-            mutable std::vector<CSGPolygon<T>> mergedPolygons;
-            mutable std::vector<CSGPolygonPath> allPolygonPaths;
-            mutable std::vector<CSGPolygonPath> twoPolygonUnions;
     };
 
 }
@@ -21,6 +21,7 @@ namespace urchin
     void NavObject::addWalkableSurface(const std::shared_ptr<PolytopeSurface> &walkableSurface)
     {
         walkableSurfaces.push_back(walkableSurface);
+        walkableSurfacesNavPolygons.emplace_back();
     }
 
     const std::vector<std::shared_ptr<PolytopeSurface>> &NavObject::getWalkableSurfaces() const
@@ -54,9 +55,24 @@ namespace urchin
         nearObjects.clear();
     }
 
-    void NavObject::addNavPolygons(const std::vector<std::shared_ptr<NavPolygon>> &navPolygonsToAdd)
+    /**
+     * @param walkableSurfaceIndex Index of the walkable surface (see getWalkableSurfaces())
+     * @param walkableSurfaceNavPolygons Navigation polygons replacing the current ones of the walkable surface
+     */
+    void NavObject::setWalkableSurfaceNavPolygons(std::size_t walkableSurfaceIndex, std::vector<std::shared_ptr<NavPolygon>> walkableSurfaceNavPolygons)
     {
-        navPolygons.insert(navPolygons.end(), navPolygonsToAdd.begin(), navPolygonsToAdd.end());
+        walkableSurfacesNavPolygons[walkableSurfaceIndex] = std::move(walkableSurfaceNavPolygons);
+
+        navPolygons.clear();
+        for(const auto &surfaceNavPolygons : walkableSurfacesNavPolygons)
+        {
+            navPolygons.insert(navPolygons.end(), surfaceNavPolygons.begin(), surfaceNavPolygons.end());
+        }
+    }
+
+    const std::vector<std::shared_ptr<NavPolygon>> &NavObject::getWalkableSurfaceNavPolygons(std::size_t walkableSurfaceIndex) const
+    {
+        return walkableSurfacesNavPolygons[walkableSurfaceIndex];
     }
 
     const std::vector<std::shared_ptr<NavPolygon>> &NavObject::getNavPolygons() const
@@ -66,6 +82,10 @@ namespace urchin
 
     void NavObject::removeAllNavPolygons()
     {
+        for(auto &surfaceNavPolygons : walkableSurfacesNavPolygons)
+        {
+            surfaceNavPolygons.clear();
+        }
         navPolygons.clear();
     }
 }
@@ -26,7 +26,8 @@ namespace urchin
             const std::vector<std::weak_ptr<NavObject>> &retrieveNearObjects();
             void removeAllNearObjects();
 
-            void addNavPolygons(const std::vector<std::shared_ptr<NavPolygon>> &);
+            void setWalkableSurfaceNavPolygons(std::size_t, std::vector<std::shared_ptr<NavPolygon>>);
+            const std::vector<std::shared_ptr<NavPolygon>> &getWalkableSurfaceNavPolygons(std::size_t) const;
             const std::vector<std::shared_ptr<NavPolygon>> &getNavPolygons() const;
             void removeAllNavPolygons();
 
@@ -34,7 +35,8 @@ namespace urchin
             std::shared_ptr<Polytope> expandedPolytope;
             std::vector<std::shared_ptr<PolytopeSurface>> walkableSurfaces;
             std::vector<std::weak_ptr<NavObject>> nearObjects; //use weak_ptr to avoid cyclic references (=memory leak) between navigation object
-            std::vector<std::shared_ptr<NavPolygon>> navPolygons;
+            std::vector<std::vector<std::shared_ptr<NavPolygon>>> walkableSurfacesNavPolygons; //navigation polygons by walkable surface index
+            std::vector<std::shared_ptr<NavPolygon>> navPolygons; //navigation polygons of all walkable surfaces
     };
 
 }
@@ -0,0 +1,53 @@
+#ifndef URCHINENGINE_COMPILEDNAVELEMENTS_H
+#define URCHINENGINE_COMPILEDNAVELEMENTS_H
+
+#include <cstdint>
+#include <memory>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/NavLink.h"
+#include "path/navmesh/model/output/topography/NavTopography.h"
+
+namespace urchin
+{
+
+    /**
+     * Polygon of a compiled navigation mesh: triangles of a polygon are consecutive in the triangles array
+     */
+    struct CompiledNavPolygon
+    {
+        unsigned int id; //see NavPolygon::getId()
+        std::uint32_t firstTriangle;
+        std::uint32_t trianglesCount;
+        std::shared_ptr<const NavTopography> navTopography;
+    };
+
+    /**
+     * Triangle of a compiled navigation mesh: links of a triangle are consecutive in the links array and in the same order as
+     * NavMesh::getTriangleLinks()
+     */
+    struct CompiledNavTriangle
+    {
+        std::uint32_t vertices[3];
+        std::uint32_t polygon;
+        std::uint32_t firstLink;
+        std::uint32_t linksCount;
+        Point3<float> centerPoint;
+    };
+
+    /**
+     * Link of a compiled navigation mesh. Standard links cover the full source edge (start range: 1.0, end range: 0.0).
+     */
+    struct CompiledNavLink
+    {
+        std::uint32_t targetTriangle;
+        NavLinkType linkType;
+        std::uint32_t sourceEdgeIndex;
+        std::uint32_t targetEdgeIndex; //only relevant for jump links
+        float sourceEdgeLinkStartRange;
+        float sourceEdgeLinkEndRange;
+    };
+
+}
+
+#endif
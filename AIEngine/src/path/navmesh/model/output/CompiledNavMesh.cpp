@@ -0,0 +1,368 @@
+#include <cassert>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "CompiledNavMesh.h"
+#include "path/navmesh/model/output/NavMesh.h"
+
+namespace urchin
+{
+
+    /**
+     * @param navMesh Navigation mesh snapshot to compile
+     */
+    CompiledNavMesh::CompiledNavMesh(const NavMesh &navMesh) :
+            removedTrianglesCount(0),
+            removedLinksCount(0),
+            lastCompiledPolygonsCount(0)
+    {
+        compileAll(navMesh);
+    }
+
+    /**
+     * Compile a navigation mesh snapshot from the compiled navigation mesh of a previous version. Only the entries and the grid cells of
+     * the changed polygons are updated: entries of the unchanged polygons are shared with the previous compiled navigation mesh which
+     * remains unchanged.
+     * @param navMesh Navigation mesh snapshot to compile
+     * @param previousCompiledNavMesh Compiled navigation mesh of a previous version of the navigation mesh
+     * @param changedPolygonIds Identifiers of the polygons removed or modified (links updated) since the previous compiled version
+     */
+    CompiledNavMesh::CompiledNavMesh(const NavMesh &navMesh, const CompiledNavMesh &previousCompiledNavMesh, const std::vector<unsigned int> &changedPolygonIds) :
+            vertices(previousCompiledNavMesh.vertices),
+            triangles(previousCompiledNavMesh.triangles),
+            links(previousCompiledNavMesh.links),
+            polygons(previousCompiledNavMesh.polygons),
+            polygonIndices(previousCompiledNavMesh.polygonIndices),
+            triangleGrid(previousCompiledNavMesh.triangleGrid),
+            removedTrianglesCount(previousCompiledNavMesh.removedTrianglesCount),
+            removedLinksCount(previousCompiledNavMesh.removedLinksCount),
+            lastCompiledPolygonsCount(0)
+    {
+        if(!compileChanges(navMesh, changedPolygonIds))
+        {
+            compileAll(navMesh);
+        }
+    }
+
+    /**
+     * @return Number of polygons entries. Entries of the removed polygons have the identifier REMOVED_POLYGON_ID and no triangle.
+     */
+    std::uint32_t CompiledNavMesh::getPolygonsCount() const
+    {
+        return toIndex(polygons.size());
+    }
+
+    const CompiledNavPolygon &CompiledNavMesh::getPolygon(std::uint32_t polygonIndex) const
+    {
+        assert(polygonIndex < polygons.size());
+        return polygons[polygonIndex];
+    }
+
+    /**
+     * @param polygonId Identifier of the polygon (see NavPolygon::getId())
+     * @return Index of the polygon. NO_INDEX is returned when the polygon doesn't exist in the navigation mesh.
+     */
+    std::uint32_t CompiledNavMesh::findPolygon(unsigned int polygonId) const
+    {
+        auto itFind = polygonIndices.find(polygonId);
+        return itFind == polygonIndices.end() ? NO_INDEX : itFind->second;
+    }
+
+    /**
+     * @return Number of triangles entries (including the unused entries of removed polygons). Triangles are indexed from 0 to this value
+     * (excluded): triangles of a polygon are consecutive
+     */
+    std::uint32_t CompiledNavMesh::getTrianglesCount() const
+    {
+        return toIndex(triangles.size());
+    }
+
+    const CompiledNavTriangle &CompiledNavMesh::getTriangle(std::uint32_t triangleIndex) const
+    {
+        assert(triangleIndex < triangles.size());
+        return triangles[triangleIndex];
+    }
+
+    /**
+     * @return Index of the triangle in its polygon. Contrary to the triangle index, this index remains valid while the polygon is not
+     * regenerated.
+     */
+    std::uint32_t CompiledNavMesh::computePolygonTriangleIndex(std::uint32_t triangleIndex) const
+    {
+        return triangleIndex - polygons[triangles[triangleIndex].polygon].firstTriangle;
+    }
+
+    const CompiledNavLink &CompiledNavMesh::getLink(std::uint32_t linkIndex) const
+    {
+        assert(linkIndex < links.size());
+        return links[linkIndex];
+    }
+
+    const Point3<float> &CompiledNavMesh::getVertex(std::uint32_t vertexIndex) const
+    {
+        assert(vertexIndex < vertices.size());
+        return vertices[vertexIndex];
+    }
+
+    /**
+     * @return Edge of the triangle starting at the vertex 'edgeStartIndex' (see NavTriangle::computeEdge())
+     */
+    LineSegment3D<float> CompiledNavMesh::computeEdge(std::uint32_t triangleIndex, std::uint32_t edgeStartIndex) const
+    {
+        assert(edgeStartIndex <= 2);
+
+        const CompiledNavTriangle &triangle = triangles[triangleIndex];
+        std::uint32_t edgeEndIndex = (edgeStartIndex + 1) % 3;
+        return LineSegment3D<float>(vertices[triangle.vertices[edgeStartIndex]], vertices[triangle.vertices[edgeEndIndex]]);
+    }
+
+    /**
+     * @return Part of the source triangle edge crossed by the link (see NavLinkConstraint::computeSourceJumpEdge())
+     */
+    LineSegment3D<float> CompiledNavMesh::computeLinkSourceEdge(std::uint32_t sourceTriangleIndex, const CompiledNavLink &link) const
+    {
+        LineSegment3D<float> sourceEdge = computeEdge(sourceTriangleIndex, link.sourceEdgeIndex);
+        if(link.linkType == NavLinkType::STANDARD)
+        {
+            return sourceEdge;
+        }
+
+        return LineSegment3D<float>(
+                link.sourceEdgeLinkStartRange * sourceEdge.getA() + (1.0f - link.sourceEdgeLinkStartRange) * sourceEdge.getB(),
+                link.sourceEdgeLinkEndRange * sourceEdge.getA() + (1.0f - link.sourceEdgeLinkEndRange) * sourceEdge.getB());
+    }
+
+    /**
+     * @return Index of the triangle containing the point on XZ plane and located just below the point. NO_INDEX is returned when no triangle found.
+     */
+    std::uint32_t CompiledNavMesh::findTriangle(const Point3<float> &point) const
+    {
+        std::size_t triangleIndex = triangleGrid.findTriangle(point);
+        return triangleIndex == NavTriangleGrid::NO_TRIANGLE ? NO_INDEX : static_cast<std::uint32_t>(triangleIndex);
+    }
+
+    /**
+     * @param radius Maximum distance on XZ plane between the point and the triangle
+     * @return Index of the nearest walkable triangle below the point in the radius. NO_INDEX is returned when no triangle found.
+     */
+    std::uint32_t CompiledNavMesh::findNearestTriangle(const Point3<float> &point, float radius) const
+    {
+        std::size_t triangleIndex = triangleGrid.findNearestTriangle(point, radius);
+        return triangleIndex == NavTriangleGrid::NO_TRIANGLE ? NO_INDEX : static_cast<std::uint32_t>(triangleIndex);
+    }
+
+    /**
+     * @return Number of polygons compiled by the last compilation (other polygons are shared with the previous compiled version)
+     */
+    std::uint32_t CompiledNavMesh::getLastCompiledPolygonsCount() const
+    {
+        return lastCompiledPolygonsCount;
+    }
+
+    void CompiledNavMesh::compileAll(const NavMesh &navMesh)
+    {
+        const std::vector<std::shared_ptr<NavPolygon>> &navPolygons = navMesh.getPolygons();
+
+        vertices.clear();
+        triangles.clear();
+        links.clear();
+        polygons.clear();
+        polygonIndices.clear();
+        polygonIndices.reserve(navPolygons.size());
+        removedTrianglesCount = 0;
+        removedLinksCount = 0;
+
+        //polygons are appended first: links can target triangles of any polygon
+        for(const auto &navPolygon : navPolygons)
+        {
+            appendPolygon(*navPolygon);
+        }
+        for(std::size_t polygonIndex = 0; polygonIndex < navPolygons.size(); ++polygonIndex)
+        {
+            compileLinks(navMesh, polygonIndex, toIndex(polygonIndex));
+        }
+
+        triangleGrid.build(vertices, triangles);
+        lastCompiledPolygonsCount = toIndex(navPolygons.size());
+    }
+
+    /**
+     * @return False when a full compilation is required: the grid bounds don't cover the new polygons or the removed entries become
+     * more numerous than the used entries
+     */
+    bool CompiledNavMesh::compileChanges(const NavMesh &navMesh, const std::vector<unsigned int> &changedPolygonIds)
+    {
+        const std::vector<std::shared_ptr<NavPolygon>> &navPolygons = navMesh.getPolygons();
+        if(triangles.size() == removedTrianglesCount)
+        { //no grid bounds
+            return false;
+        }
+
+        std::unordered_set<unsigned int> changedPolygonIdsSet(changedPolygonIds.begin(), changedPolygonIds.end());
+        std::vector<std::uint32_t> compiledPolygonIndices(navPolygons.size(), NO_INDEX);
+        std::vector<bool> linksToCompile(navPolygons.size(), false);
+        std::unordered_set<unsigned int> polygonIds;
+        polygonIds.reserve(navPolygons.size());
+        for(std::size_t polygonIndex = 0; polygonIndex < navPolygons.size(); ++polygonIndex)
+        {
+            const std::shared_ptr<NavPolygon> &navPolygon = navPolygons[polygonIndex];
+            polygonIds.insert(navPolygon->getId());
+            compiledPolygonIndices[polygonIndex] = findPolygon(navPolygon->getId());
+            linksToCompile[polygonIndex] = changedPolygonIdsSet.find(navPolygon->getId()) != changedPolygonIdsSet.end();
+            if(compiledPolygonIndices[polygonIndex] == NO_INDEX)
+            {
+                linksToCompile[polygonIndex] = true;
+                for(const auto &point : navPolygon->getPoints())
+                {
+                    if(!triangleGrid.isInsideBounds(point))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        std::vector<unsigned int> removedPolygonIds;
+        for(const auto &polygonIndex : polygonIndices)
+        {
+            if(polygonIds.find(polygonIndex.first) == polygonIds.end())
+            {
+                removedPolygonIds.push_back(polygonIndex.first);
+            }
+        }
+        for(unsigned int removedPolygonId : removedPolygonIds)
+        {
+            removePolygon(removedPolygonId);
+        }
+
+        //new polygons are appended first: links can target triangles of any new polygon
+        for(std::size_t polygonIndex = 0; polygonIndex < navPolygons.size(); ++polygonIndex)
+        {
+            if(compiledPolygonIndices[polygonIndex] == NO_INDEX)
+            {
+                std::uint32_t firstNewTriangle = toIndex(triangles.size());
+                compiledPolygonIndices[polygonIndex] = appendPolygon(*navPolygons[polygonIndex]);
+                for(std::uint32_t triangleIndex = firstNewTriangle; triangleIndex < triangles.size(); ++triangleIndex)
+                {
+                    triangleGrid.addTriangle(triangleIndex, vertices, triangles[triangleIndex]);
+                }
+            }
+        }
+
+        lastCompiledPolygonsCount = 0;
+        for(std::size_t polygonIndex = 0; polygonIndex < navPolygons.size(); ++polygonIndex)
+        {
+            if(linksToCompile[polygonIndex])
+            {
+                compileLinks(navMesh, polygonIndex, compiledPolygonIndices[polygonIndex]);
+                lastCompiledPolygonsCount++;
+            }
+        }
+
+        return removedTrianglesCount * 2 <= triangles.size() && removedLinksCount * 2 <= links.size();
+    }
+
+    /**
+     * Mark the entries of the polygon as unused and remove its triangles from the grid
+     */
+    void CompiledNavMesh::removePolygon(unsigned int polygonId)
+    {
+        auto itPolygonIndex = polygonIndices.find(polygonId);
+        CompiledNavPolygon &polygon = polygons.edit(itPolygonIndex->second);
+        for(std::uint32_t triangleIndex = polygon.firstTriangle; triangleIndex < polygon.firstTriangle + polygon.trianglesCount; ++triangleIndex)
+        {
+            triangleGrid.removeTriangle(triangleIndex);
+            removedLinksCount += triangles[triangleIndex].linksCount;
+        }
+        removedTrianglesCount += polygon.trianglesCount;
+
+        polygon.id = REMOVED_POLYGON_ID;
+        polygon.trianglesCount = 0;
+        polygon.navTopography = nullptr;
+        polygonIndices.erase(itPolygonIndex);
+    }
+
+    /**
+     * Append the vertices, the triangles (without links) and the polygon entry
+     * @return Index of the appended polygon
+     */
+    std::uint32_t CompiledNavMesh::appendPolygon(const NavPolygon &navPolygon)
+    {
+        std::uint32_t polygonIndex = toIndex(polygons.size());
+        std::uint32_t firstVertex = toIndex(vertices.size());
+        polygonIndices[navPolygon.getId()] = polygonIndex;
+        polygons.pushBack({navPolygon.getId(), toIndex(triangles.size()), toIndex(navPolygon.getTriangles().size()), navPolygon.getNavTopography()});
+
+        for(const auto &point : navPolygon.getPoints())
+        {
+            vertices.pushBack(point);
+        }
+        for(const auto &navTriangle : navPolygon.getTriangles())
+        {
+            CompiledNavTriangle triangle = {};
+            for(std::size_t i=0; i<3; ++i)
+            {
+                triangle.vertices[i] = firstVertex + toIndex(navTriangle->getIndex(i));
+            }
+            triangle.polygon = polygonIndex;
+            triangle.firstLink = toIndex(links.size());
+            triangle.linksCount = 0;
+            triangle.centerPoint = navTriangle->getCenterPoint();
+            triangles.pushBack(triangle);
+        }
+
+        return polygonIndex;
+    }
+
+    /**
+     * Append the links of the polygon triangles. Links previously compiled for these triangles become unused.
+     * @param navPolygonIndex Index of the polygon in the navigation mesh
+     * @param polygonIndex Index of the polygon in the compiled navigation mesh
+     */
+    void CompiledNavMesh::compileLinks(const NavMesh &navMesh, std::size_t navPolygonIndex, std::uint32_t polygonIndex)
+    {
+        const CompiledNavPolygon &polygon = polygons[polygonIndex];
+        for(std::uint32_t polygonTriangleIndex = 0; polygonTriangleIndex < polygon.trianglesCount; ++polygonTriangleIndex)
+        {
+            const std::vector<std::shared_ptr<NavLink>> &navLinks = navMesh.getTriangleLinks(navPolygonIndex, polygonTriangleIndex);
+
+            CompiledNavTriangle &triangle = triangles.edit(polygon.firstTriangle + polygonTriangleIndex);
+            removedLinksCount += triangle.linksCount;
+            triangle.firstLink = toIndex(links.size());
+            triangle.linksCount = toIndex(navLinks.size());
+
+            for(const auto &navLink : navLinks)
+            {
+                const std::shared_ptr<NavTriangle> &targetTriangle = navLink->getTargetTriangle();
+                const CompiledNavPolygon &targetPolygon = polygons[polygonIndices.at(targetTriangle->getNavPolygon()->getId())];
+
+                CompiledNavLink link = {};
+                link.targetTriangle = targetPolygon.firstTriangle + toIndex(targetTriangle->getPolygonTriangleIndex());
+                link.linkType = navLink->getLinkType();
+                link.sourceEdgeIndex = navLink->getSourceEdgeIndex();
+                if(link.linkType != NavLinkType::STANDARD)
+                {
+                    link.targetEdgeIndex = static_cast<std::uint32_t>(navLink->getLinkConstraint()->getTargetEdgeIndex());
+                    link.sourceEdgeLinkStartRange = navLink->getLinkConstraint()->getSourceEdgeLinkStartRange();
+                    link.sourceEdgeLinkEndRange = navLink->getLinkConstraint()->getSourceEdgeLinkEndRange();
+                }else
+                {
+                    link.targetEdgeIndex = 0;
+                    link.sourceEdgeLinkStartRange = 1.0f;
+                    link.sourceEdgeLinkEndRange = 0.0f;
+                }
+                links.pushBack(link);
+            }
+        }
+    }
+
+    std::uint32_t CompiledNavMesh::toIndex(std::size_t value)
+    {
+        if(value >= NO_INDEX)
+        {
+            throw std::overflow_error("Navigation mesh too large to be indexed on 32 bits: " + std::to_string(value));
+        }
+        return static_cast<std::uint32_t>(value);
+    }
+
+}
@@ -0,0 +1,79 @@
+#ifndef URCHINENGINE_COMPILEDNAVMESH_H
+#define URCHINENGINE_COMPILEDNAVMESH_H
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/CompiledNavElements.h"
+#include "path/navmesh/model/output/NavTriangleGrid.h"
+#include "path/navmesh/model/output/SharedChunkArray.h"
+
+namespace urchin
+{
+
+    class NavMesh;
+    class NavPolygon;
+
+    /**
+     * Immutable and flat representation of a navigation mesh used by the path finding. Vertices, triangles, links and polygons are stored
+     * in contiguous arrays and reference each other by 32 bits indices: a search follows the links without pointer chasing nor shared
+     * pointer reference counting.
+     * A compiled navigation mesh can be built from the compiled navigation mesh of a previous version: entries of the unchanged polygons
+     * keep their indices and their memory is shared between both versions. Entries of the removed polygons remain as unused entries
+     * (polygon identifier: REMOVED_POLYGON_ID) until the garbage justifies a full compilation.
+     */
+    class CompiledNavMesh
+    {
+        public:
+            explicit CompiledNavMesh(const NavMesh &);
+            CompiledNavMesh(const NavMesh &, const CompiledNavMesh &, const std::vector<unsigned int> &);
+
+            static constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+            static constexpr unsigned int REMOVED_POLYGON_ID = 0;
+
+            std::uint32_t getPolygonsCount() const;
+            const CompiledNavPolygon &getPolygon(std::uint32_t) const;
+            std::uint32_t findPolygon(unsigned int) const;
+
+            std::uint32_t getTrianglesCount() const;
+            const CompiledNavTriangle &getTriangle(std::uint32_t) const;
+            std::uint32_t computePolygonTriangleIndex(std::uint32_t) const;
+
+            const CompiledNavLink &getLink(std::uint32_t) const;
+            const Point3<float> &getVertex(std::uint32_t) const;
+
+            LineSegment3D<float> computeEdge(std::uint32_t, std::uint32_t) const;
+            LineSegment3D<float> computeLinkSourceEdge(std::uint32_t, const CompiledNavLink &) const;
+
+            std::uint32_t findTriangle(const Point3<float> &) const;
+            std::uint32_t findNearestTriangle(const Point3<float> &, float) const;
+
+            std::uint32_t getLastCompiledPolygonsCount() const;
+
+        private:
+            void compileAll(const NavMesh &);
+            bool compileChanges(const NavMesh &, const std::vector<unsigned int> &);
+            void removePolygon(unsigned int);
+            std::uint32_t appendPolygon(const NavPolygon &);
+            void compileLinks(const NavMesh &, std::size_t, std::uint32_t);
+            static std::uint32_t toIndex(std::size_t);
+
+            SharedChunkArray<Point3<float>> vertices;
+            SharedChunkArray<CompiledNavTriangle> triangles;
+            SharedChunkArray<CompiledNavLink> links;
+            SharedChunkArray<CompiledNavPolygon> polygons;
+            std::unordered_map<unsigned int, std::uint32_t> polygonIndices; //polygon index by polygon id
+            NavTriangleGrid triangleGrid;
+
+            std::uint32_t removedTrianglesCount; //triangles of the removed polygons
+            std::uint32_t removedLinksCount; //links of the removed polygons and replaced links
+            std::uint32_t lastCompiledPolygonsCount;
+    };
+
+}
+
+#endif
@@ -1,24 +1,47 @@
+#include <unordered_set>
 #include "UrchinCommon.h"
 
 #include "NavMesh.h"
-#include "path/navmesh/model/NavModelCopy.h"
 
 namespace urchin
 {
 
     //static
+    std::atomic_uint NavMesh::nextId(0);
     unsigned int NavMesh::nextUpdateId = 0;
 
     NavMesh::NavMesh() :
-        updateId(0)
+        id(++nextId),
+        updateId(0),
+        lastCopiedPolygonsCount(0)
     {
 
     }
 
+    /**
+     * Copy the navigation mesh in constant time: polygons and links are shared with the copied navigation mesh
+     */
     NavMesh::NavMesh(const NavMesh &navMesh) :
-        updateId(navMesh.getUpdateId())
+        id(navMesh.getId()),
+        updateId(navMesh.getUpdateId()),
+        polygons(navMesh.polygons),
+        polygonsLinks(navMesh.polygonsLinks),
+        changedPolygonIds(navMesh.getChangedPolygonIds()),
+        lastCopiedPolygonsCount(navMesh.getLastCopiedPolygonsCount())
     {
-        NavModelCopy::copyNavPolygons(navMesh.getPolygons(), polygons);
+        std::lock_guard<std::mutex> lock(navMesh.compiledNavMeshMutex);
+        compiledNavMesh = navMesh.compiledNavMesh;
+        previousCompiledNavMesh = navMesh.previousCompiledNavMesh;
+        uncompiledChangedPolygonIds = navMesh.uncompiledChangedPolygonIds;
+    }
+
+    /**
+     * @return Identifier of the navigation mesh. Identifier is shared by all the versions (copies) of the navigation mesh: navigation
+     * meshes of different agents have different identifiers.
+     */
+    unsigned int NavMesh::getId() const
+    {
+        return id;
     }
 
     unsigned int NavMesh::getUpdateId() const
@@ -26,12 +49,73 @@ namespace urchin
         return updateId;
     }
 
-    void NavMesh::copyAllPolygons(const std::vector<std::shared_ptr<NavPolygon>> &allPolygons)
+    /**
+     * Create a new version of the navigation mesh. Polygons not present in the previous version are copied. Links of the polygons
+     * present in 'changedPolygonIds' are copied. Other polygons and links are shared with the previous version.
+     * @param allPolygons All polygons of the navigation mesh. A polygon must keep the same points and triangles as long as its identifier
+     * is unchanged (see NavPolygon::getId()).
+     * @param changedPolygonIds Identifiers of the polygons removed or modified (links updated) since the previous copy
+     */
+    void NavMesh::copyAllPolygons(const std::vector<std::shared_ptr<NavPolygon>> &allPolygons, const std::vector<unsigned int> &changedPolygonIds)
     {
         changeUpdateId();
+        this->changedPolygonIds = changedPolygonIds;
+
+        std::unordered_map<unsigned int, std::size_t> previousPolygonIndices;
+        previousPolygonIndices.reserve(polygons.size());
+        for(std::size_t previousPolygonIndex=0; previousPolygonIndex<polygons.size(); ++previousPolygonIndex)
+        {
+            previousPolygonIndices[polygons[previousPolygonIndex]->getId()] = previousPolygonIndex;
+        }
+        std::unordered_set<unsigned int> changedPolygonIdsSet(changedPolygonIds.begin(), changedPolygonIds.end());
+
+        std::vector<std::shared_ptr<NavPolygon>> newPolygons;
+        std::vector<std::shared_ptr<const TrianglesLinks>> newPolygonsLinks;
+        std::unordered_map<unsigned int, std::size_t> newPolygonIndices;
+        newPolygons.reserve(allPolygons.size());
+        newPolygonsLinks.reserve(allPolygons.size());
+        newPolygonIndices.reserve(allPolygons.size());
+        lastCopiedPolygonsCount = 0;
+        for(const auto &polygon : allPolygons)
+        {
+            newPolygonIndices[polygon->getId()] = newPolygons.size();
 
-        polygons.clear();
-        NavModelCopy::copyNavPolygons(allPolygons, polygons);
+            auto itPrevious = previousPolygonIndices.find(polygon->getId());
+            if(itPrevious != previousPolygonIndices.end())
+            {
+                newPolygons.push_back(polygons[itPrevious->second]);
+                bool linksChanged = changedPolygonIdsSet.find(polygon->getId()) != changedPolygonIdsSet.end();
+                newPolygonsLinks.push_back(linksChanged ? nullptr : polygonsLinks[itPrevious->second]);
+            }else
+            { //new polygon: copy of points and triangles (without links)
+                auto copiedPolygon = std::make_shared<NavPolygon>(*polygon);
+                for(const auto &copiedTriangle : copiedPolygon->getTriangles())
+                {
+                    copiedTriangle->attachNavPolygon(copiedPolygon);
+                }
+                newPolygons.push_back(copiedPolygon);
+                newPolygonsLinks.push_back(nullptr);
+                lastCopiedPolygonsCount++;
+            }
+        }
+
+        polygons = std::move(newPolygons);
+        for(std::size_t polygonIndex=0; polygonIndex<allPolygons.size(); ++polygonIndex)
+        {
+            if(!newPolygonsLinks[polygonIndex])
+            {
+                newPolygonsLinks[polygonIndex] = copyTrianglesLinks(*allPolygons[polygonIndex], newPolygonIndices);
+            }
+        }
+        polygonsLinks = std::move(newPolygonsLinks);
+
+        std::lock_guard<std::mutex> lock(compiledNavMeshMutex);
+        if(compiledNavMesh)
+        {
+            previousCompiledNavMesh = std::move(compiledNavMesh);
+            uncompiledChangedPolygonIds.clear();
+        }
+        uncompiledChangedPolygonIds.insert(uncompiledChangedPolygonIds.end(), changedPolygonIds.begin(), changedPolygonIds.end());
     }
 
     const std::vector<std::shared_ptr<NavPolygon>> &NavMesh::getPolygons() const
@@ -39,6 +123,56 @@ namespace urchin
         return polygons;
     }
 
+    /**
+     * @param polygonIndex Index of the polygon in getPolygons()
+     * @param triangleIndex Index of the triangle in the polygon
+     * @return Links of the triangle. Target triangles of the links are triangles of this navigation mesh.
+     */
+    const std::vector<std::shared_ptr<NavLink>> &NavMesh::getTriangleLinks(std::size_t polygonIndex, std::size_t triangleIndex) const
+    {
+        return (*polygonsLinks[polygonIndex])[triangleIndex];
+    }
+
+    /**
+     * @return Identifiers of the polygons removed or modified by the last update of the navigation mesh. Polygons of the navigation
+     * mesh not present in this list are identical to the ones of the previous update.
+     */
+    const std::vector<unsigned int> &NavMesh::getChangedPolygonIds() const
+    {
+        return changedPolygonIds;
+    }
+
+    /**
+     * @return Number of polygons copied by the last update of the navigation mesh (other polygons are shared with the previous version)
+     */
+    unsigned int NavMesh::getLastCopiedPolygonsCount() const
+    {
+        return lastCopiedPolygonsCount;
+    }
+
+    /**
+     * @return Compiled navigation mesh of the current version. The compiled navigation mesh is immutable: it remains valid (and
+     * unchanged) for the owners of the pointer when a new version is created. Only the polygons changed since the previous compiled
+     * version are compiled.
+     */
+    std::shared_ptr<const CompiledNavMesh> NavMesh::getCompiledNavMesh() const
+    {
+        std::lock_guard<std::mutex> lock(compiledNavMeshMutex);
+        if(!compiledNavMesh)
+        {
+            if(previousCompiledNavMesh)
+            {
+                compiledNavMesh = std::make_shared<const CompiledNavMesh>(*this, *previousCompiledNavMesh, uncompiledChangedPolygonIds);
+                previousCompiledNavMesh = nullptr;
+            }else
+            {
+                compiledNavMesh = std::make_shared<const CompiledNavMesh>(*this);
+            }
+            uncompiledChangedPolygonIds.clear();
+        }
+        return compiledNavMesh;
+    }
+
     void NavMesh::svgMeshExport(const std::string &filename) const
     {
         SVGExporter svgExporter(filename);
@@ -62,11 +196,11 @@ namespace urchin
             }
         }
 
-        for(const auto &polygon : polygons)
+        for(std::size_t polygonIndex=0; polygonIndex<polygons.size(); ++polygonIndex)
         {
-            for (const auto &triangle : polygon->getTriangles())
+            for(const auto &triangle : polygons[polygonIndex]->getTriangles())
             {
-                for(const auto &link : triangle->getLinks())
+                for(const auto &link : getTriangleLinks(polygonIndex, triangle->getPolygonTriangleIndex()))
                 {
                     Point3<float> lineP1 = triangle->getCenterPoint();
                     Point3<float> lineP2 = link->getTargetTriangle()->getCenterPoint();
@@ -87,4 +221,28 @@ namespace urchin
         updateId = ++nextUpdateId;
         return updateId;
     }
+
+    /**
+     * @param polygon Polygon of the navigation mesh generator: links target triangles of other generator polygons
+     * @param polygonIndices Indices of the polygons in this version by polygon identifier
+     * @return Copy of the links where target triangles are replaced by the triangles of this version
+     */
+    std::shared_ptr<const NavMesh::TrianglesLinks> NavMesh::copyTrianglesLinks(const NavPolygon &polygon, const std::unordered_map<unsigned int, std::size_t> &polygonIndices) const
+    {
+        auto trianglesLinks = std::make_shared<TrianglesLinks>();
+        trianglesLinks->reserve(polygon.getTriangles().size());
+        for(const auto &triangle : polygon.getTriangles())
+        {
+            std::vector<std::shared_ptr<NavLink>> copiedLinks;
+            copiedLinks.reserve(triangle->getLinks().size());
+            for(const auto &link : triangle->getLinks())
+            {
+                std::shared_ptr<NavTriangle> targetTriangle = link->getTargetTriangle();
+                std::size_t targetPolygonIndex = polygonIndices.at(targetTriangle->getNavPolygon()->getId());
+                copiedLinks.push_back(link->copyLink(polygons[targetPolygonIndex]->getTriangle(targetTriangle->getPolygonTriangleIndex())));
+            }
+            trianglesLinks->push_back(std::move(copiedLinks));
+        }
+        return trianglesLinks;
+    }
 }
@@ -3,34 +3,63 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
 
 #include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/model/output/NavLink.h"
+#include "path/navmesh/model/output/CompiledNavMesh.h"
 
 namespace urchin
 {
 
     /**
      * Navigation mesh of world which can be used to do path finding, etc.
+     * A navigation mesh is a versioned snapshot: polygons and links are never modified once copied. Unchanged polygons and links are
+     * shared between the versions and a copy of a navigation mesh shares all of them. Triangles of the polygons don't hold the links:
+     * links are retrieved with getTriangleLinks().
+     * Path finding reads only the compiled navigation mesh: a flat representation built on first access from the compiled navigation
+     * mesh of the previous version.
      */
     class NavMesh
     {
         public:
             NavMesh();
             NavMesh(const NavMesh &);
+            NavMesh &operator=(const NavMesh &) = delete;
 
+            unsigned int getId() const;
             unsigned int getUpdateId() const;
 
-            void copyAllPolygons(const std::vector<std::shared_ptr<NavPolygon>> &);
+            void copyAllPolygons(const std::vector<std::shared_ptr<NavPolygon>> &, const std::vector<unsigned int> &);
             const std::vector<std::shared_ptr<NavPolygon>> &getPolygons() const;
+            const std::vector<std::shared_ptr<NavLink>> &getTriangleLinks(std::size_t, std::size_t) const;
+            const std::vector<unsigned int> &getChangedPolygonIds() const;
+            unsigned int getLastCopiedPolygonsCount() const;
+            std::shared_ptr<const CompiledNavMesh> getCompiledNavMesh() const;
 
             void svgMeshExport(const std::string &) const;
         private:
+            using TrianglesLinks = std::vector<std::vector<std::shared_ptr<NavLink>>>; //links by triangle index of a polygon
+
             unsigned int changeUpdateId();
+            std::shared_ptr<const TrianglesLinks> copyTrianglesLinks(const NavPolygon &, const std::unordered_map<unsigned int, std::size_t> &) const;
 
+            static std::atomic_uint nextId; //navigation meshes of the agents are created in parallel
             static unsigned int nextUpdateId;
+            const unsigned int id;
             unsigned int updateId;
 
             std::vector<std::shared_ptr<NavPolygon>> polygons;
+            std::vector<std::shared_ptr<const TrianglesLinks>> polygonsLinks; //links by polygon index
+            std::vector<unsigned int> changedPolygonIds;
+            unsigned int lastCopiedPolygonsCount;
+
+            mutable std::mutex compiledNavMeshMutex;
+            mutable std::shared_ptr<const CompiledNavMesh> compiledNavMesh;
+            mutable std::shared_ptr<const CompiledNavMesh> previousCompiledNavMesh;
+            mutable std::vector<unsigned int> uncompiledChangedPolygonIds; //changed polygons since the previous compiled navigation mesh
     };
 
 }
@@ -5,7 +5,11 @@
 namespace urchin
 {
 
+    //static
+    std::atomic_uint NavPolygon::nextId(0);
+
     NavPolygon::NavPolygon(std::string name, std::vector<Point3<float>> &&points, std::shared_ptr<const NavTopography> navTopography) :
+            id(nextId.fetch_add(1, std::memory_order_relaxed) + 1),
             name(std::move(name)),
             points(std::move(points)),
             navTopography(std::move(navTopography))
@@ -14,7 +18,9 @@ namespace urchin
     }
 
     NavPolygon::NavPolygon(const NavPolygon &navPolygon) :
+            id(navPolygon.getId()),
             name(navPolygon.getName()),
+            walkableSurfaceName(navPolygon.getWalkableSurfaceName()),
             points(navPolygon.getPoints()),
             navTopography(navPolygon.getNavTopography())
     {
@@ -24,11 +30,34 @@ namespace urchin
         }
     }
 
+    /**
+     * @return Identifier of the polygon. A copy of the polygon has the same identifier while a new polygon (e.g.: polygon regenerated
+     * after a world change) has a new identifier.
+     */
+    unsigned int NavPolygon::getId() const
+    {
+        return id;
+    }
+
     const std::string &NavPolygon::getName() const
     {
         return name;
     }
 
+    /**
+     * @param walkableSurfaceName Name of the walkable surface from which the polygon is generated: identifies the polygon in a baked
+     * navigation mesh
+     */
+    void NavPolygon::setWalkableSurfaceName(std::string walkableSurfaceName)
+    {
+        this->walkableSurfaceName = std::move(walkableSurfaceName);
+    }
+
+    const std::string &NavPolygon::getWalkableSurfaceName() const
+    {
+        return walkableSurfaceName;
+    }
+
     const std::vector<Point3<float>> &NavPolygon::getPoints() const
     {
         return points;
@@ -44,9 +73,10 @@ namespace urchin
         assert(thisNavPolygon.get()==this);
 
         this->triangles = triangles;
-        for(const auto &triangle : triangles)
+        for(std::size_t triangleIndex=0; triangleIndex<triangles.size(); ++triangleIndex)
         {
-            triangle->attachNavPolygon(thisNavPolygon);
+            triangles[triangleIndex]->setPolygonTriangleIndex(triangleIndex);
+            triangles[triangleIndex]->attachNavPolygon(thisNavPolygon);
         }
     }
 
@@ -95,4 +125,12 @@ namespace urchin
         }
     }
 
+    void NavPolygon::removeExternalLinks()
+    {
+        for(const auto &triangle : triangles)
+        {
+            triangle->removeExternalLinks();
+        }
+    }
+
 }
@@ -2,6 +2,7 @@
 #define URCHINENGINE_NAVPOLYGON_H
 
 #include <vector>
+#include <atomic>
 #include "UrchinCommon.h"
 
 #include "path/navmesh/model/output/NavTriangle.h"
@@ -17,8 +18,12 @@ namespace urchin
             NavPolygon(std::string, std::vector<Point3<float>> &&, std::shared_ptr<const NavTopography>);
             NavPolygon(const NavPolygon &);
 
+            unsigned int getId() const;
             const std::string &getName() const;
 
+            void setWalkableSurfaceName(std::string);
+            const std::string &getWalkableSurfaceName() const;
+
             const std::vector<Point3<float>> &getPoints() const;
             const Point3<float> &getPoint(unsigned int) const;
 
@@ -30,9 +35,13 @@ namespace urchin
             const std::vector<NavPolygonEdge> &retrieveExternalEdges() const;
 
             void removeLinksTo(const std::shared_ptr<NavPolygon> &);
+            void removeExternalLinks();
 
         private:
+            static std::atomic_uint nextId; //polygons are created in parallel by the navigation mesh generator
+            unsigned int id; //unique identifier kept by the copies of the polygon
             std::string name;
+            std::string walkableSurfaceName;
 
             std::vector<Point3<float>> points;
             std::vector<std::shared_ptr<NavTriangle>> triangles;
@@ -10,7 +10,8 @@ namespace urchin
      * Indices of points in CCW order when looked from top
      */
     NavTriangle::NavTriangle(std::size_t index1, std::size_t index2, std::size_t index3) :
-            indices()
+            indices(),
+            polygonTriangleIndex(0)
     {
         assert(index1!=index2 && index1!=index3 && index2!=index3);
 
@@ -24,7 +25,8 @@ namespace urchin
     }
 
     NavTriangle::NavTriangle(const NavTriangle &navTriangle) :
-            indices()
+            indices(),
+            polygonTriangleIndex(navTriangle.getPolygonTriangleIndex())
     {
         this->indices[0] = navTriangle.getIndex(0);
         this->indices[1] = navTriangle.getIndex(1);
@@ -55,6 +57,19 @@ namespace urchin
         return centerPoint;
     }
 
+    /**
+     * @param polygonTriangleIndex Index of the triangle in its polygon (see NavPolygon::getTriangle())
+     */
+    void NavTriangle::setPolygonTriangleIndex(std::size_t polygonTriangleIndex)
+    {
+        this->polygonTriangleIndex = polygonTriangleIndex;
+    }
+
+    std::size_t NavTriangle::getPolygonTriangleIndex() const
+    {
+        return polygonTriangleIndex;
+    }
+
     /**
      * @return Indices of points in CCW order when looked from top
      */
@@ -103,7 +118,19 @@ namespace urchin
                 }), links.end());
     }
 
-    std::vector<std::shared_ptr<NavLink>> NavTriangle::getLinks() const
+    /**
+     * Remove the links toward the other polygons (join polygons and jump links)
+     */
+    void NavTriangle::removeExternalLinks()
+    {
+        links.erase(std::remove_if(links.begin(), links.end(),
+                [](const std::shared_ptr<NavLink>& link)
+                {
+                    return link->getLinkType() != NavLinkType::STANDARD;
+                }), links.end());
+    }
+
+    const std::vector<std::shared_ptr<NavLink>> &NavTriangle::getLinks() const
     {
         return links;
     }
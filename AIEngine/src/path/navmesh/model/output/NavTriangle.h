@@ -23,6 +23,9 @@ namespace urchin
             std::shared_ptr<NavPolygon> getNavPolygon() const;
             const Point3<float> &getCenterPoint() const;
 
+            void setPolygonTriangleIndex(std::size_t);
+            std::size_t getPolygonTriangleIndex() const;
+
             const std::size_t *getIndices() const;
             std::size_t getIndex(std::size_t) const;
 
@@ -31,7 +34,8 @@ namespace urchin
             void addJumpLink(std::size_t, const std::shared_ptr<NavTriangle> &, NavLinkConstraint *);
             void addLink(const std::shared_ptr<NavLink> &);
             void removeLinksTo(const std::shared_ptr<NavPolygon> &);
-            std::vector<std::shared_ptr<NavLink>> getLinks() const;
+            void removeExternalLinks();
+            const std::vector<std::shared_ptr<NavLink>> &getLinks() const;
 
             bool hasEdgeLinks(std::size_t) const;
             bool isExternalEdge(std::size_t) const;
@@ -46,6 +50,7 @@ namespace urchin
             std::vector<std::shared_ptr<NavLink>> links;
 
             Point3<float> centerPoint;
+            std::size_t polygonTriangleIndex;
     };
 
 }
@@ -0,0 +1,260 @@
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+
+#include "NavTriangleGrid.h"
+
+namespace urchin
+{
+
+    //static
+    const std::size_t NavTriangleGrid::NO_TRIANGLE = std::numeric_limits<std::size_t>::max();
+
+    NavTriangleGrid::NavTriangleGrid() :
+            gridMin(Point2<float>(0.0f, 0.0f)),
+            invCellSize(1.0f),
+            cellsCountX(0),
+            cellsCountZ(0)
+    {
+
+    }
+
+    /**
+     * Define bounds of the grid from the triangles and fill the cells
+     * @param vertices Vertices of the compiled navigation mesh
+     * @param triangles Triangles of the compiled navigation mesh
+     */
+    void NavTriangleGrid::build(const SharedChunkArray<Point3<float>> &vertices, const SharedChunkArray<CompiledNavTriangle> &triangles)
+    {
+        gridTriangles.clear();
+        cells.clear();
+        cellsCountX = cellsCountZ = 0;
+        if(triangles.empty())
+        {
+            return;
+        }
+
+        //flat copy of triangles points on XZ plane
+        gridTriangles.reserve(triangles.size());
+        Point2<float> gridMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+        gridMin = Point2<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        for(std::size_t triangleIndex=0; triangleIndex<triangles.size(); ++triangleIndex)
+        {
+            GridTriangle gridTriangle = toGridTriangle(vertices, triangles[triangleIndex]);
+            for(const auto &point : gridTriangle.points)
+            {
+                gridMin = Point2<float>(std::min(gridMin.X, point.X), std::min(gridMin.Y, point.Y));
+                gridMax = Point2<float>(std::max(gridMax.X, point.X), std::max(gridMax.Y, point.Y));
+            }
+            gridTriangles.pushBack(gridTriangle);
+        }
+
+        //cell size for about one triangle by cell
+        float sizeX = std::max(gridMax.X - gridMin.X, std::numeric_limits<float>::epsilon());
+        float sizeZ = std::max(gridMax.Y - gridMin.Y, std::numeric_limits<float>::epsilon());
+        float cellSize = std::sqrt((sizeX * sizeZ) / (float)triangles.size());
+        cellSize = std::max(cellSize, std::max(sizeX, sizeZ) / (float)NAV_TRIANGLE_GRID_MAX_CELLS_BY_SIDE);
+        invCellSize = 1.0f / cellSize;
+        cellsCountX = std::min((std::size_t)(sizeX * invCellSize) + 1, (std::size_t)NAV_TRIANGLE_GRID_MAX_CELLS_BY_SIDE);
+        cellsCountZ = std::min((std::size_t)(sizeZ * invCellSize) + 1, (std::size_t)NAV_TRIANGLE_GRID_MAX_CELLS_BY_SIDE);
+
+        cells.reserve(cellsCountX * cellsCountZ);
+        for(std::size_t cellIndex=0; cellIndex<cellsCountX * cellsCountZ; ++cellIndex)
+        {
+            cells.pushBack(std::vector<std::size_t>());
+        }
+        for(std::size_t triangleIndex=0; triangleIndex<gridTriangles.size(); ++triangleIndex)
+        {
+            updateCells(triangleIndex, true);
+        }
+    }
+
+    /**
+     * @return True when the point is inside the bounds of the grid on XZ plane. A triangle added outside the bounds is referenced by the
+     * border cells: search remains correct but slower.
+     */
+    bool NavTriangleGrid::isInsideBounds(const Point3<float> &point) const
+    {
+        float cellX = (point.X - gridMin.X) * invCellSize;
+        float cellZ = (point.Z - gridMin.Y) * invCellSize;
+        return cellX >= 0.0f && cellX < (float)cellsCountX && cellZ >= 0.0f && cellZ < (float)cellsCountZ;
+    }
+
+    /**
+     * Add a triangle in the cells it overlaps. Only these cells are copied when they are shared with another grid.
+     * @param triangleIndex Index of the triangle: triangles must be added in the order of their index after the triangles of the build
+     */
+    void NavTriangleGrid::addTriangle(std::size_t triangleIndex, const SharedChunkArray<Point3<float>> &vertices, const CompiledNavTriangle &triangle)
+    {
+        assert(triangleIndex == gridTriangles.size());
+        assert(cellsCountX > 0 && cellsCountZ > 0);
+
+        gridTriangles.pushBack(toGridTriangle(vertices, triangle));
+        updateCells(triangleIndex, true);
+    }
+
+    /**
+     * Remove a triangle from the cells it overlaps. Only these cells are copied when they are shared with another grid.
+     */
+    void NavTriangleGrid::removeTriangle(std::size_t triangleIndex)
+    {
+        assert(triangleIndex < gridTriangles.size());
+        updateCells(triangleIndex, false);
+    }
+
+    /**
+     * @return Index of the triangle containing the point on XZ plane and located just below the point. NO_TRIANGLE is returned when no triangle found.
+     */
+    std::size_t NavTriangleGrid::findTriangle(const Point3<float> &point) const
+    {
+        if(gridTriangles.empty())
+        {
+            return NO_TRIANGLE;
+        }
+
+        Point2<float> flattenPoint = point.toPoint2XZ();
+        float bestVerticalDistance = std::numeric_limits<float>::max();
+        std::size_t result = NO_TRIANGLE;
+
+        std::size_t cellIndex = toCellZ(flattenPoint.Y) * cellsCountX + toCellX(flattenPoint.X); //point outside the grid: nearest cell
+        for(std::size_t triangleIndex : cells[cellIndex])
+        {
+            const GridTriangle &gridTriangle = gridTriangles[triangleIndex];
+            if(isPointInsideTriangle(flattenPoint, gridTriangle))
+            {
+                float verticalDistance = point.Y - gridTriangle.centerY;
+                if(verticalDistance >= 0.0 && verticalDistance < bestVerticalDistance)
+                {
+                    bestVerticalDistance = verticalDistance;
+                    result = triangleIndex;
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @param radius Maximum distance on XZ plane between the point and the triangle
+     * @return Index of the nearest triangle on XZ plane located below the point. When several triangles contain the point, the closest
+     * vertically is returned. NO_TRIANGLE is returned when no triangle found in the radius.
+     */
+    std::size_t NavTriangleGrid::findNearestTriangle(const Point3<float> &point, float radius) const
+    {
+        std::size_t result = findTriangle(point);
+        if(result != NO_TRIANGLE || gridTriangles.empty())
+        {
+            return result;
+        }
+
+        Point2<float> flattenPoint = point.toPoint2XZ();
+        float bestSquareDistance = radius * radius;
+        float bestVerticalDistance = std::numeric_limits<float>::max();
+
+        for(std::size_t cellZ=toCellZ(flattenPoint.Y - radius); cellZ<=toCellZ(flattenPoint.Y + radius); ++cellZ)
+        {
+            for(std::size_t cellX=toCellX(flattenPoint.X - radius); cellX<=toCellX(flattenPoint.X + radius); ++cellX)
+            {
+                for(std::size_t triangleIndex : cells[cellZ * cellsCountX + cellX])
+                {
+                    const GridTriangle &gridTriangle = gridTriangles[triangleIndex];
+                    float verticalDistance = point.Y - gridTriangle.centerY;
+                    if(verticalDistance < 0.0f)
+                    {
+                        continue;
+                    }
+
+                    float squareDistance = squareDistanceToTriangle(flattenPoint, gridTriangle);
+                    if(squareDistance < bestSquareDistance || (squareDistance <= bestSquareDistance && verticalDistance < bestVerticalDistance))
+                    {
+                        bestSquareDistance = squareDistance;
+                        bestVerticalDistance = verticalDistance;
+                        result = triangleIndex;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    NavTriangleGrid::GridTriangle NavTriangleGrid::toGridTriangle(const SharedChunkArray<Point3<float>> &vertices, const CompiledNavTriangle &triangle)
+    {
+        GridTriangle gridTriangle{};
+        for(std::size_t i=0; i<3; ++i)
+        {
+            gridTriangle.points[i] = vertices[triangle.vertices[i]].toPoint2XZ();
+        }
+        gridTriangle.centerY = triangle.centerPoint.Y;
+        return gridTriangle;
+    }
+
+    /**
+     * @param add True to add the triangle in the cells overlapped by its bounding box, false to remove it from these cells
+     */
+    void NavTriangleGrid::updateCells(std::size_t triangleIndex, bool add)
+    {
+        const GridTriangle &gridTriangle = gridTriangles[triangleIndex];
+        float minX = std::min(std::min(gridTriangle.points[0].X, gridTriangle.points[1].X), gridTriangle.points[2].X);
+        float maxX = std::max(std::max(gridTriangle.points[0].X, gridTriangle.points[1].X), gridTriangle.points[2].X);
+        float minZ = std::min(std::min(gridTriangle.points[0].Y, gridTriangle.points[1].Y), gridTriangle.points[2].Y);
+        float maxZ = std::max(std::max(gridTriangle.points[0].Y, gridTriangle.points[1].Y), gridTriangle.points[2].Y);
+
+        for(std::size_t cellZ=toCellZ(minZ); cellZ<=toCellZ(maxZ); ++cellZ)
+        {
+            for(std::size_t cellX=toCellX(minX); cellX<=toCellX(maxX); ++cellX)
+            {
+                std::vector<std::size_t> &cellTriangles = cells.edit(cellZ * cellsCountX + cellX);
+                if(add)
+                {
+                    cellTriangles.push_back(triangleIndex);
+                }else
+                {
+                    cellTriangles.erase(std::find(cellTriangles.begin(), cellTriangles.end(), triangleIndex));
+                }
+            }
+        }
+    }
+
+    std::size_t NavTriangleGrid::toCellX(float x) const
+    {
+        float cellX = std::floor((x - gridMin.X) * invCellSize);
+        return (std::size_t)MathAlgorithm::clamp(cellX, 0.0f, (float)(cellsCountX - 1));
+    }
+
+    std::size_t NavTriangleGrid::toCellZ(float z) const
+    {
+        float cellZ = std::floor((z - gridMin.Y) * invCellSize);
+        return (std::size_t)MathAlgorithm::clamp(cellZ, 0.0f, (float)(cellsCountZ - 1));
+    }
+
+    bool NavTriangleGrid::isPointInsideTriangle(const Point2<float> &point, const GridTriangle &gridTriangle)
+    {
+        float crossProduct1 = crossProduct(point, gridTriangle.points[0], gridTriangle.points[1]);
+        float crossProduct2 = crossProduct(point, gridTriangle.points[1], gridTriangle.points[2]);
+        if(crossProduct1 * crossProduct2 < 0.0f)
+        { //cross products have different sign
+            return false;
+        }
+
+        float crossProduct3 = crossProduct(point, gridTriangle.points[2], gridTriangle.points[0]);
+        return crossProduct2 * crossProduct3 >= 0.0f; //check cross products sign
+    }
+
+    float NavTriangleGrid::crossProduct(const Point2<float> &p1, const Point2<float> &p2, const Point2<float> &p3)
+    {
+        //Same as: p3.vector(p1).crossProduct(p3.vector(p2))
+        return (p1.X - p3.X) * (p2.Y - p3.Y) - (p2.X - p3.X) * (p1.Y - p3.Y);
+    }
+
+    float NavTriangleGrid::squareDistanceToTriangle(const Point2<float> &point, const GridTriangle &gridTriangle)
+    {
+        if(isPointInsideTriangle(point, gridTriangle))
+        {
+            return 0.0f;
+        }
+
+        float squareDistance = LineSegment2D<float>(gridTriangle.points[0], gridTriangle.points[1]).squareDistance(point);
+        squareDistance = std::min(squareDistance, LineSegment2D<float>(gridTriangle.points[1], gridTriangle.points[2]).squareDistance(point));
+        return std::min(squareDistance, LineSegment2D<float>(gridTriangle.points[2], gridTriangle.points[0]).squareDistance(point));
+    }
+
+}
@@ -0,0 +1,62 @@
+#ifndef URCHINENGINE_NAVTRIANGLEGRID_H
+#define URCHINENGINE_NAVTRIANGLEGRID_H
+
+#include <vector>
+#include <limits>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/CompiledNavElements.h"
+#include "path/navmesh/model/output/SharedChunkArray.h"
+
+#define NAV_TRIANGLE_GRID_MAX_CELLS_BY_SIDE 1024
+
+namespace urchin
+{
+
+    /**
+     * Uniform grid on XZ plane over the triangles of a compiled navigation mesh. Each cell references the triangles overlapping it in order
+     * to locate a point without iterating over all triangles.
+     * Bounds and cells size of the grid are defined by build(). A copy of the grid shares the unchanged cells: triangles can be added and
+     * removed afterwards by updating only the cells they overlap.
+     */
+    class NavTriangleGrid
+    {
+        public:
+            NavTriangleGrid();
+
+            void build(const SharedChunkArray<Point3<float>> &, const SharedChunkArray<CompiledNavTriangle> &);
+            bool isInsideBounds(const Point3<float> &) const;
+            void addTriangle(std::size_t, const SharedChunkArray<Point3<float>> &, const CompiledNavTriangle &);
+            void removeTriangle(std::size_t);
+
+            std::size_t findTriangle(const Point3<float> &) const;
+            std::size_t findNearestTriangle(const Point3<float> &, float) const;
+
+            static const std::size_t NO_TRIANGLE;
+
+        private:
+            struct GridTriangle
+            {
+                Point2<float> points[3];
+                float centerY;
+            };
+
+            static GridTriangle toGridTriangle(const SharedChunkArray<Point3<float>> &, const CompiledNavTriangle &);
+            void updateCells(std::size_t, bool);
+            std::size_t toCellX(float) const;
+            std::size_t toCellZ(float) const;
+            static bool isPointInsideTriangle(const Point2<float> &, const GridTriangle &);
+            static float crossProduct(const Point2<float> &, const Point2<float> &, const Point2<float> &);
+            static float squareDistanceToTriangle(const Point2<float> &, const GridTriangle &);
+
+            SharedChunkArray<GridTriangle> gridTriangles; //grid triangle by triangle index
+
+            Point2<float> gridMin;
+            float invCellSize;
+            std::size_t cellsCountX, cellsCountZ;
+            SharedChunkArray<std::vector<std::size_t>> cells; //triangle indices by cell index
+    };
+
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef URCHINENGINE_SHAREDCHUNKARRAY_H
+#define URCHINENGINE_SHAREDCHUNKARRAY_H
+
+#include <vector>
+#include <memory>
+#include <cassert>
+
+#define SHARED_CHUNK_ARRAY_CHUNK_SIZE 256
+
+namespace urchin
+{
+
+    /**
+     * Array split in chunks of fixed size. A copy of the array shares all the chunks with the copied array in constant time per chunk: a
+     * shared chunk is copied on first modification (copy on write). Therefore, a new version of an array modified locally only duplicates
+     * the modified chunks.
+     */
+    template<class T> class SharedChunkArray
+    {
+        public:
+            SharedChunkArray();
+            SharedChunkArray(const SharedChunkArray &);
+            SharedChunkArray &operator=(const SharedChunkArray &) = delete;
+
+            std::size_t size() const;
+            bool empty() const;
+            void reserve(std::size_t);
+            void clear();
+
+            const T &operator[](std::size_t) const;
+            T &edit(std::size_t);
+            void pushBack(const T &);
+
+            bool isSharedWith(const SharedChunkArray &, std::size_t) const;
+
+        private:
+            void ownChunk(std::size_t);
+
+            std::vector<std::shared_ptr<std::vector<T>>> chunks; //chunk referenced by several arrays is shared
+            std::size_t elementsCount;
+    };
+
+    #include "SharedChunkArray.inl"
+
+}
+
+#endif
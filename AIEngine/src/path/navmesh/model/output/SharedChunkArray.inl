@@ -0,0 +1,92 @@
+template<class T> SharedChunkArray<T>::SharedChunkArray() :
+        elementsCount(0)
+{
+
+}
+
+/**
+ * Copy the array by sharing its chunks: chunks are copied on first modification by one of the arrays
+ */
+template<class T> SharedChunkArray<T>::SharedChunkArray(const SharedChunkArray<T> &sharedChunkArray) :
+        chunks(sharedChunkArray.chunks),
+        elementsCount(sharedChunkArray.elementsCount)
+{
+
+}
+
+template<class T> std::size_t SharedChunkArray<T>::size() const
+{
+    return elementsCount;
+}
+
+template<class T> bool SharedChunkArray<T>::empty() const
+{
+    return elementsCount == 0;
+}
+
+template<class T> void SharedChunkArray<T>::reserve(std::size_t capacity)
+{
+    chunks.reserve((capacity + SHARED_CHUNK_ARRAY_CHUNK_SIZE - 1) / SHARED_CHUNK_ARRAY_CHUNK_SIZE);
+}
+
+template<class T> void SharedChunkArray<T>::clear()
+{
+    chunks.clear();
+    elementsCount = 0;
+}
+
+template<class T> const T &SharedChunkArray<T>::operator[](std::size_t index) const
+{
+    assert(index < elementsCount);
+    return (*chunks[index / SHARED_CHUNK_ARRAY_CHUNK_SIZE])[index % SHARED_CHUNK_ARRAY_CHUNK_SIZE];
+}
+
+/**
+ * @return Modifiable element. The chunk of the element is copied when it is shared with another array.
+ */
+template<class T> T &SharedChunkArray<T>::edit(std::size_t index)
+{
+    assert(index < elementsCount);
+    std::size_t chunkIndex = index / SHARED_CHUNK_ARRAY_CHUNK_SIZE;
+    ownChunk(chunkIndex);
+    return (*chunks[chunkIndex])[index % SHARED_CHUNK_ARRAY_CHUNK_SIZE];
+}
+
+template<class T> void SharedChunkArray<T>::pushBack(const T &element)
+{
+    if(elementsCount % SHARED_CHUNK_ARRAY_CHUNK_SIZE == 0)
+    {
+        chunks.push_back(std::make_shared<std::vector<T>>());
+        chunks.back()->reserve(SHARED_CHUNK_ARRAY_CHUNK_SIZE);
+    }else
+    {
+        ownChunk(chunks.size() - 1);
+    }
+
+    chunks.back()->push_back(element);
+    elementsCount++;
+}
+
+/**
+ * @return True when the element at the index is stored in the same memory in both arrays
+ */
+template<class T> bool SharedChunkArray<T>::isSharedWith(const SharedChunkArray<T> &sharedChunkArray, std::size_t index) const
+{
+    std::size_t chunkIndex = index / SHARED_CHUNK_ARRAY_CHUNK_SIZE;
+    return chunkIndex < chunks.size() && chunkIndex < sharedChunkArray.chunks.size() && chunks[chunkIndex] == sharedChunkArray.chunks[chunkIndex];
+}
+
+/**
+ * Copy the chunk when it is shared with another array. An array is never modified while it is copied: the reference count cannot
+ * increase concurrently.
+ */
+template<class T> void SharedChunkArray<T>::ownChunk(std::size_t chunkIndex)
+{
+    if(chunks[chunkIndex].use_count() > 1)
+    {
+        auto copiedChunk = std::make_shared<std::vector<T>>();
+        copiedChunk->reserve(SHARED_CHUNK_ARRAY_CHUNK_SIZE);
+        copiedChunk->insert(copiedChunk->end(), chunks[chunkIndex]->begin(), chunks[chunkIndex]->end());
+        chunks[chunkIndex] = std::move(copiedChunk);
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef URCHINENGINE_ENTITYGEOMETRY_H
+#define URCHINENGINE_ENTITYGEOMETRY_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/csg/CSGPolygon.h"
+#include "path/navmesh/polytope/services/TerrainSplitService.h"
+#include "path/navmesh/model/output/topography/NavTopography.h"
+
+namespace urchin
+{
+
+    /**
+     * Shape of an AI object expressed in world space
+     */
+    struct ObjectShapeGeometry
+    {
+        std::string name;
+        std::unique_ptr<ConvexObject3D<float>> convexObject;
+    };
+
+    /**
+     * Split of an AI terrain with the obstacles due to its slopes. The obstacles don't depend on the agent: the agent expansion of a
+     * terrain is a vertical translation which doesn't change the slopes.
+     */
+    struct TerrainSplitGeometry
+    {
+        TerrainSplit terrainSplit;
+        std::vector<CSGPolygon<float>> selfObstacles;
+    };
+
+    /**
+     * Geometry of an AI entity which doesn't depend on the navigation mesh agent: it is computed once and expanded for each agent
+     */
+    struct EntityGeometry
+    {
+        std::vector<ObjectShapeGeometry> objectShapes; //AI object only
+        std::vector<TerrainSplitGeometry> terrainSplits; //AI terrain only
+        std::shared_ptr<const NavTopography> terrainNavTopography; //AI terrain only
+        float walkableSurfaceMaxSize = 0.0f; //maximum size of the walkable surfaces: tile size in tiled mode
+    };
+
+}
+
+#endif
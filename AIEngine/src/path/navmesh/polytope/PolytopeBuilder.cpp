@@ -30,49 +30,103 @@ namespace urchin
             {1, 3, 5} //FBL
     };
 
-    PolytopeBuilder::PolytopeBuilder() :
-            planeSurfaceSplitService(new PlaneSurfaceSplitService(ConfigService::instance()->getFloatValue("navMesh.polytopeMaxSize"))),
-            terrainSplitService(new TerrainSplitService(ConfigService::instance()->getFloatValue("navMesh.polytopeMaxSize")))
+    /**
+     * @return Maximum size of the walkable surfaces: tile size in tiled mode
+     */
+    float PolytopeBuilder::computeWalkableSurfaceMaxSize(bool tiledMode)
+    {
+        if(tiledMode)
+        {
+            return ConfigService::instance()->getFloatValue("navMesh.tileSize");
+        }
+        return ConfigService::instance()->getFloatValue("navMesh.polytopeMaxSize");
+    }
+
+    /**
+     * @param tiledMode Indicates if the walkable surfaces are split into tiles (see NavMeshGenerator::setTiledMode())
+     * @return Shapes of the object in world space
+     */
+    std::unique_ptr<EntityGeometry> PolytopeBuilder::buildGeometry(const std::shared_ptr<AIObject> &aiObject, bool tiledMode) const
     {
+        auto objectGeometry = std::make_unique<EntityGeometry>();
+        objectGeometry->walkableSurfaceMaxSize = computeWalkableSurfaceMaxSize(tiledMode);
+        objectGeometry->objectShapes.reserve(aiObject->getShapes().size());
 
+        unsigned int aiShapeIndex = 0;
+        for (auto &aiShape : aiObject->getShapes())
+        {
+            std::string shapeName = aiObject->getShapes().size()==1 ? aiObject->getName() : aiObject->getName() + "[" + std::to_string(aiShapeIndex++) + "]";
+            Transform<float> shapeTransform = aiShape->hasLocalTransform() ? aiObject->getTransform() * aiShape->getLocalTransform() : aiObject->getTransform();
+            objectGeometry->objectShapes.push_back({shapeName, aiShape->getShape()->toConvexObject(shapeTransform)});
+        }
+
+        return objectGeometry;
     }
 
-    PolytopeBuilder::~PolytopeBuilder()
+    /**
+     * @param tiledMode Indicates if the terrain is split into tiles (see NavMeshGenerator::setTiledMode())
+     * @return Splits of the terrain with their self obstacles and the topography of the terrain
+     */
+    std::unique_ptr<EntityGeometry> PolytopeBuilder::buildGeometry(const std::shared_ptr<AITerrain> &aiTerrain, bool tiledMode) const
     {
-        delete terrainSplitService;
-        delete planeSurfaceSplitService;
+        #ifndef NDEBUG
+            assert(MathAlgorithm::isOne(aiTerrain->getTransform().getScale()));
+            assert(MathAlgorithm::isOne(aiTerrain->getTransform().getOrientationMatrix().determinant()));
+        #endif
+
+        auto terrainGeometry = std::make_unique<EntityGeometry>();
+        terrainGeometry->walkableSurfaceMaxSize = computeWalkableSurfaceMaxSize(tiledMode);
+
+        auto terrainMaxWalkableSlope = AngleConverter<float>::toRadian(ConfigService::instance()->getFloatValue("navMesh.terrainMaxWalkableSlopeInDegree"));
+        float terrainObstacleSimplificationError = ConfigService::instance()->getFloatValue("navMesh.terrainObstacleSimplificationError");
+        auto heightfieldPointHelper = std::make_shared<const HeightfieldPointHelper<float>>(aiTerrain->getLocalVertices(), aiTerrain->getXLength());
+        terrainGeometry->terrainNavTopography = std::make_shared<NavTerrainTopography>(heightfieldPointHelper, aiTerrain->getTransform().getPosition());
+
+        std::vector<TerrainSplit> terrainSplits = TerrainSplitService(terrainGeometry->walkableSurfaceMaxSize).splitTerrain(aiTerrain->getName(), aiTerrain->getTransform().getPosition(),
+                aiTerrain->getLocalVertices(), aiTerrain->getXLength(), aiTerrain->getZLength());
+        terrainGeometry->terrainSplits.reserve(terrainSplits.size());
+        for(auto &terrainSplit : terrainSplits)
+        {
+            TerrainObstacleService terrainObstacleService(terrainSplit.name, terrainSplit.position, terrainSplit.localVertices, terrainSplit.xLength, terrainSplit.zLength);
+            std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(terrainMaxWalkableSlope, terrainObstacleSimplificationError);
+            terrainGeometry->terrainSplits.push_back({std::move(terrainSplit), std::move(selfObstacles)});
+        }
+
+        return terrainGeometry;
     }
 
-    std::vector<std::unique_ptr<Polytope>> PolytopeBuilder::buildExpandedPolytopes(const std::shared_ptr<AIObject> &aiObject, const std::shared_ptr<NavMeshAgent> &navMeshAgent)
+    /**
+     * @param objectGeometry Geometry of the object (see PolytopeBuilder::buildGeometry())
+     */
+    std::vector<std::unique_ptr<Polytope>> PolytopeBuilder::buildExpandedPolytopes(const std::shared_ptr<AIObject> &aiObject, const EntityGeometry &objectGeometry,
+            const std::shared_ptr<NavMeshAgent> &navMeshAgent)
     {
         std::vector<std::unique_ptr<Polytope>> expandedPolytopes;
 
-        unsigned int aiShapeIndex = 0;
-        for (auto &aiShape : aiObject->getShapes())
+        for (const auto &objectShape : objectGeometry.objectShapes)
         {
-            std::string shapeName = aiObject->getShapes().size()==1 ? aiObject->getName() : aiObject->getName() + "[" + std::to_string(aiShapeIndex++) + "]";
-            Transform<float> shapeTransform = aiShape->hasLocalTransform() ? aiObject->getTransform() * aiShape->getLocalTransform() : aiObject->getTransform();
-            std::unique_ptr<ConvexObject3D<float>> object = aiShape->getShape()->toConvexObject(shapeTransform);
+            const std::string &shapeName = objectShape.name;
+            ConvexObject3D<float> *object = objectShape.convexObject.get();
             std::unique_ptr<Polytope> expandedPolytope;
 
-            if (auto box = dynamic_cast<OBBox<float> *>(object.get()))
+            if (auto box = dynamic_cast<OBBox<float> *>(object))
             {
-                expandedPolytope = createExpandedPolytopeFor(shapeName, box, navMeshAgent);
-            } else if (auto capsule = dynamic_cast<Capsule<float> *>(object.get()))
+                expandedPolytope = createExpandedPolytopeFor(shapeName, box, navMeshAgent, objectGeometry.walkableSurfaceMaxSize);
+            } else if (auto capsule = dynamic_cast<Capsule<float> *>(object))
             {
-                expandedPolytope = createExpandedPolytopeFor(shapeName, capsule, navMeshAgent);
-            } else if (auto cone = dynamic_cast<Cone<float> *>(object.get()))
+                expandedPolytope = createExpandedPolytopeFor(shapeName, capsule, navMeshAgent, objectGeometry.walkableSurfaceMaxSize);
+            } else if (auto cone = dynamic_cast<Cone<float> *>(object))
             {
-                expandedPolytope = createExpandedPolytopeFor(shapeName, cone, navMeshAgent);
-            } else if (auto convexHull = dynamic_cast<ConvexHull3D<float> *>(object.get()))
+                expandedPolytope = createExpandedPolytopeFor(shapeName, cone, navMeshAgent, objectGeometry.walkableSurfaceMaxSize);
+            } else if (auto convexHull = dynamic_cast<ConvexHull3D<float> *>(object))
             {
-                expandedPolytope = createExpandedPolytopeFor(shapeName, convexHull, navMeshAgent);
-            } else if (auto cylinder = dynamic_cast<Cylinder<float> *>(object.get()))
+                expandedPolytope = createExpandedPolytopeFor(shapeName, convexHull, navMeshAgent, objectGeometry.walkableSurfaceMaxSize);
+            } else if (auto cylinder = dynamic_cast<Cylinder<float> *>(object))
             {
-                expandedPolytope = createExpandedPolytopeFor(shapeName, cylinder, navMeshAgent);
-            } else if (auto sphere = dynamic_cast<Sphere<float> *>(object.get()))
+                expandedPolytope = createExpandedPolytopeFor(shapeName, cylinder, navMeshAgent, objectGeometry.walkableSurfaceMaxSize);
+            } else if (auto sphere = dynamic_cast<Sphere<float> *>(object))
             {
-                expandedPolytope = createExpandedPolytopeFor(shapeName, sphere, navMeshAgent);
+                expandedPolytope = createExpandedPolytopeFor(shapeName, sphere, navMeshAgent, objectGeometry.walkableSurfaceMaxSize);
             } else
             {
                 throw std::invalid_argument("Shape type not supported by navigation mesh generator for object: " + aiObject->getName());
@@ -85,38 +139,29 @@ namespace urchin
         return expandedPolytopes;
     }
 
-    std::vector<std::unique_ptr<Polytope>> PolytopeBuilder::buildExpandedPolytope(const std::shared_ptr<AITerrain> &aiTerrain, const std::shared_ptr<NavMeshAgent> &navMeshAgent)
+    /**
+     * @param terrainGeometry Geometry of the terrain (see PolytopeBuilder::buildGeometry())
+     */
+    std::vector<std::unique_ptr<Polytope>> PolytopeBuilder::buildExpandedPolytope(const std::shared_ptr<AITerrain> &aiTerrain, const EntityGeometry &terrainGeometry,
+            const std::shared_ptr<NavMeshAgent> &navMeshAgent)
     {
-        #ifndef NDEBUG
-            assert(MathAlgorithm::isOne(aiTerrain->getTransform().getScale()));
-            assert(MathAlgorithm::isOne(aiTerrain->getTransform().getOrientationMatrix().determinant()));
-        #endif
-
         std::vector<std::unique_ptr<Polytope>> expandedPolytopes;
 
-        auto terrainMaxWalkableSlope = AngleConverter<float>::toRadian(ConfigService::instance()->getFloatValue("navMesh.terrainMaxWalkableSlopeInDegree"));
-        auto heightfieldPointHelper = std::make_shared<const HeightfieldPointHelper<float>>(aiTerrain->getLocalVertices(), aiTerrain->getXLength());
-        auto terrainNavTopography = std::make_shared<NavTerrainTopography>(heightfieldPointHelper, aiTerrain->getTransform().getPosition());
-
         Vector3<float> approximateNormal(0.0, 1.0, 0.0); //use approximate normal for all terrain surface instead of normal by vertex to speed up the computation
         Vector3<float> expandShiftVector = approximateNormal * navMeshAgent->computeExpandDistance(approximateNormal);
-        std::vector<Point3<float>> expandedLocalVertices;
-        expandedLocalVertices.reserve(aiTerrain->getLocalVertices().size());
-        for(const auto &localVertex : aiTerrain->getLocalVertices())
-        {
-            expandedLocalVertices.emplace_back(localVertex.translate(expandShiftVector));
-        }
-
-        std::vector<TerrainSplit> terrainSplits = terrainSplitService->splitTerrain(aiTerrain->getName(), aiTerrain->getTransform().getPosition(),
-                expandedLocalVertices, aiTerrain->getXLength(), aiTerrain->getZLength());
 
-        for(const auto &terrainSplit : terrainSplits)
+        for(const auto &terrainSplitGeometry : terrainGeometry.terrainSplits)
         {
-            TerrainObstacleService terrainObstacleService(terrainSplit.name, terrainSplit.position, terrainSplit.localVertices, terrainSplit.xLength, terrainSplit.zLength);
-            std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(terrainMaxWalkableSlope);
+            const TerrainSplit &terrainSplit = terrainSplitGeometry.terrainSplit;
+            std::vector<Point3<float>> expandedLocalVertices;
+            expandedLocalVertices.reserve(terrainSplit.localVertices.size());
+            for(const auto &localVertex : terrainSplit.localVertices)
+            {
+                expandedLocalVertices.emplace_back(localVertex.translate(expandShiftVector));
+            }
 
-            auto terrainSurface = std::make_shared<PolytopeTerrainSurface>(terrainSplit.position, terrainSplit.localVertices, terrainSplit.xLength, terrainSplit.zLength,
-                    approximateNormal, selfObstacles, terrainNavTopography);
+            auto terrainSurface = std::make_shared<PolytopeTerrainSurface>(terrainSplit.position, std::move(expandedLocalVertices), terrainSplit.xLength,
+                    terrainSplit.zLength, approximateNormal, terrainSplitGeometry.selfObstacles, terrainGeometry.terrainNavTopography);
             terrainSurface->setWalkableCandidate(true);
             std::vector<std::shared_ptr<PolytopeSurface>> expandedSurfaces;
             expandedSurfaces.emplace_back(std::move(terrainSurface));
@@ -130,39 +175,43 @@ namespace urchin
         return expandedPolytopes;
     }
 
-    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, OBBox<float> *box, const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
+    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, OBBox<float> *box, const std::shared_ptr<NavMeshAgent> &navMeshAgent,
+            float walkableSurfaceMaxSize) const
     {
         std::vector<Point3<float>> sortedOriginalPoints = box->getPoints();
         std::vector<Point3<float>> sortedExpandedPoints = createExpandedPoints(sortedOriginalPoints, navMeshAgent);
-        std::vector<std::shared_ptr<PolytopeSurface>> expandedPolytopeSurfaces = createExpandedPolytopeSurfaces(sortedOriginalPoints, sortedExpandedPoints, navMeshAgent);
+        std::vector<std::shared_ptr<PolytopeSurface>> expandedPolytopeSurfaces = createExpandedPolytopeSurfaces(sortedOriginalPoints, sortedExpandedPoints, navMeshAgent, walkableSurfaceMaxSize);
         return std::make_unique<Polytope>(name, expandedPolytopeSurfaces);
     }
 
-    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Capsule<float> *capsule, const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
+    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Capsule<float> *capsule, const std::shared_ptr<NavMeshAgent> &navMeshAgent,
+            float walkableSurfaceMaxSize) const
     {
         Vector3<float> boxHalfSizes(capsule->getRadius(), capsule->getRadius(), capsule->getRadius());
         boxHalfSizes[capsule->getCapsuleOrientation()] += capsule->getCylinderHeight() / 2.0f;
 
         OBBox<float> capsuleBox(boxHalfSizes, capsule->getCenterOfMass(), capsule->getOrientation());
-        std::unique_ptr<Polytope> polytope = createExpandedPolytopeFor(name, &capsuleBox, navMeshAgent);
+        std::unique_ptr<Polytope> polytope = createExpandedPolytopeFor(name, &capsuleBox, navMeshAgent, walkableSurfaceMaxSize);
         polytope->setWalkableCandidate(false);
 
         return polytope;
     }
 
-    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Cone<float> *cone, const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
+    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Cone<float> *cone, const std::shared_ptr<NavMeshAgent> &navMeshAgent,
+            float walkableSurfaceMaxSize) const
     {
         Vector3<float> boxHalfSizes(cone->getRadius(), cone->getRadius(), cone->getRadius());
         boxHalfSizes[cone->getConeOrientation()/2] = cone->getHeight() / 2.0f;
 
         OBBox<float> coneBox(boxHalfSizes, cone->getCenter(), cone->getOrientation());
-        std::unique_ptr<Polytope> polytope = createExpandedPolytopeFor(name, &coneBox, navMeshAgent);
+        std::unique_ptr<Polytope> polytope = createExpandedPolytopeFor(name, &coneBox, navMeshAgent, walkableSurfaceMaxSize);
         polytope->setWalkableCandidate(false);
 
         return polytope;
     }
 
-    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, ConvexHull3D<float> *convexHull, const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
+    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, ConvexHull3D<float> *convexHull, const std::shared_ptr<NavMeshAgent> &navMeshAgent,
+            float) const
     {
         std::map<std::size_t, Plane<float>> expandedPlanes;
         for(const auto &itTriangles : convexHull->getIndexedTriangles())
@@ -195,7 +244,8 @@ namespace urchin
         return polytope;
     }
 
-    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Cylinder<float> *cylinder, const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
+    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Cylinder<float> *cylinder, const std::shared_ptr<NavMeshAgent> &navMeshAgent,
+            float walkableSurfaceMaxSize) const
     {
         Vector3<float> boxHalfSizes(cylinder->getRadius(), cylinder->getRadius(), cylinder->getRadius());
         boxHalfSizes[cylinder->getCylinderOrientation()] = cylinder->getHeight() / 2.0f;
@@ -204,7 +254,7 @@ namespace urchin
         std::vector<Point3<float>> sortedOriginalPoints = cylinderBox.getPoints();
         std::vector<Point3<float>> sortedExpandedPoints = createExpandedPoints(sortedOriginalPoints, navMeshAgent);
 
-        std::vector<std::shared_ptr<PolytopeSurface>> expandedSurfaces = createExpandedPolytopeSurfaces(sortedOriginalPoints, sortedExpandedPoints, navMeshAgent);
+        std::vector<std::shared_ptr<PolytopeSurface>> expandedSurfaces = createExpandedPolytopeSurfaces(sortedOriginalPoints, sortedExpandedPoints, navMeshAgent, walkableSurfaceMaxSize);
 
         for(std::size_t i=0; i<expandedSurfaces.size(); ++i)
         {
@@ -214,10 +264,11 @@ namespace urchin
         return std::make_unique<Polytope>(name, expandedSurfaces);
     }
 
-    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Sphere<float> *sphere, const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
+    std::unique_ptr<Polytope> PolytopeBuilder::createExpandedPolytopeFor(const std::string &name, Sphere<float> *sphere, const std::shared_ptr<NavMeshAgent> &navMeshAgent,
+            float walkableSurfaceMaxSize) const
     {
         OBBox<float> sphereBox(*sphere);
-        std::unique_ptr<Polytope> polytope = createExpandedPolytopeFor(name, &sphereBox, navMeshAgent);
+        std::unique_ptr<Polytope> polytope = createExpandedPolytopeFor(name, &sphereBox, navMeshAgent, walkableSurfaceMaxSize);
         polytope->setWalkableCandidate(false);
 
         return polytope;
@@ -292,11 +343,12 @@ namespace urchin
      * @param sortedExpandedPoints Expanded points in the following order: NTR, FTR, NBR, FBR, NTL, FTL, NBL, FBL
      */
     std::vector<std::shared_ptr<PolytopeSurface>> PolytopeBuilder::createExpandedPolytopeSurfaces(const std::vector<Point3<float>> &sortedOriginalPoints,
-            const std::vector<Point3<float>> &sortedExpandedPoints, const std::shared_ptr<NavMeshAgent> &navMeshAgent) const
+            const std::vector<Point3<float>> &sortedExpandedPoints, const std::shared_ptr<NavMeshAgent> &navMeshAgent, float walkableSurfaceMaxSize) const
     {
         std::vector<std::shared_ptr<PolytopeSurface>> expandedSurfaces;
         expandedSurfaces.reserve(6);
 
+        PlaneSurfaceSplitService planeSurfaceSplitService(walkableSurfaceMaxSize);
         std::vector<Point3<float>> surfacePoints;
         surfacePoints.reserve(4);
 
@@ -320,7 +372,7 @@ namespace urchin
                     surfacePoints.push_back(sortedOriginalPoints[pointIndex[i]].translate(shiftVector));
                 }
 
-                std::vector<PlaneSurfaceSplit> planeSurfaceSplits = planeSurfaceSplitService->splitRectangleSurface(surfacePoints);
+                std::vector<PlaneSurfaceSplit> planeSurfaceSplits = planeSurfaceSplitService.splitRectangleSurface(surfacePoints);
                 for(const auto &planeSurfaceSplit : planeSurfaceSplits)
                 {
                     expandedSurfaces.push_back(std::make_shared<PolytopePlaneSurface>(planeSurfaceSplit.planeSurfacePoints, normal, isSlopeWalkable));
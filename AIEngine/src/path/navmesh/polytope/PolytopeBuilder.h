@@ -9,6 +9,7 @@
 #include "input/AITerrain.h"
 #include "path/navmesh/polytope/Polytope.h"
 #include "path/navmesh/polytope/PolytopeSurface.h"
+#include "path/navmesh/polytope/EntityGeometry.h"
 #include "path/navmesh/polytope/services/TerrainSplitService.h"
 #include "path/navmesh/polytope//services/PlaneSurfaceSplitService.h"
 #include "path/navmesh/model/output/NavMeshAgent.h"
@@ -21,19 +22,24 @@ namespace urchin
         public:
             friend class Singleton<PolytopeBuilder>;
 
-            std::vector<std::unique_ptr<Polytope>> buildExpandedPolytopes(const std::shared_ptr<AIObject> &, const std::shared_ptr<NavMeshAgent> &);
-            std::vector<std::unique_ptr<Polytope>> buildExpandedPolytope(const std::shared_ptr<AITerrain> &, const std::shared_ptr<NavMeshAgent> &);
+            std::unique_ptr<EntityGeometry> buildGeometry(const std::shared_ptr<AIObject> &, bool) const;
+            std::unique_ptr<EntityGeometry> buildGeometry(const std::shared_ptr<AITerrain> &, bool) const;
+
+            std::vector<std::unique_ptr<Polytope>> buildExpandedPolytopes(const std::shared_ptr<AIObject> &, const EntityGeometry &, const std::shared_ptr<NavMeshAgent> &);
+            std::vector<std::unique_ptr<Polytope>> buildExpandedPolytope(const std::shared_ptr<AITerrain> &, const EntityGeometry &, const std::shared_ptr<NavMeshAgent> &);
 
         private:
-            PolytopeBuilder();
-            ~PolytopeBuilder() override;
+            PolytopeBuilder() = default;
+            ~PolytopeBuilder() override = default;
+
+            static float computeWalkableSurfaceMaxSize(bool);
 
-            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, OBBox<float> *, const std::shared_ptr<NavMeshAgent> &) const;
-            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Capsule<float> *, const std::shared_ptr<NavMeshAgent> &) const;
-            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Cone<float> *, const std::shared_ptr<NavMeshAgent> &) const;
-            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, ConvexHull3D<float> *, const std::shared_ptr<NavMeshAgent> &) const;
-            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Cylinder<float> *, const std::shared_ptr<NavMeshAgent> &) const;
-            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Sphere<float> *, const std::shared_ptr<NavMeshAgent> &) const;
+            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, OBBox<float> *, const std::shared_ptr<NavMeshAgent> &, float) const;
+            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Capsule<float> *, const std::shared_ptr<NavMeshAgent> &, float) const;
+            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Cone<float> *, const std::shared_ptr<NavMeshAgent> &, float) const;
+            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, ConvexHull3D<float> *, const std::shared_ptr<NavMeshAgent> &, float) const;
+            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Cylinder<float> *, const std::shared_ptr<NavMeshAgent> &, float) const;
+            std::unique_ptr<Polytope> createExpandedPolytopeFor(const std::string &, Sphere<float> *, const std::shared_ptr<NavMeshAgent> &, float) const;
 
             std::vector<Point3<float>> createExpandedPoints(const std::vector<Point3<float>> &, const std::shared_ptr<NavMeshAgent> &) const;
             std::vector<Plane<float>> createExpandedBoxPlanes(const std::vector<Point3<float>> &, const std::shared_ptr<NavMeshAgent> &) const;
@@ -41,13 +47,10 @@ namespace urchin
             std::vector<Point3<float>> expandBoxPoints(const std::vector<Plane<float>> &) const;
 
             std::vector<std::shared_ptr<PolytopeSurface>> createExpandedPolytopeSurfaces(const std::vector<Point3<float>> &,
-                    const std::vector<Point3<float>> &, const std::shared_ptr<NavMeshAgent> &) const;
+                    const std::vector<Point3<float>> &, const std::shared_ptr<NavMeshAgent> &, float) const;
 
             static const unsigned int POINT_INDEX_TO_PLANES[][4];
             static const unsigned int PLANE_INDEX_TO_POINTS[][3];
-
-            PlaneSurfaceSplitService *planeSurfaceSplitService;
-            TerrainSplitService *terrainSplitService;
     };
 
 }
@@ -19,7 +19,12 @@ namespace urchin
 
     }
 
-    std::vector<CSGPolygon<float>> TerrainObstacleService::computeSelfObstacles(float maxSlopeInRadian)
+    /**
+     * @param maxSlopeInRadian Maximum walkable slope: squares steeper than this slope are obstacles
+     * @param simplificationMaxError Maximum distance between the outline of the inaccessible squares and the simplified obstacle polygon.
+     * Zero value disables the simplification: obstacle polygons follow exactly the squares edges.
+     */
+    std::vector<CSGPolygon<float>> TerrainObstacleService::computeSelfObstacles(float maxSlopeInRadian, float simplificationMaxError)
     {
         std::vector<CSGPolygon<float>> obstaclePolygons;
 
@@ -42,7 +47,13 @@ namespace urchin
             if(!isWalkableSquare(squareIndex, maxSlopeDotProduct))
             {
                 std::vector<unsigned int> inaccessibleSquares = findAllInaccessibleNeighbors(squareIndex, maxSlopeDotProduct);
-                obstaclePolygons.emplace_back(squaresToPolygon(inaccessibleSquares, obstacleIndex++));
+                CSGPolygon<float> obstaclePolygon = squaresToPolygon(inaccessibleSquares, obstacleIndex++);
+                if(simplificationMaxError > 0.0f)
+                {
+                    std::vector<Point2<float>> simplifiedCwPoints = simplifyCwPoints(obstaclePolygon.getCwPoints(), simplificationMaxError);
+                    obstaclePolygon = CSGPolygon<float>(obstaclePolygon.getName(), std::move(simplifiedCwPoints));
+                }
+                obstaclePolygons.push_back(std::move(obstaclePolygon));
 
                 for(unsigned int inaccessibleSquare : inaccessibleSquares)
                 {
@@ -259,4 +270,130 @@ namespace urchin
         return CSGPolygon<float>(obstacleName, std::move(cwPoints));
     }
 
+    /**
+     * Simplify the polygon with the Douglas-Peucker algorithm: the polygon is split in two chains between the first point and the
+     * farthest point from it. Each chain keeps recursively its farthest point from the segment joining its extremities while this
+     * distance is greater than the maximum error.
+     * @return Simplified points or original points when the simplification produces an invalid polygon
+     */
+    std::vector<Point2<float>> TerrainObstacleService::simplifyCwPoints(const std::vector<Point2<float>> &cwPoints, float maxError) const
+    {
+        if(cwPoints.size() <= 3)
+        {
+            return cwPoints;
+        }
+
+        std::size_t farthestIndex = 0;
+        float farthestSquareDistance = 0.0f;
+        for(std::size_t i = 1; i < cwPoints.size(); ++i)
+        {
+            float squareDistance = cwPoints[0].squareDistance(cwPoints[i]);
+            if(squareDistance > farthestSquareDistance)
+            {
+                farthestSquareDistance = squareDistance;
+                farthestIndex = i;
+            }
+        }
+
+        std::vector<bool> keptPoints(cwPoints.size(), false);
+        keptPoints[0] = true;
+        keptPoints[farthestIndex] = true;
+        simplifyPointsChain(cwPoints, 0, farthestIndex, maxError, keptPoints);
+        simplifyPointsChain(cwPoints, farthestIndex, cwPoints.size(), maxError, keptPoints);
+
+        std::vector<Point2<float>> simplifiedCwPoints;
+        simplifiedCwPoints.reserve(cwPoints.size());
+        for(std::size_t i = 0; i < cwPoints.size(); ++i)
+        {
+            if(keptPoints[i])
+            {
+                simplifiedCwPoints.push_back(cwPoints[i]);
+            }
+        }
+
+        if(!isValidSimplification(simplifiedCwPoints))
+        {
+            return cwPoints;
+        }
+        return simplifiedCwPoints;
+    }
+
+    /**
+     * @param endIndex End index of the chain (included). An index equals to the number of points refers to the first point.
+     */
+    void TerrainObstacleService::simplifyPointsChain(const std::vector<Point2<float>> &cwPoints, std::size_t startIndex, std::size_t endIndex,
+                                                     float maxError, std::vector<bool> &keptPoints) const
+    {
+        const float maxSquareError = maxError * maxError;
+        std::stack<std::pair<std::size_t, std::size_t>> chainsToProcess;
+        chainsToProcess.push(std::make_pair(startIndex, endIndex));
+
+        while(!chainsToProcess.empty())
+        {
+            std::pair<std::size_t, std::size_t> chain = chainsToProcess.top();
+            chainsToProcess.pop();
+
+            LineSegment2D<float> chainSegment(cwPoints[chain.first], cwPoints[chain.second % cwPoints.size()]);
+            std::size_t farthestIndex = 0;
+            float farthestSquareDistance = 0.0f;
+            for(std::size_t i = chain.first + 1; i < chain.second; ++i)
+            {
+                float squareDistance = chainSegment.squareDistance(cwPoints[i]);
+                if(squareDistance > farthestSquareDistance)
+                {
+                    farthestSquareDistance = squareDistance;
+                    farthestIndex = i;
+                }
+            }
+
+            if(farthestSquareDistance > maxSquareError)
+            {
+                keptPoints[farthestIndex] = true;
+                chainsToProcess.push(std::make_pair(chain.first, farthestIndex));
+                chainsToProcess.push(std::make_pair(farthestIndex, chain.second));
+            }
+        }
+    }
+
+    /**
+     * @return True when the simplified polygon is still a clockwise polygon without self intersection
+     */
+    bool TerrainObstacleService::isValidSimplification(const std::vector<Point2<float>> &simplifiedCwPoints) const
+    {
+        if(simplifiedCwPoints.size() < 3)
+        {
+            return false;
+        }
+
+        float area = 0.0f;
+        for (std::size_t i = 0, prevI = simplifiedCwPoints.size() - 1; i < simplifiedCwPoints.size(); prevI=i++)
+        {
+            area += (simplifiedCwPoints[i].X - simplifiedCwPoints[prevI].X) * (simplifiedCwPoints[i].Y + simplifiedCwPoints[prevI].Y);
+        }
+        if(area <= 0.0f)
+        {
+            return false;
+        }
+
+        for(std::size_t i = 0; i < simplifiedCwPoints.size(); ++i)
+        {
+            LineSegment2D<float> edge(simplifiedCwPoints[i], simplifiedCwPoints[(i + 1) % simplifiedCwPoints.size()]);
+            for(std::size_t j = i + 2; j < simplifiedCwPoints.size(); ++j)
+            {
+                if(i == 0 && j == simplifiedCwPoints.size() - 1)
+                { //adjacent edges
+                    continue;
+                }
+
+                LineSegment2D<float> otherEdge(simplifiedCwPoints[j], simplifiedCwPoints[(j + 1) % simplifiedCwPoints.size()]);
+                if(edge.hasProperIntersection(otherEdge))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
 }
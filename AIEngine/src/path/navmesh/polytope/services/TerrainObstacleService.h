@@ -21,7 +21,7 @@ namespace urchin
 
             TerrainObstacleService(std::string name, const Point3<float> &, std::vector<Point3<float>>, unsigned int, unsigned int);
 
-            std::vector<CSGPolygon<float>> computeSelfObstacles(float);
+            std::vector<CSGPolygon<float>> computeSelfObstacles(float, float);
 
         private:
             bool isWalkableSquare(unsigned int, float) const;
@@ -37,6 +37,10 @@ namespace urchin
 
             CSGPolygon<float> pointIndicesToPolygon(const std::vector<unsigned int> &, unsigned int) const;
 
+            std::vector<Point2<float>> simplifyCwPoints(const std::vector<Point2<float>> &, float) const;
+            void simplifyPointsChain(const std::vector<Point2<float>> &, std::size_t, std::size_t, float, std::vector<bool> &) const;
+            bool isValidSimplification(const std::vector<Point2<float>> &) const;
+
             std::string terrainName;
             Point3<float> position;
             std::vector<Point3<float>> localVertices;
@@ -0,0 +1,182 @@
+#include <unordered_set>
+#include <algorithm>
+#include <stdexcept>
+
+#include "PathCache.h"
+
+namespace urchin
+{
+
+    bool PathCacheKey::operator==(const PathCacheKey &other) const
+    {
+        return navMeshId == other.navMeshId && startPolygonId == other.startPolygonId && startPolygonTriangleIndex == other.startPolygonTriangleIndex
+            && endPolygonId == other.endPolygonId && endPolygonTriangleIndex == other.endPolygonTriangleIndex;
+    }
+
+    std::size_t PathCacheKeyHash::operator()(const PathCacheKey &key) const
+    {
+        std::size_t hash = std::hash<unsigned int>()(key.navMeshId);
+        hash = hash * 31 + std::hash<unsigned int>()(key.startPolygonId);
+        hash = hash * 31 + std::hash<std::size_t>()(key.startPolygonTriangleIndex);
+        hash = hash * 31 + std::hash<unsigned int>()(key.endPolygonId);
+        hash = hash * 31 + std::hash<std::size_t>()(key.endPolygonTriangleIndex);
+        return hash;
+    }
+
+    /**
+     * @param maxSize Maximum number of corridors in the cache
+     */
+    PathCache::PathCache(std::size_t maxSize) :
+            maxSize(maxSize),
+            hitCount(0),
+            missCount(0),
+            invalidationCount(0)
+    {
+        if(maxSize == 0)
+        {
+            throw std::invalid_argument("Path cache maximum size must be greater than zero");
+        }
+    }
+
+    /**
+     * @param corridor [out] Corridor from the start triangle to the end triangle of the key
+     * @return True if a corridor is cached for the key
+     */
+    bool PathCache::findCorridor(const PathCacheKey &key, std::vector<PathCorridorTriangle> &corridor)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto itFind = corridors.find(key);
+        if(itFind == corridors.end())
+        {
+            missCount++;
+            return false;
+        }
+
+        hitCount++;
+        corridorsUsage.splice(corridorsUsage.begin(), corridorsUsage, itFind->second.usageIterator);
+        corridor = itFind->second.corridor;
+        return true;
+    }
+
+    void PathCache::addCorridor(const PathCacheKey &key, const std::vector<PathCorridorTriangle> &corridor)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto itFind = corridors.find(key);
+        if(itFind != corridors.end())
+        { //corridor computed concurrently by another thread
+            itFind->second.corridor = corridor;
+            corridorsUsage.splice(corridorsUsage.begin(), corridorsUsage, itFind->second.usageIterator);
+            return;
+        }
+
+        if(corridors.size() >= maxSize)
+        {
+            corridors.erase(corridorsUsage.back());
+            corridorsUsage.pop_back();
+        }
+
+        corridorsUsage.push_front(key);
+        CachedCorridor cachedCorridor;
+        cachedCorridor.corridor = corridor;
+        cachedCorridor.usageIterator = corridorsUsage.begin();
+        corridors.emplace(key, std::move(cachedCorridor));
+    }
+
+    void PathCache::removeCorridor(const PathCacheKey &key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto itFind = corridors.find(key);
+        if(itFind != corridors.end())
+        {
+            corridorsUsage.erase(itFind->second.usageIterator);
+            corridors.erase(itFind);
+        }
+    }
+
+    /**
+     * Remove the corridors of the navigation mesh crossing a polygon changed by its last update. This method must be called after
+     * each update of each navigation mesh: corridors crossing polygons changed by a missed update are not detected.
+     */
+    void PathCache::refresh(const NavMesh &navMesh)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        unsigned int &navMeshUpdateId = navMeshUpdateIds[navMesh.getId()];
+        if(navMesh.getUpdateId() == navMeshUpdateId)
+        {
+            return;
+        }
+        navMeshUpdateId = navMesh.getUpdateId();
+
+        const std::vector<unsigned int> &changedPolygonIds = navMesh.getChangedPolygonIds();
+        if(changedPolygonIds.empty() || corridors.empty())
+        {
+            return;
+        }
+
+        std::unordered_set<unsigned int> changedPolygonIdsSet(changedPolygonIds.begin(), changedPolygonIds.end());
+        for(auto it = corridors.begin(); it != corridors.end();)
+        {
+            const std::vector<PathCorridorTriangle> &corridor = it->second.corridor;
+            bool crossChangedPolygon = it->first.navMeshId == navMesh.getId() && std::any_of(corridor.begin(), corridor.end(), [&changedPolygonIdsSet](const PathCorridorTriangle &corridorTriangle) {
+                return changedPolygonIdsSet.count(corridorTriangle.polygonId) != 0;
+            });
+
+            if(crossChangedPolygon)
+            {
+                corridorsUsage.erase(it->second.usageIterator);
+                it = corridors.erase(it);
+                invalidationCount++;
+            }else
+            {
+                ++it;
+            }
+        }
+    }
+
+    std::size_t PathCache::getSize() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return corridors.size();
+    }
+
+    unsigned int PathCache::getHitCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return hitCount;
+    }
+
+    unsigned int PathCache::getMissCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return missCount;
+    }
+
+    /**
+     * @return Number of corridors removed because they cross a polygon changed by an update of the navigation mesh
+     */
+    unsigned int PathCache::getInvalidationCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return invalidationCount;
+    }
+
+    /**
+     * @return Ratio of path requests served from a cached corridor (0.0 when no request has been done)
+     */
+    float PathCache::computeHitRate() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        unsigned int requestsCount = hitCount + missCount;
+        return requestsCount == 0 ? 0.0f : static_cast<float>(hitCount) / static_cast<float>(requestsCount);
+    }
+
+}
@@ -0,0 +1,84 @@
+#ifndef URCHINENGINE_PATHCACHE_H
+#define URCHINENGINE_PATHCACHE_H
+
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+
+#include "path/navmesh/model/output/NavMesh.h"
+
+namespace urchin
+{
+
+    /**
+     * Triangle of a path corridor identified by its polygon. This identification remains valid from one navigation mesh update to
+     * another while the polygon is not regenerated.
+     */
+    struct PathCorridorTriangle
+    {
+        unsigned int polygonId;
+        std::size_t polygonTriangleIndex;
+        std::size_t linkIndex; //index of the link from the previous corridor triangle to this triangle
+    };
+
+    struct PathCacheKey
+    {
+        unsigned int navMeshId; //navigation meshes of the agents share the cache
+        unsigned int startPolygonId;
+        std::size_t startPolygonTriangleIndex;
+        unsigned int endPolygonId;
+        std::size_t endPolygonTriangleIndex;
+
+        bool operator==(const PathCacheKey &) const;
+    };
+
+    struct PathCacheKeyHash
+    {
+        std::size_t operator()(const PathCacheKey &) const;
+    };
+
+    /**
+     * Cache of the corridors (sequence of triangles) found by the path finding between a start triangle and an end triangle. A path
+     * between two points located in the same triangles than a cached corridor is computed by applying the funnel algorithm on the
+     * corridor. Corridors are invalidated when one of their polygons is regenerated or modified by an update of the navigation mesh.
+     * Least recently used corridors are evicted when the cache is full. Cache can be used concurrently by several threads.
+     */
+    class PathCache
+    {
+        public:
+            explicit PathCache(std::size_t);
+
+            bool findCorridor(const PathCacheKey &, std::vector<PathCorridorTriangle> &);
+            void addCorridor(const PathCacheKey &, const std::vector<PathCorridorTriangle> &);
+            void removeCorridor(const PathCacheKey &);
+            void refresh(const NavMesh &);
+
+            std::size_t getSize() const;
+            unsigned int getHitCount() const;
+            unsigned int getMissCount() const;
+            unsigned int getInvalidationCount() const;
+            float computeHitRate() const;
+
+        private:
+            struct CachedCorridor
+            {
+                std::vector<PathCorridorTriangle> corridor;
+                std::list<PathCacheKey>::iterator usageIterator;
+            };
+
+            const std::size_t maxSize;
+
+            mutable std::mutex mutex;
+            std::unordered_map<PathCacheKey, CachedCorridor, PathCacheKeyHash> corridors;
+            std::list<PathCacheKey> corridorsUsage; //most recently used corridors first
+            std::unordered_map<unsigned int, unsigned int> navMeshUpdateIds; //last refreshed update id by navigation mesh id
+
+            unsigned int hitCount;
+            unsigned int missCount;
+            unsigned int invalidationCount;
+    };
+
+}
+
+#endif
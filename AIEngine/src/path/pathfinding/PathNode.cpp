@@ -1,21 +1,44 @@
 #include <cassert>
-#include <utility>
 
 #include "PathNode.h"
 
 namespace urchin
 {
-    PathNode::PathNode(std::shared_ptr<NavTriangle> navTriangle, float gScore, float hScore) :
-            navTriangle(std::move(navTriangle)),
+    PathNode::PathNode() :
+            triangleIndex(CompiledNavMesh::NO_INDEX),
+            gScore(0.0f),
+            hScore(0.0f),
+            previousNode(nullptr),
+            linkIndex(CompiledNavMesh::NO_INDEX)
+    {
+
+    }
+
+    PathNode::PathNode(std::uint32_t triangleIndex, float gScore, float hScore) :
+            triangleIndex(triangleIndex),
             gScore(gScore),
-            hScore(hScore)
+            hScore(hScore),
+            previousNode(nullptr),
+            linkIndex(CompiledNavMesh::NO_INDEX)
     {
 
     }
 
-    const std::shared_ptr<NavTriangle> &PathNode::getNavTriangle() const
+    /**
+     * Reset the node in order to reuse it in a new path search
+     */
+    void PathNode::reset(std::uint32_t triangleIndex, float gScore, float hScore)
     {
-        return navTriangle;
+        this->triangleIndex = triangleIndex;
+        this->gScore = gScore;
+        this->hScore = hScore;
+        this->previousNode = nullptr;
+        this->linkIndex = CompiledNavMesh::NO_INDEX;
+    }
+
+    std::uint32_t PathNode::getTriangleIndex() const
+    {
+        return triangleIndex;
     }
 
     void PathNode::setGScore(float gScore)
@@ -38,61 +61,72 @@ namespace urchin
         return gScore + hScore;
     }
 
-    void PathNode::setPreviousNode(const std::shared_ptr<PathNode> &previousNode, const std::shared_ptr<NavLink> &navLink)
+    void PathNode::setEntryPoint(const Point3<float> &entryPoint)
+    {
+        this->entryPoint = entryPoint;
+    }
+
+    /**
+     * @return Approximate point where the path enters in the triangle. The G score is the length of the path passing through the
+     * entry points of the previous nodes.
+     */
+    const Point3<float> &PathNode::getEntryPoint() const
+    {
+        return entryPoint;
+    }
+
+    void PathNode::setPreviousNode(const PathNode *previousNode, std::uint32_t linkIndex)
     {
         assert(previousNode != nullptr);
-        assert(navLink != nullptr);
+        assert(linkIndex != CompiledNavMesh::NO_INDEX);
 
         this->previousNode = previousNode;
-        this->navLink = navLink;
+        this->linkIndex = linkIndex;
     }
 
-    const std::shared_ptr<PathNode> &PathNode::getPreviousNode() const
+    const PathNode *PathNode::getPreviousNode() const
     {
         return previousNode;
     }
 
+    /**
+     * @return Index of the link (in the compiled navigation mesh) between previous PathNode and current PathNode
+     */
+    std::uint32_t PathNode::getLinkIndex() const
+    {
+        return linkIndex;
+    }
+
     /**
      * @return Return crossing portals (edges) between previous PathNode and current PathNode
      */
-    PathNodeEdgesLink PathNode::computePathNodeEdgesLink() const
+    PathNodeEdgesLink PathNode::computePathNodeEdgesLink(const CompiledNavMesh &compiledNavMesh) const
     {
         assert(previousNode != nullptr);
-        assert(navLink != nullptr);
+        assert(linkIndex != CompiledNavMesh::NO_INDEX);
 
         PathNodeEdgesLink pathNodeEdgesLink;
+        const CompiledNavLink &navLink = compiledNavMesh.getLink(linkIndex);
 
-        if(navLink->getLinkType() == NavLinkType::STANDARD)
+        if(navLink.linkType == NavLinkType::STANDARD || navLink.linkType == NavLinkType::JOIN_POLYGONS)
         {
-            LineSegment3D<float> sourceAndTargetEdge = previousNode->getNavTriangle()->computeEdge(navLink->getSourceEdgeIndex());
+            LineSegment3D<float> sourceAndTargetEdge = compiledNavMesh.computeLinkSourceEdge(previousNode->getTriangleIndex(), navLink);
 
             pathNodeEdgesLink.sourceEdge = sourceAndTargetEdge;
             pathNodeEdgesLink.targetEdge = sourceAndTargetEdge;
             pathNodeEdgesLink.areIdenticalEdges = true;
 
             return pathNodeEdgesLink;
-        }else if(navLink->getLinkType() == NavLinkType::JOIN_POLYGONS)
+        }else if(navLink.linkType == NavLinkType::JUMP)
         {
-            LineSegment3D<float> sourceEdge = previousNode->getNavTriangle()->computeEdge(navLink->getSourceEdgeIndex());
-            LineSegment3D<float> polygonJoinEdge = navLink->getLinkConstraint()->computeSourceJumpEdge(sourceEdge);
-
-            pathNodeEdgesLink.sourceEdge = polygonJoinEdge;
-            pathNodeEdgesLink.targetEdge = polygonJoinEdge;
-            pathNodeEdgesLink.areIdenticalEdges = true;
-
-            return pathNodeEdgesLink;
-        }else if(navLink->getLinkType() == NavLinkType::JUMP)
-        {
-            LineSegment3D<float> sourceEdge = previousNode->getNavTriangle()->computeEdge(navLink->getSourceEdgeIndex());
-
-            pathNodeEdgesLink.sourceEdge = navLink->getLinkConstraint()->computeSourceJumpEdge(sourceEdge);
-            pathNodeEdgesLink.targetEdge = getNavTriangle()->computeEdge(navLink->getLinkConstraint()->getTargetEdgeIndex());
+            pathNodeEdgesLink.sourceEdge = compiledNavMesh.computeLinkSourceEdge(previousNode->getTriangleIndex(), navLink);
+            pathNodeEdgesLink.targetEdge = compiledNavMesh.computeEdge(triangleIndex, navLink.targetEdgeIndex);
             pathNodeEdgesLink.areIdenticalEdges = false;
 
             return pathNodeEdgesLink;
         }
 
-        throw std::runtime_error("Unknown link type: " + std::to_string(navLink->getLinkType()));
+        throw std::runtime_error("Unknown link type: " + std::to_string(navLink.linkType));
     }
 
 }
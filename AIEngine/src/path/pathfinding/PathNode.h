@@ -1,9 +1,9 @@
 #ifndef URCHINENGINE_PATHNODE_H
 #define URCHINENGINE_PATHNODE_H
 
-#include <memory>
+#include <cstdint>
 
-#include "path/navmesh/model/output/NavTriangle.h"
+#include "path/navmesh/model/output/CompiledNavMesh.h"
 
 namespace urchin
 {
@@ -21,27 +21,35 @@ namespace urchin
     class PathNode
     {
         public:
-            PathNode(std::shared_ptr<NavTriangle>, float, float);
+            PathNode();
+            PathNode(std::uint32_t, float, float);
 
-            const std::shared_ptr<NavTriangle> &getNavTriangle() const;
+            void reset(std::uint32_t, float, float);
+
+            std::uint32_t getTriangleIndex() const;
 
             void setGScore(float);
             float getGScore() const;
             float getHScore() const;
             float getFScore() const;
 
-            void setPreviousNode(const std::shared_ptr<PathNode> &, const std::shared_ptr<NavLink> &);
-            const std::shared_ptr<PathNode> &getPreviousNode() const;
-            PathNodeEdgesLink computePathNodeEdgesLink() const;
+            void setEntryPoint(const Point3<float> &);
+            const Point3<float> &getEntryPoint() const;
+
+            void setPreviousNode(const PathNode *, std::uint32_t);
+            const PathNode *getPreviousNode() const;
+            std::uint32_t getLinkIndex() const;
+            PathNodeEdgesLink computePathNodeEdgesLink(const CompiledNavMesh &) const;
 
         private:
-            std::shared_ptr<NavTriangle> navTriangle;
+            std::uint32_t triangleIndex; //triangle index in the compiled navigation mesh
 
             float gScore;
             float hScore;
+            Point3<float> entryPoint; //point where the path enters in the triangle (start point for the first node)
 
-            std::shared_ptr<PathNode> previousNode;
-            std::shared_ptr<NavLink> navLink; //link between previousNode and this
+            const PathNode *previousNode;
+            std::uint32_t linkIndex; //link index (in the compiled navigation mesh) between previousNode and this
     };
 
 }
@@ -0,0 +1,127 @@
+#include <cassert>
+
+#include "PathNodeHeap.h"
+
+namespace urchin
+{
+
+    //static
+    const std::size_t PathNodeHeap::NOT_IN_HEAP = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @param pathNodes Dense nodes array. Nodes array must not be resized while the heap contains elements.
+     */
+    PathNodeHeap::PathNodeHeap(const std::vector<PathNode> &pathNodes) :
+            pathNodes(pathNodes)
+    {
+
+    }
+
+    /**
+     * Remove all nodes from heap. Memory is kept to be reused by the next path search.
+     * @param nodesCount Number of nodes in dense nodes array
+     */
+    void PathNodeHeap::clear(std::size_t nodesCount)
+    {
+        heap.clear();
+        if(heapPositions.size() < nodesCount)
+        {
+            heapPositions.resize(nodesCount, NOT_IN_HEAP);
+        }
+    }
+
+    bool PathNodeHeap::isEmpty() const
+    {
+        return heap.empty();
+    }
+
+    void PathNodeHeap::push(std::size_t nodeIndex)
+    {
+        heap.push_back(nodeIndex);
+        heapPositions[nodeIndex] = heap.size() - 1;
+        siftUp(heap.size() - 1);
+    }
+
+    /**
+     * @return Index of node with the smallest F score. Node is removed from heap.
+     */
+    std::size_t PathNodeHeap::pop()
+    {
+        assert(!heap.empty());
+
+        std::size_t topNodeIndex = heap[0];
+        heapPositions[topNodeIndex] = NOT_IN_HEAP;
+
+        std::size_t lastNodeIndex = heap.back();
+        heap.pop_back();
+        if(!heap.empty())
+        {
+            place(lastNodeIndex, 0);
+            siftDown(0);
+        }
+
+        return topNodeIndex;
+    }
+
+    /**
+     * Restore heap order after the F score of a node contained in the heap has been decreased
+     */
+    void PathNodeHeap::decreaseKey(std::size_t nodeIndex)
+    {
+        assert(heapPositions[nodeIndex] != NOT_IN_HEAP);
+
+        siftUp(heapPositions[nodeIndex]);
+    }
+
+    void PathNodeHeap::siftUp(std::size_t position)
+    {
+        std::size_t nodeIndex = heap[position];
+        while(position > 0)
+        {
+            std::size_t parentPosition = (position - 1) / 2;
+            if(!isLess(nodeIndex, heap[parentPosition]))
+            {
+                break;
+            }
+            place(heap[parentPosition], position);
+            position = parentPosition;
+        }
+        place(nodeIndex, position);
+    }
+
+    void PathNodeHeap::siftDown(std::size_t position)
+    {
+        std::size_t nodeIndex = heap[position];
+        while(true)
+        {
+            std::size_t childPosition = 2 * position + 1;
+            if(childPosition >= heap.size())
+            {
+                break;
+            }
+            if(childPosition + 1 < heap.size() && isLess(heap[childPosition + 1], heap[childPosition]))
+            {
+                childPosition++;
+            }
+            if(!isLess(heap[childPosition], nodeIndex))
+            {
+                break;
+            }
+            place(heap[childPosition], position);
+            position = childPosition;
+        }
+        place(nodeIndex, position);
+    }
+
+    bool PathNodeHeap::isLess(std::size_t nodeIndex1, std::size_t nodeIndex2) const
+    {
+        return pathNodes[nodeIndex1].getFScore() < pathNodes[nodeIndex2].getFScore();
+    }
+
+    void PathNodeHeap::place(std::size_t nodeIndex, std::size_t position)
+    {
+        heap[position] = nodeIndex;
+        heapPositions[nodeIndex] = position;
+    }
+
+}
@@ -0,0 +1,43 @@
+#ifndef URCHINENGINE_PATHNODEHEAP_H
+#define URCHINENGINE_PATHNODEHEAP_H
+
+#include <vector>
+#include <limits>
+
+#include "path/pathfinding/PathNode.h"
+
+namespace urchin
+{
+
+    /**
+     * Indexed binary min-heap of path nodes ordered by F score. Nodes are identified by their index in a dense nodes array: the
+     * position of each node in the heap is tracked to allow the decrease of its F score (decrease-key) in O(log n).
+     */
+    class PathNodeHeap
+    {
+        public:
+            explicit PathNodeHeap(const std::vector<PathNode> &);
+
+            void clear(std::size_t);
+            bool isEmpty() const;
+
+            void push(std::size_t);
+            std::size_t pop();
+            void decreaseKey(std::size_t);
+
+        private:
+            void siftUp(std::size_t);
+            void siftDown(std::size_t);
+            bool isLess(std::size_t, std::size_t) const;
+            void place(std::size_t, std::size_t);
+
+            static const std::size_t NOT_IN_HEAP;
+
+            const std::vector<PathNode> &pathNodes;
+            std::vector<std::size_t> heap;
+            std::vector<std::size_t> heapPositions;
+    };
+
+}
+
+#endif
@@ -1,15 +1,14 @@
 #include <utility>
 
 #include "PathPortal.h"
-#include "path/navmesh/model/output/NavPolygon.h"
 
 namespace urchin
 {
 
-    PathPortal::PathPortal(LineSegment3D<float> portal, std::shared_ptr<PathNode> previousPathNode, std::shared_ptr<PathNode> nextPathNode, bool bIsJumpOriginPortal) :
+    PathPortal::PathPortal(LineSegment3D<float> portal, const PathNode *previousPathNode, const PathNode *nextPathNode, bool bIsJumpOriginPortal) :
         portal(std::move(portal)),
-        previousPathNode(std::move(previousPathNode)),
-        nextPathNode(std::move(nextPathNode)),
+        previousPathNode(previousPathNode),
+        nextPathNode(nextPathNode),
         bIsJumpOriginPortal(bIsJumpOriginPortal),
         bHasTransitionPoint(false)
     {
@@ -42,9 +41,11 @@ namespace urchin
         return bIsJumpOriginPortal;
     }
 
-    bool PathPortal::hasDifferentTopography() const
+    bool PathPortal::hasDifferentTopography(const CompiledNavMesh &compiledNavMesh) const
     {
-        return previousPathNode->getNavTriangle()->getNavPolygon()->getNavTopography() != nextPathNode->getNavTriangle()->getNavPolygon()->getNavTopography();
+        const CompiledNavPolygon &previousPolygon = compiledNavMesh.getPolygon(compiledNavMesh.getTriangle(previousPathNode->getTriangleIndex()).polygon);
+        const CompiledNavPolygon &nextPolygon = compiledNavMesh.getPolygon(compiledNavMesh.getTriangle(nextPathNode->getTriangleIndex()).polygon);
+        return previousPolygon.navTopography != nextPolygon.navTopography;
     }
 
     const LineSegment3D<float> &PathPortal::getPortal() const
@@ -52,12 +53,12 @@ namespace urchin
         return portal;
     }
 
-    const std::shared_ptr<PathNode> &PathPortal::getPreviousPathNode() const
+    const PathNode *PathPortal::getPreviousPathNode() const
     {
         return previousPathNode;
     }
 
-    const std::shared_ptr<PathNode> &PathPortal::getNextPathNode() const
+    const PathNode *PathPortal::getNextPathNode() const
     {
         return nextPathNode;
     }
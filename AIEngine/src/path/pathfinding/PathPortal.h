@@ -10,23 +10,23 @@ namespace urchin
     class PathPortal
     {
         public:
-            PathPortal(LineSegment3D<float>, std::shared_ptr<PathNode>, std::shared_ptr<PathNode>, bool);
+            PathPortal(LineSegment3D<float>, const PathNode *, const PathNode *, bool);
 
             void setTransitionPoint(const Point3<float> &);
             bool hasTransitionPoint() const;
             const Point3<float> &getTransitionPoint() const;
 
             bool isJumpOriginPortal() const;
-            bool hasDifferentTopography() const;
+            bool hasDifferentTopography(const CompiledNavMesh &) const;
 
             const LineSegment3D<float> &getPortal() const;
-            const std::shared_ptr<PathNode> &getPreviousPathNode() const;
-            const std::shared_ptr<PathNode> &getNextPathNode() const;
+            const PathNode *getPreviousPathNode() const;
+            const PathNode *getNextPathNode() const;
 
         private:
             LineSegment3D<float> portal;
-            std::shared_ptr<PathNode> previousPathNode;
-            std::shared_ptr<PathNode> nextPathNode;
+            const PathNode *previousPathNode;
+            const PathNode *nextPathNode;
             bool bIsJumpOriginPortal;
 
             Point3<float> transitionPoint;
@@ -1,4 +1,7 @@
 #include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
 
 #include "PathfindingAStar.h"
 #include "path/pathfinding/PathPortal.h"
@@ -7,162 +10,370 @@
 namespace urchin
 {
 
-    bool PathNodeCompare::operator()(const std::shared_ptr<PathNode> &node1, const std::shared_ptr<PathNode> &node2) const
+    PathfindingAStar::PathfindingAStar(std::shared_ptr<const NavMesh> navMesh) :
+            jumpAdditionalCost(ConfigService::instance()->getFloatValue("pathfinding.jumpAdditionalCost")),
+            navMesh(std::move(navMesh)),
+            pathCache(nullptr),
+            exactGScore(false),
+            polygonGraph(nullptr),
+            openList(pathNodes),
+            searchId(0)
     {
-        return node1->getFScore() < node2->getFScore();
+
     }
 
-    PathfindingAStar::PathfindingAStar(std::shared_ptr<NavMesh> navMesh) :
-            jumpAdditionalCost(ConfigService::instance()->getFloatValue("pathfinding.jumpAdditionalCost")),
-            navMesh(std::move(navMesh))
+    /**
+     * @param navMesh Navigation mesh snapshot used by the next searches
+     */
+    void PathfindingAStar::setNavMesh(std::shared_ptr<const NavMesh> navMesh)
     {
+        this->navMesh = std::move(navMesh);
+    }
 
+    /**
+     * @param pathCache Cache of corridors shared between path finding instances working on the same navigation mesh. Null to disable cache.
+     */
+    void PathfindingAStar::setPathCache(PathCache *pathCache)
+    {
+        this->pathCache = pathCache;
     }
 
-    std::vector<PathPoint> PathfindingAStar::findPath(const Point3<float> &startPoint, const Point3<float> &endPoint) const
+    /**
+     * @param exactGScore Compute the G score of each node by applying the funnel algorithm from the start point. Search time becomes
+     * quadratic with the path length: to use only as reference to evaluate the path quality.
+     */
+    void PathfindingAStar::setExactGScore(bool exactGScore)
+    {
+        this->exactGScore = exactGScore;
+    }
+
+    /**
+     * @param polygonGraph Polygon graph of the navigation mesh used for high level searches. Null to disable high level searches.
+     */
+    void PathfindingAStar::setPolygonGraph(const PolygonGraph *polygonGraph)
     {
-        ScopeProfiler scopeProfiler("ai", "findPath");
+        this->polygonGraph = polygonGraph;
+    }
 
-        std::shared_ptr<NavTriangle> startTriangle = findTriangle(startPoint);
-        std::shared_ptr<NavTriangle> endTriangle = findTriangle(endPoint);
-        if(!startTriangle || !endTriangle)
+    std::vector<PathPoint> PathfindingAStar::findPath(const Point3<float> &startPoint, const Point3<float> &endPoint) const
+    {
+        compiledNavMesh = navMesh->getCompiledNavMesh();
+        std::uint32_t startTriangle = compiledNavMesh->findTriangle(startPoint);
+        std::uint32_t endTriangle = compiledNavMesh->findTriangle(endPoint);
+        if(startTriangle == CompiledNavMesh::NO_INDEX || endTriangle == CompiledNavMesh::NO_INDEX)
         {
             return {}; //no path exists
         }
 
-        float startEndHScore = computeHScore(startTriangle, endPoint);
+        const PathNode *endNodePath = nullptr;
+        PathCacheKey pathCacheKey = {};
+        if(pathCache)
+        {
+            pathCacheKey = buildPathCacheKey(startTriangle, endTriangle);
+            if(pathCache->findCorridor(pathCacheKey, corridor))
+            {
+                endNodePath = restoreCorridor();
+                if(!endNodePath)
+                { //corridor not valid anymore
+                    pathCache->removeCorridor(pathCacheKey);
+                }
+            }
+        }
+
+        if(!endNodePath)
+        {
+            endNodePath = searchPathInCorridor(startTriangle, endTriangle, startPoint, endPoint);
+            if(!endNodePath)
+            {
+                endNodePath = searchPath(startTriangle, endTriangle, startPoint, endPoint, false);
+            }
+            if(endNodePath && pathCache)
+            {
+                saveCorridor(endNodePath);
+                pathCache->addCorridor(pathCacheKey, corridor);
+            }
+        }
+
+        if(endNodePath)
+        {
+            std::vector<std::shared_ptr<PathPortal>> pathPortals = determinePath(endNodePath, startPoint, endPoint);
+            return pathPortalsToPathPoints(pathPortals, true);
+        }
+
+        return {}; //no path exists
+    }
+
+    /**
+     * @return End node of the path found by the A* algorithm restricted to the polygons determined by the high level search. Null is
+     * returned when the high level search is not applicable or when no path is found.
+     */
+    const PathNode *PathfindingAStar::searchPathInCorridor(std::uint32_t startTriangle, std::uint32_t endTriangle, const Point3<float> &startPoint,
+            const Point3<float> &endPoint) const
+    {
+        if(!polygonGraph || compiledNavMesh->getTriangle(startTriangle).polygon == compiledNavMesh->getTriangle(endTriangle).polygon)
+        {
+            return nullptr;
+        }
+
+        if(!polygonCorridorFinder.findCorridor(*compiledNavMesh, *polygonGraph, startTriangle, endTriangle, endPoint, corridorPolygonIds))
+        {
+            return nullptr;
+        }
+
+        return searchPath(startTriangle, endTriangle, startPoint, endPoint, true);
+    }
+
+    /**
+     * @param restrictToCorridor Restrict the search to the polygons of the corridor found by the high level search
+     * @return End node of the path found by the A* algorithm. Null is returned when no path exists.
+     */
+    const PathNode *PathfindingAStar::searchPath(std::uint32_t startTriangle, std::uint32_t endTriangle, const Point3<float> &startPoint,
+            const Point3<float> &endPoint, bool restrictToCorridor) const
+    {
+        initializeSearch();
+        if(restrictToCorridor)
+        {
+            allowCorridorTriangles();
+        }
 
-        std::set<NavTriangle *> closedList;
-        std::multiset<std::shared_ptr<PathNode>, PathNodeCompare> openList;
-        openList.insert(std::make_shared<PathNode>(startTriangle, 0.0, startEndHScore));
+        float startEndHScore = computeHScore(startTriangle, endPoint);
+        openPathNode(startTriangle, 0.0, startEndHScore);
+        pathNodes[startTriangle].setEntryPoint(startPoint);
 
-        std::shared_ptr<PathNode> endNodePath = nullptr;
-        while(!openList.empty())
+        const PathNode *endNodePath = nullptr;
+        while(!openList.isEmpty())
         {
-            auto currentNodeIt = openList.begin(); //node with smallest fScore
-            std::shared_ptr<PathNode> currentNode = *currentNodeIt;
+            std::size_t currentNodeIndex = openList.pop(); //node with smallest fScore
+            closedSearchIds[currentNodeIndex] = searchId;
 
-            closedList.insert(currentNode->getNavTriangle().get());
-            openList.erase(currentNodeIt);
+            const PathNode &currentNode = pathNodes[currentNodeIndex];
+            if(&currentNode == endNodePath)
+            { //end node has the smallest F score: path cannot be improved anymore
+                break;
+            }
 
-            const auto &currTriangle = currentNode->getNavTriangle();
-            for(const auto &link : currTriangle->getLinks())
+            const CompiledNavTriangle &currTriangle = compiledNavMesh->getTriangle(currentNode.getTriangleIndex());
+            for(std::uint32_t linkIndex = currTriangle.firstLink; linkIndex < currTriangle.firstLink + currTriangle.linksCount; ++linkIndex)
             {
-                auto neighborTriangle = link->getTargetTriangle();
+                std::uint32_t neighborNodeIndex = compiledNavMesh->getLink(linkIndex).targetTriangle;
 
-                if(closedList.find(neighborTriangle.get())!=closedList.end())
+                if(closedSearchIds[neighborNodeIndex] == searchId)
                 { //already processed
                     continue;
                 }
+                if(restrictToCorridor && allowedSearchIds[neighborNodeIndex] != searchId)
+                { //outside the corridor
+                    continue;
+                }
 
-                std::shared_ptr<PathNode> neighborNodePath = retrievePathNodeFrom(openList, neighborTriangle);
-                if(!neighborNodePath)
+                PathNode &neighborNodePath = pathNodes[neighborNodeIndex];
+                Point3<float> entryPoint;
+                if(openedSearchIds[neighborNodeIndex] != searchId)
                 {
-                    float gScore = computeGScore(currentNode, link, startPoint);
-                    float hScore = computeHScore(neighborTriangle, endPoint);
-                    neighborNodePath.reset(new PathNode(neighborTriangle, gScore, hScore));
-                    neighborNodePath->setPreviousNode(currentNode, link);
+                    float gScore = computeGScore(currentNode, linkIndex, startPoint, endPoint, entryPoint);
+                    float hScore = computeHScore(neighborNodeIndex, endPoint);
 
-                    if(!endNodePath || neighborNodePath->getFScore() < endNodePath->getFScore())
+                    if(!endNodePath || gScore + hScore < endNodePath->getFScore())
                     {
-                        openList.insert(neighborNodePath);
-                    }
+                        openPathNode(neighborNodeIndex, gScore, hScore);
+                        neighborNodePath.setPreviousNode(&currentNode, linkIndex);
+                        neighborNodePath.setEntryPoint(entryPoint);
 
-                    if(neighborTriangle.get() == endTriangle.get())
-                    { //end triangle reached but continue on path nodes having a smaller F score
-                        endNodePath = neighborNodePath;
+                        if(neighborNodeIndex == endTriangle)
+                        { //end triangle reached but continue on path nodes having a smaller F score
+                            endNodePath = &neighborNodePath;
+                        }
                     }
                 }else
                 {
-                    float gScore = computeGScore(currentNode, link, startPoint);
-                    if(neighborNodePath->getGScore() > gScore)
+                    float gScore = computeGScore(currentNode, linkIndex, startPoint, endPoint, entryPoint);
+                    if(neighborNodePath.getGScore() > gScore)
                     { //better path found to reach neighborNodePath: override previous values
-                        neighborNodePath->setGScore(gScore);
-                        neighborNodePath->setPreviousNode(currentNode, link);
+                        neighborNodePath.setGScore(gScore);
+                        neighborNodePath.setPreviousNode(&currentNode, linkIndex);
+                        neighborNodePath.setEntryPoint(entryPoint);
+                        openList.decreaseKey(neighborNodeIndex);
                     }
                 }
             }
         }
 
-        if(endNodePath)
-        {
-            std::vector<std::shared_ptr<PathPortal>> pathPortals = determinePath(endNodePath, startPoint, endPoint);
-            return pathPortalsToPathPoints(pathPortals, true);
-        }
+        return endNodePath;
+    }
 
-        return {}; //no path exists
+    PathCacheKey PathfindingAStar::buildPathCacheKey(std::uint32_t startTriangle, std::uint32_t endTriangle) const
+    {
+        PathCacheKey pathCacheKey = {};
+        pathCacheKey.navMeshId = navMesh->getId();
+        pathCacheKey.startPolygonId = compiledNavMesh->getPolygon(compiledNavMesh->getTriangle(startTriangle).polygon).id;
+        pathCacheKey.startPolygonTriangleIndex = compiledNavMesh->computePolygonTriangleIndex(startTriangle);
+        pathCacheKey.endPolygonId = compiledNavMesh->getPolygon(compiledNavMesh->getTriangle(endTriangle).polygon).id;
+        pathCacheKey.endPolygonTriangleIndex = compiledNavMesh->computePolygonTriangleIndex(endTriangle);
+        return pathCacheKey;
     }
 
-    std::shared_ptr<NavTriangle> PathfindingAStar::findTriangle(const Point3<float> &point) const
+    /**
+     * Rebuild the path nodes of the cached corridor on the current navigation mesh
+     * @return End node of the corridor. Null is returned when the corridor doesn't match the navigation mesh anymore.
+     */
+    const PathNode *PathfindingAStar::restoreCorridor() const
     {
-        float bestVerticalDistance = std::numeric_limits<float>::max();
-        std::shared_ptr<NavTriangle> result = nullptr;
+        initializeSearch();
 
-        for (const auto &polygon : navMesh->getPolygons())
+        const PathNode *previousNode = nullptr;
+        for(const auto &corridorTriangle : corridor)
         {
-            for (std::size_t triIndex = 0; triIndex < polygon->getTriangles().size(); ++triIndex)
+            std::uint32_t polygonIndex = compiledNavMesh->findPolygon(corridorTriangle.polygonId);
+            if(polygonIndex == CompiledNavMesh::NO_INDEX || corridorTriangle.polygonTriangleIndex >= compiledNavMesh->getPolygon(polygonIndex).trianglesCount)
             {
-                const auto &triangle = polygon->getTriangles()[triIndex];
-                Point2<float> flattenPoint(point.X, point.Z);
+                return nullptr;
+            }
+            auto triangleIndex = static_cast<std::uint32_t>(compiledNavMesh->getPolygon(polygonIndex).firstTriangle + corridorTriangle.polygonTriangleIndex);
 
-                if (isPointInsideTriangle(flattenPoint, polygon, triangle))
+            PathNode &pathNode = pathNodes[triangleIndex];
+            pathNode.reset(triangleIndex, 0.0f, 0.0f);
+            if(previousNode)
+            {
+                const CompiledNavTriangle &previousTriangle = compiledNavMesh->getTriangle(previousNode->getTriangleIndex());
+                std::uint32_t linkIndex = previousTriangle.firstLink + static_cast<std::uint32_t>(corridorTriangle.linkIndex);
+                if(corridorTriangle.linkIndex >= previousTriangle.linksCount || compiledNavMesh->getLink(linkIndex).targetTriangle != triangleIndex)
                 {
-                    float verticalDistance = point.Y - triangle->getCenterPoint().Y;
-                    if (verticalDistance >= 0.0 && verticalDistance < bestVerticalDistance)
-                    {
-                        bestVerticalDistance = verticalDistance;
-                        result = triangle;
-                    }
+                    return nullptr;
                 }
+                pathNode.setPreviousNode(previousNode, linkIndex);
             }
+            previousNode = &pathNode;
         }
-        return result;
+
+        return previousNode;
     }
 
-    bool PathfindingAStar::isPointInsideTriangle(const Point2<float> &point, const std::shared_ptr<NavPolygon> &polygon, const std::shared_ptr<NavTriangle> &triangle) const
+    void PathfindingAStar::saveCorridor(const PathNode *endNode) const
     {
-        Point2<float> p0 = polygon->getPoint(triangle->getIndex(0)).toPoint2XZ();
-        Point2<float> p1 = polygon->getPoint(triangle->getIndex(1)).toPoint2XZ();
-        Point2<float> p2 = polygon->getPoint(triangle->getIndex(2)).toPoint2XZ();
-
-        float crossProduct1 = crossProduct(point, p0, p1);
-        float crossProduct2 = crossProduct(point, p1, p2);
-        if(crossProduct1 * crossProduct2 < 0.0f)
-        { //cross products have different sign
-            return false;
+        corridor.clear();
+        for(const PathNode *pathNode = endNode; pathNode != nullptr; pathNode = pathNode->getPreviousNode())
+        {
+            PathCorridorTriangle corridorTriangle = {};
+            corridorTriangle.polygonId = compiledNavMesh->getPolygon(compiledNavMesh->getTriangle(pathNode->getTriangleIndex()).polygon).id;
+            corridorTriangle.polygonTriangleIndex = compiledNavMesh->computePolygonTriangleIndex(pathNode->getTriangleIndex());
+            if(pathNode->getPreviousNode())
+            {
+                const CompiledNavTriangle &previousTriangle = compiledNavMesh->getTriangle(pathNode->getPreviousNode()->getTriangleIndex());
+                assert(pathNode->getLinkIndex() - previousTriangle.firstLink < previousTriangle.linksCount);
+                corridorTriangle.linkIndex = pathNode->getLinkIndex() - previousTriangle.firstLink;
+            }
+            corridor.push_back(corridorTriangle);
         }
-
-        float crossProduct3 = crossProduct(point, p2, p0);
-        return crossProduct2 * crossProduct3 >= 0.0f; //check cross products sign
+        std::reverse(corridor.begin(), corridor.end());
     }
 
-    float PathfindingAStar::crossProduct(const Point2<float> &p1, const Point2<float> &p2, const Point2<float> &p3) const
+    /**
+     * Prepare the dense nodes arrays for a new search. Nodes of previous searches are invalidated by incrementing the search id.
+     */
+    void PathfindingAStar::initializeSearch() const
     {
-        //Same as: p3.vector(p1).crossProduct(p3.vector(p2))
-        return (p1.X - p3.X) * (p2.Y - p3.Y) - (p2.X - p3.X) * (p1.Y - p3.Y);
+        std::size_t trianglesCount = compiledNavMesh->getTrianglesCount();
+        if(pathNodes.size() < trianglesCount)
+        {
+            pathNodes.resize(trianglesCount);
+            openedSearchIds.resize(trianglesCount, 0);
+            closedSearchIds.resize(trianglesCount, 0);
+            allowedSearchIds.resize(trianglesCount, 0);
+        }
+        openList.clear(trianglesCount);
+
+        if(++searchId == 0)
+        { //search id overflow: reset all nodes
+            std::fill(openedSearchIds.begin(), openedSearchIds.end(), 0);
+            std::fill(closedSearchIds.begin(), closedSearchIds.end(), 0);
+            std::fill(allowedSearchIds.begin(), allowedSearchIds.end(), 0);
+            searchId = 1;
+        }
     }
 
-    std::shared_ptr<PathNode> PathfindingAStar::retrievePathNodeFrom(const std::multiset<std::shared_ptr<PathNode>, PathNodeCompare> &pathNodes,
-                                                                     const std::shared_ptr<NavTriangle> &navTriangle) const
+    void PathfindingAStar::allowCorridorTriangles() const
     {
-        for(const auto &pathNode : pathNodes)
+        for(unsigned int corridorPolygonId : corridorPolygonIds)
         {
-            if(pathNode->getNavTriangle().get() == navTriangle.get())
+            std::uint32_t polygonIndex = compiledNavMesh->findPolygon(corridorPolygonId);
+            if(polygonIndex != CompiledNavMesh::NO_INDEX)
             {
-                return pathNode;
+                const CompiledNavPolygon &polygon = compiledNavMesh->getPolygon(polygonIndex);
+                std::fill(allowedSearchIds.begin() + polygon.firstTriangle, allowedSearchIds.begin() + polygon.firstTriangle + polygon.trianglesCount, searchId);
             }
         }
-        return std::shared_ptr<PathNode>();
+    }
+
+    void PathfindingAStar::openPathNode(std::uint32_t nodeIndex, float gScore, float hScore) const
+    {
+        assert(nodeIndex < pathNodes.size());
+
+        pathNodes[nodeIndex].reset(nodeIndex, gScore, hScore);
+        openedSearchIds[nodeIndex] = searchId;
+        openList.push(nodeIndex);
+    }
+
+    /**
+     * Compute score from 'startPoint' to the target triangle of the link by extending the path of 'currentNode' (constant time)
+     * @param entryPoint [out] Point where the path enters in the target triangle of the link
+     */
+    float PathfindingAStar::computeGScore(const PathNode &currentNode, std::uint32_t linkIndex, const Point3<float> &startPoint,
+            const Point3<float> &endPoint, Point3<float> &entryPoint) const
+    {
+        std::uint32_t targetTriangle = compiledNavMesh->getLink(linkIndex).targetTriangle;
+        if(exactGScore)
+        {
+            entryPoint = compiledNavMesh->getTriangle(targetTriangle).centerPoint;
+            return computeExactGScore(currentNode, linkIndex, startPoint);
+        }
+
+        PathNode neighborNodePath(targetTriangle, 0.0f, 0.0f);
+        neighborNodePath.setPreviousNode(&currentNode, linkIndex);
+        PathNodeEdgesLink pathNodeEdgesLink = neighborNodePath.computePathNodeEdgesLink(*compiledNavMesh);
+
+        Point3<float> exitPoint = computeEntryPoint(pathNodeEdgesLink.sourceEdge, currentNode.getEntryPoint(), endPoint);
+        float gScore = currentNode.getGScore() + currentNode.getEntryPoint().distance(exitPoint);
+        if(pathNodeEdgesLink.areIdenticalEdges)
+        {
+            entryPoint = exitPoint;
+        }else
+        { //jump
+            entryPoint = pathNodeEdgesLink.targetEdge.closestPoint(exitPoint);
+            gScore += exitPoint.distance(entryPoint) + jumpAdditionalCost;
+        }
+
+        return gScore;
+    }
+
+    /**
+     * @return Point of the portal crossed by the line (on XZ plane) from the previous entry point to the end point. When the line doesn't
+     * cross the portal, the nearest portal extremity is returned.
+     */
+    Point3<float> PathfindingAStar::computeEntryPoint(const LineSegment3D<float> &portal, const Point3<float> &previousEntryPoint, const Point3<float> &endPoint) const
+    {
+        Vector3<float> portalVector = portal.getA().vector(portal.getB());
+        Vector3<float> moveVector = previousEntryPoint.vector(endPoint);
+        float denominator = portalVector.X * moveVector.Z - portalVector.Z * moveVector.X;
+        if(std::abs(denominator) < std::numeric_limits<float>::epsilon())
+        { //portal parallel to the move direction
+            return portal.closestPoint(previousEntryPoint);
+        }
+
+        Vector3<float> portalToEntryPoint = portal.getA().vector(previousEntryPoint);
+        float portalRatio = (portalToEntryPoint.X * moveVector.Z - portalToEntryPoint.Z * moveVector.X) / denominator;
+        portalRatio = MathAlgorithm::clamp(portalRatio, 0.0f, 1.0f);
+        return portal.getA().translate(portalVector * portalRatio);
     }
 
     /**
-     * Compute score from 'startPoint to 'link'
+     * Compute score from 'startPoint' to the center of target triangle of the link by applying the funnel algorithm on all the path
      */
-    float PathfindingAStar::computeGScore(const std::shared_ptr<PathNode> &currentNode, const std::shared_ptr<NavLink> &link, const Point3<float> &startPoint) const
+    float PathfindingAStar::computeExactGScore(const PathNode &currentNode, std::uint32_t linkIndex, const Point3<float> &startPoint) const
     {
-        std::shared_ptr<PathNode> neighborNodePath = std::make_shared<PathNode>(link->getTargetTriangle(), 0.0f, 0.0f);
-        neighborNodePath->setPreviousNode(currentNode, link);
-        std::vector<std::shared_ptr<PathPortal>> pathPortals = determinePath(neighborNodePath, startPoint, link->getTargetTriangle()->getCenterPoint());
+        std::uint32_t targetTriangle = compiledNavMesh->getLink(linkIndex).targetTriangle;
+        PathNode neighborNodePath(targetTriangle, 0.0f, 0.0f);
+        neighborNodePath.setPreviousNode(&currentNode, linkIndex);
+        std::vector<std::shared_ptr<PathPortal>> pathPortals = determinePath(&neighborNodePath, startPoint, compiledNavMesh->getTriangle(targetTriangle).centerPoint);
         std::vector<PathPoint> path = pathPortalsToPathPoints(pathPortals, false);
 
         float pathCost = 0.0f;
@@ -181,24 +392,24 @@ namespace urchin
     /**
      * Compute approximate score from 'current' to 'endPoint'
      */
-    float PathfindingAStar::computeHScore(const std::shared_ptr<NavTriangle> &current, const Point3<float> &endPoint) const
+    float PathfindingAStar::computeHScore(std::uint32_t currentTriangle, const Point3<float> &endPoint) const
     {
-        Point3<float> currentPoint = current->getCenterPoint();
+        const Point3<float> &currentPoint = compiledNavMesh->getTriangle(currentTriangle).centerPoint;
         return std::abs(currentPoint.X - endPoint.X) + std::abs(currentPoint.Y - endPoint.Y) + std::abs(currentPoint.Z - endPoint.Z);
     }
 
-    std::vector<std::shared_ptr<PathPortal>> PathfindingAStar::determinePath(const std::shared_ptr<PathNode> &endNode, const Point3<float> &startPoint,
+    std::vector<std::shared_ptr<PathPortal>> PathfindingAStar::determinePath(const PathNode *endNode, const Point3<float> &startPoint,
                                                                const Point3<float> &endPoint) const
     {
         std::vector<std::shared_ptr<PathPortal>> portals;
         portals.reserve(10); //estimated memory size
 
-        std::shared_ptr<PathNode> pathNode = endNode;
+        const PathNode *pathNode = endNode;
         std::shared_ptr<PathPortal> endPortal = std::make_shared<PathPortal>(LineSegment3D<float>(endPoint, endPoint), pathNode, nullptr, false);
         portals.emplace_back(endPortal);
         while(pathNode->getPreviousNode()!=nullptr)
         {
-            PathNodeEdgesLink pathNodeEdgesLink = pathNode->computePathNodeEdgesLink();
+            PathNodeEdgesLink pathNodeEdgesLink = pathNode->computePathNodeEdgesLink(*compiledNavMesh);
 
             LineSegment3D<float> targetPortal = rearrangePortal(pathNodeEdgesLink.targetEdge, portals);
             portals.emplace_back(std::make_shared<PathPortal>(targetPortal, pathNode->getPreviousNode(), pathNode, false));
@@ -253,7 +464,8 @@ namespace urchin
             {
                 if(followTopography && !pathPoints.empty())
                 {
-                    auto navPolygonTopography = pathPortal->getPreviousPathNode()->getNavTriangle()->getNavPolygon()->getNavTopography();
+                    std::uint32_t polygonIndex = compiledNavMesh->getTriangle(pathPortal->getPreviousPathNode()->getTriangleIndex()).polygon;
+                    const auto &navPolygonTopography = compiledNavMesh->getPolygon(polygonIndex).navTopography;
                     if(navPolygonTopography)
                     {
                         const Point3<float> &startPoint = pathPoints.back().getPoint();
@@ -308,7 +520,7 @@ namespace urchin
                     portals[i]->setTransitionPoint(jumpEndPoint);
                 }
                 previousTransitionPoint = portals[i]->getTransitionPoint();
-            } else if (!portals[i]->hasTransitionPoint() && portals[i]->hasDifferentTopography())
+            } else if (!portals[i]->hasTransitionPoint() && portals[i]->hasDifferentTopography(*compiledNavMesh))
             {
                 portals[i]->setTransitionPoint(computeTransitionPoint(portals[i], previousTransitionPoint));
                 previousTransitionPoint = portals[i]->getTransitionPoint();
@@ -6,36 +6,57 @@
 #include "UrchinCommon.h"
 
 #include "path/navmesh/model/output/NavMesh.h"
-#include "path/navmesh/model/output/NavTriangle.h"
+#include "path/navmesh/model/output/CompiledNavMesh.h"
 #include "path/pathfinding/PathNode.h"
+#include "path/pathfinding/PathNodeHeap.h"
+#include "path/pathfinding/PathCache.h"
+#include "path/pathfinding/hierarchical/PolygonGraph.h"
+#include "path/pathfinding/hierarchical/PolygonCorridorFinder.h"
 #include "path/pathfinding/PathPortal.h"
 #include "path/PathPoint.h"
 
 namespace urchin
 {
 
-    struct PathNodeCompare
-    {
-        bool operator()(const std::shared_ptr<PathNode> &, const std::shared_ptr<PathNode> &) const;
-    };
-
+    /**
+     * A* path finding on the triangles of the compiled navigation mesh. Path nodes are stored in dense arrays indexed by the triangles
+     * index and reused from one search to another thanks to a search id (generation counter): a search doesn't allocate nodes.
+     * An instance must not be used concurrently by several threads.
+     * G score of a node is computed incrementally from the G score of its previous node: path goes through one point of each crossed
+     * portal, the point aiming the end point. The funnel algorithm is applied once on the final path.
+     * When a polygon graph is defined and the start and end points are on different polygons, a high level search on the polygon graph
+     * determines the polygons to cross: the A* on the triangles is then restricted to these polygons.
+     * When a path cache is defined, the corridor of triangles found by a previous search between the same start and end triangles is
+     * reused: only the funnel algorithm is applied on it.
+     */
     class PathfindingAStar
     {
         public:
-            explicit PathfindingAStar(std::shared_ptr<NavMesh>);
+            explicit PathfindingAStar(std::shared_ptr<const NavMesh>);
+
+            void setNavMesh(std::shared_ptr<const NavMesh>);
+            void setPathCache(PathCache *);
+            void setExactGScore(bool);
+            void setPolygonGraph(const PolygonGraph *);
 
             std::vector<PathPoint> findPath(const Point3<float> &, const Point3<float> &) const;
 
         private:
-            std::shared_ptr<NavTriangle> findTriangle(const Point3<float> &) const;
-            bool isPointInsideTriangle(const Point2<float> &, const std::shared_ptr<NavPolygon> &, const std::shared_ptr<NavTriangle> &) const;
-            float crossProduct(const Point2<float> &, const Point2<float> &, const Point2<float> &) const;
+            const PathNode *searchPathInCorridor(std::uint32_t, std::uint32_t, const Point3<float> &, const Point3<float> &) const;
+            const PathNode *searchPath(std::uint32_t, std::uint32_t, const Point3<float> &, const Point3<float> &, bool) const;
+            void allowCorridorTriangles() const;
+            PathCacheKey buildPathCacheKey(std::uint32_t, std::uint32_t) const;
+            const PathNode *restoreCorridor() const;
+            void saveCorridor(const PathNode *) const;
 
-            std::shared_ptr<PathNode> retrievePathNodeFrom(const std::multiset<std::shared_ptr<PathNode>, PathNodeCompare> &, const std::shared_ptr<NavTriangle> &) const;
-            float computeGScore(const std::shared_ptr<PathNode> &, const std::shared_ptr<NavLink> &, const Point3<float> &) const;
-            float computeHScore(const std::shared_ptr<NavTriangle> &, const Point3<float> &) const;
+            void initializeSearch() const;
+            void openPathNode(std::uint32_t, float, float) const;
+            float computeGScore(const PathNode &, std::uint32_t, const Point3<float> &, const Point3<float> &, Point3<float> &) const;
+            Point3<float> computeEntryPoint(const LineSegment3D<float> &, const Point3<float> &, const Point3<float> &) const;
+            float computeExactGScore(const PathNode &, std::uint32_t, const Point3<float> &) const;
+            float computeHScore(std::uint32_t, const Point3<float> &) const;
 
-            std::vector<std::shared_ptr<PathPortal>> determinePath(const std::shared_ptr<PathNode> &, const Point3<float> &, const Point3<float> &) const;
+            std::vector<std::shared_ptr<PathPortal>> determinePath(const PathNode *, const Point3<float> &, const Point3<float> &) const;
             LineSegment3D<float> rearrangePortal(const LineSegment3D<float> &, const std::vector<std::shared_ptr<PathPortal>> &) const;
             Point3<float> middlePoint(const LineSegment3D<float> &) const;
 
@@ -44,7 +65,21 @@ namespace urchin
             Point3<float> computeTransitionPoint(const std::shared_ptr<PathPortal> &, const Point3<float> &) const;
 
             const float jumpAdditionalCost;
-            std::shared_ptr<NavMesh> navMesh;
+            std::shared_ptr<const NavMesh> navMesh;
+            PathCache *pathCache;
+            bool exactGScore;
+            const PolygonGraph *polygonGraph;
+
+            mutable std::shared_ptr<const CompiledNavMesh> compiledNavMesh; //compiled navigation mesh of the current search
+            mutable std::vector<PathNode> pathNodes;
+            mutable std::vector<unsigned int> openedSearchIds; //search id which has opened the node
+            mutable std::vector<unsigned int> closedSearchIds; //search id which has closed the node
+            mutable PathNodeHeap openList;
+            mutable std::vector<unsigned int> allowedSearchIds; //search id which allows the node (search restricted to a corridor of polygons)
+            mutable unsigned int searchId;
+            mutable std::vector<PathCorridorTriangle> corridor;
+            mutable PolygonCorridorFinder polygonCorridorFinder;
+            mutable std::vector<unsigned int> corridorPolygonIds;
     };
 
 }
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <limits>
+
+#include "PolygonCorridorFinder.h"
+
+namespace urchin
+{
+
+    /**
+     * @param startTriangle Index of the start triangle in the compiled navigation mesh
+     * @param endTriangle Index of the end triangle in the compiled navigation mesh
+     * @param endPoint End point of the path: used for the heuristic
+     * @param corridorPolygonIds [out] Identifiers of the polygons to cross from the start polygon to the end polygon (both included)
+     * @return True if a corridor exists
+     */
+    bool PolygonCorridorFinder::findCorridor(const CompiledNavMesh &compiledNavMesh, const PolygonGraph &polygonGraph, std::uint32_t startTriangle,
+            std::uint32_t endTriangle, const Point3<float> &endPoint, std::vector<unsigned int> &corridorPolygonIds)
+    {
+        std::uint32_t startPolygonIndex = compiledNavMesh.getTriangle(startTriangle).polygon;
+        std::uint32_t endPolygonIndex = compiledNavMesh.getTriangle(endTriangle).polygon;
+        unsigned int startPolygonId = compiledNavMesh.getPolygon(startPolygonIndex).id;
+        unsigned int endPolygonId = compiledNavMesh.getPolygon(endPolygonIndex).id;
+        const PolygonCluster *startCluster = polygonGraph.findCluster(startPolygonId);
+        const PolygonCluster *endCluster = polygonGraph.findCluster(endPolygonId);
+        if(!startCluster || !endCluster)
+        {
+            return false;
+        }
+
+        trianglesDistance.compute(compiledNavMesh, startPolygonIndex, {compiledNavMesh.computePolygonTriangleIndex(startTriangle)}, startDistances);
+        trianglesDistance.compute(compiledNavMesh, endPolygonIndex, {compiledNavMesh.computePolygonTriangleIndex(endTriangle)}, endDistances);
+
+        const std::vector<const PolygonPortal *> &portals = polygonGraph.getPortals();
+        portalGScores.assign(portals.size(), std::numeric_limits<float>::max());
+        previousPortals.assign(portals.size(), NO_PORTAL);
+
+        for(const auto &startPortal : startCluster->outgoingPortals)
+        {
+            float startCost = std::numeric_limits<float>::max();
+            for(std::size_t sourceTriangle : startPortal.sourceTriangles)
+            {
+                startCost = std::min(startCost, startDistances[sourceTriangle]);
+            }
+            if(startCost != std::numeric_limits<float>::max())
+            {
+                openPortal(startPortal, startCost + startPortal.crossingCost, NO_PORTAL, endPoint);
+            }
+        }
+
+        float bestCost = std::numeric_limits<float>::max();
+        std::size_t bestEndPortal = NO_PORTAL;
+        while(!openPortals.empty())
+        {
+            FScorePortal fScorePortal = openPortals.top();
+            openPortals.pop();
+            if(fScorePortal.first >= bestCost)
+            { //end polygon reached and remaining portals cannot improve the cost
+                break;
+            }
+
+            const PolygonPortal &portal = *portals[fScorePortal.second];
+            float gScore = portalGScores[portal.portalIndex];
+            if(fScorePortal.first > gScore + portal.targetPoint.distance(endPoint))
+            { //portal already processed with a smaller score
+                continue;
+            }
+
+            if(portal.targetPolygonId == endPolygonId)
+            {
+                for(std::size_t targetTriangle : portal.targetTriangles)
+                {
+                    if(endDistances[targetTriangle] != std::numeric_limits<float>::max() && gScore + endDistances[targetTriangle] < bestCost)
+                    {
+                        bestCost = gScore + endDistances[targetTriangle];
+                        bestEndPortal = portal.portalIndex;
+                    }
+                }
+            }
+
+            const PolygonCluster *cluster = polygonGraph.findCluster(portal.targetPolygonId);
+            if(!cluster)
+            {
+                continue;
+            }
+            std::size_t outgoingPortalsCount = cluster->outgoingPortals.size();
+            for(std::size_t outgoingIndex=0; outgoingIndex<outgoingPortalsCount; ++outgoingIndex)
+            {
+                float traversalCost = cluster->traversalCosts[portal.targetIncomingIndex * outgoingPortalsCount + outgoingIndex];
+                if(traversalCost != std::numeric_limits<float>::max())
+                {
+                    const PolygonPortal &nextPortal = cluster->outgoingPortals[outgoingIndex];
+                    openPortal(nextPortal, gScore + traversalCost + nextPortal.crossingCost, portal.portalIndex, endPoint);
+                }
+            }
+        }
+
+        openPortals = {};
+        if(bestEndPortal == NO_PORTAL)
+        {
+            return false;
+        }
+
+        corridorPolygonIds.clear();
+        for(std::size_t portalIndex = bestEndPortal; portalIndex != NO_PORTAL; portalIndex = previousPortals[portalIndex])
+        {
+            corridorPolygonIds.push_back(portals[portalIndex]->targetPolygonId);
+        }
+        corridorPolygonIds.push_back(startPolygonId);
+        std::reverse(corridorPolygonIds.begin(), corridorPolygonIds.end());
+        return true;
+    }
+
+    void PolygonCorridorFinder::openPortal(const PolygonPortal &portal, float gScore, std::size_t previousPortal, const Point3<float> &endPoint)
+    {
+        if(gScore < portalGScores[portal.portalIndex])
+        {
+            portalGScores[portal.portalIndex] = gScore;
+            previousPortals[portal.portalIndex] = previousPortal;
+            openPortals.push(std::make_pair(gScore + portal.targetPoint.distance(endPoint), portal.portalIndex));
+        }
+    }
+
+}
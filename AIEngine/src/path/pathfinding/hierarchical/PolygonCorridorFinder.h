@@ -0,0 +1,43 @@
+#ifndef URCHINENGINE_POLYGONCORRIDORFINDER_H
+#define URCHINENGINE_POLYGONCORRIDORFINDER_H
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/CompiledNavMesh.h"
+#include "path/pathfinding/hierarchical/PolygonGraph.h"
+#include "path/pathfinding/hierarchical/PolygonTrianglesDistance.h"
+
+namespace urchin
+{
+
+    /**
+     * High level path finding: A* on the portals of the polygon graph. It determines the polygons to cross to go from a start triangle to
+     * an end triangle. Search is proportional to the number of polygons and not to the number of triangles (except for the start and
+     * end polygons). An instance must not be used concurrently by several threads.
+     */
+    class PolygonCorridorFinder
+    {
+        public:
+            bool findCorridor(const CompiledNavMesh &, const PolygonGraph &, std::uint32_t, std::uint32_t, const Point3<float> &, std::vector<unsigned int> &);
+
+        private:
+            void openPortal(const PolygonPortal &, float, std::size_t, const Point3<float> &);
+
+            static constexpr std::size_t NO_PORTAL = std::numeric_limits<std::size_t>::max();
+
+            PolygonTrianglesDistance trianglesDistance;
+            std::vector<float> startDistances;
+            std::vector<float> endDistances;
+
+            std::vector<float> portalGScores;
+            std::vector<std::size_t> previousPortals;
+            using FScorePortal = std::pair<float, std::size_t>;
+            std::priority_queue<FScorePortal, std::vector<FScorePortal>, std::greater<>> openPortals;
+    };
+
+}
+
+#endif
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <limits>
+
+#include "PolygonGraph.h"
+
+namespace urchin
+{
+
+    PolygonGraph::PolygonGraph() :
+            jumpAdditionalCost(ConfigService::instance()->getFloatValue("pathfinding.jumpAdditionalCost")),
+            navMeshUpdateId(0),
+            lastRefreshComputedClusters(0)
+    {
+
+    }
+
+    /**
+     * Update the graph with the changes of the last update of the navigation mesh. This method must be called after each update of the
+     * navigation mesh.
+     */
+    void PolygonGraph::refresh(const NavMesh &navMesh)
+    {
+        if(navMesh.getUpdateId() == navMeshUpdateId)
+        {
+            return;
+        }
+        navMeshUpdateId = navMesh.getUpdateId();
+        const CompiledNavMesh &compiledNavMesh = *navMesh.getCompiledNavMesh();
+
+        for(unsigned int changedPolygonId : navMesh.getChangedPolygonIds())
+        {
+            clusters.erase(changedPolygonId);
+        }
+        for(auto it = clusters.begin(); it != clusters.end();)
+        {
+            if(compiledNavMesh.findPolygon(it->first) == CompiledNavMesh::NO_INDEX)
+            { //polygon removed from navigation mesh
+                it = clusters.erase(it);
+            }else
+            {
+                ++it;
+            }
+        }
+        for(std::uint32_t polygonIndex=0; polygonIndex<compiledNavMesh.getPolygonsCount(); ++polygonIndex)
+        {
+            unsigned int polygonId = compiledNavMesh.getPolygon(polygonIndex).id;
+            if(polygonId != CompiledNavMesh::REMOVED_POLYGON_ID && clusters.find(polygonId) == clusters.end())
+            {
+                buildOutgoingPortals(compiledNavMesh, polygonIndex, clusters[polygonId]);
+            }
+        }
+
+        portals.clear();
+        for(auto &cluster : clusters)
+        {
+            cluster.second.incomingPortals.clear();
+        }
+        for(auto &cluster : clusters)
+        {
+            for(auto &outgoingPortal : cluster.second.outgoingPortals)
+            {
+                outgoingPortal.portalIndex = portals.size();
+                portals.push_back(&outgoingPortal);
+
+                auto itTargetCluster = clusters.find(outgoingPortal.targetPolygonId);
+                if(itTargetCluster != clusters.end())
+                {
+                    itTargetCluster->second.incomingPortals.push_back(&outgoingPortal);
+                }
+            }
+        }
+
+        lastRefreshComputedClusters = 0;
+        std::vector<unsigned int> incomingSourcePolygonIds;
+        for(auto &cluster : clusters)
+        {
+            std::vector<const PolygonPortal *> &incomingPortals = cluster.second.incomingPortals;
+            std::sort(incomingPortals.begin(), incomingPortals.end(), [](const PolygonPortal *p1, const PolygonPortal *p2) {
+                return p1->sourcePolygonId < p2->sourcePolygonId;
+            });
+
+            incomingSourcePolygonIds.clear();
+            for(std::size_t i=0; i<incomingPortals.size(); ++i)
+            {
+                const_cast<PolygonPortal *>(incomingPortals[i])->targetIncomingIndex = i;
+                incomingSourcePolygonIds.push_back(incomingPortals[i]->sourcePolygonId);
+            }
+
+            if(!cluster.second.upToDate || incomingSourcePolygonIds != cluster.second.traversalSourcePolygonIds)
+            {
+                computeTraversalCosts(compiledNavMesh, cluster.first, cluster.second);
+                cluster.second.traversalSourcePolygonIds = incomingSourcePolygonIds;
+                cluster.second.upToDate = true;
+                lastRefreshComputedClusters++;
+            }
+        }
+    }
+
+    /**
+     * @return Cluster of the polygon. Null is returned when the polygon is unknown.
+     */
+    const PolygonCluster *PolygonGraph::findCluster(unsigned int polygonId) const
+    {
+        auto itFind = clusters.find(polygonId);
+        return itFind == clusters.end() ? nullptr : &itFind->second;
+    }
+
+    /**
+     * @return All the portals of the graph indexed by PolygonPortal::portalIndex
+     */
+    const std::vector<const PolygonPortal *> &PolygonGraph::getPortals() const
+    {
+        return portals;
+    }
+
+    /**
+     * @return Number of clusters having their traversal costs computed by the last refresh
+     */
+    unsigned int PolygonGraph::getLastRefreshComputedClusters() const
+    {
+        return lastRefreshComputedClusters;
+    }
+
+    void PolygonGraph::buildOutgoingPortals(const CompiledNavMesh &compiledNavMesh, std::uint32_t polygonIndex, PolygonCluster &cluster) const
+    {
+        const CompiledNavPolygon &polygon = compiledNavMesh.getPolygon(polygonIndex);
+        for(std::uint32_t triangleIndex=0; triangleIndex<polygon.trianglesCount; ++triangleIndex)
+        {
+            const CompiledNavTriangle &triangle = compiledNavMesh.getTriangle(polygon.firstTriangle + triangleIndex);
+            for(std::uint32_t linkIndex = triangle.firstLink; linkIndex < triangle.firstLink + triangle.linksCount; ++linkIndex)
+            {
+                const CompiledNavLink &link = compiledNavMesh.getLink(linkIndex);
+                if(link.linkType == NavLinkType::STANDARD)
+                { //link inside the polygon
+                    continue;
+                }
+
+                const CompiledNavTriangle &targetTriangle = compiledNavMesh.getTriangle(link.targetTriangle);
+                unsigned int targetPolygonId = compiledNavMesh.getPolygon(targetTriangle.polygon).id;
+                auto itPortal = std::find_if(cluster.outgoingPortals.begin(), cluster.outgoingPortals.end(), [targetPolygonId](const PolygonPortal &portal) {
+                    return portal.targetPolygonId == targetPolygonId;
+                });
+                if(itPortal == cluster.outgoingPortals.end())
+                {
+                    PolygonPortal portal = {};
+                    portal.sourcePolygonId = polygon.id;
+                    portal.targetPolygonId = targetPolygonId;
+                    portal.crossingCost = std::numeric_limits<float>::max();
+                    cluster.outgoingPortals.push_back(portal);
+                    itPortal = cluster.outgoingPortals.end() - 1;
+                }
+
+                float crossingCost = triangle.centerPoint.distance(targetTriangle.centerPoint);
+                if(link.linkType == NavLinkType::JUMP)
+                {
+                    crossingCost += jumpAdditionalCost;
+                }
+                itPortal->crossingCost = std::min(itPortal->crossingCost, crossingCost);
+                itPortal->sourceTriangles.push_back(triangleIndex);
+                itPortal->targetTriangles.push_back(compiledNavMesh.computePolygonTriangleIndex(link.targetTriangle));
+                itPortal->targetPoint = itPortal->targetPoint + targetTriangle.centerPoint;
+            }
+        }
+
+        for(auto &portal : cluster.outgoingPortals)
+        {
+            portal.targetPoint = portal.targetPoint / static_cast<float>(portal.targetTriangles.size());
+
+            std::sort(portal.sourceTriangles.begin(), portal.sourceTriangles.end());
+            portal.sourceTriangles.erase(std::unique(portal.sourceTriangles.begin(), portal.sourceTriangles.end()), portal.sourceTriangles.end());
+            std::sort(portal.targetTriangles.begin(), portal.targetTriangles.end());
+            portal.targetTriangles.erase(std::unique(portal.targetTriangles.begin(), portal.targetTriangles.end()), portal.targetTriangles.end());
+        }
+    }
+
+    void PolygonGraph::computeTraversalCosts(const CompiledNavMesh &compiledNavMesh, unsigned int polygonId, PolygonCluster &cluster)
+    {
+        std::uint32_t polygonIndex = compiledNavMesh.findPolygon(polygonId);
+        std::size_t outgoingPortalsCount = cluster.outgoingPortals.size();
+        cluster.traversalCosts.assign(cluster.incomingPortals.size() * outgoingPortalsCount, std::numeric_limits<float>::max());
+
+        for(std::size_t incomingIndex=0; incomingIndex<cluster.incomingPortals.size(); ++incomingIndex)
+        {
+            trianglesDistance.compute(compiledNavMesh, polygonIndex, cluster.incomingPortals[incomingIndex]->targetTriangles, distances);
+            for(std::size_t outgoingIndex=0; outgoingIndex<outgoingPortalsCount; ++outgoingIndex)
+            {
+                float &traversalCost = cluster.traversalCosts[incomingIndex * outgoingPortalsCount + outgoingIndex];
+                for(std::size_t sourceTriangle : cluster.outgoingPortals[outgoingIndex].sourceTriangles)
+                {
+                    traversalCost = std::min(traversalCost, distances[sourceTriangle]);
+                }
+            }
+        }
+    }
+
+}
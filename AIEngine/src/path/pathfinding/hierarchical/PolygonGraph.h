@@ -0,0 +1,75 @@
+#ifndef URCHINENGINE_POLYGONGRAPH_H
+#define URCHINENGINE_POLYGONGRAPH_H
+
+#include <vector>
+#include <unordered_map>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/NavMesh.h"
+#include "path/pathfinding/hierarchical/PolygonTrianglesDistance.h"
+
+namespace urchin
+{
+
+    /**
+     * Portal between two polygons: group of all the links (join polygons or jump links) from a source polygon to a target polygon
+     */
+    struct PolygonPortal
+    {
+        unsigned int sourcePolygonId;
+        unsigned int targetPolygonId;
+        std::vector<std::size_t> sourceTriangles; //index in the source polygon of the triangles having a link to the target polygon
+        std::vector<std::size_t> targetTriangles; //index in the target polygon of the triangles reached by the links
+        Point3<float> targetPoint; //average point where the links reach the target polygon
+        float crossingCost;
+
+        std::size_t portalIndex; //index of the portal in the graph
+        std::size_t targetIncomingIndex; //index of the portal in the incoming portals of the target polygon cluster
+    };
+
+    /**
+     * Cluster of triangles: all the triangles of a polygon
+     */
+    struct PolygonCluster
+    {
+        std::vector<PolygonPortal> outgoingPortals;
+        std::vector<const PolygonPortal *> incomingPortals;
+        std::vector<unsigned int> traversalSourcePolygonIds; //source polygons of the incoming portals used to compute the traversal costs
+        std::vector<float> traversalCosts; //cost to go from incoming portal 'i' to outgoing portal 'j': traversalCosts[i * outgoingPortals.size() + j]
+        bool upToDate = false;
+    };
+
+    /**
+     * Abstract graph of the navigation mesh where the nodes are the portals between polygons. Traversal costs between the portals of a
+     * polygon are precomputed. Graph is updated incrementally: only the polygons changed by a navigation mesh update and the polygons
+     * having different incoming portals are recomputed.
+     */
+    class PolygonGraph
+    {
+        public:
+            PolygonGraph();
+
+            void refresh(const NavMesh &);
+
+            const PolygonCluster *findCluster(unsigned int) const;
+            const std::vector<const PolygonPortal *> &getPortals() const;
+            unsigned int getLastRefreshComputedClusters() const;
+
+        private:
+            void buildOutgoingPortals(const CompiledNavMesh &, std::uint32_t, PolygonCluster &) const;
+            void computeTraversalCosts(const CompiledNavMesh &, unsigned int, PolygonCluster &);
+
+            const float jumpAdditionalCost;
+            unsigned int navMeshUpdateId;
+
+            std::unordered_map<unsigned int, PolygonCluster> clusters; //clusters by polygon id
+            std::vector<const PolygonPortal *> portals;
+            unsigned int lastRefreshComputedClusters;
+
+            PolygonTrianglesDistance trianglesDistance;
+            std::vector<float> distances;
+    };
+
+}
+
+#endif
@@ -0,0 +1,58 @@
+#include <limits>
+
+#include "PolygonTrianglesDistance.h"
+
+namespace urchin
+{
+
+    /**
+     * @param polygonIndex Index of the polygon in the compiled navigation mesh
+     * @param sourceTriangles Index (in the polygon) of the source triangles
+     * @param distances [out] Distance to each triangle of the polygon. Unreachable triangles have an infinite distance.
+     */
+    void PolygonTrianglesDistance::compute(const CompiledNavMesh &compiledNavMesh, std::uint32_t polygonIndex, const std::vector<std::size_t> &sourceTriangles,
+            std::vector<float> &distances)
+    {
+        const CompiledNavPolygon &polygon = compiledNavMesh.getPolygon(polygonIndex);
+        std::uint32_t firstTriangle = polygon.firstTriangle;
+        distances.assign(polygon.trianglesCount, std::numeric_limits<float>::max());
+
+        for(std::size_t sourceTriangle : sourceTriangles)
+        {
+            if(sourceTriangle < distances.size())
+            {
+                distances[sourceTriangle] = 0.0f;
+                openTriangles.push(std::make_pair(0.0f, sourceTriangle));
+            }
+        }
+
+        while(!openTriangles.empty())
+        {
+            DistanceTriangle distanceTriangle = openTriangles.top();
+            openTriangles.pop();
+            if(distanceTriangle.first > distances[distanceTriangle.second])
+            { //triangle already reached with a smaller distance
+                continue;
+            }
+
+            const CompiledNavTriangle &triangle = compiledNavMesh.getTriangle(firstTriangle + static_cast<std::uint32_t>(distanceTriangle.second));
+            for(std::uint32_t linkIndex = triangle.firstLink; linkIndex < triangle.firstLink + triangle.linksCount; ++linkIndex)
+            {
+                std::uint32_t targetTriangleIndex = compiledNavMesh.getLink(linkIndex).targetTriangle;
+                if(targetTriangleIndex < firstTriangle || targetTriangleIndex >= firstTriangle + distances.size())
+                { //triangle outside the polygon
+                    continue;
+                }
+
+                std::size_t targetTriangle = targetTriangleIndex - firstTriangle;
+                float distance = distanceTriangle.first + triangle.centerPoint.distance(compiledNavMesh.getTriangle(targetTriangleIndex).centerPoint);
+                if(distance < distances[targetTriangle])
+                {
+                    distances[targetTriangle] = distance;
+                    openTriangles.push(std::make_pair(distance, targetTriangle));
+                }
+            }
+        }
+    }
+
+}
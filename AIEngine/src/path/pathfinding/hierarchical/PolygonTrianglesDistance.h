@@ -0,0 +1,28 @@
+#ifndef URCHINENGINE_POLYGONTRIANGLESDISTANCE_H
+#define URCHINENGINE_POLYGONTRIANGLESDISTANCE_H
+
+#include <vector>
+#include <queue>
+
+#include "path/navmesh/model/output/CompiledNavMesh.h"
+
+namespace urchin
+{
+
+    /**
+     * Compute the distances (through the centers of the triangles) from source triangles to all the triangles of a polygon. Path
+     * cannot leave the polygon. Triangles are identified by their index in the polygon.
+     */
+    class PolygonTrianglesDistance
+    {
+        public:
+            void compute(const CompiledNavMesh &, std::uint32_t, const std::vector<std::size_t> &, std::vector<float> &);
+
+        private:
+            using DistanceTriangle = std::pair<float, std::size_t>;
+            std::priority_queue<DistanceTriangle, std::vector<DistanceTriangle>, std::greater<>> openTriangles;
+    };
+
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include "tools/vector/VectorEraser.h"
 #include "tools/thread/LockById.h"
 #include "tools/thread/ScopeLockById.h"
+#include "tools/thread/ThreadPool.h"
 
 #include "pattern/observer/Observable.h"
 #include "pattern/observer/Observer.h"
@@ -47,6 +48,7 @@
 
 #include "system/FileSystem.h"
 #include "system/FileHandler.h"
+#include "system/MemoryMappedFile.h"
 #include "system/NumericalCheck.h"
 
 #include "math/algebra/matrix/Matrix2.h"
@@ -48,6 +48,7 @@ namespace urchin
 
             float fatMargin;
             AABBNode<OBJ> *rootNode;
+            std::vector<AABBNode<OBJ> *> leavesToReinsert;
     };
 
     #include "AABBTree.inl"
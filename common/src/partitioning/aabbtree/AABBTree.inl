@@ -205,13 +205,11 @@ template<class OBJ> void AABBTree<OBJ>::removeNode(AABBNode<OBJ> *nodeToRemove)
 
 template<class OBJ> void AABBTree<OBJ>::updateObjects()
 {
-    for(int i=objectsNode.size()-1; i>=0; --i)
-    { //loop backward to remove elements
-        auto it = objectsNode.begin();
-        std::advance(it, i);
-
+    leavesToReinsert.clear();
+    for(auto it = objectsNode.rbegin(); it != objectsNode.rend(); ++it)
+    { //loop backward: same order as leaves reinsertion
         AABBNode<OBJ> *leaf = it->second;
-        if(it->second->getNodeData()->isObjectMoving())
+        if(leaf->getNodeData()->isObjectMoving())
         {
             preUpdateObjectCallback(leaf);
 
@@ -220,12 +218,18 @@ template<class OBJ> void AABBTree<OBJ>::updateObjects()
 
             if(!leafFatAABBox.include(objectAABBox))
             {
-                AABBNodeData<OBJ> *clonedNodeData = leaf->getNodeData()->clone();
-                removeObject(leaf->getNodeData());
-                addObject(clonedNodeData);
+                leavesToReinsert.push_back(leaf);
             }
         }
     }
+
+    //leaves are reinserted once the map browsed: objects which don't move (e.g. sleeping bodies) are only checked by the loop above
+    for(AABBNode<OBJ> *leaf : leavesToReinsert)
+    {
+        AABBNodeData<OBJ> *clonedNodeData = leaf->getNodeData()->clone();
+        removeObject(leaf->getNodeData());
+        addObject(clonedNodeData);
+    }
 }
 
 template<class OBJ> void AABBTree<OBJ>::preUpdateObjectCallback(AABBNode<OBJ> *)
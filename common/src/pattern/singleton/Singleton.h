@@ -3,6 +3,8 @@
 
 #include <typeinfo>
 #include <iostream>
+#include <atomic>
+#include <mutex>
 
 #include "pattern/singleton/SingletonManager.h"
 #include "pattern/singleton/SingletonInterface.h"
@@ -11,7 +13,8 @@ namespace urchin
 {
 
     /**
-    * Allows to create a singleton class (no thread-safe)
+    * Allows to create a singleton class. Creation of the singleton is thread-safe: methods of the singleton class must be thread-safe
+    * when the singleton is used by several threads.
     */
     template<class T> class Singleton : public SingletonInterface
     {
@@ -23,7 +26,8 @@ namespace urchin
             Singleton();
 
         private:
-            static T *objectT;
+            static std::atomic<T *> objectT;
+            static std::mutex creationMutex;
     };
 
     #include "Singleton.inl"
@@ -1,5 +1,6 @@
 //static
-template<class T> T *Singleton<T>::objectT = nullptr;
+template<class T> std::atomic<T *> Singleton<T>::objectT(nullptr);
+template<class T> std::mutex Singleton<T>::creationMutex;
 
 template<class T> Singleton<T>::Singleton()
 {
@@ -8,20 +9,28 @@ template<class T> Singleton<T>::Singleton()
 
 template<class T> Singleton<T>::~Singleton()
 {
-    objectT = nullptr;
+    objectT.store(nullptr, std::memory_order_release);
 }
 
 template<class T> T* Singleton<T>::instance()
 {
-    if(!objectT)
+    T *object = objectT.load(std::memory_order_acquire);
+    if(!object)
     {
-        objectT = static_cast<T*>(SingletonManager::getSingleton(typeid(T).name()));
-        if(!objectT)
+        std::lock_guard<std::mutex> lock(creationMutex);
+
+        object = objectT.load(std::memory_order_relaxed);
+        if(!object)
         {
-            objectT = new T;
-            SingletonManager::addSingleton(typeid(T).name(), objectT);
+            object = static_cast<T*>(SingletonManager::getSingleton(typeid(T).name()));
+            if(!object)
+            {
+                object = new T;
+                SingletonManager::addSingleton(typeid(T).name(), object);
+            }
+            objectT.store(object, std::memory_order_release);
         }
     }
 
-    return objectT;
+    return object;
 }
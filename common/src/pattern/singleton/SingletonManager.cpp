@@ -4,10 +4,13 @@ namespace urchin
 {
 
     //static
+    std::recursive_mutex SingletonManager::mutex;
     std::map<std::string, SingletonInterface *> SingletonManager::singletons;
 
     void *SingletonManager::getSingleton(const std::string &name)
     {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+
         auto it = singletons.find(name);
         if(it==singletons.end())
         {
@@ -18,11 +21,15 @@ namespace urchin
 
     void SingletonManager::addSingleton(const std::string &name, SingletonInterface *ptr)
     {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+
         singletons[name] = ptr;
     }
 
     void SingletonManager::destroyAllSingletons()
     {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+
         for (auto &singleton : singletons)
         {
             delete singleton.second;
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 
 #include "pattern/singleton/SingletonInterface.h"
 
@@ -37,6 +38,7 @@ namespace urchin
             SingletonManager() = default;
             ~SingletonManager() = default;
 
+            static std::recursive_mutex mutex;
             static std::map<std::string, SingletonInterface *> singletons;
     };
 
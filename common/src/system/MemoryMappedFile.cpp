@@ -0,0 +1,118 @@
+#include <stdexcept>
+#include <string>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <cstring>
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#include "system/MemoryMappedFile.h"
+
+namespace urchin
+{
+
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(const std::string &filename) :
+            data(nullptr),
+            size(0)
+    {
+        HANDLE fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(fileHandle == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Unable to open file " + filename + ": error " + std::to_string(GetLastError()));
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if(!GetFileSizeEx(fileHandle, &fileSize))
+        {
+            CloseHandle(fileHandle);
+            throw std::runtime_error("Unable to read size of file " + filename + ": error " + std::to_string(GetLastError()));
+        }
+
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        if(size > 0)
+        { //empty file cannot be mapped
+            HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            void *mappedData = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if(!mappedData)
+            {
+                DWORD error = GetLastError();
+                if(mappingHandle)
+                {
+                    CloseHandle(mappingHandle);
+                }
+                CloseHandle(fileHandle);
+                throw std::runtime_error("Unable to map file " + filename + " in memory: error " + std::to_string(error));
+            }
+            data = static_cast<const char *>(mappedData);
+            CloseHandle(mappingHandle); //view stays valid once the mapping handle is closed
+        }
+
+        CloseHandle(fileHandle);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if(data)
+        {
+            UnmapViewOfFile(data);
+        }
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(const std::string &filename) :
+            data(nullptr),
+            size(0)
+    {
+        int fileDescriptor = open(filename.c_str(), O_RDONLY);
+        if(fileDescriptor == -1)
+        {
+            throw std::runtime_error("Unable to open file " + filename + ": " + std::strerror(errno));
+        }
+
+        struct stat fileStat = {};
+        if(fstat(fileDescriptor, &fileStat) == -1)
+        {
+            close(fileDescriptor);
+            throw std::runtime_error("Unable to read size of file " + filename + ": " + std::strerror(errno));
+        }
+
+        size = static_cast<std::size_t>(fileStat.st_size);
+        if(size > 0)
+        {
+            void *mappedData = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            if(mappedData == MAP_FAILED)
+            {
+                close(fileDescriptor);
+                throw std::runtime_error("Unable to map file " + filename + " in memory: " + std::strerror(errno));
+            }
+            data = static_cast<const char *>(mappedData);
+        }
+
+        close(fileDescriptor); //mapping stays valid once the file is closed
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if(data)
+        {
+            munmap(const_cast<char *>(data), size);
+        }
+    }
+#endif
+
+    const char *MemoryMappedFile::getData() const
+    {
+        return data;
+    }
+
+    std::size_t MemoryMappedFile::getSize() const
+    {
+        return size;
+    }
+
+}
@@ -0,0 +1,31 @@
+#ifndef URCHINENGINE_MEMORYMAPPEDFILE_H
+#define URCHINENGINE_MEMORYMAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+namespace urchin
+{
+
+    /**
+    * Read only file mapped in memory: the content is loaded on demand by the operating system
+    */
+    class MemoryMappedFile
+    {
+        public:
+            explicit MemoryMappedFile(const std::string &);
+            MemoryMappedFile(const MemoryMappedFile &) = delete;
+            MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+            ~MemoryMappedFile();
+
+            const char *getData() const;
+            std::size_t getSize() const;
+
+        private:
+            const char *data;
+            std::size_t size;
+    };
+
+}
+
+#endif
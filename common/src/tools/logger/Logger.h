@@ -5,6 +5,7 @@
 #include <sstream>
 #include <memory>
 #include <iostream>
+#include <mutex>
 
 namespace urchin
 {
@@ -42,6 +43,7 @@ namespace urchin
 
             virtual void write(const std::string &) = 0;
 
+            std::mutex mutex;
             bool bHasFailure;
             static std::unique_ptr<Logger> instance;
     };
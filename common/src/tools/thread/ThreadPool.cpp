@@ -0,0 +1,162 @@
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+#define CHUNKS_BY_THREAD 4
+
+namespace urchin
+{
+
+    /**
+     * @param numberWorkerThreads Number of threads created in addition of the calling thread. With zero worker thread, the loops
+     * are executed sequentially by the calling thread.
+     */
+    ThreadPool::ThreadPool(unsigned int numberWorkerThreads) :
+            stopWorkers(false),
+            task(nullptr),
+            taskSize(0),
+            numberChunks(0),
+            nextChunk(0),
+            completedChunks(0)
+    {
+        workers.reserve(numberWorkerThreads);
+        for(unsigned int i=0; i<numberWorkerThreads; ++i)
+        {
+            workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopWorkers = true;
+        }
+        chunkCondition.notify_all();
+
+        for(auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    /**
+     * @return Number of threads executing the loops (worker threads and calling thread)
+     */
+    unsigned int ThreadPool::getNumberThreads() const
+    {
+        return static_cast<unsigned int>(workers.size()) + 1;
+    }
+
+    /**
+     * Execute the task on the range [0, size[ split in chunks. The task receives the begin (inclusive) and end (exclusive) index
+     * of the chunk to process and must be thread-safe between two different chunks. Method must not be called from a task.
+     * @param minChunkSize Minimum number of elements by chunk: avoid to pay the synchronization cost for small ranges
+     */
+    void ThreadPool::parallelFor(std::size_t size, std::size_t minChunkSize, const std::function<void(std::size_t, std::size_t)> &parallelTask)
+    {
+        if(size == 0)
+        {
+            return;
+        }
+
+        std::size_t chunkSize = std::max(minChunkSize, static_cast<std::size_t>(1));
+        std::size_t maxNumberChunks = (size + chunkSize - 1) / chunkSize;
+        std::size_t chunksCount = std::min(maxNumberChunks, static_cast<std::size_t>(getNumberThreads()) * CHUNKS_BY_THREAD);
+        if(workers.empty() || chunksCount <= 1)
+        {
+            parallelTask(0, size);
+            return;
+        }
+
+        std::lock_guard<std::mutex> parallelForLock(parallelForMutex);
+        std::unique_lock<std::mutex> lock(mutex);
+
+        task = &parallelTask;
+        taskSize = size;
+        numberChunks = chunksCount;
+        nextChunk = 0;
+        completedChunks = 0;
+        taskException = nullptr;
+        chunkCondition.notify_all();
+
+        while(nextChunk < numberChunks)
+        {
+            executeChunk(lock);
+        }
+        completionCondition.wait(lock, [this]{return completedChunks == numberChunks;});
+
+        task = nullptr;
+        numberChunks = 0;
+        nextChunk = 0;
+
+        if(taskException)
+        {
+            std::rethrow_exception(taskException);
+        }
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            chunkCondition.wait(lock, [this]{return stopWorkers || nextChunk < numberChunks;});
+            if(stopWorkers)
+            {
+                return;
+            }
+
+            executeChunk(lock);
+        }
+    }
+
+    /**
+     * Execute next chunk of the current task. Lock is released during the execution of the chunk.
+     */
+    void ThreadPool::executeChunk(std::unique_lock<std::mutex> &lock)
+    {
+        std::size_t chunk = nextChunk++;
+        std::size_t beginIndex = (taskSize * chunk) / numberChunks;
+        std::size_t endIndex = (taskSize * (chunk + 1)) / numberChunks;
+        const std::function<void(std::size_t, std::size_t)> *chunkTask = task;
+
+        lock.unlock();
+        std::exception_ptr chunkException = nullptr;
+        try
+        {
+            (*chunkTask)(beginIndex, endIndex);
+        }catch(...)
+        {
+            chunkException = std::current_exception();
+        }
+        lock.lock();
+
+        if(chunkException && !taskException)
+        {
+            taskException = chunkException;
+        }
+
+        if(++completedChunks == numberChunks)
+        {
+            completionCondition.notify_all();
+        }
+    }
+
+    /**
+     * Execute the task on the thread pool or on the calling thread when the thread pool is null
+     * @param threadPool Thread pool executing the task. Null to execute the task on the calling thread.
+     * @param minChunkSize Minimum number of elements by chunk (see ThreadPool::parallelFor)
+     */
+    void parallelFor(ThreadPool *threadPool, std::size_t size, std::size_t minChunkSize, const std::function<void(std::size_t, std::size_t)> &parallelTask)
+    {
+        if(threadPool)
+        {
+            threadPool->parallelFor(size, minChunkSize, parallelTask);
+        }else if(size > 0)
+        {
+            parallelTask(0, size);
+        }
+    }
+
+}
@@ -0,0 +1,51 @@
+#ifndef URCHINENGINE_THREADPOOL_H
+#define URCHINENGINE_THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace urchin
+{
+
+    /**
+    * Pool of worker threads allowing to split a loop in chunks executed in parallel. The calling thread also executes chunks.
+    */
+    class ThreadPool
+    {
+        public:
+            explicit ThreadPool(unsigned int);
+            ~ThreadPool();
+
+            unsigned int getNumberThreads() const;
+
+            void parallelFor(std::size_t, std::size_t, const std::function<void(std::size_t, std::size_t)> &);
+
+        private:
+            void workerLoop();
+            void executeChunk(std::unique_lock<std::mutex> &);
+
+            std::vector<std::thread> workers;
+
+            std::mutex parallelForMutex;
+            std::mutex mutex;
+            std::condition_variable chunkCondition;
+            std::condition_variable completionCondition;
+            bool stopWorkers;
+
+            const std::function<void(std::size_t, std::size_t)> *task;
+            std::size_t taskSize;
+            std::size_t numberChunks;
+            std::size_t nextChunk;
+            std::size_t completedChunks;
+            std::exception_ptr taskException;
+    };
+
+    void parallelFor(ThreadPool *, std::size_t, std::size_t, const std::function<void(std::size_t, std::size_t)> &);
+
+}
+
+#endif
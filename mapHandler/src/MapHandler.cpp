@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <fstream>
 
 #include "MapHandler.h"
 #include "load/NullLoadCallback.h"
@@ -7,6 +8,7 @@ namespace urchin
 {
 
     MapHandler::MapHandler(Renderer3d *renderer3d, PhysicsWorld *physicsWorld, SoundManager *soundManager, AIManager *aiManager) :
+        aiManager(aiManager),
         map(nullptr)
     {
         if(!renderer3d)
@@ -37,9 +39,33 @@ namespace urchin
         XmlParser xmlParser(filename);
 
         relativeWorkingDirectory = xmlParser.getRootChunk()->getAttributeValue(WORKING_DIR_ATTR);
+
+        //baked navigation mesh defined before the AI entities are added: the first generation can start during the map loading
+        loadBakedNavMesh(filename);
         map->loadFrom(xmlParser.getRootChunk(), xmlParser, loadCallback);
     }
 
+    /**
+     * Load the navigation mesh baked with the map: the navigation mesh is not generated from scratch when the AI world didn't change since
+     * the bake. A missing or invalid baked file is ignored.
+     */
+    void MapHandler::loadBakedNavMesh(const std::string &filename)
+    {
+        std::string bakedNavMeshFilePath = FileSystem::instance()->getResourcesDirectory() + getBakedNavMeshFilename(filename);
+        if(!std::ifstream(bakedNavMeshFilePath).good())
+        {
+            return;
+        }
+
+        try
+        {
+            aiManager->getNavMeshGenerator()->setBakedNavMesh(std::make_shared<BakedNavMesh>(bakedNavMeshFilePath));
+        }catch(const std::runtime_error &e)
+        {
+            Logger::logger().logWarning("Baked navigation mesh ignored: " + std::string(e.what()));
+        }
+    }
+
     void MapHandler::writeMapOnFile(const std::string &filename) const
     {
         XmlWriter xmlWriter(filename);
@@ -48,6 +74,18 @@ namespace urchin
         map->writeOn(rootChunk, xmlWriter);
 
         xmlWriter.saveInFile();
+
+        aiManager->bakeNavMesh(FileSystem::instance()->getResourcesDirectory() + getBakedNavMeshFilename(filename));
+    }
+
+    /**
+     * @param filename Map filename relative to the resources directory
+     * @return Baked navigation mesh filename relative to the resources directory: the file is saved alongside the map
+     */
+    std::string MapHandler::getBakedNavMeshFilename(const std::string &filename)
+    {
+        std::string directory = filename.find_last_of("/\\") == std::string::npos ? "" : FileHandler::getDirectoryFrom(filename);
+        return directory + FileHandler::getFileNameNoExtension(filename) + BAKED_NAV_MESH_FILE_EXTENSION;
     }
 
     /**
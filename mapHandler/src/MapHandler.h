@@ -27,6 +27,9 @@ namespace urchin
         //XML attributes
         #define WORKING_DIR_ATTR "relativeWorkingDirectory"
 
+        //baked navigation mesh file
+        #define BAKED_NAV_MESH_FILE_EXTENSION ".navmesh"
+
         public:
             MapHandler(Renderer3d *, PhysicsWorld *, SoundManager *, AIManager *);
             ~MapHandler();
@@ -34,6 +37,7 @@ namespace urchin
             void loadMapFromFile(const std::string &, LoadCallback &loadCallback);
             void writeMapOnFile(const std::string &) const;
 
+            static std::string getBakedNavMeshFilename(const std::string &);
             static std::string getRelativeWorkingDirectory(const std::string &);
             std::string getRelativeWorkingDirectory() const;
             void setRelativeWorkingDirectory(const std::string &);
@@ -45,6 +49,9 @@ namespace urchin
             void unpause();
 
         private:
+            void loadBakedNavMesh(const std::string &);
+
+            AIManager *aiManager;
             std::string relativeWorkingDirectory;
             Map *map;
     };
@@ -18,24 +18,25 @@ namespace urchin
 
     void NavMeshDisplayer::display()
     {
-        NavMesh navMesh = aiManager->getNavMeshGenerator()->copyLastGeneratedNavMesh();
+        std::shared_ptr<const NavMesh> navMesh = aiManager->getNavMeshGenerator()->getLastGeneratedNavMesh();
 
-        if(loadedNavMeshId != navMesh.getUpdateId())
+        if(loadedNavMeshId != navMesh->getUpdateId())
         {
             clearDisplay();
 
             std::vector<Point3<float>> triangleMeshPoints;
             std::vector<Point3<float>> quadJumpPoints;
 
-            for (const auto &navPolygon : navMesh.getPolygons())
+            for (std::size_t polygonIndex = 0; polygonIndex < navMesh->getPolygons().size(); ++polygonIndex)
             {
+                const std::shared_ptr<NavPolygon> &navPolygon = navMesh->getPolygons()[polygonIndex];
                 for (const auto &triangle : navPolygon->getTriangles())
                 {
                     triangleMeshPoints.emplace_back(navPolygon->getPoints()[triangle->getIndex(0)]);
                     triangleMeshPoints.emplace_back(navPolygon->getPoints()[triangle->getIndex(1)]);
                     triangleMeshPoints.emplace_back(navPolygon->getPoints()[triangle->getIndex(2)]);
 
-                    for (const auto &link : triangle->getLinks())
+                    for (const auto &link : navMesh->getTriangleLinks(polygonIndex, triangle->getPolygonTriangleIndex()))
                     {
                         if (link->getLinkType() == NavLinkType::JUMP)
                         {
@@ -61,7 +62,7 @@ namespace urchin
             auto *jumpModel = new QuadsModel(quadJumpPoints);
             addNavMeshModel(jumpModel, GeometryModel::FILL, Vector3<float>(0.5, 0.0, 0.5));
 
-            loadedNavMeshId = navMesh.getUpdateId();
+            loadedNavMeshId = navMesh->getUpdateId();
         }
     }
 
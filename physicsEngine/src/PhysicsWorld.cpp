@@ -20,6 +20,7 @@ namespace urchin
             paused(true),
             bodyManager(new BodyManager()),
             collisionWorld(new CollisionWorld(bodyManager)),
+            physicsStatistics(new PhysicsStatistics(ConfigService::instance()->getUnsignedIntValue("profiler.physicsStatisticsSteps"))),
             collisionVisualizer(nullptr)
     {
         NumericalCheck::instance()->perform();
@@ -41,6 +42,7 @@ namespace urchin
 
         delete collisionVisualizer;
 
+        delete physicsStatistics;
         delete collisionWorld;
         delete bodyManager;
 
@@ -57,6 +59,14 @@ namespace urchin
         return collisionWorld;
     }
 
+    /**
+     * @return Statistics (timings and counters) of the physics steps. Statistics can be queried from any thread.
+     */
+    PhysicsStatistics *PhysicsWorld::getPhysicsStatistics() const
+    {
+        return physicsStatistics;
+    }
+
     void PhysicsWorld::addBody(AbstractBody *body)
     {
         if(body)
@@ -254,11 +264,17 @@ namespace urchin
         //physics execution
         if(!paused)
         {
+            auto stepStartTime = std::chrono::high_resolution_clock::now();
+
             setupProcessables(copiedProcessables, frameTimeStep, gravity);
 
             collisionWorld->process(frameTimeStep, gravity);
 
             executeProcessables(copiedProcessables, frameTimeStep, gravity);
+
+            auto stepEndTime = std::chrono::high_resolution_clock::now();
+            double stepTime = std::chrono::duration<double, std::milli>(stepEndTime - stepStartTime).count();
+            physicsStatistics->addStep(stepTime, collisionWorld->getLastStageTimings(), collisionWorld->getLastStepCounters());
         }
     }
 
@@ -14,6 +14,7 @@
 #include "processable/Processable.h"
 #include "processable/raytest/RayTestResult.h"
 #include "visualizer/CollisionVisualizer.h"
+#include "statistics/PhysicsStatistics.h"
 
 namespace urchin
 {
@@ -26,6 +27,7 @@ namespace urchin
 
             BodyManager *getBodyManager() const;
             CollisionWorld *getCollisionWorld() const;
+            PhysicsStatistics *getPhysicsStatistics() const;
 
             void addBody(AbstractBody *);
             void removeBody(AbstractBody *);
@@ -67,6 +69,7 @@ namespace urchin
 
             BodyManager *bodyManager;
             CollisionWorld *collisionWorld;
+            PhysicsStatistics *physicsStatistics;
 
             std::vector<std::shared_ptr<Processable>> processables;
             std::vector<std::shared_ptr<Processable>> oneShotProcessables;
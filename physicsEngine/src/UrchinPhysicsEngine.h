@@ -29,8 +29,13 @@
 
 #include "collision/OverlappingPair.h"
 #include "collision/ManifoldResult.h"
+#include "collision/ManifoldResultArena.h"
 #include "collision/ManifoldContactPoint.h"
+#include "collision/StageTimings.h"
+#include "collision/StepCounters.h"
 #include "collision/broadphase/aabbtree/AABBTreeAlgorithm.h"
+#include "collision/broadphase/sweepandprune/SweepAndPruneAlgorithm.h"
+#include "collision/broadphase/spatialhash/SpatialHashAlgorithm.h"
 #include "collision/narrowphase/algorithm/epa/EPAAlgorithm.h"
 #include "collision/narrowphase/algorithm/epa/result/EPAResult.h"
 #include "collision/narrowphase/algorithm/gjk/GJKAlgorithm.h"
@@ -44,7 +49,10 @@
 
 #include "character/PhysicsCharacterController.h"
 #include "character/PhysicsCharacter.h"
+#include "character/PhysicsCharacterSystem.h"
 
 #include "visualizer/CollisionVisualizer.h"
 
+#include "statistics/PhysicsStatistics.h"
+
 #endif
@@ -6,6 +6,7 @@ namespace urchin
 {
 
     BodyManager::BodyManager() :
+        workBodiesUpdated(false),
         lastUpdatedWorkBody(nullptr)
     {
 
@@ -47,6 +48,27 @@ namespace urchin
         return workBodies;
     }
 
+    /**
+     * @return Work rigid bodies. Must be used from the physics thread.
+     */
+    const std::vector<WorkRigidBody *> &BodyManager::getWorkRigidBodies()
+    {
+        if(workBodiesUpdated)
+        {
+            workRigidBodies.clear();
+            for(auto &workBody : workBodies)
+            {
+                WorkRigidBody *rigidBody = WorkRigidBody::upCast(workBody);
+                if(rigidBody)
+                {
+                    workRigidBodies.push_back(rigidBody);
+                }
+            }
+            workBodiesUpdated = false;
+        }
+        return workRigidBodies;
+    }
+
     /**
      * Setup work bodies with new data on bodies
      */
@@ -88,6 +110,7 @@ namespace urchin
         body->setIsNew(false);
         body->setNeedFullRefresh(false);
         workBodies.push_back(workBody);
+        workBodiesUpdated = true;
 
         //update work body
         body->updateTo(workBody);
@@ -126,6 +149,7 @@ namespace urchin
             //delete work body
             delete workBody;
             workBodies.erase(itFind);
+            workBodiesUpdated = true;
         }
     }
 
@@ -5,6 +5,7 @@
 
 #include "body/model/AbstractBody.h"
 #include "body/work/AbstractWorkBody.h"
+#include "body/work/WorkRigidBody.h"
 
 namespace urchin
 {
@@ -33,6 +34,7 @@ namespace urchin
             void applyWorkBodies();
 
             const std::vector<AbstractWorkBody *> &getWorkBodies() const;
+            const std::vector<WorkRigidBody *> &getWorkRigidBodies();
 
         private:
             void createNewWorkBody(AbstractBody *);
@@ -41,6 +43,8 @@ namespace urchin
 
             std::vector<AbstractBody *> bodies;
             std::vector<AbstractWorkBody *> workBodies;
+            std::vector<WorkRigidBody *> workRigidBodies;
+            bool workBodiesUpdated;
 
             mutable std::mutex bodiesMutex;
 
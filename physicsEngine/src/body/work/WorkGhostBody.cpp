@@ -1,5 +1,4 @@
 #include "body/work/WorkGhostBody.h"
-#include "collision/broadphase/SyncVectorPairContainer.h"
 
 namespace urchin
 {
@@ -30,7 +29,7 @@ namespace urchin
     /**
      * @return Pair container used to collect colliding pairs on ghost body
      */
-    PairContainer *WorkGhostBody::getPairContainer() const
+    SyncVectorPairContainer *WorkGhostBody::getPairContainer() const
     {
         return pairContainer;
     }
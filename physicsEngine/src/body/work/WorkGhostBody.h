@@ -4,6 +4,7 @@
 #include <string>
 
 #include "body/work/AbstractWorkBody.h"
+#include "collision/broadphase/SyncVectorPairContainer.h"
 
 namespace urchin
 {
@@ -20,12 +21,12 @@ namespace urchin
             static WorkGhostBody *upCast(AbstractWorkBody *);
             static const WorkGhostBody *upCast(const AbstractWorkBody *);
 
-            PairContainer *getPairContainer() const override;
+            SyncVectorPairContainer *getPairContainer() const override;
 
             bool isGhostBody() const override;
 
         private:
-            PairContainer *pairContainer;
+            SyncVectorPairContainer *pairContainer;
 
     };
 
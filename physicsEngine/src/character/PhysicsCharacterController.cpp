@@ -22,6 +22,8 @@ namespace urchin
         verticalSpeed(0.0f),
         makeJump(false),
         initialOrientation(physicsCharacter->getTransform().getOrientation()),
+        significantContactValues(resetSignificantContactValues()),
+        recoverMove(Vector3<float>(0.0f, 0.0f, 0.0f)),
         numberOfHit(0),
         isOnGround(false),
         hitRoof(false),
@@ -68,6 +70,7 @@ namespace urchin
     }
 
     /**
+     * Update the character from the caller thread. Character controllers managed by a character system must not be updated with this method.
      * @param dt Delta of time between two simulation steps
      */
     void PhysicsCharacterController::update(float dt)
@@ -75,28 +78,19 @@ namespace urchin
         ScopeProfiler profiler("physics", "charactCtrlExec");
 
         //setup values
-        setup(dt);
+        setup(dt, physicsWorld->getGravity());
 
         //recover from penetration
-        recoverFromPenetration(dt);
+        recoverFromPenetration();
 
-        //compute values
-        slopeInPercentage = 0.0f;
-        if(isOnGround)
-        {
-            verticalSpeed = 0.0f;
-            slopeInPercentage = computeSlope();
-        }
-        if(hitRoof)
-        {
-            verticalSpeed = 0.0f;
-        }
-
-        //set new transform on character
-        physicsCharacter->updateTransform(ghostBody->getPhysicsTransform());
+        //compute values and set new transform on character
+        updateCharacter(dt);
     }
 
-    void PhysicsCharacterController::setup(float dt)
+    /**
+     * @param gravity Gravity expressed in units/s^2
+     */
+    void PhysicsCharacterController::setup(float dt, const Vector3<float> &gravity)
     {
         //save values
         previousBodyPosition = ghostBody->getPosition();
@@ -136,7 +130,7 @@ namespace urchin
         //compute gravity velocity
         if(!isOnGround || numberOfHit > 1)
         {
-            verticalSpeed -= (-physicsWorld->getGravity().Y) * dt;
+            verticalSpeed -= (-gravity.Y) * dt;
             if(verticalSpeed < -maxVerticalSpeed)
             {
                 verticalSpeed = -maxVerticalSpeed;
@@ -153,12 +147,12 @@ namespace urchin
         //apply data on body
         targetPosition.Y += verticalSpeed * dt;
         ghostBody->setPosition(targetPosition);
+
+        significantContactValues = resetSignificantContactValues();
     }
 
-    void PhysicsCharacterController::recoverFromPenetration(float dt)
+    void PhysicsCharacterController::recoverFromPenetration()
     {
-        SignificantContactValues significantContactValues = resetSignificantContactValues();
-
         for(unsigned int subStepIndex=0; subStepIndex<RECOVER_PENETRATION_SUB_STEPS; ++subStepIndex)
         {
             manifoldResults.clear();
@@ -166,29 +160,41 @@ namespace urchin
 
             for(const auto &manifoldResult : manifoldResults)
             {
-                float sign = manifoldResult.getBody1()==ghostBody ? -1.0 : 1.0;
-                for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
-                {
-                    const ManifoldContactPoint &manifoldContactPoint = manifoldResult.getManifoldContactPoint(i);
-                    float depth = manifoldContactPoint.getDepth();
+                computeRecoverMove(manifoldResult, subStepIndex);
+            }
+            applyRecoverMove();
+        }
+    }
 
-                    if(depth < maxDepthToRecover)
-                    {
-                        Vector3<float> normal =  manifoldContactPoint.getNormalFromObject2() * sign;
-                        Vector3<float> moveVector = normal * depth * recoverFactors[subStepIndex];
+    /**
+     * Accumulate the move allowing to recover from the penetration of the manifold result. Move is applied on the ghost body once all the
+     * manifold results of the sub step are computed.
+     */
+    void PhysicsCharacterController::computeRecoverMove(const ManifoldResult &manifoldResult, unsigned int subStepIndex)
+    {
+        float sign = manifoldResult.getBody1()==ghostBody ? -1.0 : 1.0;
+        for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+        {
+            const ManifoldContactPoint &manifoldContactPoint = manifoldResult.getManifoldContactPoint(i);
+            float depth = manifoldContactPoint.getDepth();
 
-                        ghostBody->setPosition(ghostBody->getPosition().translate(moveVector));
+            if(depth < maxDepthToRecover)
+            {
+                Vector3<float> normal =  manifoldContactPoint.getNormalFromObject2() * sign;
+                recoverMove += normal * depth * recoverFactors[subStepIndex];
 
-                        if(subStepIndex==0)
-                        {
-                            saveSignificantContactValues(significantContactValues, normal);
-                        }
-                    }
+                if(subStepIndex==0)
+                {
+                    saveSignificantContactValues(significantContactValues, normal);
                 }
             }
         }
+    }
 
-        computeSignificantContactValues(significantContactValues, dt);
+    void PhysicsCharacterController::applyRecoverMove()
+    {
+        ghostBody->setPosition(ghostBody->getPosition().translate(recoverMove));
+        recoverMove.setNull();
     }
 
     SignificantContactValues PhysicsCharacterController::resetSignificantContactValues()
@@ -229,6 +235,24 @@ namespace urchin
         timeInTheAir = isOnGround ? 0.0f : timeInTheAir+dt;
     }
 
+    void PhysicsCharacterController::updateCharacter(float dt)
+    {
+        computeSignificantContactValues(significantContactValues, dt);
+
+        slopeInPercentage = 0.0f;
+        if(isOnGround)
+        {
+            verticalSpeed = 0.0f;
+            slopeInPercentage = computeSlope();
+        }
+        if(hitRoof)
+        {
+            verticalSpeed = 0.0f;
+        }
+
+        physicsCharacter->updateTransform(ghostBody->getPhysicsTransform());
+    }
+
     /**
      * Compute slope based on previous body position.
      * Slope is expressed in percentage. A positive value means that character climb.
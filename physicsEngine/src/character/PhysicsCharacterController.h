@@ -29,10 +29,12 @@ namespace urchin
     };
 
     /**
-    * Character controller: allow to move a character in a world
+    * Character controller: allow to move a character in a world. Controller can be updated individually or by a character system.
     */
     class PhysicsCharacterController
     {
+        friend class PhysicsCharacterSystem;
+
         public:
             PhysicsCharacterController(const std::shared_ptr<PhysicsCharacter> &, PhysicsWorld *);
             ~PhysicsCharacterController();
@@ -43,15 +45,18 @@ namespace urchin
             void update(float);
 
         private:
-            void setup(float);
+            void setup(float, const Vector3<float> &);
 
             Vector3<float> getVelocity() const;
             bool needJumpAndResetFlag();
 
-            void recoverFromPenetration(float);
+            void recoverFromPenetration();
+            void computeRecoverMove(const ManifoldResult &, unsigned int);
+            void applyRecoverMove();
             SignificantContactValues resetSignificantContactValues();
             void saveSignificantContactValues(SignificantContactValues &, const Vector3<float> &);
             void computeSignificantContactValues(SignificantContactValues &, float);
+            void updateCharacter(float);
 
             float computeSlope();
 
@@ -64,6 +69,7 @@ namespace urchin
             std::shared_ptr<PhysicsCharacter> physicsCharacter;
             PhysicsWorld *physicsWorld;
             std::vector<ManifoldResult> manifoldResults;
+            std::vector<ManifoldResult *> ghostManifoldResults;
             mutable std::mutex characterMutex;
             WorkGhostBody *ghostBody;
             float verticalSpeed;
@@ -73,6 +79,8 @@ namespace urchin
 
             Point3<float> previousBodyPosition;
             Quaternion<float> initialOrientation;
+            SignificantContactValues significantContactValues;
+            Vector3<float> recoverMove;
             Vector3<float> lastVelocity;
             unsigned int numberOfHit; //number of contact point touching the character
             bool isOnGround; //character is on the ground
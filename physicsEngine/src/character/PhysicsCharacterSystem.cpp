@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <chrono>
+
+#include "character/PhysicsCharacterSystem.h"
+#include "PhysicsWorld.h"
+
+namespace urchin
+{
+
+    PhysicsCharacterSystem::PhysicsCharacterSystem() :
+            collisionWorld(nullptr),
+            lastUpdateDuration(0.0),
+            lastUpdateManifoldCount(0)
+    {
+
+    }
+
+    /**
+     * @param characterController Character controller to update by the system. Controller must not be updated anymore by the caller.
+     */
+    void PhysicsCharacterSystem::addCharacterController(const std::shared_ptr<PhysicsCharacterController> &characterController)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        characterControllers.push_back(characterController);
+    }
+
+    void PhysicsCharacterSystem::removeCharacterController(const std::shared_ptr<PhysicsCharacterController> &characterController)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto itFind = std::find(characterControllers.begin(), characterControllers.end(), characterController);
+        if(itFind != characterControllers.end())
+        {
+            characterControllers.erase(itFind);
+        }
+    }
+
+    void PhysicsCharacterSystem::initialize(PhysicsWorld *physicsWorld)
+    {
+        collisionWorld = physicsWorld->getCollisionWorld();
+    }
+
+    void PhysicsCharacterSystem::setup(float, const Vector3<float> &)
+    {
+        //nothing to do
+    }
+
+    /**
+     * @param dt Delta of time between two simulation steps
+     * @param gravity Gravity expressed in units/s^2
+     */
+    void PhysicsCharacterSystem::execute(float dt, const Vector3<float> &gravity)
+    {
+        ScopeProfiler profiler("physics", "charactSysExec");
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        copiedCharacterControllers.clear();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            copiedCharacterControllers = characterControllers;
+        }
+
+        ThreadPool *threadPool = collisionWorld->getThreadPool();
+        NarrowPhaseManager *narrowPhaseManager = collisionWorld->getNarrowPhaseManager();
+        std::atomic_uint manifoldCount(0);
+
+        threadPool->parallelFor(copiedCharacterControllers.size(), CHARACTER_MIN_CHUNK_SIZE, [this, dt, &gravity](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
+            {
+                copiedCharacterControllers[i]->setup(dt, gravity);
+            }
+        });
+
+        for(unsigned int subStepIndex=0; subStepIndex<RECOVER_PENETRATION_SUB_STEPS; ++subStepIndex)
+        {
+            //ghost bodies stay unchanged while the recover moves are computed: other ghost bodies can be part of the manifold results
+            threadPool->parallelFor(copiedCharacterControllers.size(), CHARACTER_MIN_CHUNK_SIZE,
+                    [this, narrowPhaseManager, subStepIndex, &manifoldCount](std::size_t beginIndex, std::size_t endIndex) {
+                unsigned int chunkManifoldCount = 0;
+                for(std::size_t i=beginIndex; i<endIndex; ++i)
+                {
+                    PhysicsCharacterController *characterController = copiedCharacterControllers[i].get();
+
+                    characterController->ghostManifoldResults.clear();
+                    narrowPhaseManager->processGhostBody(characterController->ghostBody, characterController->ghostManifoldResults);
+                    for(const auto &manifoldResult : characterController->ghostManifoldResults)
+                    {
+                        characterController->computeRecoverMove(*manifoldResult, subStepIndex);
+                    }
+                    chunkManifoldCount += static_cast<unsigned int>(characterController->ghostManifoldResults.size());
+                }
+                manifoldCount.fetch_add(chunkManifoldCount, std::memory_order_relaxed);
+            });
+
+            for(const auto &characterController : copiedCharacterControllers)
+            {
+                characterController->applyRecoverMove();
+            }
+        }
+
+        threadPool->parallelFor(copiedCharacterControllers.size(), CHARACTER_MIN_CHUNK_SIZE, [this, dt](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
+            {
+                copiedCharacterControllers[i]->updateCharacter(dt);
+            }
+        });
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        lastUpdateDuration.store(std::chrono::duration<double, std::milli>(endTime - startTime).count(), std::memory_order_relaxed);
+        lastUpdateManifoldCount.store(manifoldCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Duration (ms) of the last update of the characters
+     */
+    double PhysicsCharacterSystem::getLastUpdateDuration() const
+    {
+        return lastUpdateDuration.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Number of manifold results processed by the last update of the characters (all penetration recovery sub steps included)
+     */
+    unsigned int PhysicsCharacterSystem::getLastUpdateManifoldCount() const
+    {
+        return lastUpdateManifoldCount.load(std::memory_order_relaxed);
+    }
+
+}
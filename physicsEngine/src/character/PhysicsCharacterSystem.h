@@ -0,0 +1,52 @@
+#ifndef URCHINENGINE_PHYSICSCHARACTERSYSTEM_H
+#define URCHINENGINE_PHYSICSCHARACTERSYSTEM_H
+
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "character/PhysicsCharacterController.h"
+#include "processable/Processable.h"
+#include "collision/CollisionWorld.h"
+
+#define CHARACTER_MIN_CHUNK_SIZE 8
+
+namespace urchin
+{
+
+    /**
+    * Character system: update all the character controllers in one pass of the physics thread. Ghost bodies of the characters use the
+    * overlapping pairs computed by the broad phase of the physics step. Penetration recovery and slope computation are processed in parallel.
+    */
+    class PhysicsCharacterSystem : public Processable
+    {
+        public:
+            PhysicsCharacterSystem();
+
+            void addCharacterController(const std::shared_ptr<PhysicsCharacterController> &);
+            void removeCharacterController(const std::shared_ptr<PhysicsCharacterController> &);
+
+            void initialize(PhysicsWorld *) override;
+
+            void setup(float, const Vector3<float> &) override;
+            void execute(float, const Vector3<float> &) override;
+
+            double getLastUpdateDuration() const;
+            unsigned int getLastUpdateManifoldCount() const;
+
+        private:
+            CollisionWorld *collisionWorld;
+
+            std::mutex mutex;
+            std::vector<std::shared_ptr<PhysicsCharacterController>> characterControllers;
+            std::vector<std::shared_ptr<PhysicsCharacterController>> copiedCharacterControllers;
+
+            std::atomic<double> lastUpdateDuration;
+            std::atomic_uint lastUpdateManifoldCount;
+    };
+
+}
+
+#endif
@@ -2,18 +2,33 @@
 
 #include "collision/CollisionWorld.h"
 #include "collision/OverlappingPair.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmResultAllocator.h"
 
 namespace urchin
 {
 
     CollisionWorld::CollisionWorld(BodyManager *bodyManager) :
+            CollisionWorld(bodyManager, ConfigService::instance()->getStringValue("broadPhase.algorithm"))
+    {
+
+    }
+
+    /**
+     * @param broadPhaseAlgorithmName Name of broad phase algorithm: 'aabbTree', 'sweepAndPrune' or 'spatialHash'
+     */
+    CollisionWorld::CollisionWorld(BodyManager *bodyManager, const std::string &broadPhaseAlgorithmName) :
             bodyManager(bodyManager),
-            broadPhaseManager(new BroadPhaseManager(bodyManager)),
-            narrowPhaseManager(new NarrowPhaseManager(bodyManager, broadPhaseManager)),
-            integrateVelocityManager(new IntegrateVelocityManager(bodyManager)),
-            constraintSolverManager(new ConstraintSolverManager()),
+            threadPool(new ThreadPool(ConfigService::instance()->getUnsignedIntValue("parallelProcessing.physicsWorkerThreads"))),
+            broadPhaseManager(new BroadPhaseManager(bodyManager, broadPhaseAlgorithmName)),
+            narrowPhaseManager(new NarrowPhaseManager(bodyManager, broadPhaseManager, threadPool)),
+            integrateVelocityManager(new IntegrateVelocityManager(bodyManager, threadPool)),
             islandManager(new IslandManager(bodyManager)),
-            integrateTransformManager(new IntegrateTransformManager(bodyManager, broadPhaseManager, narrowPhaseManager))
+            constraintSolverManager(new ConstraintSolverManager(islandManager)),
+            integrateTransformManager(new IntegrateTransformManager(bodyManager, broadPhaseManager, narrowPhaseManager, threadPool)),
+            addedPairsCount(0),
+            removedPairsCount(0),
+            gjkIterations(0),
+            epaIterations(0)
     {
 
     }
@@ -23,9 +38,10 @@ namespace urchin
         delete broadPhaseManager;
         delete narrowPhaseManager;
         delete integrateVelocityManager;
-        delete constraintSolverManager;
         delete islandManager;
+        delete constraintSolverManager;
         delete integrateTransformManager;
+        delete threadPool;
     }
 
     BroadPhaseManager *CollisionWorld::getBroadPhaseManager() const
@@ -38,6 +54,11 @@ namespace urchin
         return narrowPhaseManager;
     }
 
+    ThreadPool *CollisionWorld::getThreadPool() const
+    {
+        return threadPool;
+    }
+
     /**
      * Update bodies by performing collision tests and responses
      * @param dt Delta of time (sec.) between two simulation steps
@@ -47,34 +68,127 @@ namespace urchin
     {
         ScopeProfiler profiler("physics", "colWorldProc");
 
+        //manifold results of previous step are owned by pairs which can be removed from now
+        manifoldResults.clear();
+
+        //counters of the previous step are used to compute the counters of the current step
+        addedPairsCount = broadPhaseManager->getPairContainer()->getAddedPairsCount();
+        removedPairsCount = broadPhaseManager->getPairContainer()->getRemovedPairsCount();
+        gjkIterations = narrowPhaseManager->getGJKIterationCount();
+        epaIterations = narrowPhaseManager->getEPAIterationCount();
+
         //initialize work bodies from bodies
         bodyManager->setupWorkBodies();
 
         //broad phase: determine pairs of bodies potentially colliding based on their AABBox
+        auto stageStartTime = std::chrono::high_resolution_clock::now();
         const std::vector<OverlappingPair *> &overlappingPairs = broadPhaseManager->computeOverlappingPairs();
+        stageTimings.broadPhase = retrieveElapsedTime(stageStartTime);
 
         //integrate bodies velocities (gravity, external forces...)
         integrateVelocityManager->integrateVelocity(dt, overlappingPairs, gravity);
+        stageTimings.integration = retrieveElapsedTime(stageStartTime);
 
         //narrow phase: check if pair of bodies colliding and update collision constraints
-        manifoldResults.clear();
         narrowPhaseManager->process(dt, overlappingPairs, manifoldResults);
+        stageTimings.narrowPhase = retrieveElapsedTime(stageStartTime);
         notifyObservers(this, COLLISION_RESULT_UPDATED);
 
-        //constraints solver: solve collision constraints
+        //islands: merge and split the islands of bodies for the contacts of the step
+        stageStartTime = std::chrono::high_resolution_clock::now();
+        islandManager->updateIslands(manifoldResults);
+        stageTimings.island = retrieveElapsedTime(stageStartTime);
+
+        //constraints solver: solve collision constraints of each island
         constraintSolverManager->solveConstraints(dt, manifoldResults);
+        stageTimings.constraintSolver = retrieveElapsedTime(stageStartTime);
 
         //update bodies state and integrate transformations
-        islandManager->refreshBodyActiveState(manifoldResults);
+        islandManager->refreshBodyActiveState();
+        stageTimings.island += retrieveElapsedTime(stageStartTime);
         integrateTransformManager->integrateTransform(dt);
+        stageTimings.integration += retrieveElapsedTime(stageStartTime);
 
         //apply work bodies to bodies
         bodyManager->applyWorkBodies();
+
+        computeStepCounters(overlappingPairs);
+    }
+
+    void CollisionWorld::computeStepCounters(const std::vector<OverlappingPair *> &overlappingPairs)
+    {
+        stepCounters.bodies = static_cast<unsigned int>(bodyManager->getWorkBodies().size());
+        stepCounters.activeBodies = 0;
+        stepCounters.sleepingBodies = 0;
+        for(const auto workBody : bodyManager->getWorkBodies())
+        {
+            if(workBody->isActive())
+            {
+                stepCounters.activeBodies++;
+            }else if(!workBody->isStatic() && WorkRigidBody::upCast(workBody))
+            {
+                stepCounters.sleepingBodies++;
+            }
+        }
+
+        stepCounters.overlappingPairs = static_cast<unsigned int>(overlappingPairs.size());
+        stepCounters.newPairs = broadPhaseManager->getPairContainer()->getAddedPairsCount() - addedPairsCount;
+        stepCounters.removedPairs = broadPhaseManager->getPairContainer()->getRemovedPairsCount() - removedPairsCount;
+
+        stepCounters.manifolds = static_cast<unsigned int>(manifoldResults.size());
+        stepCounters.contactPoints = 0;
+        for(const auto manifoldResult : manifoldResults)
+        {
+            stepCounters.contactPoints += manifoldResult->getNumContactPoints();
+        }
+        stepCounters.gjkIterations = narrowPhaseManager->getGJKIterationCount() - gjkIterations;
+        stepCounters.epaIterations = narrowPhaseManager->getEPAIterationCount() - epaIterations;
+        stepCounters.continuousCollisionSweeps = narrowPhaseManager->getContinuousCollisionSweepCount();
+
+        stepCounters.solverConstraints = constraintSolverManager->getConstraintCount();
+        stepCounters.solverIterations = constraintSolverManager->getIterationCount();
+        stepCounters.solverIslandIterations = constraintSolverManager->getIslandIterationCount();
+
+        stepCounters.algorithmPoolHighWaterMark = narrowPhaseManager->getAlgorithmPoolHighWaterMark();
+        stepCounters.algorithmResultPoolHighWaterMark = AlgorithmResultAllocator::instance()->getAlgorithmResultPool()->getHighWaterMark();
+        stepCounters.constraintSolvingPoolHighWaterMark = constraintSolverManager->getConstraintSolvingPoolHighWaterMark();
     }
 
-    const std::vector<ManifoldResult> &CollisionWorld::getLastUpdatedManifoldResults()
+    /**
+     * @return Manifold results of the last step. Manifold results are owned by the narrow phase and stay valid until the next process.
+     */
+    const std::vector<ManifoldResult *> &CollisionWorld::getLastUpdatedManifoldResults()
     {
         return manifoldResults;
     }
 
+    /**
+     * @return Execution times of the stages of the last step
+     */
+    const StageTimings &CollisionWorld::getLastStageTimings() const
+    {
+        return stageTimings;
+    }
+
+    /**
+     * @return Counters of the last step
+     */
+    const StepCounters &CollisionWorld::getLastStepCounters() const
+    {
+        return stepCounters;
+    }
+
+    /**
+     * @param startTime [IN/OUT] Start time of the stage. Updated to the current time in order to be re-used for the next stage.
+     * @return Elapsed time in milliseconds since the start time
+     */
+    double CollisionWorld::retrieveElapsedTime(std::chrono::high_resolution_clock::time_point &startTime)
+    {
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double elapsedTime = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        startTime = endTime;
+
+        return elapsedTime;
+    }
+
 }
@@ -1,10 +1,13 @@
 #ifndef URCHINENGINE_COLLISIONWORLD_H
 #define URCHINENGINE_COLLISIONWORLD_H
 
+#include <chrono>
 #include "UrchinCommon.h"
 
 #include "body/BodyManager.h"
 #include "collision/ManifoldResult.h"
+#include "collision/StageTimings.h"
+#include "collision/StepCounters.h"
 #include "collision/broadphase/BroadPhaseManager.h"
 #include "collision/narrowphase/NarrowPhaseManager.h"
 #include "collision/integration/IntegrateVelocityManager.h"
@@ -22,6 +25,7 @@ namespace urchin
     {
         public:
             explicit CollisionWorld(BodyManager *);
+            CollisionWorld(BodyManager *, const std::string &);
             ~CollisionWorld() override;
 
             enum NotificationType
@@ -31,22 +35,35 @@ namespace urchin
 
             BroadPhaseManager *getBroadPhaseManager() const;
             NarrowPhaseManager *getNarrowPhaseManager() const;
+            ThreadPool *getThreadPool() const;
 
             void process(float, const Vector3<float> &);
 
-            const std::vector<ManifoldResult> &getLastUpdatedManifoldResults();
+            const std::vector<ManifoldResult *> &getLastUpdatedManifoldResults();
+            const StageTimings &getLastStageTimings() const;
+            const StepCounters &getLastStepCounters() const;
 
         private:
+            static double retrieveElapsedTime(std::chrono::high_resolution_clock::time_point &);
+            void computeStepCounters(const std::vector<OverlappingPair *> &);
+
             BodyManager *bodyManager;
+            ThreadPool *threadPool;
 
             BroadPhaseManager *broadPhaseManager;
             NarrowPhaseManager *narrowPhaseManager;
             IntegrateVelocityManager *integrateVelocityManager;
-            ConstraintSolverManager *constraintSolverManager;
             IslandManager *islandManager;
+            ConstraintSolverManager *constraintSolverManager;
             IntegrateTransformManager *integrateTransformManager;
 
-            std::vector<ManifoldResult> manifoldResults;
+            std::vector<ManifoldResult *> manifoldResults;
+            StageTimings stageTimings;
+            StepCounters stepCounters;
+            unsigned int addedPairsCount;
+            unsigned int removedPairsCount;
+            unsigned int gjkIterations;
+            unsigned int epaIterations;
     };
 
 }
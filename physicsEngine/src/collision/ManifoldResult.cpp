@@ -88,8 +88,8 @@ namespace urchin
         int nearestPointIndex = getNearestPointIndex(localPointOnObject2);
         if(nearestPointIndex >= 0)
         { //replace existing point
-            contactPoints[nearestPointIndex] = ManifoldContactPoint(normalFromObject2, pointOnObject1, pointOnObject2,
-                    localPointOnObject1, localPointOnObject2, depth, isPredictive);
+            replaceContactPoint(static_cast<unsigned int>(nearestPointIndex), ManifoldContactPoint(normalFromObject2, pointOnObject1, pointOnObject2,
+                    localPointOnObject1, localPointOnObject2, depth, isPredictive));
             return;
         }
 
@@ -160,6 +160,26 @@ namespace urchin
         return nearestPointIndex;
     }
 
+    /**
+     * Replace a contact point by a new one representing the same contact. Accumulated impulses are kept for warm starting when the
+     * contact didn't significantly move on the object 1 and when the contact normal is similar.
+     */
+    void ManifoldResult::replaceContactPoint(unsigned int index, const ManifoldContactPoint &newContactPoint)
+    {
+        ManifoldContactPoint &contactPoint = contactPoints[index];
+        AccumulatedSolvingData accumulatedSolvingData = contactPoint.getAccumulatedSolvingData();
+
+        float localPointsSquareDistance = contactPoint.getLocalPointOnObject1().vector(newContactPoint.getLocalPointOnObject1()).squareLength();
+        float normalsDotProduct = contactPoint.getNormalFromObject2().dotProduct(newContactPoint.getNormalFromObject2());
+        bool isSameContact = localPointsSquareDistance < contactBreakingThreshold * contactBreakingThreshold && normalsDotProduct > PERSISTENT_NORMAL_MIN_DOT_PRODUCT;
+
+        contactPoint = newContactPoint;
+        if(isSameContact)
+        {
+            contactPoint.getAccumulatedSolvingData() = accumulatedSolvingData;
+        }
+    }
+
     /**
      * Compute the best index where to insert the new point when MAX_PERSISTENT_POINTS is reach.
      * We keep deepest point and four points cover the biggest area.
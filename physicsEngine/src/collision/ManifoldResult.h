@@ -7,6 +7,7 @@
 #include "body/work/AbstractWorkBody.h"
 
 #define MAX_PERSISTENT_POINTS 4
+#define PERSISTENT_NORMAL_MIN_DOT_PRODUCT 0.95f //minimum dot product between old and new normals to keep accumulated impulses of a contact point
 
 namespace urchin
 {
@@ -36,6 +37,7 @@ namespace urchin
 
         private:
             int getNearestPointIndex(const Point3<float> &) const;
+            void replaceContactPoint(unsigned int, const ManifoldContactPoint &);
             unsigned int computeBestInsertionIndex(const Point3<float> &) const;
             unsigned int getDeepestPointIndex() const;
             float computeArea(const Point3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &) const;
@@ -0,0 +1,62 @@
+#include "collision/ManifoldResultArena.h"
+
+namespace urchin
+{
+
+    /**
+     * @param chunkSize Number of manifold results allocated at once when the arena is full
+     */
+    ManifoldResultArena::ManifoldResultArena(unsigned int chunkSize) :
+            chunkSize(chunkSize),
+            currentChunkIndex(0),
+            chunkAllocationCount(0)
+    {
+        if(chunkSize==0)
+        {
+            throw std::invalid_argument("Manifold result arena chunk size must be greater than zero.");
+        }
+    }
+
+    /**
+     * @return New manifold result valid until the next clear of the arena
+     */
+    ManifoldResult *ManifoldResultArena::newManifoldResult(AbstractWorkBody *body1, AbstractWorkBody *body2)
+    {
+        if(currentChunkIndex < chunks.size() && chunks[currentChunkIndex].size()==chunkSize)
+        {
+            currentChunkIndex++;
+        }
+
+        if(currentChunkIndex==chunks.size())
+        { //chunk vector must never be resized to keep returned pointers valid: a new chunk is reserved instead
+            chunks.emplace_back();
+            chunks.back().reserve(chunkSize);
+            chunkAllocationCount++;
+        }
+
+        std::vector<ManifoldResult> &currentChunk = chunks[currentChunkIndex];
+        currentChunk.emplace_back(body1, body2);
+        return &currentChunk.back();
+    }
+
+    /**
+     * Destroy all manifold results. Allocated memory is kept for next usage.
+     */
+    void ManifoldResultArena::clear()
+    {
+        for(auto &chunk : chunks)
+        {
+            chunk.clear();
+        }
+        currentChunkIndex = 0;
+    }
+
+    /**
+     * @return Number of memory allocations done since the arena creation. This number stays unchanged once the arena reached its steady size.
+     */
+    unsigned int ManifoldResultArena::getChunkAllocationCount() const
+    {
+        return chunkAllocationCount;
+    }
+
+}
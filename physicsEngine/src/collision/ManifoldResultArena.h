@@ -0,0 +1,36 @@
+#ifndef URCHINENGINE_MANIFOLDRESULTARENA_H
+#define URCHINENGINE_MANIFOLDRESULTARENA_H
+
+#include <vector>
+
+#include "collision/ManifoldResult.h"
+#include "body/work/AbstractWorkBody.h"
+
+namespace urchin
+{
+
+    /**
+    * Arena of manifold results living during one physics step. Memory is allocated by chunks and is reused after each clear: pointers
+    * on manifold results stay valid until the next clear and no allocation is performed once the arena reached its steady size.
+    */
+    class ManifoldResultArena
+    {
+        public:
+            explicit ManifoldResultArena(unsigned int);
+
+            ManifoldResult *newManifoldResult(AbstractWorkBody *, AbstractWorkBody *);
+            void clear();
+
+            unsigned int getChunkAllocationCount() const;
+
+        private:
+            const unsigned int chunkSize;
+
+            std::vector<std::vector<ManifoldResult>> chunks;
+            unsigned int currentChunkIndex;
+            unsigned int chunkAllocationCount;
+    };
+
+}
+
+#endif
@@ -26,6 +26,18 @@ namespace urchin
 
     }
 
+    /**
+     * Copy the bodies of the pair. The collision algorithm is owned by the original pair and is not copied.
+     */
+    OverlappingPair::OverlappingPair(const OverlappingPair &overlappingPair) :
+            body1(overlappingPair.body1),
+            body2(overlappingPair.body2),
+            bodiesId(overlappingPair.bodiesId),
+            collisionAlgorithm(nullptr)
+    {
+
+    }
+
     /**
       * @param index Index of body to return. Index must be '0' for body1 or '1' for body2.
       */
@@ -71,14 +83,14 @@ namespace urchin
         return bodiesId;
     }
 
-    void OverlappingPair::setCollisionAlgorithm(std::shared_ptr<CollisionAlgorithm> collisionAlgorithm)
+    void OverlappingPair::setCollisionAlgorithm(std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> collisionAlgorithm)
     {
         this->collisionAlgorithm = std::move(collisionAlgorithm);
     }
 
-    std::shared_ptr<CollisionAlgorithm> OverlappingPair::getCollisionAlgorithm() const
+    CollisionAlgorithm *OverlappingPair::getCollisionAlgorithm() const
     {
-        return collisionAlgorithm;
+        return collisionAlgorithm.get();
     }
 
 }
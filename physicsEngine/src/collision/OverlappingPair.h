@@ -5,6 +5,7 @@
 
 #include "body/work/AbstractWorkBody.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmDeleter.h"
 
 namespace urchin
 {
@@ -17,7 +18,8 @@ namespace urchin
         public:
             OverlappingPair(AbstractWorkBody *, AbstractWorkBody *);
             OverlappingPair(AbstractWorkBody *, AbstractWorkBody *, uint_fast64_t);
-            OverlappingPair(const OverlappingPair &) = default;
+            OverlappingPair(const OverlappingPair &);
+            OverlappingPair &operator=(const OverlappingPair &) = delete;
 
             AbstractWorkBody *getBody(unsigned int) const;
             AbstractWorkBody *getBody1() const;
@@ -26,15 +28,15 @@ namespace urchin
             static uint_fast64_t computeBodiesId(const AbstractWorkBody *, const AbstractWorkBody *);
             uint_fast64_t getBodiesId() const;
 
-            void setCollisionAlgorithm(std::shared_ptr<CollisionAlgorithm>);
-            std::shared_ptr<CollisionAlgorithm> getCollisionAlgorithm() const;
+            void setCollisionAlgorithm(std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter>);
+            CollisionAlgorithm *getCollisionAlgorithm() const;
 
         private:
             AbstractWorkBody *body1;
             AbstractWorkBody *body2;
             uint_fast64_t bodiesId;
 
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm;
+            std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> collisionAlgorithm;
     };
 
 }
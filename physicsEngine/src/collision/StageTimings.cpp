@@ -0,0 +1,16 @@
+#include "collision/StageTimings.h"
+
+namespace urchin
+{
+
+    StageTimings::StageTimings() :
+            broadPhase(0.0),
+            narrowPhase(0.0),
+            constraintSolver(0.0),
+            island(0.0),
+            integration(0.0)
+    {
+
+    }
+
+}
@@ -0,0 +1,23 @@
+#ifndef URCHINENGINE_STAGETIMINGS_H
+#define URCHINENGINE_STAGETIMINGS_H
+
+namespace urchin
+{
+
+    /**
+    * Execution times (in milliseconds) of the stages of one collision world step
+    */
+    struct StageTimings
+    {
+        StageTimings();
+
+        double broadPhase;
+        double narrowPhase;
+        double constraintSolver;
+        double island;
+        double integration; //velocity and transform integrations
+    };
+
+}
+
+#endif
@@ -0,0 +1,28 @@
+#include "collision/StepCounters.h"
+
+namespace urchin
+{
+
+    StepCounters::StepCounters() :
+            bodies(0),
+            activeBodies(0),
+            sleepingBodies(0),
+            overlappingPairs(0),
+            newPairs(0),
+            removedPairs(0),
+            manifolds(0),
+            contactPoints(0),
+            gjkIterations(0),
+            epaIterations(0),
+            continuousCollisionSweeps(0),
+            solverConstraints(0),
+            solverIterations(0),
+            solverIslandIterations(0),
+            algorithmPoolHighWaterMark(0),
+            algorithmResultPoolHighWaterMark(0),
+            constraintSolvingPoolHighWaterMark(0)
+    {
+
+    }
+
+}
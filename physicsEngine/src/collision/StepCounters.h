@@ -0,0 +1,39 @@
+#ifndef URCHINENGINE_STEPCOUNTERS_H
+#define URCHINENGINE_STEPCOUNTERS_H
+
+namespace urchin
+{
+
+    /**
+    * Counters of one collision world step
+    */
+    struct StepCounters
+    {
+        StepCounters();
+
+        unsigned int bodies;
+        unsigned int activeBodies;
+        unsigned int sleepingBodies;
+
+        unsigned int overlappingPairs;
+        unsigned int newPairs;
+        unsigned int removedPairs;
+
+        unsigned int manifolds;
+        unsigned int contactPoints;
+        unsigned int gjkIterations;
+        unsigned int epaIterations;
+        unsigned int continuousCollisionSweeps;
+
+        unsigned int solverConstraints;
+        unsigned int solverIterations;
+        unsigned int solverIslandIterations;
+
+        unsigned int algorithmPoolHighWaterMark;
+        unsigned int algorithmResultPoolHighWaterMark;
+        unsigned int constraintSolvingPoolHighWaterMark;
+    };
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include "collision/broadphase/BodyPairsHandler.h"
+#include "collision/broadphase/VectorPairContainer.h"
+
+namespace urchin
+{
+
+    /**
+     * @param nodeDataRetriever Retrieve the node data of a body known by the broad phase algorithm
+     */
+    BodyPairsHandler::BodyPairsHandler(std::function<BodyAABBNodeData *(AbstractWorkBody *)> nodeDataRetriever) :
+            nodeDataRetriever(std::move(nodeDataRetriever)),
+            defaultPairContainer(new VectorPairContainer())
+    {
+
+    }
+
+    BodyPairsHandler::~BodyPairsHandler()
+    {
+        delete defaultPairContainer;
+    }
+
+    const std::vector<OverlappingPair *> &BodyPairsHandler::getOverlappingPairs() const
+    {
+        return defaultPairContainer->getOverlappingPairs();
+    }
+
+    /**
+     * @return Pair container of the bodies without alternative pair container
+     */
+    const PairContainer *BodyPairsHandler::getPairContainer() const
+    {
+        return defaultPairContainer;
+    }
+
+    void BodyPairsHandler::createOverlappingPair(BodyAABBNodeData *nodeData1, BodyAABBNodeData *nodeData2)
+    {
+        if(!nodeData1->hasAlternativePairContainer() && !nodeData2->hasAlternativePairContainer())
+        {
+            defaultPairContainer->addOverlappingPair(nodeData1->getNodeObject(), nodeData2->getNodeObject());
+        }else
+        {
+            if(nodeData1->hasAlternativePairContainer())
+            {
+                nodeData1->getAlternativePairContainer()->addOverlappingPair(nodeData1->getNodeObject(), nodeData2->getNodeObject());
+                nodeData2->addOwnerPairContainer(nodeData1->getAlternativePairContainer());
+            }
+
+            if(nodeData2->hasAlternativePairContainer())
+            {
+                nodeData2->getAlternativePairContainer()->addOverlappingPair(nodeData1->getNodeObject(), nodeData2->getNodeObject());
+                nodeData1->addOwnerPairContainer(nodeData2->getAlternativePairContainer());
+            }
+        }
+    }
+
+    void BodyPairsHandler::removeOverlappingPair(BodyAABBNodeData *nodeData1, BodyAABBNodeData *nodeData2)
+    {
+        if(!nodeData1->hasAlternativePairContainer() && !nodeData2->hasAlternativePairContainer())
+        {
+            defaultPairContainer->removeOverlappingPair(nodeData1->getNodeObject(), nodeData2->getNodeObject());
+        }else
+        {
+            if(nodeData1->hasAlternativePairContainer())
+            {
+                nodeData1->getAlternativePairContainer()->removeOverlappingPair(nodeData1->getNodeObject(), nodeData2->getNodeObject());
+                nodeData2->removeOwnerPairContainer(nodeData1->getAlternativePairContainer());
+            }
+
+            if(nodeData2->hasAlternativePairContainer())
+            {
+                nodeData2->getAlternativePairContainer()->removeOverlappingPair(nodeData1->getNodeObject(), nodeData2->getNodeObject());
+                nodeData1->removeOwnerPairContainer(nodeData2->getAlternativePairContainer());
+            }
+        }
+    }
+
+    void BodyPairsHandler::removeOverlappingPairs(const BodyAABBNodeData *nodeData)
+    {
+        if(!nodeData->hasAlternativePairContainer())
+        {
+            defaultPairContainer->removeOverlappingPairs(nodeData->getNodeObject());
+        }else
+        {
+            PairContainer *alternativePairContainer = nodeData->getAlternativePairContainer();
+
+            removeAlternativePairContainerReferences(nodeData->getNodeObject(), alternativePairContainer);
+            alternativePairContainer->removeOverlappingPairs(nodeData->getNodeObject());
+        }
+
+        for(auto &ownerPairContainer : nodeData->getOwnerPairContainers())
+        {
+            ownerPairContainer->removeOverlappingPairs(nodeData->getNodeObject());
+        }
+    }
+
+    void BodyPairsHandler::removeAlternativePairContainerReferences(const AbstractWorkBody *body, PairContainer *alternativePairContainer)
+    {
+        std::vector<OverlappingPair> overlappingPairs = alternativePairContainer->retrieveCopyOverlappingPairs();
+        for (const auto &overlappingPair : overlappingPairs)
+        {
+            AbstractWorkBody *otherPairBody = overlappingPair.getBody1() == body ? overlappingPair.getBody2() : overlappingPair.getBody1();
+            nodeDataRetriever(otherPairBody)->removeOwnerPairContainer(alternativePairContainer);
+        }
+    }
+
+}
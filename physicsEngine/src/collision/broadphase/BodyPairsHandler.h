@@ -0,0 +1,42 @@
+#ifndef URCHINENGINE_BODYPAIRSHANDLER_H
+#define URCHINENGINE_BODYPAIRSHANDLER_H
+
+#include <vector>
+#include <functional>
+#include "UrchinCommon.h"
+
+#include "body/work/AbstractWorkBody.h"
+#include "collision/OverlappingPair.h"
+#include "collision/broadphase/PairContainer.h"
+#include "collision/broadphase/aabbtree/BodyAABBNodeData.h"
+
+namespace urchin
+{
+
+    /**
+    * Create and remove the overlapping pairs found by a broad phase algorithm. A pair is stored in the default pair container
+    * or, when a body has one, in the alternative pair container of the body (e.g. ghost body).
+    */
+    class BodyPairsHandler
+    {
+        public:
+            explicit BodyPairsHandler(std::function<BodyAABBNodeData *(AbstractWorkBody *)>);
+            ~BodyPairsHandler();
+
+            const std::vector<OverlappingPair *> &getOverlappingPairs() const;
+            const PairContainer *getPairContainer() const;
+
+            void createOverlappingPair(BodyAABBNodeData *, BodyAABBNodeData *);
+            void removeOverlappingPair(BodyAABBNodeData *, BodyAABBNodeData *);
+            void removeOverlappingPairs(const BodyAABBNodeData *);
+
+        private:
+            void removeAlternativePairContainerReferences(const AbstractWorkBody *, PairContainer *);
+
+            std::function<BodyAABBNodeData *(AbstractWorkBody *)> nodeDataRetriever;
+            PairContainer *defaultPairContainer;
+    };
+
+}
+
+#endif
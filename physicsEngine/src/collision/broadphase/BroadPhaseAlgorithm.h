@@ -21,9 +21,11 @@ namespace urchin
             virtual void updateBodies() = 0;
 
             virtual const std::vector<OverlappingPair *> &getOverlappingPairs() const = 0;
+            virtual const PairContainer *getPairContainer() const = 0;
 
             virtual std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const = 0;
             virtual std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const = 0;
+            virtual std::vector<AbstractWorkBody *> aabboxTest(const AABBox<float> &) const = 0;
     };
 
 }
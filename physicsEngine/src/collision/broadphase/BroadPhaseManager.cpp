@@ -1,12 +1,26 @@
 #include "collision/broadphase/BroadPhaseManager.h"
 #include "collision/broadphase/aabbtree/AABBTreeAlgorithm.h"
+#include "collision/broadphase/sweepandprune/SweepAndPruneAlgorithm.h"
+#include "collision/broadphase/spatialhash/SpatialHashAlgorithm.h"
 
 namespace urchin
 {
 
-    BroadPhaseManager::BroadPhaseManager(BodyManager *bodyManager)
+    /**
+     * Create a broad phase manager using the algorithm defined by the property 'broadPhase.algorithm'
+     */
+    BroadPhaseManager::BroadPhaseManager(BodyManager *bodyManager) :
+            BroadPhaseManager(bodyManager, ConfigService::instance()->getStringValue("broadPhase.algorithm"))
+    {
+
+    }
+
+    /**
+     * @param algorithmName Name of broad phase algorithm: 'aabbTree', 'sweepAndPrune' or 'spatialHash'
+     */
+    BroadPhaseManager::BroadPhaseManager(BodyManager *bodyManager, const std::string &algorithmName) :
+            broadPhaseAlgorithm(newBroadPhaseAlgorithm(algorithmName))
     {
-        broadPhaseAlgorithm = new AABBTreeAlgorithm();
 
         bodyManager->addObserver(this, BodyManager::ADD_WORK_BODY);
         bodyManager->addObserver(this, BodyManager::REMOVE_WORK_BODY);
@@ -18,6 +32,22 @@ namespace urchin
         delete broadPhaseAlgorithm;
     }
 
+    BroadPhaseAlgorithm *BroadPhaseManager::newBroadPhaseAlgorithm(const std::string &algorithmName)
+    {
+        if(algorithmName == "aabbTree")
+        {
+            return new AABBTreeAlgorithm();
+        }else if(algorithmName == "sweepAndPrune")
+        {
+            return new SweepAndPruneAlgorithm();
+        }else if(algorithmName == "spatialHash")
+        {
+            return new SpatialHashAlgorithm();
+        }
+
+        throw std::invalid_argument("Unknown broad phase algorithm: " + algorithmName);
+    }
+
     void BroadPhaseManager::notify(Observable *observable, int notificationType)
     {
         if(auto *bodyManager = dynamic_cast<BodyManager *>(observable))
@@ -90,6 +120,14 @@ namespace urchin
         return broadPhaseAlgorithm->getOverlappingPairs();
     }
 
+    /**
+     * @return Pair container of the overlapping pairs returned by the broad phase (pairs of ghost bodies excluded)
+     */
+    const PairContainer *BroadPhaseManager::getPairContainer() const
+    {
+        return broadPhaseAlgorithm->getPairContainer();
+    }
+
     std::vector<AbstractWorkBody *> BroadPhaseManager::rayTest(const Ray<float> &ray) const
     {
         return broadPhaseAlgorithm->rayTest(ray);
@@ -100,4 +138,12 @@ namespace urchin
         return broadPhaseAlgorithm->bodyTest(body, from, to);
     }
 
+    /**
+     * @return Bodies having a broad phase AABBox colliding with the provided AABBox
+     */
+    std::vector<AbstractWorkBody *> BroadPhaseManager::aabboxTest(const AABBox<float> &aabbox) const
+    {
+        return broadPhaseAlgorithm->aabboxTest(aabbox);
+    }
+
 }
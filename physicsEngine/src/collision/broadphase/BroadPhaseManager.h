@@ -2,6 +2,7 @@
 #define URCHINENGINE_BROADPHASEMANAGER_H
 
 #include <vector>
+#include <string>
 #include "UrchinCommon.h"
 
 #include "collision/broadphase/BroadPhaseAlgorithm.h"
@@ -20,6 +21,7 @@ namespace urchin
     {
         public:
             explicit BroadPhaseManager(BodyManager *);
+            BroadPhaseManager(BodyManager *, const std::string &);
             ~BroadPhaseManager() override;
 
             void notify(Observable *, int) override;
@@ -28,11 +30,15 @@ namespace urchin
             void removeBodyAsync(AbstractWorkBody *);
 
             const std::vector<OverlappingPair *> &computeOverlappingPairs();
+            const PairContainer *getPairContainer() const;
 
             std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const;
             std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const;
+            std::vector<AbstractWorkBody *> aabboxTest(const AABBox<float> &) const;
 
         private:
+            static BroadPhaseAlgorithm *newBroadPhaseAlgorithm(const std::string &);
+
             void addBody(AbstractWorkBody *);
             void removeBody(AbstractWorkBody *);
             void synchronizeBodies();
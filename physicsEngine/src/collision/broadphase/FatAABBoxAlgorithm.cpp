@@ -0,0 +1,157 @@
+#include <algorithm>
+
+#include "collision/broadphase/FatAABBoxAlgorithm.h"
+
+namespace urchin
+{
+
+    FatAABBoxAlgorithm::FatAABBoxBody::FatAABBoxBody(AbstractWorkBody *body, PairContainer *alternativePairContainer) :
+            nodeData(body, alternativePairContainer),
+            fatAABBoxUpdated(true)
+    {
+
+    }
+
+    FatAABBoxAlgorithm::FatAABBoxAlgorithm() :
+            fatMargin(ConfigService::instance()->getFloatValue("broadPhase.fatMargin")),
+            bodyPairsHandler([this](AbstractWorkBody *body) { return &bodiesMap.at(body)->nodeData; })
+    {
+
+    }
+
+    FatAABBoxAlgorithm::~FatAABBoxAlgorithm()
+    {
+        for(auto &fatAABBoxBody : fatAABBoxBodies)
+        {
+            delete fatAABBoxBody;
+        }
+    }
+
+    void FatAABBoxAlgorithm::addBody(AbstractWorkBody *body, PairContainer *alternativePairContainer)
+    {
+        auto *fatAABBoxBody = new FatAABBoxBody(body, alternativePairContainer);
+        fatAABBoxBody->fatAABBox = computeFatAABBox(fatAABBoxBody->nodeData.retrieveObjectAABBox());
+
+        fatAABBoxBodies.push_back(fatAABBoxBody);
+        bodiesMap[body] = fatAABBoxBody;
+        addFatAABBoxBody(fatAABBoxBody);
+    }
+
+    void FatAABBoxAlgorithm::removeBody(AbstractWorkBody *body)
+    {
+        auto itFind = bodiesMap.find(body);
+        if(itFind == bodiesMap.end())
+        {
+            throw std::invalid_argument("Impossible to remove body " + body->getId() + " from broad phase: body not found");
+        }
+        FatAABBoxBody *fatAABBoxBody = itFind->second;
+
+        bodyPairsHandler.removeOverlappingPairs(&fatAABBoxBody->nodeData);
+        removeFatAABBoxBody(fatAABBoxBody);
+
+        fatAABBoxBodies.erase(std::find(fatAABBoxBodies.begin(), fatAABBoxBodies.end(), fatAABBoxBody));
+        bodiesMap.erase(itFind);
+        delete fatAABBoxBody;
+    }
+
+    void FatAABBoxAlgorithm::updateBodies()
+    {
+        if(!worldBoundary.isComputed())
+        {
+            computeWorldBoundary();
+        }
+
+        updatedBodies.clear();
+        for(auto &fatAABBoxBody : fatAABBoxBodies)
+        {
+            if(fatAABBoxBody->nodeData.isObjectMoving())
+            {
+                worldBoundary.control(fatAABBoxBody->nodeData);
+
+                AABBox<float> objectAABBox = fatAABBoxBody->nodeData.retrieveObjectAABBox();
+                if(!fatAABBoxBody->fatAABBox.include(objectAABBox))
+                {
+                    AABBox<float> oldFatAABBox = fatAABBoxBody->fatAABBox;
+                    fatAABBoxBody->fatAABBox = computeFatAABBox(objectAABBox);
+                    moveFatAABBoxBody(fatAABBoxBody, oldFatAABBox);
+                    fatAABBoxBody->fatAABBoxUpdated = true;
+                }
+            }
+
+            if(fatAABBoxBody->fatAABBoxUpdated)
+            {
+                updatedBodies.push_back(fatAABBoxBody);
+            }
+        }
+
+        if(!updatedBodies.empty())
+        {
+            computeOverlappingPairs(updatedBodies);
+
+            for(auto &updatedBody : updatedBodies)
+            {
+                updatedBody->fatAABBoxUpdated = false;
+            }
+        }
+    }
+
+    const std::vector<OverlappingPair *> &FatAABBoxAlgorithm::getOverlappingPairs() const
+    {
+        return bodyPairsHandler.getOverlappingPairs();
+    }
+
+    /**
+     * @return Pair container of the bodies without alternative pair container
+     */
+    const PairContainer *FatAABBoxAlgorithm::getPairContainer() const
+    {
+        return bodyPairsHandler.getPairContainer();
+    }
+
+    const std::vector<FatAABBoxAlgorithm::FatAABBoxBody *> &FatAABBoxAlgorithm::getFatAABBoxBodies() const
+    {
+        return fatAABBoxBodies;
+    }
+
+    void FatAABBoxAlgorithm::createOverlappingPair(FatAABBoxBody *fatAABBoxBody1, FatAABBoxBody *fatAABBoxBody2)
+    {
+        bodyPairsHandler.createOverlappingPair(&fatAABBoxBody1->nodeData, &fatAABBoxBody2->nodeData);
+    }
+
+    void FatAABBoxAlgorithm::removeOverlappingPair(FatAABBoxBody *fatAABBoxBody1, FatAABBoxBody *fatAABBoxBody2)
+    {
+        bodyPairsHandler.removeOverlappingPair(&fatAABBoxBody1->nodeData, &fatAABBoxBody2->nodeData);
+    }
+
+    void FatAABBoxAlgorithm::removeOverlappingPairs(FatAABBoxBody *fatAABBoxBody)
+    {
+        bodyPairsHandler.removeOverlappingPairs(&fatAABBoxBody->nodeData);
+    }
+
+    /**
+     * Strict ordering of bodies based on their object ID. Allows to process bodies in an order independent of memory addresses.
+     */
+    bool FatAABBoxAlgorithm::isBodyBefore(const FatAABBoxBody *fatAABBoxBody1, const FatAABBoxBody *fatAABBoxBody2)
+    {
+        return fatAABBoxBody1->nodeData.getNodeObject()->getObjectId() < fatAABBoxBody2->nodeData.getNodeObject()->getObjectId();
+    }
+
+    AABBox<float> FatAABBoxAlgorithm::computeFatAABBox(const AABBox<float> &objectAABBox) const
+    {
+        Point3<float> fatMargin3(fatMargin, fatMargin, fatMargin);
+        return AABBox<float>(objectAABBox.getMin() - fatMargin3, objectAABBox.getMax() + fatMargin3);
+    }
+
+    void FatAABBoxAlgorithm::computeWorldBoundary()
+    {
+        std::vector<AABBox<float>> bodiesAABBox;
+        bodiesAABBox.reserve(fatAABBoxBodies.size());
+        for(const auto &fatAABBoxBody : fatAABBoxBodies)
+        {
+            bodiesAABBox.push_back(fatAABBoxBody->fatAABBox);
+        }
+
+        worldBoundary.compute(bodiesAABBox);
+    }
+
+}
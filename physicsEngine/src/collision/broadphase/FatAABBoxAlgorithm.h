@@ -0,0 +1,74 @@
+#ifndef URCHINENGINE_FATAABBOXALGORITHM_H
+#define URCHINENGINE_FATAABBOXALGORITHM_H
+
+#include <vector>
+#include <unordered_map>
+#include "UrchinCommon.h"
+
+#include "body/work/AbstractWorkBody.h"
+#include "collision/OverlappingPair.h"
+#include "collision/broadphase/BroadPhaseAlgorithm.h"
+#include "collision/broadphase/PairContainer.h"
+#include "collision/broadphase/BodyPairsHandler.h"
+#include "collision/broadphase/WorldBoundary.h"
+#include "collision/broadphase/aabbtree/BodyAABBNodeData.h"
+
+namespace urchin
+{
+
+    /**
+    * Base of broad phase algorithms working on fat AABBox of bodies. As for the AABB tree, overlapping pairs of a body are
+    * recomputed only when the AABBox of the body goes out of its fat AABBox. The algorithm updates the overlapping pairs of a moved fat
+    * AABBox: either in moveFatAABBoxBody() or by removing them and creating them again in computeOverlappingPairs().
+    */
+    class FatAABBoxAlgorithm : public BroadPhaseAlgorithm
+    {
+        public:
+            FatAABBoxAlgorithm();
+            ~FatAABBoxAlgorithm() override;
+
+            void addBody(AbstractWorkBody *, PairContainer *) override;
+            void removeBody(AbstractWorkBody *) override;
+            void updateBodies() override;
+
+            const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
+            const PairContainer *getPairContainer() const override;
+
+        protected:
+            struct FatAABBoxBody
+            {
+                FatAABBoxBody(AbstractWorkBody *, PairContainer *);
+
+                BodyAABBNodeData nodeData;
+                AABBox<float> fatAABBox;
+                bool fatAABBoxUpdated; //true when fat AABBox is new or has been moved since last update
+            };
+
+            virtual void addFatAABBoxBody(FatAABBoxBody *) = 0;
+            virtual void removeFatAABBoxBody(FatAABBoxBody *) = 0;
+            virtual void moveFatAABBoxBody(FatAABBoxBody *, const AABBox<float> &) = 0;
+            virtual void computeOverlappingPairs(const std::vector<FatAABBoxBody *> &) = 0;
+
+            const std::vector<FatAABBoxBody *> &getFatAABBoxBodies() const;
+            void createOverlappingPair(FatAABBoxBody *, FatAABBoxBody *);
+            void removeOverlappingPair(FatAABBoxBody *, FatAABBoxBody *);
+            void removeOverlappingPairs(FatAABBoxBody *);
+
+            static bool isBodyBefore(const FatAABBoxBody *, const FatAABBoxBody *);
+
+        private:
+            AABBox<float> computeFatAABBox(const AABBox<float> &) const;
+            void computeWorldBoundary();
+
+            const float fatMargin;
+            BodyPairsHandler bodyPairsHandler;
+            WorldBoundary worldBoundary;
+
+            std::vector<FatAABBoxBody *> fatAABBoxBodies;
+            std::unordered_map<const AbstractWorkBody *, FatAABBoxBody *> bodiesMap;
+            std::vector<FatAABBoxBody *> updatedBodies;
+    };
+
+}
+
+#endif
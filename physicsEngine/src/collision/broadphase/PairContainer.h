@@ -21,6 +21,9 @@ namespace urchin
 
             virtual const std::vector<OverlappingPair *> &getOverlappingPairs() const = 0;
             virtual std::vector<OverlappingPair> retrieveCopyOverlappingPairs() const = 0;
+
+            virtual unsigned int getAddedPairsCount() const = 0;
+            virtual unsigned int getRemovedPairsCount() const = 0;
     };
 
 }
@@ -46,4 +46,26 @@ namespace urchin
         return copiedOverlappingPairs;
     }
 
+    /**
+     * Lock the container: pairs cannot be added or removed by the physics thread while the returned lock is owned.
+     */
+    std::unique_lock<std::mutex> SyncVectorPairContainer::lockOverlappingPairs() const
+    {
+        return std::unique_lock<std::mutex>(pairMutex);
+    }
+
+    /**
+     * Returns overlapping pairs without copy. Pairs (and their collision algorithms) can be used while the lock is owned.
+     * @param pairLock Lock returned by 'lockOverlappingPairs' method
+     */
+    const std::vector<OverlappingPair *> &SyncVectorPairContainer::getLockedOverlappingPairs(const std::unique_lock<std::mutex> &pairLock) const
+    {
+        if(!pairLock.owns_lock() || pairLock.mutex()!=&pairMutex)
+        {
+            throw std::runtime_error("Cannot retrieve overlapping pairs reference on a thread safe container without owning its lock");
+        }
+
+        return overlappingPairs;
+    }
+
 }
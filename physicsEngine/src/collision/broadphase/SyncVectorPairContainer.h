@@ -23,6 +23,9 @@ namespace urchin
             const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
             std::vector<OverlappingPair> retrieveCopyOverlappingPairs() const override;
 
+            std::unique_lock<std::mutex> lockOverlappingPairs() const;
+            const std::vector<OverlappingPair *> &getLockedOverlappingPairs(const std::unique_lock<std::mutex> &) const;
+
         private:
             mutable std::mutex pairMutex;
     };
@@ -5,6 +5,13 @@
 namespace urchin
 {
 
+    VectorPairContainer::VectorPairContainer() :
+            addedPairsCount(0),
+            removedPairsCount(0)
+    {
+
+    }
+
     VectorPairContainer::~VectorPairContainer()
     {
         for (auto &overlappingPair : overlappingPairs)
@@ -30,6 +37,7 @@ namespace urchin
         if(!found)
         { //pair doesn't exist: we create it
             overlappingPairs.push_back(new OverlappingPair(body1, body2, bodiesId));
+            addedPairsCount++;
         }
     }
 
@@ -42,6 +50,7 @@ namespace urchin
             {
                 delete *it;
                 VectorEraser::erase(overlappingPairs, it);
+                removedPairsCount++;
                 break;
             }
         }
@@ -58,6 +67,7 @@ namespace urchin
             {
                 it = overlappingPairs.erase(it);
                 delete pair;
+                removedPairsCount++;
             }else
             {
                 ++it;
@@ -74,4 +84,20 @@ namespace urchin
     {
         throw std::runtime_error("Not implemented: use 'getOverlappingPairs' method");
     }
+
+    /**
+     * @return Number of pairs added since the container creation
+     */
+    unsigned int VectorPairContainer::getAddedPairsCount() const
+    {
+        return addedPairsCount;
+    }
+
+    /**
+     * @return Number of pairs removed since the container creation
+     */
+    unsigned int VectorPairContainer::getRemovedPairsCount() const
+    {
+        return removedPairsCount;
+    }
 }
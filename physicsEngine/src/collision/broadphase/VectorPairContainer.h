@@ -17,6 +17,7 @@ namespace urchin
     class VectorPairContainer : public PairContainer
     {
         public:
+            VectorPairContainer();
             ~VectorPairContainer() override;
 
             void addOverlappingPair(AbstractWorkBody *, AbstractWorkBody *) override;
@@ -26,8 +27,14 @@ namespace urchin
             const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
             std::vector<OverlappingPair> retrieveCopyOverlappingPairs() const override;
 
+            unsigned int getAddedPairsCount() const override;
+            unsigned int getRemovedPairsCount() const override;
+
         protected:
             std::vector<OverlappingPair *> overlappingPairs;
+
+            unsigned int addedPairsCount;
+            unsigned int removedPairsCount;
     };
 
 }
@@ -0,0 +1,54 @@
+#include <limits>
+
+#include "collision/broadphase/WorldBoundary.h"
+
+namespace urchin
+{
+
+    WorldBoundary::WorldBoundary() :
+            computed(false),
+            minYBoundary(std::numeric_limits<float>::max())
+    {
+
+    }
+
+    bool WorldBoundary::isComputed() const
+    {
+        return computed;
+    }
+
+    /**
+     * @param bodiesAABBox AABBoxes of the bodies present in the world
+     */
+    void WorldBoundary::compute(const std::vector<AABBox<float>> &bodiesAABBox)
+    {
+        float maxYBoundary = -std::numeric_limits<float>::max();
+        for(const auto &bodyAABBox : bodiesAABBox)
+        {
+            minYBoundary = std::min(bodyAABBox.getMin().Y, minYBoundary);
+            maxYBoundary = std::max(bodyAABBox.getMax().Y, maxYBoundary);
+        }
+
+        float worldHeight = maxYBoundary - minYBoundary;
+        minYBoundary -= worldHeight * BOUNDARIES_MARGIN_PERCENTAGE;
+        computed = true;
+    }
+
+    void WorldBoundary::control(const AABBNodeData<AbstractWorkBody *> &nodeData) const
+    {
+        const AABBox<float> &bodyAABBox = nodeData.retrieveObjectAABBox();
+
+        if(bodyAABBox.getMax().Y < minYBoundary)
+        {
+            AbstractWorkBody *body = nodeData.getNodeObject();
+
+            std::stringstream logStream;
+            logStream<<"Body "<<body->getId()<<" is below the limit of "<<std::to_string(minYBoundary)<<": "<<body->getPosition();
+            Logger::logger().log(Logger::CriticalityLevel::WARNING, logStream.str());
+
+            body->setIsStatic(true);
+            body->setPosition(Point3<float>(body->getPosition().X, minYBoundary + bodyAABBox.getHalfSizes().Y + 0.01f, body->getPosition().Z));
+        }
+    }
+
+}
@@ -0,0 +1,33 @@
+#ifndef URCHINENGINE_WORLDBOUNDARY_H
+#define URCHINENGINE_WORLDBOUNDARY_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "body/work/AbstractWorkBody.h"
+
+namespace urchin
+{
+
+    /**
+    * Lower boundary of the world computed from the bodies present at the first update. A body falling below the boundary is
+    * made static and replaced on the boundary.
+    */
+    class WorldBoundary
+    {
+        public:
+            WorldBoundary();
+
+            bool isComputed() const;
+            void compute(const std::vector<AABBox<float>> &);
+
+            void control(const AABBNodeData<AbstractWorkBody *> &) const;
+
+        private:
+            bool computed;
+            float minYBoundary;
+    };
+
+}
+
+#endif
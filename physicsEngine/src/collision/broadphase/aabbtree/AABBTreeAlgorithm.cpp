@@ -35,6 +35,11 @@ namespace urchin
         return tree->getOverlappingPairs();
     }
 
+    const PairContainer *AABBTreeAlgorithm::getPairContainer() const
+    {
+        return tree->getPairContainer();
+    }
+
     std::vector<AbstractWorkBody *> AABBTreeAlgorithm::rayTest(const Ray<float> &ray) const
     {
         std::vector<AbstractWorkBody *> bodiesAABBoxHitRay;
@@ -58,4 +63,14 @@ namespace urchin
         return bodiesAABBoxHitBody;
     }
 
+    std::vector<AbstractWorkBody *> AABBTreeAlgorithm::aabboxTest(const AABBox<float> &aabbox) const
+    {
+        std::vector<AbstractWorkBody *> bodiesAABBoxHit;
+        bodiesAABBoxHit.reserve(15);
+
+        tree->aabboxQuery(aabbox, bodiesAABBoxHit);
+
+        return bodiesAABBoxHit;
+    }
+
 }
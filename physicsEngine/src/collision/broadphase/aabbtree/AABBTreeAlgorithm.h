@@ -22,9 +22,11 @@ namespace urchin
             void updateBodies() override;
 
             const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
+            const PairContainer *getPairContainer() const override;
 
             std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const override;
             std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const override;
+            std::vector<AbstractWorkBody *> aabboxTest(const AABBox<float> &) const override;
 
         private:
             BodyAABBTree *tree;
@@ -7,6 +7,8 @@
 #include "collision/OverlappingPair.h"
 #include "collision/broadphase/PairContainer.h"
 #include "collision/broadphase/BroadPhaseAlgorithm.h"
+#include "collision/broadphase/BodyPairsHandler.h"
+#include "collision/broadphase/WorldBoundary.h"
 #include "collision/broadphase/aabbtree/BodyAABBNodeData.h"
 
 namespace urchin
@@ -16,7 +18,7 @@ namespace urchin
     {
         public:
             BodyAABBTree();
-            ~BodyAABBTree() override;
+            ~BodyAABBTree() override = default;
 
             void addBody(AbstractWorkBody *, PairContainer *);
             void postAddObjectCallback(AABBNode<AbstractWorkBody *> *) override;
@@ -28,20 +30,14 @@ namespace urchin
             void preUpdateObjectCallback(AABBNode<AbstractWorkBody *> *) override;
 
             const std::vector<OverlappingPair *> &getOverlappingPairs() const;
+            const PairContainer *getPairContainer() const;
 
         private:
             void computeOverlappingPairsFor(AABBNode<AbstractWorkBody *> *);
-            void createOverlappingPair(BodyAABBNodeData *, BodyAABBNodeData *);
-            void removeOverlappingPairs(const BodyAABBNodeData *);
-            void removeAlternativePairContainerReferences(const AbstractWorkBody *, PairContainer *);
-
             void computeWorldBoundary();
-            void controlBoundaries(AABBNode<AbstractWorkBody *> *);
-
-            PairContainer *defaultPairContainer;
 
-            bool inInitializationPhase;
-            float minYBoundary;
+            BodyPairsHandler bodyPairsHandler;
+            WorldBoundary worldBoundary;
     };
 
 }
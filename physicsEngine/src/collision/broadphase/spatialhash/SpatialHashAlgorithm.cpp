@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <cmath>
+
+#include "collision/broadphase/spatialhash/SpatialHashAlgorithm.h"
+
+namespace urchin
+{
+
+    SpatialHashAlgorithm::SpatialHashAlgorithm() :
+            cellSize(ConfigService::instance()->getFloatValue("broadPhase.spatialHashCellSize"))
+    {
+        if(cellSize <= 0.0f)
+        {
+            throw std::invalid_argument("Spatial hash cell size must be strictly positive: " + std::to_string(cellSize));
+        }
+    }
+
+    std::vector<AbstractWorkBody *> SpatialHashAlgorithm::rayTest(const Ray<float> &ray) const
+    {
+        std::vector<AbstractWorkBody *> bodiesAABBoxHitRay;
+        bodiesAABBoxHitRay.reserve(10);
+
+        enlargedRayQuery(ray, 0.0f, nullptr, bodiesAABBoxHitRay);
+
+        return bodiesAABBoxHitRay;
+    }
+
+    std::vector<AbstractWorkBody *> SpatialHashAlgorithm::bodyTest(AbstractWorkBody *body, const PhysicsTransform &from, const PhysicsTransform &to) const
+    {
+        std::vector<AbstractWorkBody *> bodiesAABBoxHitBody;
+        bodiesAABBoxHitBody.reserve(15);
+
+        Ray<float> ray(from.getPosition(), to.getPosition());
+        float bodyBoundingSphereRadius = body->getShape()->getMaxDistanceToCenter();
+
+        enlargedRayQuery(ray, bodyBoundingSphereRadius, body, bodiesAABBoxHitBody);
+
+        return bodiesAABBoxHitBody;
+    }
+
+    std::vector<AbstractWorkBody *> SpatialHashAlgorithm::aabboxTest(const AABBox<float> &aabbox) const
+    {
+        std::vector<AbstractWorkBody *> bodiesAABBoxHit;
+        bodiesAABBoxHit.reserve(15);
+
+        std::vector<FatAABBoxBody *> queryCandidateBodies; //local buffer: queries can be executed in parallel of the broad phase
+        aabboxQuery(aabbox, queryCandidateBodies);
+        for(const auto &candidateBody : queryCandidateBodies)
+        {
+            if(candidateBody->fatAABBox.collideWithAABBox(aabbox))
+            {
+                bodiesAABBoxHit.push_back(candidateBody->nodeData.getNodeObject());
+            }
+        }
+
+        return bodiesAABBoxHit;
+    }
+
+    void SpatialHashAlgorithm::addFatAABBoxBody(FatAABBoxBody *fatAABBoxBody)
+    {
+        insertInCells(fatAABBoxBody);
+    }
+
+    void SpatialHashAlgorithm::removeFatAABBoxBody(FatAABBoxBody *fatAABBoxBody)
+    {
+        removeFromCells(fatAABBoxBody, fatAABBoxBody->fatAABBox);
+    }
+
+    void SpatialHashAlgorithm::moveFatAABBoxBody(FatAABBoxBody *fatAABBoxBody, const AABBox<float> &oldFatAABBox)
+    {
+        removeOverlappingPairs(fatAABBoxBody); //pairs are created again in next computation of overlapping pairs
+
+        removeFromCells(fatAABBoxBody, oldFatAABBox);
+        insertInCells(fatAABBoxBody);
+    }
+
+    /**
+     * Create overlapping pairs of updated bodies with the bodies sharing a cell with them
+     */
+    void SpatialHashAlgorithm::computeOverlappingPairs(const std::vector<FatAABBoxBody *> &updatedBodies)
+    {
+        ScopeProfiler profiler("physics", "shComputePair");
+
+        for(const auto &updatedBody : updatedBodies)
+        {
+            aabboxQuery(updatedBody->fatAABBox, broadPhaseCandidateBodies);
+
+            for(const auto &candidateBody : broadPhaseCandidateBodies)
+            {
+                if(candidateBody == updatedBody || (candidateBody->fatAABBoxUpdated && isBodyBefore(candidateBody, updatedBody)))
+                { //pair with another updated body is created only once
+                    continue;
+                }
+
+                if(updatedBody->fatAABBox.collideWithAABBox(candidateBody->fatAABBox))
+                {
+                    createOverlappingPair(updatedBody, candidateBody);
+                }
+            }
+        }
+    }
+
+    SpatialHashAlgorithm::CellRange SpatialHashAlgorithm::computeCellRange(const AABBox<float> &aabbox) const
+    {
+        CellRange cellRange{};
+        for(int axis=0; axis<3; ++axis)
+        {
+            cellRange.min[axis] = static_cast<int>(std::floor(aabbox.getMin()[axis] / cellSize));
+            cellRange.max[axis] = static_cast<int>(std::floor(aabbox.getMax()[axis] / cellSize));
+        }
+        return cellRange;
+    }
+
+    uint_fast64_t SpatialHashAlgorithm::computeNumberCells(const CellRange &cellRange)
+    {
+        uint_fast64_t numberCells = 1;
+        for(int axis=0; axis<3; ++axis)
+        {
+            numberCells *= static_cast<uint_fast64_t>(static_cast<int_fast64_t>(cellRange.max[axis]) - cellRange.min[axis] + 1);
+        }
+        return numberCells;
+    }
+
+    /**
+     * @return Key of the cell: 21 bits by axis. Cells too far from the origin share the keys of other cells.
+     */
+    uint_fast64_t SpatialHashAlgorithm::computeCellKey(int x, int y, int z)
+    {
+        constexpr uint_fast64_t axisMask = (1u << 21u) - 1u;
+        return ((static_cast<uint_fast64_t>(x) & axisMask) << 42u) | ((static_cast<uint_fast64_t>(y) & axisMask) << 21u) | (static_cast<uint_fast64_t>(z) & axisMask);
+    }
+
+    void SpatialHashAlgorithm::insertInCells(FatAABBoxBody *fatAABBoxBody)
+    {
+        CellRange cellRange = computeCellRange(fatAABBoxBody->fatAABBox);
+        if(computeNumberCells(cellRange) > SPATIAL_HASH_MAX_CELLS_BY_BODY)
+        {
+            largeBodies.push_back(fatAABBoxBody);
+            return;
+        }
+
+        for(int x=cellRange.min[0]; x<=cellRange.max[0]; ++x)
+        {
+            for(int y=cellRange.min[1]; y<=cellRange.max[1]; ++y)
+            {
+                for(int z=cellRange.min[2]; z<=cellRange.max[2]; ++z)
+                {
+                    cells[computeCellKey(x, y, z)].push_back(fatAABBoxBody);
+                }
+            }
+        }
+    }
+
+    /**
+     * @param fatAABBox Fat AABBox used to register the body in the cells
+     */
+    void SpatialHashAlgorithm::removeFromCells(FatAABBoxBody *fatAABBoxBody, const AABBox<float> &fatAABBox)
+    {
+        CellRange cellRange = computeCellRange(fatAABBox);
+        if(computeNumberCells(cellRange) > SPATIAL_HASH_MAX_CELLS_BY_BODY)
+        {
+            largeBodies.erase(std::find(largeBodies.begin(), largeBodies.end(), fatAABBoxBody));
+            return;
+        }
+
+        for(int x=cellRange.min[0]; x<=cellRange.max[0]; ++x)
+        {
+            for(int y=cellRange.min[1]; y<=cellRange.max[1]; ++y)
+            {
+                for(int z=cellRange.min[2]; z<=cellRange.max[2]; ++z)
+                {
+                    auto itCell = cells.find(computeCellKey(x, y, z));
+                    std::vector<FatAABBoxBody *> &cellBodies = itCell->second;
+                    VectorEraser::erase(cellBodies, std::find(cellBodies.begin(), cellBodies.end(), fatAABBoxBody));
+                    if(cellBodies.empty())
+                    {
+                        cells.erase(itCell);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @param candidateBodies [out] Bodies potentially colliding with the AABBox. Candidate bodies are sorted and unique.
+     */
+    void SpatialHashAlgorithm::aabboxQuery(const AABBox<float> &aabbox, std::vector<FatAABBoxBody *> &candidateBodies) const
+    {
+        candidateBodies.clear();
+
+        CellRange cellRange = computeCellRange(aabbox);
+        if(computeNumberCells(cellRange) > SPATIAL_HASH_MAX_QUERY_CELLS)
+        { //browsing all bodies is cheaper than browsing the cells
+            const std::vector<FatAABBoxBody *> &fatAABBoxBodies = getFatAABBoxBodies();
+            candidateBodies.insert(candidateBodies.end(), fatAABBoxBodies.begin(), fatAABBoxBodies.end());
+        }else
+        {
+            for(int x=cellRange.min[0]; x<=cellRange.max[0]; ++x)
+            {
+                for(int y=cellRange.min[1]; y<=cellRange.max[1]; ++y)
+                {
+                    for(int z=cellRange.min[2]; z<=cellRange.max[2]; ++z)
+                    {
+                        auto itCell = cells.find(computeCellKey(x, y, z));
+                        if(itCell != cells.end())
+                        {
+                            candidateBodies.insert(candidateBodies.end(), itCell->second.begin(), itCell->second.end());
+                        }
+                    }
+                }
+            }
+            candidateBodies.insert(candidateBodies.end(), largeBodies.begin(), largeBodies.end());
+        }
+
+        std::sort(candidateBodies.begin(), candidateBodies.end(), &FatAABBoxAlgorithm::isBodyBefore);
+        candidateBodies.erase(std::unique(candidateBodies.begin(), candidateBodies.end()), candidateBodies.end());
+    }
+
+    /**
+     * @param enlargeBoxHalfSize Half size used to enlarge the fat AABBoxes before testing them against the ray
+     * @param bodiesAABBoxHitEnlargedRay [out] Bodies having an enlarged fat AABBox hit by the ray
+     */
+    void SpatialHashAlgorithm::enlargedRayQuery(const Ray<float> &ray, float enlargeBoxHalfSize, const AbstractWorkBody *bodyToExclude,
+            std::vector<AbstractWorkBody *> &bodiesAABBoxHitEnlargedRay) const
+    {
+        std::vector<Point3<float>> rayPoints = {ray.getOrigin(), ray.computeTo()};
+        std::vector<FatAABBoxBody *> queryCandidateBodies; //local buffer: queries can be executed in parallel of the broad phase
+        aabboxQuery(AABBox<float>(rayPoints).enlarge(enlargeBoxHalfSize, enlargeBoxHalfSize), queryCandidateBodies);
+
+        for(const auto &candidateBody : queryCandidateBodies)
+        {
+            if(candidateBody->nodeData.getNodeObject() != bodyToExclude
+                    && candidateBody->fatAABBox.enlarge(enlargeBoxHalfSize, enlargeBoxHalfSize).collideWithRay(ray))
+            {
+                bodiesAABBoxHitEnlargedRay.push_back(candidateBody->nodeData.getNodeObject());
+            }
+        }
+    }
+
+}
@@ -0,0 +1,62 @@
+#ifndef URCHINENGINE_SPATIALHASHALGORITHM_H
+#define URCHINENGINE_SPATIALHASHALGORITHM_H
+
+#include <vector>
+#include <unordered_map>
+#include "UrchinCommon.h"
+
+#include "body/work/AbstractWorkBody.h"
+#include "collision/broadphase/FatAABBoxAlgorithm.h"
+
+#define SPATIAL_HASH_MAX_CELLS_BY_BODY 64
+#define SPATIAL_HASH_MAX_QUERY_CELLS 512
+
+namespace urchin
+{
+
+    /**
+    * Spatial hash broad phase algorithm: fat AABBoxes are registered in the cells of a uniform grid stored in a hash map.
+    * Bodies covering too many cells (e.g.: terrains) are kept in a separate list and tested against all bodies.
+    */
+    class SpatialHashAlgorithm : public FatAABBoxAlgorithm
+    {
+        public:
+            SpatialHashAlgorithm();
+
+            std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const override;
+            std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const override;
+            std::vector<AbstractWorkBody *> aabboxTest(const AABBox<float> &) const override;
+
+        protected:
+            void addFatAABBoxBody(FatAABBoxBody *) override;
+            void removeFatAABBoxBody(FatAABBoxBody *) override;
+            void moveFatAABBoxBody(FatAABBoxBody *, const AABBox<float> &) override;
+            void computeOverlappingPairs(const std::vector<FatAABBoxBody *> &) override;
+
+        private:
+            struct CellRange
+            {
+                int min[3];
+                int max[3];
+            };
+
+            CellRange computeCellRange(const AABBox<float> &) const;
+            static uint_fast64_t computeNumberCells(const CellRange &);
+            static uint_fast64_t computeCellKey(int, int, int);
+
+            void insertInCells(FatAABBoxBody *);
+            void removeFromCells(FatAABBoxBody *, const AABBox<float> &);
+
+            void aabboxQuery(const AABBox<float> &, std::vector<FatAABBoxBody *> &) const;
+            void enlargedRayQuery(const Ray<float> &, float, const AbstractWorkBody *, std::vector<AbstractWorkBody *> &) const;
+
+            const float cellSize;
+
+            std::unordered_map<uint_fast64_t, std::vector<FatAABBoxBody *>> cells;
+            std::vector<FatAABBoxBody *> largeBodies;
+            std::vector<FatAABBoxBody *> broadPhaseCandidateBodies;
+    };
+
+}
+
+#endif
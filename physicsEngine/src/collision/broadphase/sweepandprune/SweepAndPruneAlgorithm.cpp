@@ -0,0 +1,444 @@
+#include <algorithm>
+#include <cassert>
+
+#include "collision/broadphase/sweepandprune/SweepAndPruneAlgorithm.h"
+
+namespace urchin
+{
+
+    SweepAndPruneAlgorithm::SweepAndPruneAlgorithm() :
+            sweepAxis(0)
+    {
+
+    }
+
+    std::vector<AbstractWorkBody *> SweepAndPruneAlgorithm::rayTest(const Ray<float> &ray) const
+    {
+        std::vector<AbstractWorkBody *> bodiesAABBoxHitRay;
+        bodiesAABBoxHitRay.reserve(10);
+
+        enlargedRayQuery(ray, 0.0f, nullptr, bodiesAABBoxHitRay);
+
+        return bodiesAABBoxHitRay;
+    }
+
+    std::vector<AbstractWorkBody *> SweepAndPruneAlgorithm::bodyTest(AbstractWorkBody *body, const PhysicsTransform &from, const PhysicsTransform &to) const
+    {
+        std::vector<AbstractWorkBody *> bodiesAABBoxHitBody;
+        bodiesAABBoxHitBody.reserve(15);
+
+        Ray<float> ray(from.getPosition(), to.getPosition());
+        float bodyBoundingSphereRadius = body->getShape()->getMaxDistanceToCenter();
+
+        enlargedRayQuery(ray, bodyBoundingSphereRadius, body, bodiesAABBoxHitBody);
+
+        return bodiesAABBoxHitBody;
+    }
+
+    std::vector<AbstractWorkBody *> SweepAndPruneAlgorithm::aabboxTest(const AABBox<float> &aabbox) const
+    {
+        std::vector<AbstractWorkBody *> bodiesAABBoxHit;
+        bodiesAABBoxHit.reserve(15);
+
+        for(const auto &endpoint : endpoints[sweepAxis])
+        {
+            if(endpoint.value > aabbox.getMax()[sweepAxis])
+            { //next bodies are located after the AABBox on sweep axis
+                break;
+            }
+
+            const FatAABBoxBody *fatAABBoxBody = sweepBodies[endpoint.sweepBodyIndex].fatAABBoxBody;
+            if(!endpoint.isMax && fatAABBoxBody->fatAABBox.collideWithAABBox(aabbox))
+            {
+                bodiesAABBoxHit.push_back(fatAABBoxBody->nodeData.getNodeObject());
+            }
+        }
+
+        for(const auto &fatAABBoxBody : bodiesToInsert)
+        {
+            if(fatAABBoxBody->fatAABBox.collideWithAABBox(aabbox))
+            {
+                bodiesAABBoxHit.push_back(fatAABBoxBody->nodeData.getNodeObject());
+            }
+        }
+
+        return bodiesAABBoxHit;
+    }
+
+    void SweepAndPruneAlgorithm::addFatAABBoxBody(FatAABBoxBody *fatAABBoxBody)
+    {
+        bodiesToInsert.push_back(fatAABBoxBody);
+    }
+
+    void SweepAndPruneAlgorithm::removeFatAABBoxBody(FatAABBoxBody *fatAABBoxBody)
+    {
+        auto itFind = sweepBodyIndices.find(fatAABBoxBody);
+        if(itFind == sweepBodyIndices.end())
+        {
+            bodiesToInsert.erase(std::find(bodiesToInsert.begin(), bodiesToInsert.end(), fatAABBoxBody));
+            return;
+        }
+        std::size_t sweepBodyIndex = itFind->second;
+        sweepBodyIndices.erase(itFind);
+
+        for(int axis=0; axis<3; ++axis)
+        {
+            std::size_t minIndex = sweepBodies[sweepBodyIndex].minEndpoints[axis];
+            std::size_t maxIndex = sweepBodies[sweepBodyIndex].maxEndpoints[axis];
+            endpoints[axis].erase(endpoints[axis].begin() + (long)maxIndex);
+            endpoints[axis].erase(endpoints[axis].begin() + (long)minIndex);
+            for(std::size_t endpointIndex=minIndex; endpointIndex<endpoints[axis].size(); ++endpointIndex)
+            {
+                updateEndpointIndex(axis, endpointIndex);
+            }
+        }
+
+        //last sweep body takes the place of the removed one
+        std::size_t lastSweepBodyIndex = sweepBodies.size() - 1;
+        if(sweepBodyIndex != lastSweepBodyIndex)
+        {
+            sweepBodies[sweepBodyIndex] = sweepBodies[lastSweepBodyIndex];
+            const SweepBody &movedSweepBody = sweepBodies[sweepBodyIndex];
+            for(int axis=0; axis<3; ++axis)
+            {
+                endpoints[axis][movedSweepBody.minEndpoints[axis]].sweepBodyIndex = sweepBodyIndex;
+                endpoints[axis][movedSweepBody.maxEndpoints[axis]].sweepBodyIndex = sweepBodyIndex;
+            }
+            sweepBodyIndices[movedSweepBody.fatAABBoxBody] = sweepBodyIndex;
+        }
+        sweepBodies.pop_back();
+    }
+
+    void SweepAndPruneAlgorithm::moveFatAABBoxBody(FatAABBoxBody *fatAABBoxBody, const AABBox<float> &)
+    {
+        auto itFind = sweepBodyIndices.find(fatAABBoxBody);
+        if(itFind != sweepBodyIndices.end())
+        { //bodies not inserted yet are inserted with their new fat AABBox
+            movedSweepBodyIndices.push_back(itFind->second);
+        }
+    }
+
+    /**
+     * Update the pairs of the moved bodies and insert the new bodies
+     */
+    void SweepAndPruneAlgorithm::computeOverlappingPairs(const std::vector<FatAABBoxBody *> &)
+    {
+        ScopeProfiler profiler("physics", "sapComputePair");
+
+        if(!movedSweepBodyIndices.empty())
+        {
+            moveBodies();
+        }
+
+        if(!bodiesToInsert.empty())
+        {
+            insertBodies();
+        }
+    }
+
+    void SweepAndPruneAlgorithm::moveBodies()
+    {
+        if((float)movedSweepBodyIndices.size() > (float)sweepBodies.size() * SWEEP_AND_PRUNE_BATCH_MOVED_BODIES_RATIO)
+        {
+            moveBodiesBatch();
+        }else
+        {
+            for(std::size_t movedSweepBodyIndex : movedSweepBodyIndices)
+            {
+                moveBody(movedSweepBodyIndex);
+            }
+        }
+        movedSweepBodyIndices.clear();
+    }
+
+    /**
+     * Move the endpoints of the body to their new sorted position. Each swap between a min and a max endpoint of two bodies updates
+     * the overlapping pair of these bodies. Endpoints of the axes are updated and sorted one axis after the other: the overlap on the
+     * other axes is checked with their sorted endpoints, so that the pairs always match the boxes defined by the endpoints.
+     */
+    void SweepAndPruneAlgorithm::moveBody(std::size_t sweepBodyIndex)
+    {
+        const SweepBody &sweepBody = sweepBodies[sweepBodyIndex];
+        const AABBox<float> &fatAABBox = sweepBody.fatAABBoxBody->fatAABBox;
+
+        for(int axis=0; axis<3; ++axis)
+        {
+            float oldMin = endpoints[axis][sweepBody.minEndpoints[axis]].value;
+            float oldMax = endpoints[axis][sweepBody.maxEndpoints[axis]].value;
+            endpoints[axis][sweepBody.minEndpoints[axis]].value = fatAABBox.getMin()[axis];
+            endpoints[axis][sweepBody.maxEndpoints[axis]].value = fatAABBox.getMax()[axis];
+
+            //box is enlarged before being reduced: min endpoint cannot pass over the max endpoint of the same body
+            if(fatAABBox.getMin()[axis] < oldMin)
+            {
+                sortEndpointDown(axis, sweepBody.minEndpoints[axis]);
+            }
+            if(fatAABBox.getMax()[axis] > oldMax)
+            {
+                sortEndpointUp(axis, sweepBody.maxEndpoints[axis]);
+            }
+            if(fatAABBox.getMin()[axis] > oldMin)
+            {
+                sortEndpointUp(axis, sweepBody.minEndpoints[axis]);
+            }
+            if(fatAABBox.getMax()[axis] < oldMax)
+            {
+                sortEndpointDown(axis, sweepBody.maxEndpoints[axis]);
+            }
+        }
+    }
+
+    /**
+     * Update the endpoints of all moved bodies on an axis then restore the order with an insertion sort. As for moveBody(), each swap
+     * between a min and a max endpoint updates the overlapping pair of the two bodies. Endpoint indices of the axis are updated once
+     * sorted: overlap checks during the sort only use the endpoint indices of the other axes.
+     */
+    void SweepAndPruneAlgorithm::moveBodiesBatch()
+    {
+        for(int axis=0; axis<3; ++axis)
+        {
+            std::vector<Endpoint> &axisEndpoints = endpoints[axis];
+            for(std::size_t movedSweepBodyIndex : movedSweepBodyIndices)
+            {
+                const SweepBody &sweepBody = sweepBodies[movedSweepBodyIndex];
+                axisEndpoints[sweepBody.minEndpoints[axis]].value = sweepBody.fatAABBoxBody->fatAABBox.getMin()[axis];
+                axisEndpoints[sweepBody.maxEndpoints[axis]].value = sweepBody.fatAABBoxBody->fatAABBox.getMax()[axis];
+            }
+
+            for(std::size_t i=1; i<axisEndpoints.size(); ++i)
+            {
+                Endpoint endpoint = axisEndpoints[i];
+
+                std::size_t j = i;
+                for(; j>0 && isEndpointLower(endpoint, axisEndpoints[j - 1]); --j)
+                {
+                    updatePairOnSwap(axis, endpoint, axisEndpoints[j - 1]);
+                    axisEndpoints[j] = axisEndpoints[j - 1];
+                }
+                axisEndpoints[j] = endpoint;
+            }
+
+            for(std::size_t endpointIndex=0; endpointIndex<axisEndpoints.size(); ++endpointIndex)
+            {
+                updateEndpointIndex(axis, endpointIndex);
+            }
+        }
+    }
+
+    /**
+     * Merge the endpoints of the new bodies in the sorted endpoints and create the pairs of the new bodies
+     */
+    void SweepAndPruneAlgorithm::insertBodies()
+    {
+        std::size_t firstNewSweepBodyIndex = sweepBodies.size();
+        for(const auto &fatAABBoxBody : bodiesToInsert)
+        {
+            sweepBodyIndices[fatAABBoxBody] = sweepBodies.size();
+            sweepBodies.push_back({fatAABBoxBody, {}, {}, true});
+        }
+        bodiesToInsert.clear();
+
+        for(int axis=0; axis<3; ++axis)
+        {
+            std::vector<Endpoint> &axisEndpoints = endpoints[axis];
+            auto numberSortedEndpoints = static_cast<long>(axisEndpoints.size());
+            for(std::size_t sweepBodyIndex=firstNewSweepBodyIndex; sweepBodyIndex<sweepBodies.size(); ++sweepBodyIndex)
+            {
+                const AABBox<float> &fatAABBox = sweepBodies[sweepBodyIndex].fatAABBoxBody->fatAABBox;
+                axisEndpoints.push_back({fatAABBox.getMin()[axis], sweepBodyIndex, false});
+                axisEndpoints.push_back({fatAABBox.getMax()[axis], sweepBodyIndex, true});
+            }
+
+            std::sort(axisEndpoints.begin() + numberSortedEndpoints, axisEndpoints.end(), isEndpointLower);
+            std::inplace_merge(axisEndpoints.begin(), axisEndpoints.begin() + numberSortedEndpoints, axisEndpoints.end(), isEndpointLower);
+            for(std::size_t endpointIndex=0; endpointIndex<axisEndpoints.size(); ++endpointIndex)
+            {
+                updateEndpointIndex(axis, endpointIndex);
+            }
+        }
+
+        updateSweepAxis();
+        createNewBodiesPairs();
+
+        for(std::size_t sweepBodyIndex=firstNewSweepBodyIndex; sweepBodyIndex<sweepBodies.size(); ++sweepBodyIndex)
+        {
+            sweepBodies[sweepBodyIndex].isNew = false;
+        }
+    }
+
+    /**
+     * Select the axis along which the centers of the fat AABBoxes have the greatest variance: this axis minimizes the number of
+     * endpoints visited by the queries.
+     */
+    void SweepAndPruneAlgorithm::updateSweepAxis()
+    {
+        if(sweepBodies.size() < 2)
+        {
+            return;
+        }
+
+        Point3<float> centerSum(0.0f, 0.0f, 0.0f);
+        Point3<float> centerSquareSum(0.0f, 0.0f, 0.0f);
+        for(const auto &sweepBody : sweepBodies)
+        {
+            Point3<float> center = sweepBody.fatAABBoxBody->fatAABBox.getCenterOfMass();
+            centerSum += center;
+            centerSquareSum += Point3<float>(center.X * center.X, center.Y * center.Y, center.Z * center.Z);
+        }
+
+        auto numberBodies = static_cast<float>(sweepBodies.size());
+        float variances[3];
+        for(int axis=0; axis<3; ++axis)
+        {
+            variances[axis] = centerSquareSum[axis] - (centerSum[axis] * centerSum[axis]) / numberBodies;
+        }
+
+        sweepAxis = static_cast<int>(std::distance(variances, std::max_element(variances, variances + 3)));
+    }
+
+    /**
+     * Sweep the endpoints of the first axis and create overlapping pairs implying at least one new body
+     */
+    void SweepAndPruneAlgorithm::createNewBodiesPairs()
+    {
+        std::vector<std::size_t> activeSweepBodyIndices; //bodies overlapping the current endpoint on the first axis
+        for(const auto &endpoint : endpoints[0])
+        {
+            if(endpoint.isMax)
+            {
+                auto itFind = std::find(activeSweepBodyIndices.begin(), activeSweepBodyIndices.end(), endpoint.sweepBodyIndex);
+                *itFind = activeSweepBodyIndices.back();
+                activeSweepBodyIndices.pop_back();
+                continue;
+            }
+
+            const SweepBody &sweepBody = sweepBodies[endpoint.sweepBodyIndex];
+            for(std::size_t activeSweepBodyIndex : activeSweepBodyIndices)
+            {
+                const SweepBody &activeSweepBody = sweepBodies[activeSweepBodyIndex];
+                if((sweepBody.isNew || activeSweepBody.isNew) && isOverlapOnAxis(1, sweepBody, activeSweepBody) && isOverlapOnAxis(2, sweepBody, activeSweepBody))
+                {
+                    createOverlappingPair(activeSweepBody.fatAABBoxBody, sweepBody.fatAABBoxBody);
+                }
+            }
+            activeSweepBodyIndices.push_back(endpoint.sweepBodyIndex);
+        }
+    }
+
+    void SweepAndPruneAlgorithm::sortEndpointDown(int axis, std::size_t endpointIndex)
+    {
+        std::vector<Endpoint> &axisEndpoints = endpoints[axis];
+        for(; endpointIndex > 0 && isEndpointLower(axisEndpoints[endpointIndex], axisEndpoints[endpointIndex - 1]); --endpointIndex)
+        {
+            updatePairOnSwap(axis, axisEndpoints[endpointIndex], axisEndpoints[endpointIndex - 1]);
+            swapEndpoints(axis, endpointIndex - 1, endpointIndex);
+        }
+    }
+
+    void SweepAndPruneAlgorithm::sortEndpointUp(int axis, std::size_t endpointIndex)
+    {
+        std::vector<Endpoint> &axisEndpoints = endpoints[axis];
+        for(; endpointIndex + 1 < axisEndpoints.size() && isEndpointLower(axisEndpoints[endpointIndex + 1], axisEndpoints[endpointIndex]); ++endpointIndex)
+        {
+            updatePairOnSwap(axis, axisEndpoints[endpointIndex + 1], axisEndpoints[endpointIndex]);
+            swapEndpoints(axis, endpointIndex, endpointIndex + 1);
+        }
+    }
+
+    /**
+     * @param lowerEndpoint Endpoint passing before the upper endpoint on the axis
+     */
+    void SweepAndPruneAlgorithm::updatePairOnSwap(int axis, const Endpoint &lowerEndpoint, const Endpoint &upperEndpoint)
+    {
+        if(lowerEndpoint.isMax == upperEndpoint.isMax)
+        { //overlap on axis unchanged
+            return;
+        }
+
+        assert(lowerEndpoint.sweepBodyIndex != upperEndpoint.sweepBodyIndex);
+        const SweepBody &lowerSweepBody = sweepBodies[lowerEndpoint.sweepBodyIndex];
+        const SweepBody &upperSweepBody = sweepBodies[upperEndpoint.sweepBodyIndex];
+        if(isOverlapOnAxis((axis + 1) % 3, lowerSweepBody, upperSweepBody) && isOverlapOnAxis((axis + 2) % 3, lowerSweepBody, upperSweepBody))
+        {
+            if(lowerEndpoint.isMax)
+            { //max endpoint passes before a min endpoint: boxes stop to overlap
+                removeOverlappingPair(lowerSweepBody.fatAABBoxBody, upperSweepBody.fatAABBoxBody);
+            }else
+            { //min endpoint passes before a max endpoint: boxes start to overlap
+                createOverlappingPair(upperSweepBody.fatAABBoxBody, lowerSweepBody.fatAABBoxBody);
+            }
+        }
+    }
+
+    void SweepAndPruneAlgorithm::swapEndpoints(int axis, std::size_t endpointIndex1, std::size_t endpointIndex2)
+    {
+        std::swap(endpoints[axis][endpointIndex1], endpoints[axis][endpointIndex2]);
+        updateEndpointIndex(axis, endpointIndex1);
+        updateEndpointIndex(axis, endpointIndex2);
+    }
+
+    void SweepAndPruneAlgorithm::updateEndpointIndex(int axis, std::size_t endpointIndex)
+    {
+        const Endpoint &endpoint = endpoints[axis][endpointIndex];
+        SweepBody &sweepBody = sweepBodies[endpoint.sweepBodyIndex];
+        if(endpoint.isMax)
+        {
+            sweepBody.maxEndpoints[axis] = endpointIndex;
+        }else
+        {
+            sweepBody.minEndpoints[axis] = endpointIndex;
+        }
+    }
+
+    /**
+     * Max endpoints are placed before min endpoints of same value: touching boxes don't overlap (see AABBox::collideWithAABBox())
+     */
+    bool SweepAndPruneAlgorithm::isEndpointLower(const Endpoint &endpoint1, const Endpoint &endpoint2)
+    {
+        return endpoint1.value < endpoint2.value || (endpoint1.value == endpoint2.value && endpoint1.isMax && !endpoint2.isMax);
+    }
+
+    /**
+     * @return True when the boxes overlap on the sorted axis. Endpoints order is used: endpoints values are not read.
+     */
+    bool SweepAndPruneAlgorithm::isOverlapOnAxis(int axis, const SweepBody &sweepBody1, const SweepBody &sweepBody2)
+    {
+        return sweepBody1.minEndpoints[axis] < sweepBody2.maxEndpoints[axis] && sweepBody2.minEndpoints[axis] < sweepBody1.maxEndpoints[axis];
+    }
+
+    /**
+     * @param enlargeBoxHalfSize Half size used to enlarge the fat AABBoxes before testing them against the ray
+     * @param bodiesAABBoxHitEnlargedRay [out] Bodies having an enlarged fat AABBox hit by the ray
+     */
+    void SweepAndPruneAlgorithm::enlargedRayQuery(const Ray<float> &ray, float enlargeBoxHalfSize, const AbstractWorkBody *bodyToExclude,
+            std::vector<AbstractWorkBody *> &bodiesAABBoxHitEnlargedRay) const
+    {
+        float rayMin = std::min(ray.getOrigin()[sweepAxis], ray.computeTo()[sweepAxis]) - enlargeBoxHalfSize;
+        float rayMax = std::max(ray.getOrigin()[sweepAxis], ray.computeTo()[sweepAxis]) + enlargeBoxHalfSize;
+
+        for(const auto &endpoint : endpoints[sweepAxis])
+        {
+            if(endpoint.value > rayMax)
+            { //next bodies are located after the ray on sweep axis
+                break;
+            }
+
+            const FatAABBoxBody *fatAABBoxBody = sweepBodies[endpoint.sweepBodyIndex].fatAABBoxBody;
+            if(!endpoint.isMax && fatAABBoxBody->fatAABBox.getMax()[sweepAxis] >= rayMin && fatAABBoxBody->nodeData.getNodeObject() != bodyToExclude
+                    && fatAABBoxBody->fatAABBox.enlarge(enlargeBoxHalfSize, enlargeBoxHalfSize).collideWithRay(ray))
+            {
+                bodiesAABBoxHitEnlargedRay.push_back(fatAABBoxBody->nodeData.getNodeObject());
+            }
+        }
+
+        for(const auto &fatAABBoxBody : bodiesToInsert)
+        {
+            if(fatAABBoxBody->nodeData.getNodeObject() != bodyToExclude
+                    && fatAABBoxBody->fatAABBox.enlarge(enlargeBoxHalfSize, enlargeBoxHalfSize).collideWithRay(ray))
+            {
+                bodiesAABBoxHitEnlargedRay.push_back(fatAABBoxBody->nodeData.getNodeObject());
+            }
+        }
+    }
+
+}
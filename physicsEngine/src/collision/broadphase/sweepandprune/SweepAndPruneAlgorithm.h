@@ -0,0 +1,81 @@
+#ifndef URCHINENGINE_SWEEPANDPRUNEALGORITHM_H
+#define URCHINENGINE_SWEEPANDPRUNEALGORITHM_H
+
+#include <vector>
+#include <unordered_map>
+#include "UrchinCommon.h"
+
+#include "body/work/AbstractWorkBody.h"
+#include "collision/broadphase/FatAABBoxAlgorithm.h"
+
+#define SWEEP_AND_PRUNE_BATCH_MOVED_BODIES_RATIO 0.1f
+
+namespace urchin
+{
+
+    /**
+    * Sweep and prune broad phase algorithm: min and max endpoints of the fat AABBoxes are kept sorted on the three axes. When a fat
+    * AABBox moves, its endpoints are moved by insertion sort swaps (few swaps thanks to temporal coherence): an overlapping pair is
+    * created when two boxes start to overlap on an axis while overlapping on the two other axes and removed when they stop to overlap.
+    * When many bodies move together, the endpoints of an axis are updated at once and sorted by a single insertion sort: bodies moving
+    * together don't swap their endpoints. New bodies are merged in the endpoints arrays and their pairs are found by a sweep on the first axis.
+    */
+    class SweepAndPruneAlgorithm : public FatAABBoxAlgorithm
+    {
+        public:
+            SweepAndPruneAlgorithm();
+
+            std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const override;
+            std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const override;
+            std::vector<AbstractWorkBody *> aabboxTest(const AABBox<float> &) const override;
+
+        protected:
+            void addFatAABBoxBody(FatAABBoxBody *) override;
+            void removeFatAABBoxBody(FatAABBoxBody *) override;
+            void moveFatAABBoxBody(FatAABBoxBody *, const AABBox<float> &) override;
+            void computeOverlappingPairs(const std::vector<FatAABBoxBody *> &) override;
+
+        private:
+            struct Endpoint
+            {
+                float value;
+                std::size_t sweepBodyIndex;
+                bool isMax;
+            };
+
+            struct SweepBody
+            {
+                FatAABBoxBody *fatAABBoxBody;
+                std::size_t minEndpoints[3]; //index of min endpoint by axis
+                std::size_t maxEndpoints[3]; //index of max endpoint by axis
+                bool isNew;
+            };
+
+            void moveBodies();
+            void moveBody(std::size_t);
+            void moveBodiesBatch();
+            void insertBodies();
+            void updateSweepAxis();
+            void createNewBodiesPairs();
+
+            void sortEndpointDown(int, std::size_t);
+            void sortEndpointUp(int, std::size_t);
+            void updatePairOnSwap(int, const Endpoint &, const Endpoint &);
+            void swapEndpoints(int, std::size_t, std::size_t);
+            void updateEndpointIndex(int, std::size_t);
+            static bool isEndpointLower(const Endpoint &, const Endpoint &);
+            static bool isOverlapOnAxis(int, const SweepBody &, const SweepBody &);
+
+            void enlargedRayQuery(const Ray<float> &, float, const AbstractWorkBody *, std::vector<AbstractWorkBody *> &) const;
+
+            int sweepAxis; //axis along which the bodies are the most spread out: used for queries
+            std::vector<Endpoint> endpoints[3]; //sorted endpoints by axis
+            std::vector<SweepBody> sweepBodies;
+            std::unordered_map<const FatAABBoxBody *, std::size_t> sweepBodyIndices;
+            std::vector<std::size_t> movedSweepBodyIndices;
+            std::vector<FatAABBoxBody *> bodiesToInsert;
+    };
+
+}
+
+#endif
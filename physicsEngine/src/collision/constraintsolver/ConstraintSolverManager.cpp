@@ -1,16 +1,33 @@
+#include <algorithm>
+
 #include "collision/constraintsolver/ConstraintSolverManager.h"
 
 namespace urchin
 {
 
-    ConstraintSolverManager::ConstraintSolverManager() :
-            constraintSolverIteration(ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolverIteration")),
+    /**
+     * @param islandManager Island manager providing the islands of the bodies. Islands must be updated with the contacts of the step
+     * before solving the constraints.
+     */
+    ConstraintSolverManager::ConstraintSolverManager(IslandManager *islandManager) :
+            islandManager(islandManager),
+            maxIslandIteration(0),
+            totalIslandIteration(0),
+            constraintSolverMinIteration(ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolverMinIteration")),
+            constraintSolverMaxIteration(ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolverMaxIteration")),
+            convergenceTolerance(ConfigService::instance()->getFloatValue("constraintSolver.convergenceTolerance")),
             biasFactor(ConfigService::instance()->getFloatValue("constraintSolver.biasFactor")),
             useWarmStarting(ConfigService::instance()->getBoolValue("constraintSolver.useWarmStarting")),
             restitutionVelocityThreshold(ConfigService::instance()->getFloatValue("constraintSolver.restitutionVelocityThreshold"))
     {
         unsigned int constraintSolvingPoolSize = ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolvingPoolSize");
         constraintSolvingPool = new FixedSizePool<ConstraintSolving>("constraintSolvingPool", sizeof(ConstraintSolving), constraintSolvingPoolSize);
+
+        if(constraintSolverMinIteration > constraintSolverMaxIteration)
+        {
+            throw std::invalid_argument("Constraint solver min iteration (" + std::to_string(constraintSolverMinIteration)
+                    + ") cannot be greater than max iteration (" + std::to_string(constraintSolverMaxIteration) + ")");
+        }
     }
 
     ConstraintSolverManager::~ConstraintSolverManager()
@@ -28,21 +45,55 @@ namespace urchin
      * @param dt Delta of time (sec.) between two simulation steps
      * @param manifoldResults Constraints to solve
      */
-    void ConstraintSolverManager::solveConstraints(float dt, std::vector<ManifoldResult> &manifoldResults)
+    void ConstraintSolverManager::solveConstraints(float dt, const std::vector<ManifoldResult *> &manifoldResults)
     {
         ScopeProfiler profiler("physics", "solveConstraint");
 
         //setup step to solve constraints
         setupConstraints(manifoldResults, dt);
 
-        //iterative constraint solver
-        for(unsigned int i=0; i<constraintSolverIteration; ++i)
+        //iterative constraint solver: each island iterates until convergence
+        buildSolvingIslands();
+        maxIslandIteration = 0;
+        totalIslandIteration = 0;
+        for(std::size_t islandIndex=0; islandIndex + 1 < islandOffsets.size(); ++islandIndex)
         {
-            solveConstraints();
+            unsigned int islandIteration = solveIsland(islandOffsets[islandIndex], islandOffsets[islandIndex + 1]);
+            maxIslandIteration = std::max(maxIslandIteration, islandIteration);
+            totalIslandIteration += islandIteration;
         }
     }
 
-    void ConstraintSolverManager::setupConstraints(std::vector<ManifoldResult> &manifoldResults, float dt)
+    /**
+     * @return Number of constraints solved during the last step
+     */
+    unsigned int ConstraintSolverManager::getConstraintCount() const
+    {
+        return static_cast<unsigned int>(constraintsSolving.size());
+    }
+
+    /**
+     * @return Highest number of iterations executed by an island of constraints during the last step
+     */
+    unsigned int ConstraintSolverManager::getIterationCount() const
+    {
+        return maxIslandIteration;
+    }
+
+    /**
+     * @return Sum of iterations executed by all islands of constraints during the last step
+     */
+    unsigned int ConstraintSolverManager::getIslandIterationCount() const
+    {
+        return totalIslandIteration;
+    }
+
+    unsigned int ConstraintSolverManager::getConstraintSolvingPoolHighWaterMark() const
+    {
+        return constraintSolvingPool->getHighWaterMark();
+    }
+
+    void ConstraintSolverManager::setupConstraints(const std::vector<ManifoldResult *> &manifoldResults, float dt)
     { //See http://en.wikipedia.org/wiki/Collision_response for formulas
 
         //clear constraints solving
@@ -53,22 +104,22 @@ namespace urchin
         constraintsSolving.clear();
 
         //setup constraints solving
-        for (auto &manifoldResult : manifoldResults)
+        for (auto manifoldResult : manifoldResults)
         {
-            for(unsigned int j=0; j< manifoldResult.getNumContactPoints(); ++j)
+            for(unsigned int j=0; j< manifoldResult->getNumContactPoints(); ++j)
             {
-                ManifoldContactPoint &contact = manifoldResult.getManifoldContactPoint(j);
+                ManifoldContactPoint &contact = manifoldResult->getManifoldContactPoint(j);
                 if(contact.getDepth() > 0.0 && !contact.isPredictive())
                 {
                     continue;
                 }
 
-                WorkRigidBody *body1 = WorkRigidBody::upCast(manifoldResult.getBody1());
-                WorkRigidBody *body2 = WorkRigidBody::upCast(manifoldResult.getBody2());
+                WorkRigidBody *body1 = WorkRigidBody::upCast(manifoldResult->getBody1());
+                WorkRigidBody *body2 = WorkRigidBody::upCast(manifoldResult->getBody2());
                 void *memPtr = constraintSolvingPool->allocate(sizeof(ConstraintSolving));
                 auto *constraintSolving = new(memPtr) ConstraintSolving(body1, body2, contact);
 
-                const CommonSolvingData &commonSolvingData = fillCommonSolvingData(manifoldResult, contact);
+                const CommonSolvingData &commonSolvingData = fillCommonSolvingData(*manifoldResult, contact);
                 constraintSolving->setCommonData(commonSolvingData);
 
                 const ImpulseSolvingData &impulseSolvingData = fillImpulseSolvingData(commonSolvingData, dt);
@@ -88,19 +139,80 @@ namespace urchin
         }
     }
 
-    void ConstraintSolverManager::solveConstraints()
+    /**
+     * Group the constraints by the islands of the island manager. Constraints are sorted by island while keeping their original
+     * order inside each island.
+     */
+    void ConstraintSolverManager::buildSolvingIslands()
     {
-        //solve tangent constraint first because non-penetration is more important than friction
+        islandConstraintsSolving.clear();
         for (auto &constraintSolving : constraintsSolving)
+        { //static bodies are never merged: the island of the constraint is the island of its non-static body
+            WorkRigidBody *body = constraintSolving->getBody1()->isStatic() ? constraintSolving->getBody2() : constraintSolving->getBody1();
+            islandConstraintsSolving.emplace_back(islandManager->findIslandId(body), constraintSolving);
+        }
+        std::stable_sort(islandConstraintsSolving.begin(), islandConstraintsSolving.end(),
+                [](const std::pair<unsigned int, ConstraintSolving *> &left, const std::pair<unsigned int, ConstraintSolving *> &right) {
+            return left.first < right.first;
+        });
+
+        islandOffsets.clear();
+        for(std::size_t i=0; i<islandConstraintsSolving.size(); ++i)
+        {
+            if(i==0 || islandConstraintsSolving[i].first != islandConstraintsSolving[i - 1].first)
+            { //first constraint of an island
+                islandOffsets.push_back(i);
+            }
+            constraintsSolving[i] = islandConstraintsSolving[i].second;
+        }
+        islandOffsets.push_back(constraintsSolving.size());
+    }
+
+    /**
+     * @return Number of iterations executed to solve the constraints of the island
+     */
+    unsigned int ConstraintSolverManager::solveIsland(std::size_t beginIndex, std::size_t endIndex)
+    {
+        for(unsigned int iteration=1; iteration<constraintSolverMaxIteration; ++iteration)
+        {
+            bool converged = solveIslandIteration(beginIndex, endIndex);
+            if(converged && iteration >= constraintSolverMinIteration)
+            {
+                return iteration;
+            }
+        }
+
+        if(constraintSolverMaxIteration > 0)
         {
-            solveTangentConstraint(constraintSolving);
+            solveIslandIteration(beginIndex, endIndex);
+        }
+        return constraintSolverMaxIteration;
+    }
+
+    /**
+     * @return True when the impulses applied during this iteration are negligible compared to the accumulated impulses
+     */
+    bool ConstraintSolverManager::solveIslandIteration(std::size_t beginIndex, std::size_t endIndex)
+    {
+        float appliedImpulses = 0.0f;
+        float accumulatedImpulses = 0.0f;
+
+        //solve tangent constraint first because non-penetration is more important than friction
+        for(std::size_t i=beginIndex; i<endIndex; ++i)
+        {
+            appliedImpulses += solveTangentConstraint(constraintsSolving[i]);
         }
 
         //solve normal constraint
-        for (auto &constraintSolving : constraintsSolving)
+        for(std::size_t i=beginIndex; i<endIndex; ++i)
         {
-            solveNormalConstraint(constraintSolving);
+            appliedImpulses += solveNormalConstraint(constraintsSolving[i]);
+
+            const AccumulatedSolvingData &accumulatedSolvingData = constraintsSolving[i]->getAccumulatedData();
+            accumulatedImpulses += std::abs(accumulatedSolvingData.accNormalImpulse) + std::abs(accumulatedSolvingData.accTangentImpulse);
         }
+
+        return appliedImpulses <= convergenceTolerance * accumulatedImpulses;
     }
 
     CommonSolvingData ConstraintSolverManager::fillCommonSolvingData(const ManifoldResult &manifoldResult, const ManifoldContactPoint &contact)
@@ -171,8 +283,9 @@ namespace urchin
 
     /**
      * Solve normal constraint. Normal constraint is related to non-penetration
+     * @return Absolute value of the applied impulse
      */
-    void ConstraintSolverManager::solveNormalConstraint(ConstraintSolving *constraintSolving)
+    float ConstraintSolverManager::solveNormalConstraint(ConstraintSolving *constraintSolving)
     {
         const CommonSolvingData &commonSolvingData = constraintSolving->getCommonData();
         const ImpulseSolvingData &impulseSolvingData = constraintSolving->getImpulseData();
@@ -189,12 +302,15 @@ namespace urchin
 
         const Vector3<float> normalImpulseVector = normalImpulse * commonSolvingData.contactNormal;
         applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, normalImpulseVector);
+
+        return std::abs(normalImpulse);
     }
 
     /**
      * Solve tangent constraint. Tangent constraint is related to friction
+     * @return Absolute value of the applied impulse
      */
-    void ConstraintSolverManager::solveTangentConstraint(ConstraintSolving *constraintSolving)
+    float ConstraintSolverManager::solveTangentConstraint(ConstraintSolving *constraintSolving)
     {
         const CommonSolvingData &commonSolvingData = constraintSolving->getCommonData();
         const ImpulseSolvingData &impulseSolvingData = constraintSolving->getImpulseData();
@@ -212,6 +328,8 @@ namespace urchin
 
         const Vector3<float> tangentImpulseVector = tangentImpulse * commonSolvingData.contactTangent;
         applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, tangentImpulseVector);
+
+        return std::abs(tangentImpulse);
     }
 
     void ConstraintSolverManager::applyImpulse(WorkRigidBody *body1, WorkRigidBody *body2, const CommonSolvingData &commonData, const Vector3<float> &impulseVector)
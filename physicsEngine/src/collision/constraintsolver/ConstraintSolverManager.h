@@ -2,7 +2,6 @@
 #define URCHINENGINE_CONSTRAINTSOLVERMANAGER_H
 
 #include <vector>
-#include <map>
 #include "UrchinCommon.h"
 
 #include "collision/constraintsolver/ConstraintSolving.h"
@@ -10,29 +9,41 @@
 #include "collision/constraintsolver/solvingdata/ImpulseSolvingData.h"
 #include "body/BodyManager.h"
 #include "collision/ManifoldResult.h"
+#include "collision/island/IslandManager.h"
 #include "utils/pool/FixedSizePool.h"
 #include "body/work/WorkRigidBody.h"
 
 namespace urchin
 {
 
+    /**
+    * Iterative constraint solver. Constraints are grouped by the islands of the island manager (static bodies don't link islands) and
+    * each island iterates until the impulses applied during an iteration become negligible compared to the accumulated impulses.
+    */
     class ConstraintSolverManager
     {
         public:
-            ConstraintSolverManager();
+            explicit ConstraintSolverManager(IslandManager *);
             ~ConstraintSolverManager();
 
-            void solveConstraints(float, std::vector<ManifoldResult> &);
+            void solveConstraints(float, const std::vector<ManifoldResult *> &);
+
+            unsigned int getConstraintCount() const;
+            unsigned int getIterationCount() const;
+            unsigned int getIslandIterationCount() const;
+            unsigned int getConstraintSolvingPoolHighWaterMark() const;
 
         private:
-            void setupConstraints(std::vector<ManifoldResult> &, float);
-            void solveConstraints();
+            void setupConstraints(const std::vector<ManifoldResult *> &, float);
+            void buildSolvingIslands();
+            unsigned int solveIsland(std::size_t, std::size_t);
+            bool solveIslandIteration(std::size_t, std::size_t);
 
             CommonSolvingData fillCommonSolvingData(const ManifoldResult &, const ManifoldContactPoint &);
             ImpulseSolvingData fillImpulseSolvingData(const CommonSolvingData &, float) const;
 
-            void solveNormalConstraint(ConstraintSolving *);
-            void solveTangentConstraint(ConstraintSolving *);
+            float solveNormalConstraint(ConstraintSolving *);
+            float solveTangentConstraint(ConstraintSolving *);
 
             void applyImpulse(WorkRigidBody *, WorkRigidBody *, const CommonSolvingData &, const Vector3<float> &);
             Vector3<float> computeRelativeVelocity(const CommonSolvingData &) const;
@@ -40,10 +51,20 @@ namespace urchin
 
             void logCommonData(const std::string &, const CommonSolvingData &) const;
 
+            IslandManager *islandManager;
+
             std::vector<ConstraintSolving *> constraintsSolving;
             FixedSizePool<ConstraintSolving> *constraintSolvingPool;
 
-            const unsigned int constraintSolverIteration;
+            std::vector<std::pair<unsigned int, ConstraintSolving *>> islandConstraintsSolving;
+            std::vector<std::size_t> islandOffsets;
+
+            unsigned int maxIslandIteration;
+            unsigned int totalIslandIteration;
+
+            const unsigned int constraintSolverMinIteration;
+            const unsigned int constraintSolverMaxIteration;
+            const float convergenceTolerance;
             const float biasFactor;
             const bool useWarmStarting;
             const float restitutionVelocityThreshold;
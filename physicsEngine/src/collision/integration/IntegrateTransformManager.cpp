@@ -9,11 +9,15 @@
 namespace urchin
 {
 
-    IntegrateTransformManager::IntegrateTransformManager(const BodyManager *bodyManager,
-            const BroadPhaseManager *broadPhaseManager, const NarrowPhaseManager *narrowPhaseManager) :
+    /**
+     * @param threadPool Thread pool used to integrate the bodies in parallel chunks
+     */
+    IntegrateTransformManager::IntegrateTransformManager(BodyManager *bodyManager, const BroadPhaseManager *broadPhaseManager,
+            const NarrowPhaseManager *narrowPhaseManager, ThreadPool *threadPool) :
             bodyManager(bodyManager),
             broadPhaseManager(broadPhaseManager),
-            narrowPhaseManager(narrowPhaseManager)
+            narrowPhaseManager(narrowPhaseManager),
+            threadPool(threadPool)
     {
 
     }
@@ -23,26 +27,42 @@ namespace urchin
      */
     void IntegrateTransformManager::integrateTransform(float dt)
     {
-        for (auto abstractBody : bodyManager->getWorkBodies())
-        {
-            WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
-            if(body && body->isActive())
-            {
-                const PhysicsTransform &currentTransform = body->getPhysicsTransform();
-                PhysicsTransform newTransform = body->getPhysicsTransform().integrate(body->getLinearVelocity(), body->getAngularVelocity(), dt);
-
-                float ccdMotionThreshold = body->getCcdMotionThreshold();
-                float motion = currentTransform.getPosition().vector(newTransform.getPosition()).length();
+        const std::vector<WorkRigidBody *> &rigidBodies = bodyManager->getWorkRigidBodies();
+        requireContinuousCollision.resize(rigidBodies.size());
 
-                if(motion > ccdMotionThreshold)
-                {
-                    handleContinuousCollision(body, currentTransform, newTransform, dt);
-                }else
+        //integrate transforms and apply them on bodies not requiring continuous collision
+        threadPool->parallelFor(rigidBodies.size(), INTEGRATE_TRANSFORM_MIN_CHUNK_SIZE, [this, &rigidBodies, dt](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
+            {
+                WorkRigidBody *body = rigidBodies[i];
+                requireContinuousCollision[i] = false;
+                if(body->isActive())
                 {
-                    body->setPosition(newTransform.getPosition());
-                    body->setOrientation(newTransform.getOrientation());
+                    PhysicsTransform newTransform = body->getPhysicsTransform().integrate(body->getLinearVelocity(), body->getAngularVelocity(), dt);
+                    float motion = body->getPosition().vector(newTransform.getPosition()).length();
+
+                    if(motion > body->getCcdMotionThreshold())
+                    {
+                        requireContinuousCollision[i] = true;
+                    }else
+                    {
+                        body->setPosition(newTransform.getPosition());
+                        body->setOrientation(newTransform.getOrientation());
+                    }
                 }
             }
+        });
+
+        //handle continuous collision of fast bodies: broad phase queries are not thread-safe
+        for(std::size_t i=0; i<rigidBodies.size(); ++i)
+        {
+            if(requireContinuousCollision[i])
+            {
+                WorkRigidBody *body = rigidBodies[i];
+                const PhysicsTransform &currentTransform = body->getPhysicsTransform();
+                PhysicsTransform newTransform = currentTransform.integrate(body->getLinearVelocity(), body->getAngularVelocity(), dt);
+                handleContinuousCollision(body, currentTransform, newTransform, dt);
+            }
         }
     }
 
@@ -6,6 +6,8 @@
 #include "collision/broadphase/BroadPhaseManager.h"
 #include "collision/narrowphase/NarrowPhaseManager.h"
 
+#define INTEGRATE_TRANSFORM_MIN_CHUNK_SIZE 128
+
 namespace urchin
 {
 
@@ -15,16 +17,19 @@ namespace urchin
     class IntegrateTransformManager
     {
         public:
-            IntegrateTransformManager(const BodyManager *, const BroadPhaseManager *, const NarrowPhaseManager *);
+            IntegrateTransformManager(BodyManager *, const BroadPhaseManager *, const NarrowPhaseManager *, ThreadPool *);
 
             void integrateTransform(float);
 
         private:
             void handleContinuousCollision(WorkRigidBody *, const PhysicsTransform &, const PhysicsTransform &, float);
 
-            const BodyManager *bodyManager;
+            BodyManager *bodyManager;
             const BroadPhaseManager *broadPhaseManager;
             const NarrowPhaseManager *narrowPhaseManager;
+            ThreadPool *threadPool;
+
+            std::vector<char> requireContinuousCollision; //not a vector of bool: written in parallel by several threads
     };
 
 }
@@ -4,8 +4,12 @@
 namespace urchin
 {
 
-    IntegrateVelocityManager::IntegrateVelocityManager(const BodyManager *bodyManager) :
-        bodyManager(bodyManager)
+    /**
+     * @param threadPool Thread pool used to integrate the bodies in parallel chunks
+     */
+    IntegrateVelocityManager::IntegrateVelocityManager(BodyManager *bodyManager, ThreadPool *threadPool) :
+        bodyManager(bodyManager),
+        threadPool(threadPool)
     {
 
     }
@@ -18,43 +22,38 @@ namespace urchin
     void IntegrateVelocityManager::integrateVelocity(float dt, const std::vector<OverlappingPair *> &overlappingPairs, const Vector3<float> &gravity)
     {
         //apply internal forces
-        applyGravityForce(gravity, dt);
         applyRollingFrictionResistanceForce(dt, overlappingPairs);
 
-        //integrate velocities and apply damping
-        for (auto abstractBody : bodyManager->getWorkBodies())
-        {
-            WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
-            if(body && body->isActive())
+        //apply gravity force, integrate velocities and apply damping
+        const std::vector<WorkRigidBody *> &rigidBodies = bodyManager->getWorkRigidBodies();
+        threadPool->parallelFor(rigidBodies.size(), INTEGRATE_VELOCITY_MIN_CHUNK_SIZE, [&rigidBodies, dt, &gravity](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
             {
-                //integrate velocity
-                body->setLinearVelocity(body->getLinearVelocity() + (body->getTotalMomentum() * body->getInvMass()));
-                body->setAngularVelocity(body->getAngularVelocity() + (body->getTotalTorqueMomentum() * body->getInvWorldInertia()));
-
-                //apply damping
-                body->setLinearVelocity(body->getLinearVelocity() * powf(1.0f - body->getLinearDamping(), dt));
-                body->setAngularVelocity(body->getAngularVelocity() * powf(1.0f - body->getAngularDamping(), dt));
-
-                //reset momentum
-                body->resetMomentum();
-                body->resetTorqueMomentum();
+                WorkRigidBody *body = rigidBodies[i];
+                if(body->isActive())
+                {
+                    integrateBodyVelocity(body, dt, gravity);
+                }
             }
-        }
+        });
     }
 
-    /**
-     * @param gravity Gravity expressed in units/s^2
-     */
-    void IntegrateVelocityManager::applyGravityForce(const Vector3<float> &gravity, float dt)
+    void IntegrateVelocityManager::integrateBodyVelocity(WorkRigidBody *body, float dt, const Vector3<float> &gravity)
     {
-        for (auto abstractBody : bodyManager->getWorkBodies())
-        {
-            WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
-            if(body && body->isActive())
-            {
-                body->applyCentralMomentum(gravity * body->getMass() * dt);
-            }
-        }
+        //apply gravity force
+        body->applyCentralMomentum(gravity * body->getMass() * dt);
+
+        //integrate velocity
+        body->setLinearVelocity(body->getLinearVelocity() + (body->getTotalMomentum() * body->getInvMass()));
+        body->setAngularVelocity(body->getAngularVelocity() + (body->getTotalTorqueMomentum() * body->getInvWorldInertia()));
+
+        //apply damping
+        body->setLinearVelocity(body->getLinearVelocity() * powf(1.0f - body->getLinearDamping(), dt));
+        body->setAngularVelocity(body->getAngularVelocity() * powf(1.0f - body->getAngularDamping(), dt));
+
+        //reset momentum
+        body->resetMomentum();
+        body->resetTorqueMomentum();
     }
 
     void IntegrateVelocityManager::applyRollingFrictionResistanceForce(float dt, const std::vector<OverlappingPair *> &overlappingPairs)
@@ -5,8 +5,11 @@
 #include <vector>
 
 #include "body/BodyManager.h"
+#include "body/work/WorkRigidBody.h"
 #include "collision/OverlappingPair.h"
 
+#define INTEGRATE_VELOCITY_MIN_CHUNK_SIZE 128
+
 namespace urchin
 {
 
@@ -16,15 +19,16 @@ namespace urchin
     class IntegrateVelocityManager
     {
         public:
-            explicit IntegrateVelocityManager(const BodyManager *);
+            IntegrateVelocityManager(BodyManager *, ThreadPool *);
 
             void integrateVelocity(float, const std::vector<OverlappingPair *> &, const Vector3<float> &);
 
         private:
-            void applyGravityForce(const Vector3<float> &, float);
             void applyRollingFrictionResistanceForce(float , const std::vector<OverlappingPair *> &);
+            static void integrateBodyVelocity(WorkRigidBody *, float, const Vector3<float> &);
 
-            const BodyManager *bodyManager;
+            BodyManager *bodyManager;
+            ThreadPool *threadPool;
     };
 
 }
@@ -7,35 +7,53 @@ namespace urchin
 {
 
     IslandContainer::IslandContainer() :
-        containerSorted(false)
+        elementsCount(0)
     {
 
     }
 
     /**
-     * Reset the container of island elements. Create islands of one element for each island elements asked.
+     * Add an element to the container. Element is added in a new island of one element.
      */
-    void IslandContainer::reset(const std::vector<IslandElement *> &islandElements)
+    void IslandContainer::addElement(IslandElement *element)
     {
-        containerSorted = false;
+        unsigned int elementRef;
+        if(freeElementRefs.empty())
+        {
+            elementRef = static_cast<unsigned int>(islandElementsLink.size());
+            islandElementsLink.emplace_back(IslandElementLink());
+        }else
+        {
+            elementRef = freeElementRefs.back();
+            freeElementRefs.pop_back();
+            islandElementsLink[elementRef] = IslandElementLink();
+        }
 
-        islandElementsLink.clear();
-        islandElementsLink.resize(islandElements.size());
+        element->setIslandElementId(elementRef);
+        islandElementsLink[elementRef].element = element;
+        islandElementsLink[elementRef].islandIdRef = elementRef;
+        islandElementsLink[elementRef].nextElementRef = elementRef;
 
-        for(std::size_t i=0; i<islandElements.size(); ++i)
-        {
-            islandElements[i]->setIslandElementId(i);
+        elementsCount++;
+    }
 
-            islandElementsLink[i].element = islandElements[i];
-            islandElementsLink[i].linkedToStaticElement = !islandElements[i]->isActive();
-            islandElementsLink[i].islandIdRef = i;
-        }
+    /**
+     * Remove an element from the container. The island of the element is marked to be split: link of the element is released
+     * during the next split.
+     */
+    void IslandContainer::removeElement(IslandElement *element)
+    {
+        unsigned int elementRef = element->getIslandElementId();
+        assert(islandElementsLink[elementRef].element == element);
+
+        markIslandToSplit(element);
+        islandElementsLink[elementRef].element = nullptr;
+
+        elementsCount--;
     }
 
     void IslandContainer::mergeIsland(IslandElement *element1, IslandElement *element2)
     {
-        assert(!containerSorted);
-
         unsigned int islandId1 = findIslandId(element1->getIslandElementId());
         unsigned int islandId2 = findIslandId(element2->getIslandElementId());
 
@@ -44,47 +62,129 @@ namespace urchin
             return;
         }
 
-        islandElementsLink[islandId1].islandIdRef = islandId2;
+        //union by size: smallest island is attached to the biggest one
+        if(islandElementsLink[islandId1].islandSize > islandElementsLink[islandId2].islandSize)
+        {
+            std::swap(islandId1, islandId2);
+        }
+
+        IslandElementLink &islandLink1 = islandElementsLink[islandId1];
+        IslandElementLink &islandLink2 = islandElementsLink[islandId2];
+        islandLink1.islandIdRef = islandId2;
+        islandLink2.islandSize += islandLink1.islandSize;
+        islandLink2.islandToSplit = islandLink2.islandToSplit || islandLink1.islandToSplit;
+        std::swap(islandLink1.nextElementRef, islandLink2.nextElementRef); //concatenate the circular lists of elements
     }
 
     void IslandContainer::linkToStaticElement(IslandElement *element)
+    {
+        islandElementsLink[element->getIslandElementId()].linkedToStaticElement = true;
+    }
+
+    /**
+     * Mark the island of the element to be split. The split is done lazily by the method splitMarkedIslands.
+     */
+    void IslandContainer::markIslandToSplit(IslandElement *element)
     {
         unsigned int islandId = findIslandId(element->getIslandElementId());
-        islandElementsLink[islandId].linkedToStaticElement = true;
+        if(!islandElementsLink[islandId].islandToSplit)
+        {
+            islandElementsLink[islandId].islandToSplit = true;
+            elementRefsToSplit.push_back(islandId);
+        }
     }
 
     /**
-     * Sorts the islands by ID and returns them.
-     * Once the islands sorted, the container is not usable anymore and need to be reset.
+     * Split the islands marked to be split: each element of these islands is put in a new island of one element.
+     * Caller is responsible to merge again the elements still in contact.
+     * @return True if at least one island has been split
      */
-    const std::vector<IslandElementLink> &IslandContainer::retrieveSortedIslandElements()
+    bool IslandContainer::splitMarkedIslands()
     {
-        //store directly island ID on islandIdRef instead of reference
-        for(std::size_t i=0; i<islandElementsLink.size(); ++i)
+        if(elementRefsToSplit.empty())
         {
-            islandElementsLink[i].islandIdRef = findIslandId(i);
+            return false;
         }
 
-        std::sort(islandElementsLink.begin(), islandElementsLink.end(), IslandElementLinkSortPredicate());
+        for(unsigned int elementRefToSplit : elementRefsToSplit)
+        {
+            unsigned int islandId = findIslandId(elementRefToSplit);
+            if(!islandElementsLink[islandId].islandToSplit)
+            { //island already split
+                continue;
+            }
+
+            unsigned int elementRef = islandId;
+            do
+            {
+                IslandElementLink &elementLink = islandElementsLink[elementRef];
+                unsigned int nextElementRef = elementLink.nextElementRef;
+
+                elementLink.islandIdRef = elementRef;
+                elementLink.nextElementRef = elementRef;
+                elementLink.islandSize = 1;
+                elementLink.islandToSplit = false;
+                if(!elementLink.element)
+                { //element removed: release the link
+                    freeElementRefs.push_back(elementRef);
+                }
+
+                elementRef = nextElementRef;
+            }while(elementRef != islandId);
+        }
+        elementRefsToSplit.clear();
 
-        containerSorted = true;
+        return true;
+    }
 
-        return islandElementsLink;
+    unsigned int IslandContainer::findIslandId(IslandElement *element)
+    {
+        return findIslandId(element->getIslandElementId());
     }
 
-    unsigned int IslandContainer::findIslandId(unsigned int elementRef) const
+    unsigned int IslandContainer::findIslandId(unsigned int elementRef)
     {
-        while(elementRef!=islandElementsLink[elementRef].islandIdRef)
+        unsigned int islandId = elementRef;
+        while(islandId!=islandElementsLink[islandId].islandIdRef)
+        {
+            islandId = islandElementsLink[islandId].islandIdRef;
+        }
+
+        //path compression
+        while(elementRef!=islandId)
         {
-            elementRef = islandElementsLink[elementRef].islandIdRef;
+            unsigned int nextElementRef = islandElementsLink[elementRef].islandIdRef;
+            islandElementsLink[elementRef].islandIdRef = islandId;
+            elementRef = nextElementRef;
         }
 
-        return elementRef;
+        return islandId;
     }
 
+    /**
+     * @param islandElementsLinkResult [out] Links of the elements belonging to the island
+     */
+    void IslandContainer::retrieveIslandElementsLink(unsigned int islandId, std::vector<IslandElementLink *> &islandElementsLinkResult)
+    {
+        islandElementsLinkResult.clear();
+
+        unsigned int elementRef = islandId;
+        do
+        {
+            if(islandElementsLink[elementRef].element)
+            {
+                islandElementsLinkResult.push_back(&islandElementsLink[elementRef]);
+            }
+            elementRef = islandElementsLink[elementRef].nextElementRef;
+        }while(elementRef != islandId);
+    }
+
+    /**
+     * @return Number of elements in the container
+     */
     unsigned int IslandContainer::getSize() const
     {
-        return islandElementsLink.size();
+        return elementsCount;
     }
 
 }
@@ -12,25 +12,33 @@ namespace urchin
     * Island container. An island is a set of elements/bodies which are in contact.
     * The island are useful to made sleep elements/bodies. If all elements/bodies of an island doesn't
     * move: there is no need to execute collision detection checks on these island elements/bodies.
+    * Islands are persistent between steps: they are merged when new contacts appear and split lazily
+    * (see splitMarkedIslands) when contacts are broken.
     */
     class IslandContainer
     {
         public:
             IslandContainer();
 
-            void reset(const std::vector<IslandElement *> &);
+            void addElement(IslandElement *);
+            void removeElement(IslandElement *);
+
             void mergeIsland(IslandElement *, IslandElement *);
             void linkToStaticElement(IslandElement *);
+            void markIslandToSplit(IslandElement *);
+            bool splitMarkedIslands();
 
-            const std::vector<IslandElementLink> &retrieveSortedIslandElements();
+            unsigned int findIslandId(IslandElement *);
+            void retrieveIslandElementsLink(unsigned int, std::vector<IslandElementLink *> &);
             unsigned int getSize() const;
 
         private:
-            unsigned int findIslandId(unsigned int) const;
+            unsigned int findIslandId(unsigned int);
 
             std::vector<IslandElementLink> islandElementsLink;
-
-            bool containerSorted;
+            std::vector<unsigned int> freeElementRefs;
+            std::vector<unsigned int> elementRefsToSplit;
+            unsigned int elementsCount;
     };
 
 }
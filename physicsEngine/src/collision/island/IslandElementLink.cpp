@@ -6,7 +6,10 @@ namespace urchin
     IslandElementLink::IslandElementLink() :
         element(nullptr),
         islandIdRef(0),
-        linkedToStaticElement(false)
+        nextElementRef(0),
+        islandSize(1),
+        linkedToStaticElement(false),
+        islandToSplit(false)
     {
 
     }
@@ -13,18 +13,13 @@ namespace urchin
     {
         IslandElementLink();
 
-        IslandElement *element; //reference to the element
+        IslandElement *element; //reference to the element. Null when the element has been removed and the link is not yet released.
 
         unsigned int islandIdRef; //reference to the next island element. If it references itself: it's the island id.
+        unsigned int nextElementRef; //reference to the next element of the same island (circular list).
+        unsigned int islandSize; //number of elements in the island (only valid for the island id).
         bool linkedToStaticElement; //true if 'element' is linked to a static element.
-    };
-
-    struct IslandElementLinkSortPredicate
-    {
-        bool operator() (const IslandElementLink &elem1, const IslandElementLink &elem2) const
-        {
-            return elem1.islandIdRef < elem2.islandIdRef;
-        }
+        bool islandToSplit; //true if the island must be split because some contacts are broken (only valid for the island id).
     };
 
 }
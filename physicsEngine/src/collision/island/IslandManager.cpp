@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "collision/island/IslandManager.h"
 
 namespace urchin
@@ -6,96 +8,116 @@ namespace urchin
     //Debug parameters
     bool DEBUG_PRINT_ISLANDS = false;
 
-    IslandManager::IslandManager(const BodyManager *bodyManager) :
+    IslandManager::IslandManager(BodyManager *bodyManager) :
         bodyManager(bodyManager),
+        currentStep(0),
         squaredLinearSleepingThreshold(ConfigService::instance()->getFloatValue("island.linearSleepingThreshold") * ConfigService::instance()->getFloatValue("island.linearSleepingThreshold")),
         squaredAngularSleepingThreshold(ConfigService::instance()->getFloatValue("island.angularSleepingThreshold") * ConfigService::instance()->getFloatValue("island.angularSleepingThreshold"))
     {
+        bodyManager->addObserver(this, BodyManager::ADD_WORK_BODY);
+        bodyManager->addObserver(this, BodyManager::REMOVE_WORK_BODY);
+    }
 
+    void IslandManager::notify(Observable *observable, int notificationType)
+    {
+        if(auto *bodyManager = dynamic_cast<BodyManager *>(observable))
+        {
+            if(notificationType==BodyManager::ADD_WORK_BODY)
+            {
+                addBody(bodyManager->getLastUpdatedWorkBody());
+            }else if(notificationType==BodyManager::REMOVE_WORK_BODY)
+            {
+                removeBody(bodyManager->getLastUpdatedWorkBody());
+            }
+        }
     }
 
     /**
-     * Refresh body active state. If all bodies of an island can sleep, we set their status to inactive.
-     * If one body of the island cannot sleep, we set their status to active.
-     * @param overlappingPairs Overlapping pairs of broad phase used to determine the islands
+     * All bodies are added in the island container (static bodies included) because static state of a body can change
+     * without work body re-creation. Static bodies are never merged with others bodies.
      */
-    void IslandManager::refreshBodyActiveState(const std::vector<ManifoldResult> &manifoldResults)
+    void IslandManager::addBody(AbstractWorkBody *body)
     {
-        ScopeProfiler profiler("physics", "refreshBodyStat");
+        islandContainer.addElement(body);
+    }
 
-        buildIslands(manifoldResults);
-        const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveSortedIslandElements();
+    void IslandManager::removeBody(AbstractWorkBody *body)
+    {
+        islandContainer.removeElement(body);
 
-        if(DEBUG_PRINT_ISLANDS)
+        for(std::size_t i=contactLinks.size(); i>0; --i)
         {
-            printIslands(islandElementsLink);
+            const IslandContactLink &contactLink = contactLinks[i-1];
+            if(contactLink.body1==body || contactLink.body2==body)
+            {
+                removeContactLink(i-1);
+            }
         }
+    }
 
-        unsigned int i=0;
-        while(islandElementsLink.size()>i)
-        { //loop on islands
-            unsigned int startElementIndex = i;
-            unsigned int nbElements = computeNumberElements(islandElementsLink, startElementIndex);
-
-            bool islandLinkedToStaticElement = false;
-            bool islandBodiesCanSleep = true;
-            for(unsigned int j=0; j<nbElements; ++j)
-            { //loop on elements of the island
-                auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
-                if(isBodyMoving(body))
-                {
-                    islandBodiesCanSleep = false;
-                    break;
-                }
+    /**
+     * Refresh body active state. If all bodies of an island can sleep, we set their status to inactive.
+     * If one body of the island cannot sleep, we set their status to active.
+     * Islands without active body are not evaluated. Islands must be updated (see updateIslands) before.
+     */
+    void IslandManager::refreshBodyActiveState()
+    {
+        ScopeProfiler profiler("physics", "refreshBodyStat");
 
-                islandLinkedToStaticElement = islandLinkedToStaticElement || islandElementsLink[startElementIndex+j].linkedToStaticElement;
+        //retrieve islands having at least one active body
+        activeIslandIds.clear();
+        for(auto body : bodyManager->getWorkBodies())
+        {
+            if(!body->isStatic() && body->isActive() && WorkRigidBody::upCast(body))
+            {
+                activeIslandIds.push_back(islandContainer.findIslandId(body));
             }
-            islandBodiesCanSleep = islandBodiesCanSleep && islandLinkedToStaticElement; //one element of the island must be in contact with a static element to sleep the island
-
-            for(unsigned int j=0; j<nbElements; ++j)
-            { //loop on elements of the island
-                auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
-                bool bodyActiveState = !islandBodiesCanSleep;
-                if(body->isActive()!=bodyActiveState)
-                {
-                    body->setIsActive(bodyActiveState);
+        }
+        std::sort(activeIslandIds.begin(), activeIslandIds.end());
+        activeIslandIds.erase(std::unique(activeIslandIds.begin(), activeIslandIds.end()), activeIslandIds.end());
 
-                    if(bodyActiveState)
-                    {
-                        body->setLinearVelocity(Vector3<float>(0.0, 0.0, 0.0));
-                        body->setAngularVelocity(Vector3<float>(0.0, 0.0, 0.0));
-                    }
-                }
-            }
+        for(unsigned int activeIslandId : activeIslandIds)
+        {
+            evaluateIsland(activeIslandId);
+        }
 
-            i += nbElements;
+        if(DEBUG_PRINT_ISLANDS)
+        {
+            std::cout<<std::endl;
         }
     }
 
-    void IslandManager::buildIslands(const std::vector<ManifoldResult> &manifoldResults)
+    /**
+     * Update the islands with the contacts of the current step
+     * @param manifoldResults Manifold results of narrow phase used to determine the islands
+     */
+    void IslandManager::updateIslands(const std::vector<ManifoldResult *> &manifoldResults)
     {
-        //1. create an island for each body
-        islandElements.clear();
-        for (auto body : bodyManager->getWorkBodies())
-        {
-            if(!body->isStatic())
-            {
-                islandElements.push_back(body);
-            }
-        }
-        islandContainer.reset(islandElements);
+        ScopeProfiler profiler("physics", "updateIslands");
+
+        currentStep++;
 
-        //2. merge islands for bodies in contact
-        for(const auto &manifoldResult : manifoldResults)
+        //1. merge islands for new contacts
+        for(const auto manifoldResult : manifoldResults)
         {
-            if(manifoldResult.getNumContactPoints() > 0)
+            if(manifoldResult->getNumContactPoints() > 0)
             {
-                AbstractWorkBody *body1 = manifoldResult.getBody1();
-                AbstractWorkBody *body2 = manifoldResult.getBody2();
+                AbstractWorkBody *body1 = manifoldResult->getBody1();
+                AbstractWorkBody *body2 = manifoldResult->getBody2();
 
                 if(!body1->isStatic() && !body2->isStatic())
                 {
-                    islandContainer.mergeIsland(body1, body2);
+                    uint_fast64_t contactLinkId = computeContactLinkId(body1, body2);
+                    auto itFind = contactLinkIndices.find(contactLinkId);
+                    if(itFind==contactLinkIndices.end())
+                    {
+                        contactLinkIndices.insert(std::make_pair(contactLinkId, contactLinks.size()));
+                        contactLinks.push_back({body1, body2, currentStep});
+                        islandContainer.mergeIsland(body1, body2);
+                    }else
+                    {
+                        contactLinks[itFind->second].lastContactStep = currentStep;
+                    }
                 }else if(!body1->isStatic() && body2->isStatic())
                 {
                     islandContainer.linkToStaticElement(body1);
@@ -105,21 +127,108 @@ namespace urchin
                 }
             }
         }
+
+        //2. remove broken contacts. Contacts between two sleeping bodies are not computed by narrow phase: they are kept.
+        for(std::size_t i=contactLinks.size(); i>0; --i)
+        {
+            const IslandContactLink &contactLink = contactLinks[i-1];
+            if(contactLink.lastContactStep!=currentStep && (contactLink.body1->isActive() || contactLink.body2->isActive()))
+            {
+                islandContainer.markIslandToSplit(contactLink.body1);
+                removeContactLink(i-1);
+            }
+        }
+
+        //3. split islands having broken contacts and merge again the bodies still in contact
+        if(islandContainer.splitMarkedIslands())
+        {
+            for(const auto &contactLink : contactLinks)
+            {
+                islandContainer.mergeIsland(contactLink.body1, contactLink.body2);
+            }
+        }
     }
 
     /**
-     * @return Number of element for island starting at 'startElementIndex'
+     * @return Island id of the body. Static bodies are never merged: each static body has its own island.
      */
-    unsigned int IslandManager::computeNumberElements(const std::vector<IslandElementLink> &islandElementsLink, unsigned int startElementIndex) const
+    unsigned int IslandManager::findIslandId(AbstractWorkBody *body)
+    {
+        return islandContainer.findIslandId(body);
+    }
+
+    void IslandManager::removeContactLink(std::size_t contactLinkIndex)
     {
-        unsigned int islandId = islandElementsLink[startElementIndex].islandIdRef;
-        unsigned int endElementIndex;
+        contactLinkIndices.erase(computeContactLinkId(contactLinks[contactLinkIndex].body1, contactLinks[contactLinkIndex].body2));
 
-        for(endElementIndex = startElementIndex; islandElementsLink.size()>endElementIndex && islandId==islandElementsLink[endElementIndex].islandIdRef; ++endElementIndex)
+        if(contactLinkIndex!=contactLinks.size()-1)
         {
+            contactLinks[contactLinkIndex] = contactLinks.back();
+            contactLinkIndices[computeContactLinkId(contactLinks[contactLinkIndex].body1, contactLinks[contactLinkIndex].body2)] = contactLinkIndex;
         }
+        contactLinks.pop_back();
+    }
 
-        return endElementIndex - startElementIndex;
+    uint_fast64_t IslandManager::computeContactLinkId(const AbstractWorkBody *body1, const AbstractWorkBody *body2)
+    {
+        auto bodyId1 = static_cast<uint_fast64_t>(std::min(body1->getObjectId(), body2->getObjectId()));
+        auto bodyId2 = static_cast<uint_fast64_t>(std::max(body1->getObjectId(), body2->getObjectId()));
+
+        return (bodyId1 << 32u) | bodyId2;
+    }
+
+    void IslandManager::evaluateIsland(unsigned int islandId)
+    {
+        islandContainer.retrieveIslandElementsLink(islandId, islandElementsLink);
+
+        if(DEBUG_PRINT_ISLANDS)
+        {
+            printIsland(islandId, islandElementsLink);
+        }
+
+        bool islandLinkedToStaticElement = false;
+        bool islandBodiesCanSleep = true;
+        for(auto islandElementLink : islandElementsLink)
+        { //loop on elements of the island
+            auto *body = dynamic_cast<WorkRigidBody *>(islandElementLink->element);
+            if(!body || body->isStatic())
+            {
+                continue;
+            }
+
+            if(isBodyMoving(body))
+            {
+                islandBodiesCanSleep = false;
+                break;
+            }
+
+            //sleeping body is considered as a static element
+            islandLinkedToStaticElement = islandLinkedToStaticElement || islandElementLink->linkedToStaticElement || !body->isActive();
+        }
+        islandBodiesCanSleep = islandBodiesCanSleep && islandLinkedToStaticElement; //one element of the island must be in contact with a static element to sleep the island
+
+        for(auto islandElementLink : islandElementsLink)
+        { //loop on elements of the island
+            islandElementLink->linkedToStaticElement = false;
+
+            auto *body = dynamic_cast<WorkRigidBody *>(islandElementLink->element);
+            if(!body || body->isStatic())
+            {
+                continue;
+            }
+
+            bool bodyActiveState = !islandBodiesCanSleep;
+            if(body->isActive()!=bodyActiveState)
+            {
+                body->setIsActive(bodyActiveState);
+
+                if(bodyActiveState)
+                {
+                    body->setLinearVelocity(Vector3<float>(0.0, 0.0, 0.0));
+                    body->setAngularVelocity(Vector3<float>(0.0, 0.0, 0.0));
+                }
+            }
+        }
     }
 
     bool IslandManager::isBodyMoving(const WorkRigidBody *body) const
@@ -128,28 +237,18 @@ namespace urchin
                  && body->getAngularVelocity().squareLength() < squaredAngularSleepingThreshold);
     }
 
-    void IslandManager::printIslands(const std::vector<IslandElementLink> &islandElementsLink)
+    void IslandManager::printIsland(unsigned int islandId, const std::vector<IslandElementLink *> &islandElementsLink) const
     {
-        unsigned int islandId = 0;
-        unsigned int i=0;
-        while(islandElementsLink.size()>i)
-        { //loop on islands
-            unsigned int startElementIndex = i;
-            unsigned int nbElements = computeNumberElements(islandElementsLink, startElementIndex);
-
-            std::cout<<"Island "<<islandId<<":"<<std::endl;
-
-            for(unsigned int j=0; j<nbElements; ++j)
-            { //loop on elements of the island
-                auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
+        std::cout<<"Island "<<islandId<<":"<<std::endl;
+
+        for(auto islandElementLink : islandElementsLink)
+        { //loop on elements of the island
+            auto *body = dynamic_cast<WorkRigidBody *>(islandElementLink->element);
+            if(body)
+            {
                 std::cout<<"  - Body: "<<body->getId()<<" (moving: "<<isBodyMoving(body)<<", active: "<<body->isActive()<<")"<<std::endl;
             }
-
-            i += nbElements;
-            islandId++;
         }
-
-        std::cout<<std::endl;
     }
 
 }
@@ -2,6 +2,8 @@
 #define URCHINENGINE_ISLANDMANAGER_H
 
 #include <vector>
+#include <unordered_map>
+#include "UrchinCommon.h"
 
 #include "collision/island/IslandContainer.h"
 #include "collision/ManifoldResult.h"
@@ -11,23 +13,53 @@
 namespace urchin
 {
 
-    class IslandManager
+    /**
+    * Contact between two non-static bodies keeping their island merged
+    */
+    struct IslandContactLink
+    {
+        AbstractWorkBody *body1;
+        AbstractWorkBody *body2;
+        unsigned int lastContactStep;
+    };
+
+    /**
+    * Island manager: islands are updated incrementally. New contacts merge islands, broken contacts mark islands to be split
+    * and only the islands containing at least one active body are evaluated. Contacts between two sleeping bodies are kept
+    * to preserve the sleeping islands.
+    */
+    class IslandManager : public Observer
     {
         public:
-            explicit IslandManager(const BodyManager *);
+            explicit IslandManager(BodyManager *);
+
+            void notify(Observable *, int) override;
 
-            void refreshBodyActiveState(const std::vector<ManifoldResult> &);
+            void updateIslands(const std::vector<ManifoldResult *> &);
+            unsigned int findIslandId(AbstractWorkBody *);
+            void refreshBodyActiveState();
 
         private:
-            void buildIslands(const std::vector<ManifoldResult> &);
-            unsigned int computeNumberElements(const std::vector<IslandElementLink> &, unsigned int) const;
+            void addBody(AbstractWorkBody *);
+            void removeBody(AbstractWorkBody *);
+
+            void removeContactLink(std::size_t);
+            static uint_fast64_t computeContactLinkId(const AbstractWorkBody *, const AbstractWorkBody *);
+
+            void evaluateIsland(unsigned int);
             bool isBodyMoving(const WorkRigidBody *) const;
 
-            void printIslands(const std::vector<IslandElementLink> &);
+            void printIsland(unsigned int, const std::vector<IslandElementLink *> &) const;
 
             const BodyManager *bodyManager;
-            std::vector<IslandElement *> islandElements;
             IslandContainer islandContainer;
+            unsigned int currentStep;
+
+            std::vector<IslandContactLink> contactLinks;
+            std::unordered_map<uint_fast64_t, std::size_t> contactLinkIndices;
+
+            std::vector<unsigned int> activeIslandIds;
+            std::vector<IslandElementLink *> islandElementsLink;
 
             const float squaredLinearSleepingThreshold;
             const float squaredAngularSleepingThreshold;
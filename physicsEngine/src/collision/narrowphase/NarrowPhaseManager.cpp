@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cmath>
+
 #include "collision/narrowphase/NarrowPhaseManager.h"
 #include "shape/CollisionShape3D.h"
 #include "shape/CollisionSphereShape.h"
@@ -9,10 +14,16 @@
 namespace urchin
 {
 
-    NarrowPhaseManager::NarrowPhaseManager(const BodyManager *bodyManager, const BroadPhaseManager *broadPhaseManager) :
+    /**
+     * @param threadPool Thread pool used to handle the continuous collision of the fast bodies in parallel
+     */
+    NarrowPhaseManager::NarrowPhaseManager(const BodyManager *bodyManager, const BroadPhaseManager *broadPhaseManager, ThreadPool *threadPool) :
             bodyManager(bodyManager),
             broadPhaseManager(broadPhaseManager),
+            threadPool(threadPool),
             collisionAlgorithmSelector(new CollisionAlgorithmSelector()),
+            predictiveManifoldResults(ConfigService::instance()->getUnsignedIntValue("narrowPhase.manifoldResultArenaChunkSize")),
+            continuousCollisionSweepCount(0),
             bodiesMutex(LockById::getInstance("narrowPhaseBodyIds"))
     {
 
@@ -26,12 +37,13 @@ namespace urchin
     /**
      * @param dt Delta of time (sec.) between two simulation steps
      * @param overlappingPairs Pairs of bodies potentially colliding
-     * @param manifoldResults [OUT] Collision constraints
+     * @param manifoldResults [OUT] Collision constraints. Manifold results are owned by the narrow phase and stay valid until the next process.
      */
-    void NarrowPhaseManager::process(float dt, const std::vector<OverlappingPair *> &overlappingPairs, std::vector<ManifoldResult> &manifoldResults)
+    void NarrowPhaseManager::process(float dt, const std::vector<OverlappingPair *> &overlappingPairs, std::vector<ManifoldResult *> &manifoldResults)
     {
         ScopeProfiler profiler("physics", "narrowPhase");
 
+        predictiveManifoldResults.clear();
         processOverlappingPairs(overlappingPairs, manifoldResults);
         processPredictiveContacts(dt, manifoldResults);
     }
@@ -39,39 +51,124 @@ namespace urchin
     /**
      * Process ghost body. This method can be called in different thread that physics thread.
      * @param ghostBody Ghost body to process
-     * @param manifoldResults [OUT] Collision constraints
+     * @param manifoldResults [OUT] Collision constraints. Manifold results are copied because the pairs can be removed by the physics thread once unlocked.
      */
     void NarrowPhaseManager::processGhostBody(WorkGhostBody *ghostBody, std::vector<ManifoldResult> &manifoldResults)
     {
-        std::vector<OverlappingPair> overlappingPairs = ghostBody->getPairContainer()->retrieveCopyOverlappingPairs();
+        processGhostBodyPairs(ghostBody, [&manifoldResults](ManifoldResult *manifoldResult) {
+            manifoldResults.push_back(*manifoldResult);
+        });
+    }
 
-        for(auto &overlappingPair : overlappingPairs)
-        {
-            processOverlappingPair(&overlappingPair, manifoldResults);
-        }
+    /**
+     * Process ghost body from the physics thread. This method can be called in parallel for different ghost bodies.
+     * @param ghostBody Ghost body to process
+     * @param manifoldResults [OUT] Collision constraints. Manifold results are not copied: they are owned by the pairs of the ghost body and stay
+     * valid until the next broad phase process.
+     */
+    void NarrowPhaseManager::processGhostBody(WorkGhostBody *ghostBody, std::vector<ManifoldResult *> &manifoldResults)
+    {
+        processGhostBodyPairs(ghostBody, [&manifoldResults](ManifoldResult *manifoldResult) {
+            manifoldResults.push_back(manifoldResult);
+        });
+    }
+
+    /**
+     * @return Number of memory allocations done by the narrow phase outside its pools and arenas since its creation. This number stays unchanged
+     * once the pools and arenas are correctly sized.
+     */
+    unsigned int NarrowPhaseManager::getHeapAllocationCount() const
+    {
+        return collisionAlgorithmSelector->getAlgorithmPool()->getHeapAllocationCount() + predictiveManifoldResults.getChunkAllocationCount();
+    }
+
+    unsigned int NarrowPhaseManager::getAlgorithmPoolHighWaterMark() const
+    {
+        return collisionAlgorithmSelector->getAlgorithmPool()->getHighWaterMark();
+    }
+
+    /**
+     * @return Number of iterations executed by the GJK algorithm of the narrow phase since its creation
+     */
+    unsigned int NarrowPhaseManager::getGJKIterationCount() const
+    {
+        return collisionAlgorithmSelector->getIterationCounter()->getGJKIterations();
+    }
+
+    /**
+     * @return Number of iterations executed by the EPA algorithm of the narrow phase since its creation
+     */
+    unsigned int NarrowPhaseManager::getEPAIterationCount() const
+    {
+        return collisionAlgorithmSelector->getIterationCounter()->getEPAIterations();
+    }
+
+    /**
+     * @return Number of fast bodies swept by the continuous collision detection during the last process
+     */
+    unsigned int NarrowPhaseManager::getContinuousCollisionSweepCount() const
+    {
+        return continuousCollisionSweepCount;
     }
 
-    void NarrowPhaseManager::processOverlappingPairs(const std::vector<OverlappingPair *> &overlappingPairs, std::vector<ManifoldResult> &manifoldResults)
+    void NarrowPhaseManager::processOverlappingPairs(const std::vector<OverlappingPair *> &overlappingPairs, std::vector<ManifoldResult *> &manifoldResults)
     {
         ScopeProfiler profiler("physics", "procOverlapPair");
 
         for(const auto &overlappingPair : overlappingPairs)
         {
-            processOverlappingPair(overlappingPair, manifoldResults);
+            ManifoldResult *manifoldResult = processOverlappingPair(overlappingPair, nullptr);
+            if(manifoldResult)
+            {
+                manifoldResults.push_back(manifoldResult);
+            }
         }
     }
 
-    void NarrowPhaseManager::processOverlappingPair(OverlappingPair *overlappingPair, std::vector<ManifoldResult> &manifoldResults)
+    /**
+     * Process the pairs of the ghost body while they are locked
+     * @param manifoldResultHandler Handler of the manifold results having contact points. Manifold results are valid while the pairs are locked.
+     */
+    void NarrowPhaseManager::processGhostBodyPairs(WorkGhostBody *ghostBody, const std::function<void(ManifoldResult *)> &manifoldResultHandler)
+    {
+        SyncVectorPairContainer *pairContainer = ghostBody->getPairContainer();
+        std::unique_lock<std::mutex> pairLock = pairContainer->lockOverlappingPairs();
+
+        for(const auto &overlappingPair : pairContainer->getLockedOverlappingPairs(pairLock))
+        {
+            ManifoldResult *manifoldResult = processOverlappingPair(overlappingPair, ghostBody);
+            if(manifoldResult)
+            {
+                manifoldResultHandler(manifoldResult);
+            }
+        }
+    }
+
+    /**
+     * @param ghostBody Ghost body owning the pair or nullptr when the pair is owned by the broad phase
+     * @return Persistent manifold result of the pair collision algorithm or nullptr when there is no contact point
+     */
+    ManifoldResult *NarrowPhaseManager::processOverlappingPair(OverlappingPair *overlappingPair, const AbstractWorkBody *ghostBody)
     {
         AbstractWorkBody *body1 = overlappingPair->getBody1();
         AbstractWorkBody *body2 = overlappingPair->getBody2();
 
         if(body1->isActive() || body2->isActive())
         {
-            ScopeLockById lockBody1(bodiesMutex, body1->getObjectId());
-            ScopeLockById lockBody2(bodiesMutex, body2->getObjectId());
+            //bodies are locked by order of object ID to avoid deadlock when ghost bodies are processed in parallel
+            AbstractWorkBody *firstBody = body1->getObjectId() < body2->getObjectId() ? body1 : body2;
+            AbstractWorkBody *secondBody = firstBody==body1 ? body2 : body1;
+            std::optional<ScopeLockById> lockFirstBody, lockSecondBody;
+            if(isLockRequired(firstBody, ghostBody))
+            {
+                lockFirstBody.emplace(bodiesMutex, firstBody->getObjectId());
+            }
+            if(isLockRequired(secondBody, ghostBody))
+            {
+                lockSecondBody.emplace(bodiesMutex, secondBody->getObjectId());
+            }
 
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = retrieveCollisionAlgorithm(overlappingPair);
+            CollisionAlgorithm *collisionAlgorithm = retrieveCollisionAlgorithm(overlappingPair);
 
             CollisionObjectWrapper collisionObject1(*body1->getShape(), body1->getPhysicsTransform());
             CollisionObjectWrapper collisionObject2(*body2->getShape(), body2->getPhysicsTransform());
@@ -79,31 +176,47 @@ namespace urchin
 
             if(collisionAlgorithm->getConstManifoldResult().getNumContactPoints()!=0)
             {
-                manifoldResults.push_back(collisionAlgorithm->getConstManifoldResult());
+                return &collisionAlgorithm->getManifoldResult();
             }
         }
+
+        return nullptr;
+    }
+
+    /**
+     * Static and sleeping bodies are not moved while the pairs are processed: they are not locked. The triangles of the concave shapes are
+     * stored in a buffer by thread, so a static ground can be tested by several ghost bodies in parallel.
+     * @return True when the body must be locked to process a pair
+     */
+    bool NarrowPhaseManager::isLockRequired(const AbstractWorkBody *body, const AbstractWorkBody *ghostBody)
+    {
+        return body==ghostBody || (!body->isStatic() && body->isActive());
     }
 
-    std::shared_ptr<CollisionAlgorithm> NarrowPhaseManager::retrieveCollisionAlgorithm(OverlappingPair *overlappingPair)
+    CollisionAlgorithm *NarrowPhaseManager::retrieveCollisionAlgorithm(OverlappingPair *overlappingPair)
     {
-        std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = overlappingPair->getCollisionAlgorithm();
+        CollisionAlgorithm *collisionAlgorithm = overlappingPair->getCollisionAlgorithm();
         if(!collisionAlgorithm)
         {
             AbstractWorkBody *body1 = overlappingPair->getBody1();
             AbstractWorkBody *body2 = overlappingPair->getBody2();
 
-            collisionAlgorithm = collisionAlgorithmSelector->createCollisionAlgorithm(body1, body1->getShape(), body2, body2->getShape());
-
-            overlappingPair->setCollisionAlgorithm(collisionAlgorithm);
+            overlappingPair->setCollisionAlgorithm(collisionAlgorithmSelector->createCollisionAlgorithm(body1, body1->getShape(), body2, body2->getShape()));
+            collisionAlgorithm = overlappingPair->getCollisionAlgorithm();
         }
 
         return collisionAlgorithm;
     }
 
-    void NarrowPhaseManager::processPredictiveContacts(float dt, std::vector<ManifoldResult> &manifoldResults)
+    /**
+     * Create predictive contact points for the fast bodies. Continuous collisions of the fast bodies are computed in parallel: fast bodies
+     * are grouped in batches of nearby bodies and each batch requires only one query to the broad phase.
+     */
+    void NarrowPhaseManager::processPredictiveContacts(float dt, std::vector<ManifoldResult *> &manifoldResults)
     {
         ScopeProfiler profiler("physics", "proPrediContact");
 
+        continuousCollisionBodies.clear();
         for (auto workBody : bodyManager->getWorkBodies())
         {
             WorkRigidBody *body = WorkRigidBody::upCast(workBody);
@@ -119,111 +232,288 @@ namespace urchin
 
                 if(motion > ccdMotionThreshold)
                 {
-                    handleContinuousCollision(body, currentTransform, newTransform, manifoldResults);
+                    const Point3<float> &fromPosition = currentTransform.getPosition();
+                    const Point3<float> &toPosition = newTransform.getPosition();
+                    float boundingSphereRadius = body->getShape()->getMaxDistanceToCenter();
+                    AABBox<float> sweptAABBox = AABBox<float>(
+                            Point3<float>(std::min(fromPosition.X, toPosition.X), std::min(fromPosition.Y, toPosition.Y), std::min(fromPosition.Z, toPosition.Z)),
+                            Point3<float>(std::max(fromPosition.X, toPosition.X), std::max(fromPosition.Y, toPosition.Y), std::max(fromPosition.Z, toPosition.Z)))
+                            .enlarge(boundingSphereRadius, boundingSphereRadius);
+
+                    continuousCollisionBodies.push_back({body, currentTransform, newTransform, sweptAABBox, 0, nullptr});
                 }
             }
         }
-    }
+        continuousCollisionSweepCount = static_cast<unsigned int>(continuousCollisionBodies.size());
 
-    void NarrowPhaseManager::handleContinuousCollision(AbstractWorkBody *body, const PhysicsTransform &from, const PhysicsTransform &to, std::vector<ManifoldResult> &manifoldResults)
-    {
-        std::vector<AbstractWorkBody *> bodiesAABBoxHitBody = broadPhaseManager->bodyTest(body, from, to);
-        if(!bodiesAABBoxHitBody.empty())
+        if(continuousCollisionBodies.empty())
         {
-            ccd_set ccdResults;
+            return;
+        }
 
-            const CollisionShape3D *bodyShape = body->getShape();
-            if(bodyShape->isCompound())
-            {
-                const auto *compoundShape = dynamic_cast<const CollisionCompoundShape *>(bodyShape);
-                const std::vector<std::shared_ptr<const LocalizedCollisionShape>> & localizedShapes = compoundShape->getLocalizedShapes();
-                for(const auto &localizedShape : localizedShapes)
-                {
-                    TemporalObject temporalObject(localizedShape->shape.get(), from * localizedShape->transform, to * localizedShape->transform);
-                    ccdResults.merge(continuousCollisionTest(temporalObject, bodiesAABBoxHitBody));
-                }
-            }else if(bodyShape->isConvex())
-            {
-                TemporalObject temporalObject(body->getShape(), from, to);
-                ccdResults = continuousCollisionTest(temporalObject, bodiesAABBoxHitBody);
-            }else
+        buildContinuousCollisionBatches();
+
+        threadPool->parallelFor(continuousCollisionBodies.size(), CCD_MIN_CHUNK_SIZE, [this](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
             {
-                throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+                handleContinuousCollision(continuousCollisionBodies[i]);
             }
+        });
 
-            if(!ccdResults.empty())
+        //manifold results are created in the bodies order to keep the simulation deterministic
+        for(auto &continuousCollisionBody : continuousCollisionBodies)
+        {
+            if(continuousCollisionBody.firstResult)
             {
-                const std::unique_ptr<ContinuousCollisionResult<float>, AlgorithmResultDeleter> &firstCCDResult = *ccdResults.begin();
+                const std::unique_ptr<ContinuousCollisionResult<float>, AlgorithmResultDeleter> &firstCCDResult = continuousCollisionBody.firstResult;
+                const PhysicsTransform &from = continuousCollisionBody.from;
+                const PhysicsTransform &to = continuousCollisionBody.to;
 
                 Vector3<float> distanceVector = from.getPosition().vector(to.getPosition()) * firstCCDResult->getTimeToHit();
                 float depth = distanceVector.dotProduct(-firstCCDResult->getNormalFromObject2());
                 const Point3<float> &hitPointOnObject2 = firstCCDResult->getHitPointOnObject2();
                 const Vector3<float> &normalFromObject2 = firstCCDResult->getNormalFromObject2();
 
-                ManifoldResult manifoldResult(body, firstCCDResult->getBody2());
-                manifoldResult.addContactPoint(normalFromObject2, hitPointOnObject2, depth, true);
+                ManifoldResult *manifoldResult = predictiveManifoldResults.newManifoldResult(continuousCollisionBody.body, firstCCDResult->getBody2());
+                manifoldResult->addContactPoint(normalFromObject2, hitPointOnObject2, depth, true);
 
                 manifoldResults.push_back(manifoldResult);
             }
         }
+        continuousCollisionBodies.clear();
     }
 
-    ccd_set NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, const std::vector<AbstractWorkBody *> &bodiesAABBoxHit) const
+    /**
+     * Group the fast bodies in batches of bodies sorted on X axis. A body joins the current batch while the merged swept AABBox stays compact
+     * compared to the swept AABBoxes of the batch bodies. The broad phase is then queried once by batch.
+     */
+    void NarrowPhaseManager::buildContinuousCollisionBatches()
     {
-        ccd_set continuousCollisionResults;
-
-        for(auto bodyAABBoxHit : bodiesAABBoxHit)
+        ScopeProfiler profiler("physics", "buildCcdBatches");
+
+        sortedContinuousCollisionBodies.resize(continuousCollisionBodies.size());
+        std::iota(sortedContinuousCollisionBodies.begin(), sortedContinuousCollisionBodies.end(), 0);
+        std::sort(sortedContinuousCollisionBodies.begin(), sortedContinuousCollisionBodies.end(), [this](std::size_t index1, std::size_t index2) {
+            float minX1 = continuousCollisionBodies[index1].sweptAABBox.getMin().X;
+            float minX2 = continuousCollisionBodies[index2].sweptAABBox.getMin().X;
+            return minX1 < minX2 || (minX1 == minX2 && index1 < index2);
+        });
+
+        std::vector<AABBox<float>> batchesAABBox;
+        unsigned int batchSize = 0;
+        float batchBodiesVolume = 0.0f;
+        for(std::size_t sortedIndex : sortedContinuousCollisionBodies)
         {
-            ScopeLockById lockBody(bodiesMutex, bodyAABBoxHit->getObjectId());
+            ContinuousCollisionBody &continuousCollisionBody = continuousCollisionBodies[sortedIndex];
+            const AABBox<float> &sweptAABBox = continuousCollisionBody.sweptAABBox;
 
-            const CollisionShape3D *bodyShape = bodyAABBoxHit->getShape();
-            if(bodyShape->isCompound())
+            if(batchSize > 0 && batchSize < CCD_BATCH_MAX_BODIES)
             {
-                const auto *compoundShape = dynamic_cast<const CollisionCompoundShape *>(bodyShape);
-                const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes = compoundShape->getLocalizedShapes();
-                for(const auto &localizedShape : localizedShapes)
+                AABBox<float> mergedAABBox = batchesAABBox.back().merge(sweptAABBox);
+                if(mergedAABBox.getVolume() <= 2.0f * (batchBodiesVolume + sweptAABBox.getVolume()))
                 {
-                    PhysicsTransform fromToObject2 = bodyAABBoxHit->getPhysicsTransform() * localizedShape->transform;
-                    TemporalObject temporalObject2(localizedShape->shape.get(), fromToObject2, fromToObject2);
+                    batchesAABBox.back() = mergedAABBox;
+                    batchBodiesVolume += sweptAABBox.getVolume();
+                    batchSize++;
+                    continuousCollisionBody.batchIndex = batchesAABBox.size() - 1;
+                    continue;
+                }
+            }
 
-                    continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
+            batchesAABBox.push_back(sweptAABBox);
+            batchBodiesVolume = sweptAABBox.getVolume();
+            batchSize = 1;
+            continuousCollisionBody.batchIndex = batchesAABBox.size() - 1;
+        }
+
+        continuousCollisionBatches.resize(batchesAABBox.size());
+        for(std::size_t batchIndex=0; batchIndex<batchesAABBox.size(); ++batchIndex)
+        {
+            ContinuousCollisionBatch &batch = continuousCollisionBatches[batchIndex];
+            batch.bodiesAABBoxHit = broadPhaseManager->aabboxTest(batchesAABBox[batchIndex]);
+
+            batch.bodiesAABBoxHitAABBox.clear();
+            for(auto bodyAABBoxHit : batch.bodiesAABBoxHit)
+            {
+                ScopeLockById lockBody(bodiesMutex, bodyAABBoxHit->getObjectId());
+                batch.bodiesAABBoxHitAABBox.push_back(bodyAABBoxHit->getShape()->toAABBox(bodyAABBoxHit->getPhysicsTransform()));
+            }
+        }
+    }
+
+    /**
+     * Determine the first hit of a fast body. This method is executed in parallel for different fast bodies. Bodies of the batch are tested
+     * by order of time of entry in their AABBox: once a hit is found, the remaining bodies cannot be reached before this hit and are ignored.
+     */
+    void NarrowPhaseManager::handleContinuousCollision(ContinuousCollisionBody &continuousCollisionBody) const
+    {
+        const ContinuousCollisionBatch &batch = continuousCollisionBatches[continuousCollisionBody.batchIndex];
+        AbstractWorkBody *body = continuousCollisionBody.body;
+        const PhysicsTransform &from = continuousCollisionBody.from;
+        const PhysicsTransform &to = continuousCollisionBody.to;
+        Vector3<float> motion = from.getPosition().vector(to.getPosition());
+        float boundingSphereRadius = body->getShape()->getMaxDistanceToCenter();
+
+        std::vector<std::pair<float, AbstractWorkBody *>> bodiesAABBoxHitBody;
+        for(std::size_t i=0; i<batch.bodiesAABBoxHit.size(); ++i)
+        {
+            if(batch.bodiesAABBoxHit[i] != body)
+            {
+                AABBox<float> enlargedAABBox = batch.bodiesAABBoxHitAABBox[i].enlarge(boundingSphereRadius, boundingSphereRadius);
+                float timeOfEntry = computeTimeOfEntry(enlargedAABBox, from.getPosition(), motion);
+                if(timeOfEntry <= 1.0f)
+                {
+                    bodiesAABBoxHitBody.emplace_back(std::make_pair(timeOfEntry, batch.bodiesAABBoxHit[i]));
                 }
-            }else if(bodyShape->isConvex())
+            }
+        }
+        if(bodiesAABBoxHitBody.empty())
+        {
+            return;
+        }
+        std::sort(bodiesAABBoxHitBody.begin(), bodiesAABBoxHitBody.end(), [](const auto &bodyHit1, const auto &bodyHit2) {
+            return bodyHit1.first < bodyHit2.first || (bodyHit1.first == bodyHit2.first && bodyHit1.second->getObjectId() < bodyHit2.second->getObjectId());
+        });
+
+        std::vector<TemporalObject> temporalObjects;
+        const CollisionShape3D *bodyShape = body->getShape();
+        if(bodyShape->isCompound())
+        {
+            const auto *compoundShape = dynamic_cast<const CollisionCompoundShape *>(bodyShape);
+            const std::vector<std::shared_ptr<const LocalizedCollisionShape>> & localizedShapes = compoundShape->getLocalizedShapes();
+            temporalObjects.reserve(localizedShapes.size());
+            for(const auto &localizedShape : localizedShapes)
             {
-                const PhysicsTransform &fromToObject2 = bodyAABBoxHit->getPhysicsTransform();
-                TemporalObject temporalObject2(bodyShape, fromToObject2, fromToObject2);
+                temporalObjects.emplace_back(TemporalObject(localizedShape->shape.get(), from * localizedShape->transform, to * localizedShape->transform));
+            }
+        }else if(bodyShape->isConvex())
+        {
+            temporalObjects.emplace_back(TemporalObject(bodyShape, from, to));
+        }else
+        {
+            throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+        }
 
-                continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
-            }else if(bodyShape->isConcave())
+        ccd_set ccdResults;
+        for(const auto &bodyAABBoxHitBody : bodiesAABBoxHitBody)
+        {
+            if(!ccdResults.empty() && bodyAABBoxHitBody.first > (*ccdResults.begin())->getTimeToHit())
+            { //conservative advancement: next bodies cannot be hit before the first hit found
+                break;
+            }
+
+            for(const auto &temporalObject : temporalObjects)
             {
-                const auto *concaveShape = dynamic_cast<const CollisionConcaveShape *>(bodyShape);
+                continuousCollisionTest(temporalObject, bodyAABBoxHitBody.second, ccdResults);
+            }
+        }
 
-                PhysicsTransform inverseTransformObject2 = bodyAABBoxHit->getPhysicsTransform().inverse();
-                AABBox<float> fromAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getFrom());
-                AABBox<float> toAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getTo());
+        if(!ccdResults.empty())
+        {
+            continuousCollisionBody.firstResult = std::move(ccdResults.extract(ccdResults.begin()).value());
+        }
+    }
 
-                if(temporalObject1.isRay())
-                {
-                    LineSegment3D<float> ray(fromAABBoxLocalToObject1.getMin(), toAABBoxLocalToObject1.getMin());
-                    const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesHitByRay(ray);
+    /**
+     * @param from Start point of the motion
+     * @param motion Motion vector
+     * @return Fraction of the motion (between 0.0 and 1.0) where the point enters in the AABBox. Return a value greater than 1.0 when the point
+     * doesn't enter in the AABBox during the motion.
+     */
+    float NarrowPhaseManager::computeTimeOfEntry(const AABBox<float> &aabbox, const Point3<float> &from, const Vector3<float> &motion)
+    {
+        float timeOfEntry = 0.0f;
+        float timeOfExit = 1.0f;
 
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
-                }else
+        for(int axis=0; axis<3; ++axis)
+        {
+            if(std::abs(motion[axis]) <= std::numeric_limits<float>::epsilon())
+            {
+                if(from[axis] < aabbox.getMin()[axis] || from[axis] > aabbox.getMax()[axis])
                 {
-                    AABBox<float> temporalAABBoxLocalToObject1 = fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1);
-                    const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesInAABBox(temporalAABBoxLocalToObject1);
-
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+                    return std::numeric_limits<float>::max();
                 }
             }else
             {
-                throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+                float invMotion = 1.0f / motion[axis];
+                float timeToMin = (aabbox.getMin()[axis] - from[axis]) * invMotion;
+                float timeToMax = (aabbox.getMax()[axis] - from[axis]) * invMotion;
+
+                timeOfEntry = std::max(timeOfEntry, std::min(timeToMin, timeToMax));
+                timeOfExit = std::min(timeOfExit, std::max(timeToMin, timeToMax));
+                if(timeOfEntry > timeOfExit)
+                {
+                    return std::numeric_limits<float>::max();
+                }
             }
         }
 
+        return timeOfEntry;
+    }
+
+    ccd_set NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, const std::vector<AbstractWorkBody *> &bodiesAABBoxHit) const
+    {
+        ccd_set continuousCollisionResults;
+
+        for(auto bodyAABBoxHit : bodiesAABBoxHit)
+        {
+            continuousCollisionTest(temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+        }
+
         return continuousCollisionResults;
     }
 
+    /**
+     * Continuous collision test between a temporal object and a body. This method can be called by different threads.
+     * @param continuousCollisionResults [OUT] In case of collision detected: continuous collision result will be updated with collision details
+     */
+    void NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, AbstractWorkBody *bodyAABBoxHit, ccd_set &continuousCollisionResults) const
+    {
+        const CollisionShape3D *bodyShape = bodyAABBoxHit->getShape();
+        if(bodyShape->isCompound())
+        {
+            const auto *compoundShape = dynamic_cast<const CollisionCompoundShape *>(bodyShape);
+            const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes = compoundShape->getLocalizedShapes();
+            for(const auto &localizedShape : localizedShapes)
+            {
+                PhysicsTransform fromToObject2 = bodyAABBoxHit->getPhysicsTransform() * localizedShape->transform;
+                TemporalObject temporalObject2(localizedShape->shape.get(), fromToObject2, fromToObject2);
+
+                continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
+            }
+        }else if(bodyShape->isConvex())
+        {
+            const PhysicsTransform &fromToObject2 = bodyAABBoxHit->getPhysicsTransform();
+            TemporalObject temporalObject2(bodyShape, fromToObject2, fromToObject2);
+
+            continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
+        }else if(bodyShape->isConcave())
+        {
+            const auto *concaveShape = dynamic_cast<const CollisionConcaveShape *>(bodyShape);
+
+            PhysicsTransform inverseTransformObject2 = bodyAABBoxHit->getPhysicsTransform().inverse();
+            AABBox<float> fromAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getFrom());
+            AABBox<float> toAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getTo());
+
+            if(temporalObject1.isRay())
+            {
+                LineSegment3D<float> ray(fromAABBoxLocalToObject1.getMin(), toAABBoxLocalToObject1.getMin());
+                const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesHitByRay(ray);
+
+                trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+            }else
+            {
+                AABBox<float> temporalAABBoxLocalToObject1 = fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1);
+                const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesInAABBox(temporalAABBoxLocalToObject1);
+
+                trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+            }
+        }else
+        {
+            throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+        }
+    }
+
     /**
      * @param continuousCollisionResults [OUT] In case of collision detected: continuous collision result will be updated with collision details
      */
@@ -4,9 +4,12 @@
 #include <memory>
 #include <vector>
 #include <mutex>
+#include <functional>
+#include <optional>
 #include "UrchinCommon.h"
 
 #include "collision/ManifoldResult.h"
+#include "collision/ManifoldResultArena.h"
 #include "collision/OverlappingPair.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
@@ -19,35 +22,73 @@
 #include "object/TemporalObject.h"
 #include "shape/CollisionTriangleShape.h"
 
+#define CCD_BATCH_MAX_BODIES 32
+#define CCD_MIN_CHUNK_SIZE 4
+
 namespace urchin
 {
     class NarrowPhaseManager
     {
         public:
-            NarrowPhaseManager(const BodyManager *, const BroadPhaseManager *);
+            NarrowPhaseManager(const BodyManager *, const BroadPhaseManager *, ThreadPool *);
             ~NarrowPhaseManager();
 
-            void process(float, const std::vector<OverlappingPair *> &, std::vector<ManifoldResult> &);
+            void process(float, const std::vector<OverlappingPair *> &, std::vector<ManifoldResult *> &);
             void processGhostBody(WorkGhostBody *, std::vector<ManifoldResult> &);
+            void processGhostBody(WorkGhostBody *, std::vector<ManifoldResult *> &);
+
+            unsigned int getHeapAllocationCount() const;
+            unsigned int getAlgorithmPoolHighWaterMark() const;
+            unsigned int getGJKIterationCount() const;
+            unsigned int getEPAIterationCount() const;
+            unsigned int getContinuousCollisionSweepCount() const;
 
             ccd_set continuousCollisionTest(const TemporalObject &,  const std::vector<AbstractWorkBody *> &) const;
             ccd_set rayTest(const Ray<float> &, const std::vector<AbstractWorkBody *> &) const;
 
         private:
-            void processOverlappingPairs(const std::vector<OverlappingPair *> &, std::vector<ManifoldResult> &);
-            void processOverlappingPair(OverlappingPair *, std::vector<ManifoldResult> &);
-            std::shared_ptr<CollisionAlgorithm> retrieveCollisionAlgorithm(OverlappingPair *);
+            void processOverlappingPairs(const std::vector<OverlappingPair *> &, std::vector<ManifoldResult *> &);
+            void processGhostBodyPairs(WorkGhostBody *, const std::function<void(ManifoldResult *)> &);
+            ManifoldResult *processOverlappingPair(OverlappingPair *, const AbstractWorkBody *);
+            static bool isLockRequired(const AbstractWorkBody *, const AbstractWorkBody *);
+            CollisionAlgorithm *retrieveCollisionAlgorithm(OverlappingPair *);
+
+            struct ContinuousCollisionBody
+            {
+                AbstractWorkBody *body;
+                PhysicsTransform from;
+                PhysicsTransform to;
+                AABBox<float> sweptAABBox;
+                std::size_t batchIndex;
+                std::unique_ptr<ContinuousCollisionResult<float>, AlgorithmResultDeleter> firstResult;
+            };
 
-            void processPredictiveContacts(float, std::vector<ManifoldResult> &);
-            void handleContinuousCollision(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &, std::vector<ManifoldResult> &);
+            struct ContinuousCollisionBatch
+            {
+                std::vector<AbstractWorkBody *> bodiesAABBoxHit;
+                std::vector<AABBox<float>> bodiesAABBoxHitAABBox;
+            };
+
+            void processPredictiveContacts(float, std::vector<ManifoldResult *> &);
+            void buildContinuousCollisionBatches();
+            void handleContinuousCollision(ContinuousCollisionBody &) const;
+            static float computeTimeOfEntry(const AABBox<float> &, const Point3<float> &, const Vector3<float> &);
+            void continuousCollisionTest(const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
             void trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape> &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
             void continuousCollisionTest(const TemporalObject &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
 
             const BodyManager *bodyManager;
             const BroadPhaseManager *broadPhaseManager;
+            ThreadPool *threadPool;
 
             CollisionAlgorithmSelector *const collisionAlgorithmSelector;
             const GJKContinuousCollisionAlgorithm<double, float> gjkContinuousCollisionAlgorithm;
+            ManifoldResultArena predictiveManifoldResults;
+
+            std::vector<ContinuousCollisionBody> continuousCollisionBodies;
+            std::vector<std::size_t> sortedContinuousCollisionBodies;
+            std::vector<ContinuousCollisionBatch> continuousCollisionBatches;
+            unsigned int continuousCollisionSweepCount;
 
             std::shared_ptr<LockById> bodiesMutex;
     };
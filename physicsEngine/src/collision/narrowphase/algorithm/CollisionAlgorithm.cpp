@@ -64,8 +64,6 @@ namespace urchin
 
     void CollisionAlgorithm::refreshContactPoints()
     {
-        ScopeProfiler profiler("physics", "reContactPts");
-
         manifoldResult.refreshContactPoints();
     }
 
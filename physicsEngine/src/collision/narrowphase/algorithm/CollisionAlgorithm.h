@@ -21,13 +21,13 @@ namespace urchin
 
             bool isObjectSwapped() const;
             const ManifoldResult &getConstManifoldResult() const;
+            ManifoldResult &getManifoldResult();
 
         protected:
             virtual void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) = 0;
 
             const CollisionAlgorithmSelector *getCollisionAlgorithmSelector() const;
 
-            ManifoldResult &getManifoldResult();
             void addNewContactPoint(const Vector3<float> &, const Point3<float> &, float);
             float getContactBreakingThreshold() const;
 
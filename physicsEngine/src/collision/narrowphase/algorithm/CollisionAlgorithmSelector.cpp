@@ -130,7 +130,7 @@ namespace urchin
      * @param shape1 Shape or partial shape composing the body 1
      * @param shape2 Shape or partial shape composing the body 2
      */
-    std::shared_ptr<CollisionAlgorithm> CollisionAlgorithmSelector::createCollisionAlgorithm(
+    std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> CollisionAlgorithmSelector::createCollisionAlgorithm(
             AbstractWorkBody *body1, const CollisionShape3D *shape1, AbstractWorkBody *body2, const CollisionShape3D *shape2) const
     {
         CollisionAlgorithmBuilder *collisionAlgorithmBuilder = collisionAlgorithmBuilderMatrix[shape1->getShapeType()][shape2->getShapeType()];
@@ -149,20 +149,22 @@ namespace urchin
                                      + " and " + std::to_string(shape2->getShapeType()));
         }
 
-        std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = std::shared_ptr<CollisionAlgorithm>(collisionAlgorithmPtr, AlgorithmDeleter(algorithmPool));
+        std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> collisionAlgorithm(collisionAlgorithmPtr, AlgorithmDeleter(algorithmPool));
         collisionAlgorithm->setupCollisionAlgorithmSelector(this);
         return collisionAlgorithm;
     }
 
-    CollisionAlgorithmSelector::AlgorithmDeleter::AlgorithmDeleter(FixedSizePool<CollisionAlgorithm> *const algorithmPool) :
-        algorithmPool(algorithmPool)
+    const FixedSizePool<CollisionAlgorithm> *CollisionAlgorithmSelector::getAlgorithmPool() const
     {
-
+        return algorithmPool;
     }
 
-    void CollisionAlgorithmSelector::AlgorithmDeleter::operator()(CollisionAlgorithm *const collisionAlgorithm)
+    /**
+     * @return Counter of the iterations executed by the GJK and EPA algorithms of the collision algorithms
+     */
+    AlgorithmIterationCounter *CollisionAlgorithmSelector::getIterationCounter() const
     {
-        algorithmPool->free(collisionAlgorithm);
+        return &iterationCounter;
     }
 
 }
@@ -6,6 +6,8 @@
 #include "body/work/AbstractWorkBody.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmDeleter.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmIterationCounter.h"
 #include "utils/pool/SyncFixedSizePool.h"
 
 namespace urchin
@@ -17,7 +19,10 @@ namespace urchin
             CollisionAlgorithmSelector();
             ~CollisionAlgorithmSelector();
 
-            std::shared_ptr<CollisionAlgorithm> createCollisionAlgorithm(AbstractWorkBody *, const CollisionShape3D *, AbstractWorkBody *, const CollisionShape3D *) const;
+            std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> createCollisionAlgorithm(AbstractWorkBody *, const CollisionShape3D *, AbstractWorkBody *, const CollisionShape3D *) const;
+
+            const FixedSizePool<CollisionAlgorithm> *getAlgorithmPool() const;
+            AlgorithmIterationCounter *getIterationCounter() const;
 
         private:
             void initializeCollisionAlgorithmBuilderMatrix();
@@ -27,17 +32,8 @@ namespace urchin
 
             void initializeAlgorithmPool();
 
-            class AlgorithmDeleter
-            {
-                public:
-                    explicit AlgorithmDeleter(FixedSizePool<CollisionAlgorithm> *);
-                    void operator()(CollisionAlgorithm *);
-
-                private:
-                    FixedSizePool<CollisionAlgorithm> *const algorithmPool;
-            };
-
             SyncFixedSizePool<CollisionAlgorithm> *algorithmPool;
+            mutable AlgorithmIterationCounter iterationCounter;
             CollisionAlgorithmBuilder *collisionAlgorithmBuilderMatrix[CollisionShape3D::SHAPE_MAX][CollisionShape3D::SHAPE_MAX];
     };
 
@@ -13,8 +13,6 @@ namespace urchin
 
     void CompoundAnyCollisionAlgorithm::doProcessCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
     {
-        ScopeProfiler profiler("physics", "algCompoundAny");
-
         const auto &compoundShape = dynamic_cast<const CollisionCompoundShape &>(object1.getShape());
         const CollisionShape3D &otherShape = object2.getShape();
 
@@ -24,7 +22,7 @@ namespace urchin
         const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes = compoundShape.getLocalizedShapes();
         for (const auto &localizedShape : localizedShapes)
         {
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
+            std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
                     body1, localizedShape->shape.get(), body2, &otherShape);
 
             PhysicsTransform shapeWorldTransform = object1.getShapeWorldTransform() * localizedShape->transform;
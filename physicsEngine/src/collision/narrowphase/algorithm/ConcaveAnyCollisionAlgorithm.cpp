@@ -15,8 +15,6 @@ namespace urchin
 
     void ConcaveAnyCollisionAlgorithm::doProcessCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
     {
-        ScopeProfiler profiler("physics", "algConcaveAny");
-
         const CollisionShape3D &otherShape = object2.getShape();
 
         AbstractWorkBody *body1 = getManifoldResult().getBody1();
@@ -28,7 +26,7 @@ namespace urchin
         const std::vector<CollisionTriangleShape> &triangles = concaveShape.findTrianglesInAABBox(aabboxLocalToObject1);
         for(const auto &triangle : triangles)
         {
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
+            std::unique_ptr<CollisionAlgorithm, AlgorithmDeleter> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
                     body1, &triangle, body2, &otherShape);
 
             CollisionObjectWrapper subObject1(triangle, object1.getShapeWorldTransform());
@@ -1,6 +1,7 @@
 #include <memory>
 
 #include "collision/narrowphase/algorithm/ConvexConvexCollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "object/CollisionConvexObject3D.h"
 
 namespace urchin
@@ -14,14 +15,13 @@ namespace urchin
 
     void ConvexConvexCollisionAlgorithm::doProcessCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
     {
-        ScopeProfiler profiler("physics", "algConvConv");
-
         //transform convex hull shapes
         std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject1 = object1.getShape().toConvexObject(object1.getShapeWorldTransform());
         std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject2 = object2.getShape().toConvexObject(object2.getShapeWorldTransform());
 
         //process GJK and EPA hybrid algorithms
-        std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithoutMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, false);
+        std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithoutMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, false,
+                getCollisionAlgorithmSelector()->getIterationCounter());
 
         if(gjkResultWithoutMargin->isValidResult())
         {
@@ -48,11 +48,13 @@ namespace urchin
     void ConvexConvexCollisionAlgorithm::processCollisionAlgorithmWithMargin(const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &convexObject1,
             const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &convexObject2)
     {
-        std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, true);
+        std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, true,
+                getCollisionAlgorithmSelector()->getIterationCounter());
 
         if(gjkResultWithMargin->isValidResult() && gjkResultWithMargin->isCollide())
         {
-            std::unique_ptr<EPAResult<double>, AlgorithmResultDeleter> epaResult = epaAlgorithm.processEPA(*convexObject1, *convexObject2, *gjkResultWithMargin);
+            std::unique_ptr<EPAResult<double>, AlgorithmResultDeleter> epaResult = epaAlgorithm.processEPA(*convexObject1, *convexObject2, *gjkResultWithMargin,
+                    getCollisionAlgorithmSelector()->getIterationCounter());
 
             if(epaResult->isValidResult() && epaResult->isCollide())
             { //should be always true except for problems due to float imprecision
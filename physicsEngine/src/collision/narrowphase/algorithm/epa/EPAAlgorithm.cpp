@@ -13,8 +13,11 @@ namespace urchin
 
     }
 
+    /**
+     * @param iterationCounter Counter of the iterations of the collision world. Null when the iterations are not counted.
+     */
     template<class T> std::unique_ptr<EPAResult<T>, AlgorithmResultDeleter> EPAAlgorithm<T>::processEPA(const CollisionConvexObject3D &convexObject1, const CollisionConvexObject3D &convexObject2,
-            const GJKResult<T> &gjkResult) const
+            const GJKResult<T> &gjkResult, AlgorithmIterationCounter *iterationCounter) const
     {
         assert(gjkResult.isCollide());
 
@@ -116,6 +119,10 @@ namespace urchin
             }
             iterationNumber++;
         }
+        if(iterationCounter)
+        {
+            iterationCounter->addEPAIterations(iterationNumber + 1);
+        }
 
         //5. compute EPA result: normal, penetration depth and contact points of collision
         const EPATriangleData<T> &closestTriangleData = itClosestTriangleData->second;
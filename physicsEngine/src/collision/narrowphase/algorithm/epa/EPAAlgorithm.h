@@ -16,6 +16,7 @@
 #include "collision/narrowphase/algorithm/epa/result/EPAResultNoCollide.h"
 #include "collision/narrowphase/algorithm/epa/result/EPAResultInvalid.h"
 #include "collision/narrowphase/algorithm/utils/AlgorithmResultDeleter.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmIterationCounter.h"
 #include "object/CollisionConvexObject3D.h"
 #include "collision/narrowphase/algorithm/gjk/result/GJKResult.h"
 
@@ -27,7 +28,8 @@ namespace urchin
         public:
             EPAAlgorithm();
 
-            std::unique_ptr<EPAResult<T>, AlgorithmResultDeleter> processEPA(const CollisionConvexObject3D &, const CollisionConvexObject3D &, const GJKResult<T> &) const;
+            std::unique_ptr<EPAResult<T>, AlgorithmResultDeleter> processEPA(const CollisionConvexObject3D &, const CollisionConvexObject3D &, const GJKResult<T> &,
+                    AlgorithmIterationCounter *) const;
 
         private:
             std::unique_ptr<EPAResult<T>, AlgorithmResultDeleter> handleSubTriangle(const CollisionConvexObject3D &, const CollisionConvexObject3D &) const;
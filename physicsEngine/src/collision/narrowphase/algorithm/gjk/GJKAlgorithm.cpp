@@ -18,9 +18,10 @@ namespace urchin
 
     /**
     * @param includeMargin Indicate whether algorithm operates on objects with margin
+    * @param iterationCounter Counter of the iterations of the collision world. Null when the iterations are not counted.
     */
     template<class T> std::unique_ptr<GJKResult<T>, AlgorithmResultDeleter> GJKAlgorithm<T>::processGJK(const CollisionConvexObject3D &convexObject1,
-            const CollisionConvexObject3D &convexObject2, bool includeMargin) const
+            const CollisionConvexObject3D &convexObject2, bool includeMargin, AlgorithmIterationCounter *iterationCounter) const
     {
         //get point which belongs to the outline of the shape (Minkowski difference)
         Vector3<T> initialDirection = Vector3<T>(1.0, 0.0, 0.0);
@@ -46,6 +47,10 @@ namespace urchin
             //check termination conditions: new point is not more extreme that existing ones OR new point already exist in simplex
             if((closestPointSquareDistance-closestPointDotNewPoint) <= terminationTolerance || simplex.isPointInSimplex(newPoint))
             {
+                if(iterationCounter)
+                {
+                    iterationCounter->addGJKIterations(iterationNumber + 1);
+                }
                 if(closestPointDotNewPoint <= 0.0)
                 { //collision detected
                     return AlgorithmResultAllocator::instance()->newGJKResultCollide<T>(simplex);
@@ -59,6 +64,10 @@ namespace urchin
             direction = (-simplex.getClosestPointToOrigin()).toVector();
         }
 
+        if(iterationCounter)
+        {
+            iterationCounter->addGJKIterations(maxIteration);
+        }
         logMaximumIterationReach(convexObject1, convexObject2, includeMargin);
 
         return AlgorithmResultAllocator::instance()->newGJKResultInvalid<T>();
@@ -9,6 +9,7 @@
 #include "collision/narrowphase/algorithm/gjk/result/GJKResultNoCollide.h"
 #include "collision/narrowphase/algorithm/gjk/result/GJKResultInvalid.h"
 #include "collision/narrowphase/algorithm/utils/AlgorithmResultDeleter.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmIterationCounter.h"
 #include "object/CollisionConvexObject3D.h"
 
 namespace urchin
@@ -22,7 +23,8 @@ namespace urchin
         public:
             GJKAlgorithm();
 
-            std::unique_ptr<GJKResult<T>, AlgorithmResultDeleter> processGJK(const CollisionConvexObject3D &, const CollisionConvexObject3D &, bool) const;
+            std::unique_ptr<GJKResult<T>, AlgorithmResultDeleter> processGJK(const CollisionConvexObject3D &, const CollisionConvexObject3D &, bool,
+                    AlgorithmIterationCounter *) const;
 
         private:
             void logMaximumIterationReach(const CollisionConvexObject3D &, const CollisionConvexObject3D &, bool) const;
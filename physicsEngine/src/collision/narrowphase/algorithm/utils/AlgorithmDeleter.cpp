@@ -0,0 +1,23 @@
+#include "AlgorithmDeleter.h"
+
+namespace urchin
+{
+
+    AlgorithmDeleter::AlgorithmDeleter() :
+        algorithmPool(nullptr)
+    {
+
+    }
+
+    AlgorithmDeleter::AlgorithmDeleter(FixedSizePool<CollisionAlgorithm> *algorithmPool) :
+        algorithmPool(algorithmPool)
+    {
+
+    }
+
+    void AlgorithmDeleter::operator()(CollisionAlgorithm *const collisionAlgorithm)
+    {
+        algorithmPool->free(collisionAlgorithm);
+    }
+
+}
@@ -0,0 +1,27 @@
+#ifndef URCHINENGINE_ALGORITHMDELETER_H
+#define URCHINENGINE_ALGORITHMDELETER_H
+
+#include "utils/pool/FixedSizePool.h"
+#include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
+
+namespace urchin
+{
+
+    /**
+     * Deleter giving back the collision algorithm memory to the pool which has allocated it
+     */
+    class AlgorithmDeleter
+    {
+        public:
+            AlgorithmDeleter();
+            explicit AlgorithmDeleter(FixedSizePool<CollisionAlgorithm> *);
+
+            void operator()(CollisionAlgorithm *);
+
+        private:
+            FixedSizePool<CollisionAlgorithm> *algorithmPool;
+    };
+
+}
+
+#endif
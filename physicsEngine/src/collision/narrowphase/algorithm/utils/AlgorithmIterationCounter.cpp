@@ -0,0 +1,33 @@
+#include "collision/narrowphase/algorithm/utils/AlgorithmIterationCounter.h"
+
+namespace urchin
+{
+
+    AlgorithmIterationCounter::AlgorithmIterationCounter() :
+            gjkIterations(0),
+            epaIterations(0)
+    {
+
+    }
+
+    void AlgorithmIterationCounter::addGJKIterations(unsigned int iterations)
+    {
+        gjkIterations.fetch_add(iterations, std::memory_order_relaxed);
+    }
+
+    void AlgorithmIterationCounter::addEPAIterations(unsigned int iterations)
+    {
+        epaIterations.fetch_add(iterations, std::memory_order_relaxed);
+    }
+
+    unsigned int AlgorithmIterationCounter::getGJKIterations() const
+    {
+        return gjkIterations.load(std::memory_order_relaxed);
+    }
+
+    unsigned int AlgorithmIterationCounter::getEPAIterations() const
+    {
+        return epaIterations.load(std::memory_order_relaxed);
+    }
+
+}
@@ -0,0 +1,31 @@
+#ifndef URCHINENGINE_ALGORITHMITERATIONCOUNTER_H
+#define URCHINENGINE_ALGORITHMITERATIONCOUNTER_H
+
+#include <atomic>
+
+namespace urchin
+{
+
+    /**
+    * Count the iterations executed by the GJK and EPA algorithms of one collision world. Counters can be incremented by several threads:
+    * the number of iterations of a step is the difference between the counter values at the end and at the beginning of the step.
+    */
+    class AlgorithmIterationCounter
+    {
+        public:
+            AlgorithmIterationCounter();
+
+            void addGJKIterations(unsigned int);
+            void addEPAIterations(unsigned int);
+
+            unsigned int getGJKIterations() const;
+            unsigned int getEPAIterations() const;
+
+        private:
+            std::atomic_uint gjkIterations;
+            std::atomic_uint epaIterations;
+    };
+
+}
+
+#endif
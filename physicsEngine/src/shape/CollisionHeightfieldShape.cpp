@@ -17,12 +17,12 @@ namespace urchin
         localAABBox = buildLocalAABBox();
 
         unsigned int trianglesShapePoolSize = ConfigService::instance()->getUnsignedIntValue("collisionShape.heightfieldTrianglesPoolSize");
-        triangleShapesPool = new FixedSizePool<TriangleShape3D<float>>("triangleShapesPool", sizeof(TriangleShape3D<float>), trianglesShapePoolSize);
+        triangleShapesPool = new SyncFixedSizePool<TriangleShape3D<float>>("triangleShapesPool", sizeof(TriangleShape3D<float>), trianglesShapePoolSize);
     }
 
     CollisionHeightfieldShape::~CollisionHeightfieldShape()
     {
-        trianglesInAABBox.clear();
+        trianglesBuffers.clear();
         delete triangleShapesPool;
     }
 
@@ -144,8 +144,12 @@ namespace urchin
         return new CollisionHeightfieldShape(vertices, xLength, zLength);
     }
 
+    /**
+     * @return Triangles in the AABBox. Triangles are stored in a buffer of the calling thread: they stay valid until the next search of the thread.
+     */
     const std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::findTrianglesInAABBox(const AABBox<float> &checkAABBox) const
     {
+        std::vector<CollisionTriangleShape> &trianglesInAABBox = retrieveTrianglesBuffer();
         trianglesInAABBox.clear();
 
         auto vertexXRange = computeStartEndIndices(checkAABBox.getMin().X, checkAABBox.getMax().X, Axis::X);
@@ -155,16 +159,20 @@ namespace urchin
         {
             for (unsigned int x = vertexXRange.first; x < vertexXRange.second; ++x)
             {
-                createTrianglesMatchHeight(x, z, checkAABBox.getMin().Y, checkAABBox.getMax().Y);
+                createTrianglesMatchHeight(trianglesInAABBox, x, z, checkAABBox.getMin().Y, checkAABBox.getMax().Y);
             }
         }
 
         return trianglesInAABBox;
     }
 
+    /**
+     * @return Triangles hit by the ray. Triangles are stored in a buffer of the calling thread: they stay valid until the next search of the thread.
+     */
     const std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::findTrianglesHitByRay(const LineSegment3D<float> &ray) const
     {
-        trianglesInAABBox.clear();
+        std::vector<CollisionTriangleShape> &trianglesHitByRay = retrieveTrianglesBuffer();
+        trianglesHitByRay.clear();
 
         bool raySameXValues = ray.getA().X == ray.getB().X;
         bool raySameZValues = ray.getA().Z == ray.getB().Z;
@@ -209,11 +217,11 @@ namespace urchin
                 float rayMinY = std::max(yMinMaxValue1.first, yMinMaxValue2.first);
                 float rayMaxY = std::min(yMinMaxValue1.second, yMinMaxValue2.second);
 
-                createTrianglesMatchHeight(x, z, rayMinY, rayMaxY);
+                createTrianglesMatchHeight(trianglesHitByRay, x, z, rayMinY, rayMaxY);
             }
         }
 
-        return trianglesInAABBox;
+        return trianglesHitByRay;
     }
 
     /**
@@ -235,7 +243,13 @@ namespace urchin
         return std::make_pair(startVertex, endVertex);
     }
 
-    void CollisionHeightfieldShape::createTrianglesMatchHeight(unsigned int x, unsigned int z, float minY, float maxY) const
+    std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::retrieveTrianglesBuffer() const
+    {
+        std::lock_guard<std::mutex> lock(trianglesBuffersMutex);
+        return trianglesBuffers[std::this_thread::get_id()]; //reference stays valid when other threads insert their buffer
+    }
+
+    void CollisionHeightfieldShape::createTrianglesMatchHeight(std::vector<CollisionTriangleShape> &triangles, unsigned int x, unsigned int z, float minY, float maxY) const
     {
         Point3<float> point1 = vertices[x + xLength * z]; //far-left
         Point3<float> point2 = vertices[x + 1 + xLength * z]; //far-right
@@ -247,19 +261,20 @@ namespace urchin
 
         if( (point1.Y > minY || hasDiagonalPointAbove) && (point1.Y < maxY || hasDiagonalPointBelow) )
         {
-            createCollisionTriangleShape(point1, point3, point2);
+            createCollisionTriangleShape(triangles, point1, point3, point2);
         }
 
         if( (point4.Y > minY || hasDiagonalPointAbove) && (point4.Y < maxY || hasDiagonalPointBelow) )
         {
-            createCollisionTriangleShape(point2, point3, point4);
+            createCollisionTriangleShape(triangles, point2, point3, point4);
         }
     }
 
-    void CollisionHeightfieldShape::createCollisionTriangleShape(const Point3<float> &p1, const Point3<float> &p2, const Point3<float> &p3) const
+    void CollisionHeightfieldShape::createCollisionTriangleShape(std::vector<CollisionTriangleShape> &triangles, const Point3<float> &p1, const Point3<float> &p2,
+            const Point3<float> &p3) const
     {
         void *shapeMemPtr = triangleShapesPool->allocate(sizeof(TriangleShape3D<float>));
-        trianglesInAABBox.emplace_back(CollisionTriangleShape(new (shapeMemPtr) TriangleShape3D<float>(p1, p2, p3), triangleShapesPool));
+        triangles.emplace_back(CollisionTriangleShape(new (shapeMemPtr) TriangleShape3D<float>(p1, p2, p3), triangleShapesPool));
     }
 
 }
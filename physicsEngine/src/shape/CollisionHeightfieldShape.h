@@ -3,12 +3,15 @@
 
 #include <memory>
 #include <vector>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include "UrchinCommon.h"
 
 #include "shape/CollisionShape3D.h"
 #include "shape/CollisionConcaveShape.h"
 #include "object/CollisionTriangleObject.h"
-#include "utils/pool/FixedSizePool.h"
+#include "utils/pool/SyncFixedSizePool.h"
 
 namespace urchin
 {
@@ -46,8 +49,9 @@ namespace urchin
 
             std::unique_ptr<BoxShape<float>> buildLocalAABBox() const;
             std::pair<unsigned int, unsigned int> computeStartEndIndices(float, float, Axis) const;
-            void createTrianglesMatchHeight(unsigned int, unsigned int, float, float) const;
-            void createCollisionTriangleShape(const Point3<float> &, const Point3<float> &, const Point3<float> &) const;
+            std::vector<CollisionTriangleShape> &retrieveTrianglesBuffer() const;
+            void createTrianglesMatchHeight(std::vector<CollisionTriangleShape> &, unsigned int, unsigned int, float, float) const;
+            void createCollisionTriangleShape(std::vector<CollisionTriangleShape> &, const Point3<float> &, const Point3<float> &, const Point3<float> &) const;
 
             std::vector<Point3<float>> vertices;
             unsigned int xLength;
@@ -55,8 +59,9 @@ namespace urchin
 
             std::unique_ptr<BoxShape<float>> localAABBox;
             
-            mutable std::vector<CollisionTriangleShape> trianglesInAABBox;
-            FixedSizePool<TriangleShape3D<float>> *triangleShapesPool;
+            mutable std::mutex trianglesBuffersMutex;
+            mutable std::unordered_map<std::thread::id, std::vector<CollisionTriangleShape>> trianglesBuffers; //one buffer by thread: triangles can be searched in parallel
+            SyncFixedSizePool<TriangleShape3D<float>> *triangleShapesPool;
     };
 
 }
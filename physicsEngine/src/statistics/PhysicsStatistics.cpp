@@ -0,0 +1,242 @@
+#include <stdexcept>
+#include <limits>
+
+#include "statistics/PhysicsStatistics.h"
+
+namespace urchin
+{
+
+    //static
+    const std::array<double, STATISTICS_HISTOGRAM_BUCKETS> PhysicsStatistics::BUCKET_UPPER_BOUNDS = {
+            0.05, 0.1, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0, std::numeric_limits<double>::max()};
+    const std::vector<std::pair<std::string, unsigned int StepCounters::*>> PhysicsStatistics::COUNTERS = {
+            {"bodies", &StepCounters::bodies},
+            {"activeBodies", &StepCounters::activeBodies},
+            {"sleepingBodies", &StepCounters::sleepingBodies},
+            {"overlappingPairs", &StepCounters::overlappingPairs},
+            {"newPairs", &StepCounters::newPairs},
+            {"removedPairs", &StepCounters::removedPairs},
+            {"manifolds", &StepCounters::manifolds},
+            {"contactPoints", &StepCounters::contactPoints},
+            {"gjkIterations", &StepCounters::gjkIterations},
+            {"epaIterations", &StepCounters::epaIterations},
+            {"continuousCollisionSweeps", &StepCounters::continuousCollisionSweeps},
+            {"solverConstraints", &StepCounters::solverConstraints},
+            {"solverIterations", &StepCounters::solverIterations},
+            {"solverIslandIterations", &StepCounters::solverIslandIterations},
+            {"algorithmPoolHighWaterMark", &StepCounters::algorithmPoolHighWaterMark},
+            {"algorithmResultPoolHighWaterMark", &StepCounters::algorithmResultPoolHighWaterMark},
+            {"constraintSolvingPoolHighWaterMark", &StepCounters::constraintSolvingPoolHighWaterMark}};
+
+    /**
+     * @param maxSteps Maximum number of steps kept in the time series. Oldest steps are replaced by the new ones.
+     */
+    PhysicsStatistics::PhysicsStatistics(unsigned int maxSteps) :
+            maxSteps(maxSteps),
+            nextStepPosition(0),
+            stepCount(0)
+    {
+        if(maxSteps==0)
+        {
+            throw std::invalid_argument("Physics statistics must keep at least one step");
+        }
+
+        stageHistograms.push_back({"step", nullptr, {}});
+        stageHistograms.push_back({"broadPhase", &StageTimings::broadPhase, {}});
+        stageHistograms.push_back({"narrowPhase", &StageTimings::narrowPhase, {}});
+        stageHistograms.push_back({"constraintSolver", &StageTimings::constraintSolver, {}});
+        stageHistograms.push_back({"island", &StageTimings::island, {}});
+        stageHistograms.push_back({"integration", &StageTimings::integration, {}});
+
+        stepsStatistics.reserve(maxSteps);
+    }
+
+    /**
+     * @param stepTime Total execution time (ms) of the step
+     * @param stageTimings Execution times of the stages of the step
+     * @param stepCounters Counters of the step
+     */
+    void PhysicsStatistics::addStep(double stepTime, const StageTimings &stageTimings, const StepCounters &stepCounters)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        StepStatistics stepStatistics = {stepCount, stepTime, stageTimings, stepCounters};
+        if(stepsStatistics.size() < maxSteps)
+        {
+            stepsStatistics.push_back(stepStatistics);
+        }else
+        {
+            stepsStatistics[nextStepPosition] = stepStatistics;
+        }
+        nextStepPosition = (nextStepPosition + 1) % maxSteps;
+        stepCount++;
+
+        for(auto &stageHistogram : stageHistograms)
+        {
+            double timing = stageHistogram.stageTiming ? stageTimings.*stageHistogram.stageTiming : stepTime;
+            stageHistogram.bucketCounts[computeBucketIndex(timing)]++;
+        }
+    }
+
+    void PhysicsStatistics::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        stepsStatistics.clear();
+        nextStepPosition = 0;
+        stepCount = 0;
+        for(auto &stageHistogram : stageHistograms)
+        {
+            stageHistogram.bucketCounts.fill(0);
+        }
+    }
+
+    /**
+     * @return Number of steps recorded since the last clear
+     */
+    unsigned int PhysicsStatistics::getStepCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return stepCount;
+    }
+
+    double PhysicsStatistics::getLastStepTime() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return stepsStatistics.empty() ? 0.0 : getStepStatistics(stepsStatistics.size() - 1).stepTime;
+    }
+
+    StageTimings PhysicsStatistics::getLastStageTimings() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return stepsStatistics.empty() ? StageTimings() : getStepStatistics(stepsStatistics.size() - 1).stageTimings;
+    }
+
+    StepCounters PhysicsStatistics::getLastStepCounters() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return stepsStatistics.empty() ? StepCounters() : getStepStatistics(stepsStatistics.size() - 1).stepCounters;
+    }
+
+    /**
+     * Write the time series in CSV format: one line by step, from the oldest step to the last one.
+     */
+    void PhysicsStatistics::writeCsv(std::ostream &stream) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        stream << "stepIndex";
+        for(const auto &stageHistogram : stageHistograms)
+        {
+            stream << "," << stageHistogram.stageName << "Ms";
+        }
+        for(const auto &counter : COUNTERS)
+        {
+            stream << "," << counter.first;
+        }
+        stream << std::endl;
+
+        for(std::size_t i=0; i<stepsStatistics.size(); ++i)
+        {
+            const StepStatistics &stepStatistics = getStepStatistics(i);
+
+            stream << stepStatistics.stepIndex;
+            for(const auto &stageHistogram : stageHistograms)
+            {
+                stream << "," << (stageHistogram.stageTiming ? stepStatistics.stageTimings.*stageHistogram.stageTiming : stepStatistics.stepTime);
+            }
+            for(const auto &counter : COUNTERS)
+            {
+                stream << "," << stepStatistics.stepCounters.*counter.second;
+            }
+            stream << std::endl;
+        }
+    }
+
+    /**
+     * Write the time series and the histograms in JSON format. The last histogram bucket has no upper bound (null).
+     */
+    void PhysicsStatistics::writeJson(std::ostream &stream) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        stream << "{" << std::endl;
+        stream << "  \"stepCount\": " << stepCount << "," << std::endl;
+
+        stream << "  \"steps\": [";
+        for(std::size_t i=0; i<stepsStatistics.size(); ++i)
+        {
+            const StepStatistics &stepStatistics = getStepStatistics(i);
+
+            stream << (i==0 ? "" : ",") << std::endl << "    {\"stepIndex\": " << stepStatistics.stepIndex << ", \"timingsMs\": {";
+            for(std::size_t j=0; j<stageHistograms.size(); ++j)
+            {
+                const StageHistogram &stageHistogram = stageHistograms[j];
+                stream << (j==0 ? "" : ", ") << "\"" << stageHistogram.stageName << "\": "
+                       << (stageHistogram.stageTiming ? stepStatistics.stageTimings.*stageHistogram.stageTiming : stepStatistics.stepTime);
+            }
+            stream << "}, \"counters\": {";
+            for(std::size_t j=0; j<COUNTERS.size(); ++j)
+            {
+                stream << (j==0 ? "" : ", ") << "\"" << COUNTERS[j].first << "\": " << stepStatistics.stepCounters.*COUNTERS[j].second;
+            }
+            stream << "}}";
+        }
+        stream << std::endl << "  ]," << std::endl;
+
+        stream << "  \"histogramsMs\": {" << std::endl;
+        stream << "    \"upperBounds\": [";
+        for(std::size_t i=0; i<BUCKET_UPPER_BOUNDS.size(); ++i)
+        {
+            stream << (i==0 ? "" : ", ");
+            if(i==BUCKET_UPPER_BOUNDS.size() - 1)
+            {
+                stream << "null";
+            }else
+            {
+                stream << BUCKET_UPPER_BOUNDS[i];
+            }
+        }
+        stream << "]";
+        for(const auto &stageHistogram : stageHistograms)
+        {
+            stream << "," << std::endl << "    \"" << stageHistogram.stageName << "\": [";
+            for(std::size_t i=0; i<stageHistogram.bucketCounts.size(); ++i)
+            {
+                stream << (i==0 ? "" : ", ") << stageHistogram.bucketCounts[i];
+            }
+            stream << "]";
+        }
+        stream << std::endl << "  }" << std::endl;
+        stream << "}" << std::endl;
+    }
+
+    /**
+     * @param index Index of the step in chronological order (0: oldest step kept)
+     */
+    const PhysicsStatistics::StepStatistics &PhysicsStatistics::getStepStatistics(std::size_t index) const
+    {
+        if(stepsStatistics.size() < maxSteps)
+        {
+            return stepsStatistics[index];
+        }
+        return stepsStatistics[(nextStepPosition + index) % maxSteps];
+    }
+
+    unsigned int PhysicsStatistics::computeBucketIndex(double timing)
+    {
+        for(unsigned int i=0; i<BUCKET_UPPER_BOUNDS.size() - 1; ++i)
+        {
+            if(timing <= BUCKET_UPPER_BOUNDS[i])
+            {
+                return i;
+            }
+        }
+        return BUCKET_UPPER_BOUNDS.size() - 1;
+    }
+
+}
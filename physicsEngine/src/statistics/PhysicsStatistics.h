@@ -0,0 +1,71 @@
+#ifndef URCHINENGINE_PHYSICSSTATISTICS_H
+#define URCHINENGINE_PHYSICSSTATISTICS_H
+
+#include <vector>
+#include <array>
+#include <string>
+#include <ostream>
+#include <mutex>
+
+#include "collision/StageTimings.h"
+#include "collision/StepCounters.h"
+
+#define STATISTICS_HISTOGRAM_BUCKETS 10
+
+namespace urchin
+{
+
+    /**
+    * Statistics of the physics steps: time series of the timings and counters of the last steps and histograms of the stage timings
+    * computed on all steps recorded since the last clear. Steps are recorded by the physics thread while statistics can be queried and
+    * dumped (CSV or JSON) from any thread.
+    */
+    class PhysicsStatistics
+    {
+        public:
+            explicit PhysicsStatistics(unsigned int);
+
+            void addStep(double, const StageTimings &, const StepCounters &);
+            void clear();
+
+            unsigned int getStepCount() const;
+            double getLastStepTime() const;
+            StageTimings getLastStageTimings() const;
+            StepCounters getLastStepCounters() const;
+
+            void writeCsv(std::ostream &) const;
+            void writeJson(std::ostream &) const;
+
+        private:
+            struct StepStatistics
+            {
+                unsigned int stepIndex;
+                double stepTime;
+                StageTimings stageTimings;
+                StepCounters stepCounters;
+            };
+
+            struct StageHistogram
+            {
+                std::string stageName;
+                double StageTimings::*stageTiming; //null for the step time
+                std::array<unsigned int, STATISTICS_HISTOGRAM_BUCKETS> bucketCounts;
+            };
+
+            const StepStatistics &getStepStatistics(std::size_t) const;
+            static unsigned int computeBucketIndex(double);
+
+            static const std::array<double, STATISTICS_HISTOGRAM_BUCKETS> BUCKET_UPPER_BOUNDS;
+            static const std::vector<std::pair<std::string, unsigned int StepCounters::*>> COUNTERS;
+
+            mutable std::mutex mutex;
+            const unsigned int maxSteps;
+            std::vector<StepStatistics> stepsStatistics; //circular buffer of the last steps
+            std::size_t nextStepPosition;
+            unsigned int stepCount;
+            std::vector<StageHistogram> stageHistograms;
+    };
+
+}
+
+#endif
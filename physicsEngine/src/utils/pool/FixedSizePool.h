@@ -2,16 +2,18 @@
 #define URCHINENGINE_FIXEDSIZEPOOL_H
 
 #include <cassert>
-#include <sstream>
 #include <string>
+#include <vector>
+#include <cstddef>
+#include <atomic>
 #include "UrchinCommon.h"
 
 namespace urchin
 {
 
     /**
-    * Pool which allocate a fixed size of memory defined in constructor argument. This pool offers high performance until the maximum
-    * elements defined in constructor is not reached. Once maximum number of element reached, the performance strongly decrease.
+    * Pool which allocate memory by pages of fixed size elements. A first page is allocated in constructor. Once all elements of the
+    * allocated pages are used, a new page is allocated: elements are never allocated one by one outside the pool.
     */
     template<class BaseType> class FixedSizePool
     {
@@ -22,18 +24,29 @@ namespace urchin
             virtual void* allocate(unsigned int);
             virtual void free(BaseType *ptr);
 
+            unsigned int getHeapAllocationCount() const;
+            unsigned int getHighWaterMark() const;
+
+        protected:
+            void checkAllocationSize(unsigned int) const;
+            void* allocateElement();
+            void releaseElement(void *);
+
         private:
-            void logPoolIsFull();
+            void addPage();
 
             std::string poolName;
             unsigned int maxElementSize;
-            unsigned int maxElements;
+            unsigned int elementsPerPage;
+            unsigned int totalElements;
             unsigned int freeCount; //number of free locations
 
-            unsigned char* pool;
+            std::vector<unsigned char *> pages;
             void* firstFree;
 
-            bool fullPoolLogged;
+            //statistics: atomic because they can be read without lock while a thread safe pool is used
+            std::atomic_uint heapAllocationCount; //number of pages allocated after the first one
+            std::atomic_uint highWaterMark; //highest number of elements used at the same time
     };
 
     #include "FixedSizePool.inl"
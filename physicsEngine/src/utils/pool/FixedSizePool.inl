@@ -1,96 +1,139 @@
 /**
  * @param maxElementSize Size of element to store in pool. If there are several classes which extends 'BaseType', the biggest one
  *  should be provided
- * @param maxElement Maximum of elements which can be stored in the pool. If the maximum is exceed, a classical allocation
- *  (new/delete) will be performed.
+ * @param elementsPerPage Number of elements allocated at once. If all elements are used, a new page of elements is allocated.
  */
-template<class BaseType> FixedSizePool<BaseType>::FixedSizePool(const std::string &poolName, unsigned int maxElementSize, unsigned int maxElements) :
+template<class BaseType> FixedSizePool<BaseType>::FixedSizePool(const std::string &poolName, unsigned int maxElementSize, unsigned int elementsPerPage) :
         poolName(poolName),
         maxElementSize(maxElementSize),
-        maxElements(maxElements),
-        freeCount(maxElements),
-        fullPoolLogged(false)
+        elementsPerPage(elementsPerPage),
+        totalElements(0),
+        freeCount(0),
+        firstFree(nullptr),
+        heapAllocationCount(0),
+        highWaterMark(0)
 {
-    //create pool
-    pool = static_cast<unsigned char *>(operator new(this->maxElementSize * this->maxElements));
-    firstFree = pool;
-
-    //initialize pool: each element contains address of next element and last one contains 0
-    unsigned char *p = pool;
-    int count = this->maxElements;
-    while (--count)
+    if(this->elementsPerPage==0)
     {
-        *(void**)p = (p + this->maxElementSize);
-        p += this->maxElementSize;
+        throw std::invalid_argument("Fixed size pool '" + poolName + "' must have at least one element per page");
     }
-    *(void**)p = 0;
+
+    //each free element contains address of next free element: element size is rounded to keep elements aligned
+    const unsigned int alignment = alignof(std::max_align_t);
+    this->maxElementSize = std::max(this->maxElementSize, (unsigned int)sizeof(void*));
+    this->maxElementSize = ((this->maxElementSize + alignment - 1) / alignment) * alignment;
+
+    addPage();
 }
 
 template<class BaseType> FixedSizePool<BaseType>::~FixedSizePool()
 {
-    if(freeCount != maxElements) //ensure that 'free' method has been called
+    if(freeCount != totalElements) //ensure that 'free' method has been called
     {
-        Logger::logger().logError("Fixed size pool '" + poolName + "' not correctly cleared. Free count: " + std::to_string(freeCount) + ", max elements: " + std::to_string(maxElements) + ".");
+        Logger::logger().logError("Fixed size pool '" + poolName + "' not correctly cleared. Free count: " + std::to_string(freeCount) + ", total elements: " + std::to_string(totalElements) + ".");
     }
 
-    delete pool;
+    for(unsigned char *page : pages)
+    {
+        operator delete(page);
+    }
 }
 
 /**
  * @return Memory pointer which can be used to instantiate an element.
  */
 template<class BaseType> void* FixedSizePool<BaseType>::allocate(unsigned int size)
+{
+    checkAllocationSize(size);
+
+    return allocateElement();
+}
+
+/**
+ * Call destructor of pointer and free location in the pool.
+ * @param ptr Pointer to free
+ */
+template<class BaseType> void FixedSizePool<BaseType>::free(BaseType *ptr)
+{
+    ptr->~BaseType();
+
+    releaseElement(ptr);
+}
+
+/**
+ * @return Number of memory allocations done by the pool after its creation (i.e.: number of additional pages). This number stays
+ * unchanged once the pool reached its steady size.
+ */
+template<class BaseType> unsigned int FixedSizePool<BaseType>::getHeapAllocationCount() const
+{
+    return heapAllocationCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @return Highest number of elements used at the same time since the pool creation. For thread safe pools, elements cached by the
+ * threads are considered as used.
+ */
+template<class BaseType> unsigned int FixedSizePool<BaseType>::getHighWaterMark() const
+{
+    return highWaterMark.load(std::memory_order_relaxed);
+}
+
+template<class BaseType> void FixedSizePool<BaseType>::checkAllocationSize(unsigned int size) const
 {
     if(size > maxElementSize)
     {
         throw std::runtime_error("Fixed size pool '" + poolName + "' cannot allocate " + std::to_string(size) + " bytes because max allowed allocation is " + std::to_string(maxElementSize) + " bytes");
     }
+}
 
-    if(freeCount!=0)
-    { //pool is not full
-        void* result = firstFree;
-        firstFree = *(void**)firstFree;
-        --freeCount;
+/**
+ * @return Free memory location of the pool. Destructor/constructor are not called.
+ */
+template<class BaseType> void* FixedSizePool<BaseType>::allocateElement()
+{
+    if(freeCount==0)
+    { //all pages are full
+        addPage();
+        heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
 
-        return result;
+    void* result = firstFree;
+    firstFree = *(void**)firstFree;
+    --freeCount;
+    unsigned int usedElements = totalElements - freeCount;
+    if(usedElements > highWaterMark.load(std::memory_order_relaxed))
+    { //written under lock for thread safe pools: no concurrent writer
+        highWaterMark.store(usedElements, std::memory_order_relaxed);
     }
 
-    //pool is full: allocate new memory location
-    logPoolIsFull();
-    return operator new(maxElementSize);
+    return result;
 }
 
 /**
- * Call destructor of pointer and free location in the pool.
- * @param ptr Pointer to free
+ * Give back a memory location to the pool. Destructor must be already called.
  */
-template<class BaseType> void FixedSizePool<BaseType>::free(BaseType *ptr)
+template<class BaseType> void FixedSizePool<BaseType>::releaseElement(void *ptr)
 {
-    if (((unsigned char*)ptr >= pool && (unsigned char*)ptr < pool + maxElementSize*maxElements))
-    { //ptr is in the pool
-        ptr->~BaseType();
-
-        *(void**)ptr = firstFree;
-        firstFree = ptr;
-        ++freeCount;
-    }else
-    {
-        delete ptr;
-    }
+    *(void**)ptr = firstFree;
+    firstFree = ptr;
+    ++freeCount;
 }
 
-template<class BaseType> void FixedSizePool<BaseType>::logPoolIsFull()
+template<class BaseType> void FixedSizePool<BaseType>::addPage()
 {
-    if(!fullPoolLogged)
+    auto *page = static_cast<unsigned char *>(operator new(maxElementSize * elementsPerPage));
+    pages.push_back(page);
+
+    //initialize page: each element contains address of next element and last one contains address of the current first free element
+    unsigned char *p = page;
+    for(unsigned int i=0; i<elementsPerPage - 1; ++i)
     {
-        std::stringstream logStream;
-        logStream << "Pool is full of elements." << std::endl;
-        logStream << " - Pool name: " << poolName << std::endl;
-        logStream << " - Element size: " << maxElementSize << std::endl;
-        logStream << " - Maximum elements: " << maxElements;
-        Logger::logger().logWarning(logStream.str());
-
-        fullPoolLogged = true;
+        *(void**)p = (p + maxElementSize);
+        p += maxElementSize;
     }
-}
+    *(void**)p = firstFree;
+    firstFree = page;
 
+    freeCount += elementsPerPage;
+    totalElements += elementsPerPage;
+}
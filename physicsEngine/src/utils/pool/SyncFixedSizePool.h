@@ -2,23 +2,62 @@
 #define URCHINENGINE_SYNCFIXEDSIZEPOOL_H
 
 #include <mutex>
+#include <memory>
+#include <vector>
 
 #include "utils/pool/FixedSizePool.h"
 
+#define SYNC_POOL_THREAD_CACHE_SIZE 64
+#define SYNC_POOL_THREAD_CACHE_BATCH_SIZE 32
+
 namespace urchin
 {
 
+    /**
+    * Thread safe fixed size pool. Each thread owns a cache of free elements: the shared pool (protected by a mutex) is only accessed to
+    * refill or empty the cache by batch of elements. The cache of a thread is given back to the pool when the thread exits.
+    */
     template<class BaseType> class SyncFixedSizePool : public FixedSizePool<BaseType>
     {
         public:
             SyncFixedSizePool(const std::string &, unsigned int, unsigned int);
-            ~SyncFixedSizePool() = default;
+            ~SyncFixedSizePool() override;
 
-            void* allocate(unsigned int);
-            void free(BaseType *ptr);
+            void* allocate(unsigned int) override;
+            void free(BaseType *ptr) override;
 
         private:
-            std::mutex mutex;
+            struct ThreadCache
+            {
+                void *elements[SYNC_POOL_THREAD_CACHE_SIZE];
+                unsigned int count;
+            };
+
+            /**
+            * State shared by the pool and the threads using it: a thread exiting after the pool destruction doesn't access the pool
+            */
+            struct SharedState
+            {
+                std::mutex mutex;
+                SyncFixedSizePool<BaseType> *pool;
+                std::vector<std::unique_ptr<ThreadCache>> threadCaches;
+            };
+
+            /**
+            * Caches of the current thread for each pool used by the thread
+            */
+            struct ThreadCacheRegistry
+            {
+                ~ThreadCacheRegistry();
+                void removeDestroyedPoolCaches();
+
+                std::vector<std::pair<std::shared_ptr<SharedState>, ThreadCache *>> threadCaches;
+            };
+
+            ThreadCache &retrieveThreadCache();
+            void releaseThreadCache(ThreadCache *);
+
+            std::shared_ptr<SharedState> sharedState;
     };
 
     #include "SyncFixedSizePool.inl"
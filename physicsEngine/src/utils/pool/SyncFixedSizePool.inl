@@ -1,19 +1,133 @@
-template<class BaseType> SyncFixedSizePool<BaseType>::SyncFixedSizePool(const std::string &poolName, unsigned int maxElementSize, unsigned int maxElements) :
-        FixedSizePool<BaseType>(poolName, maxElementSize, maxElements)
+template<class BaseType> SyncFixedSizePool<BaseType>::SyncFixedSizePool(const std::string &poolName, unsigned int maxElementSize, unsigned int elementsPerPage) :
+        FixedSizePool<BaseType>(poolName, maxElementSize, elementsPerPage),
+        sharedState(std::make_shared<SharedState>())
 {
+    sharedState->pool = this;
+}
+
+template<class BaseType> SyncFixedSizePool<BaseType>::~SyncFixedSizePool()
+{
+    std::lock_guard<std::mutex> lock(sharedState->mutex);
 
+    //give back elements of all threads caches to the pool: threads using the pool must be terminated or must not use the pool anymore
+    while(!sharedState->threadCaches.empty())
+    {
+        releaseThreadCache(sharedState->threadCaches.back().get());
+    }
+    sharedState->pool = nullptr;
 }
 
 template<class BaseType> void* SyncFixedSizePool<BaseType>::allocate(unsigned int size)
 {
-    std::lock_guard<std::mutex> lock(mutex);
+    FixedSizePool<BaseType>::checkAllocationSize(size);
 
-    return FixedSizePool<BaseType>::allocate(size);
+    ThreadCache &threadCache = retrieveThreadCache();
+    if(threadCache.count==0)
+    { //refill thread cache
+        std::lock_guard<std::mutex> lock(sharedState->mutex);
+        while(threadCache.count < SYNC_POOL_THREAD_CACHE_BATCH_SIZE)
+        {
+            threadCache.elements[threadCache.count++] = FixedSizePool<BaseType>::allocateElement();
+        }
+    }
+
+    return threadCache.elements[--threadCache.count];
 }
 
+/**
+ * Call destructor of pointer and free location in the cache of the current thread. The pointer can be allocated by another thread.
+ * @param ptr Pointer to free
+ */
 template<class BaseType> void SyncFixedSizePool<BaseType>::free(BaseType *ptr)
 {
-    std::lock_guard<std::mutex> lock(mutex);
+    ptr->~BaseType();
+
+    ThreadCache &threadCache = retrieveThreadCache();
+    if(threadCache.count==SYNC_POOL_THREAD_CACHE_SIZE)
+    { //empty thread cache
+        std::lock_guard<std::mutex> lock(sharedState->mutex);
+        while(threadCache.count > SYNC_POOL_THREAD_CACHE_SIZE - SYNC_POOL_THREAD_CACHE_BATCH_SIZE)
+        {
+            FixedSizePool<BaseType>::releaseElement(threadCache.elements[--threadCache.count]);
+        }
+    }
+
+    threadCache.elements[threadCache.count++] = ptr;
+}
+
+template<class BaseType> typename SyncFixedSizePool<BaseType>::ThreadCache &SyncFixedSizePool<BaseType>::retrieveThreadCache()
+{
+    //caches are given back to their pools on thread exit
+    thread_local ThreadCacheRegistry threadCacheRegistry;
+
+    for(const auto &threadCache : threadCacheRegistry.threadCaches)
+    {
+        if(threadCache.first == sharedState)
+        {
+            return *threadCache.second;
+        }
+    }
+
+    //first usage of the pool by the current thread
+    threadCacheRegistry.removeDestroyedPoolCaches();
+
+    std::lock_guard<std::mutex> lock(sharedState->mutex);
+    sharedState->threadCaches.push_back(std::make_unique<ThreadCache>());
+    ThreadCache *threadCache = sharedState->threadCaches.back().get();
+    threadCache->count = 0;
+    threadCacheRegistry.threadCaches.emplace_back(sharedState, threadCache);
+
+    return *threadCache;
+}
+
+/**
+ * Give back the elements of the thread cache to the pool and delete the thread cache. The mutex of the shared state must be locked.
+ */
+template<class BaseType> void SyncFixedSizePool<BaseType>::releaseThreadCache(ThreadCache *threadCache)
+{
+    while(threadCache->count > 0)
+    {
+        FixedSizePool<BaseType>::releaseElement(threadCache->elements[--threadCache->count]);
+    }
+
+    for(std::size_t i=0; i<sharedState->threadCaches.size(); ++i)
+    {
+        if(sharedState->threadCaches[i].get() == threadCache)
+        {
+            sharedState->threadCaches[i] = std::move(sharedState->threadCaches.back());
+            sharedState->threadCaches.pop_back();
+            break;
+        }
+    }
+}
+
+template<class BaseType> SyncFixedSizePool<BaseType>::ThreadCacheRegistry::~ThreadCacheRegistry()
+{
+    //thread exit: elements of the caches are given back to the pools still alive
+    for(auto &threadCache : threadCaches)
+    {
+        std::lock_guard<std::mutex> lock(threadCache.first->mutex);
+        if(threadCache.first->pool)
+        {
+            threadCache.first->pool->releaseThreadCache(threadCache.second);
+        }
+    }
+}
+
+template<class BaseType> void SyncFixedSizePool<BaseType>::ThreadCacheRegistry::removeDestroyedPoolCaches()
+{
+    for(std::size_t i=threadCaches.size(); i>0; --i)
+    {
+        bool poolDestroyed;
+        {
+            std::lock_guard<std::mutex> lock(threadCaches[i-1].first->mutex);
+            poolDestroyed = !threadCaches[i-1].first->pool;
+        }
 
-    FixedSizePool<BaseType>::free(ptr);
+        if(poolDestroyed)
+        {
+            threadCaches[i-1] = std::move(threadCaches.back());
+            threadCaches.pop_back();
+        }
+    }
 }
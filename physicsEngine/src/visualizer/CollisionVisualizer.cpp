@@ -22,11 +22,11 @@ namespace urchin
             {
                 std::lock_guard<std::mutex> lock(visualizerDataMutex);
 
-                const std::vector<ManifoldResult> &manifoldResults = collisionWorld->getLastUpdatedManifoldResults();
+                const std::vector<ManifoldResult *> &manifoldResults = collisionWorld->getLastUpdatedManifoldResults();
                 this->manifoldResults.clear();
                 for (const auto &manifoldResult : manifoldResults)
                 {
-                    this->manifoldResults.push_back(manifoldResult);
+                    this->manifoldResults.push_back(*manifoldResult);
                 }
             }
         }
@@ -0,0 +1,55 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "UrchinAIEngine.h"
+#include "ai/PathfindingBenchmark.h"
+#include "ai/PolygonsUnionBenchmark.h"
+
+#define DEFAULT_NUMBER_REQUESTS 50
+#define DEFAULT_LENGTH_TOLERANCE 1.1f
+#define POLYGONS_UNION_ITERATIONS 10
+
+/**
+ * Usage: aiBenchmark [numberRequests] [lengthTolerance]
+ * Result is written in JSON format on the standard output. Exit code is not zero when a path quality is out of tolerance.
+ */
+int main(int argc, char *argv[])
+{
+    unsigned int numberRequests = (argc > 1) ? static_cast<unsigned int>(std::stoul(argv[1])) : DEFAULT_NUMBER_REQUESTS;
+    float lengthTolerance = (argc > 2) ? std::stof(argv[2]) : DEFAULT_LENGTH_TOLERANCE;
+
+    urchin::ConfigService::instance()->loadProperties("resources/engine.properties");
+
+    std::vector<unsigned int> gridSizes = {10, 20, 40};
+
+    PathfindingBenchmark pathfindingBenchmark(numberRequests, lengthTolerance);
+    bool withinTolerance = true;
+    std::cout << "{" << std::endl << "  \"pathfinding\": [" << std::endl;
+    for(std::size_t i=0; i<gridSizes.size(); ++i)
+    {
+        if(i != 0)
+        {
+            std::cout << "," << std::endl;
+        }
+        withinTolerance = pathfindingBenchmark.run(gridSizes[i], std::cout) && withinTolerance;
+    }
+    std::cout << std::endl << "  ]," << std::endl;
+
+    std::vector<unsigned int> footprintsCounts = {10, 100, 1000};
+
+    PolygonsUnionBenchmark polygonsUnionBenchmark(POLYGONS_UNION_ITERATIONS);
+    std::cout << "  \"polygonsUnion\": [" << std::endl;
+    for(std::size_t i=0; i<footprintsCounts.size(); ++i)
+    {
+        if(i != 0)
+        {
+            std::cout << "," << std::endl;
+        }
+        polygonsUnionBenchmark.run(footprintsCounts[i], std::cout);
+    }
+    std::cout << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+    urchin::SingletonManager::destroyAllSingletons();
+    return withinTolerance ? 0 : 1;
+}
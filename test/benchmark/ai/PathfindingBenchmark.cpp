@@ -0,0 +1,139 @@
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "ai/PathfindingBenchmark.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
+using namespace urchin;
+
+#define OBSTACLE_SQUARES_RATIO 0.2f
+
+/**
+ * @param numberRequests Number of path requests computed on each grid
+ * @param lengthTolerance Maximum ratio accepted between the length of a path found with incremental G score and the length of the
+ * path found with exact G score
+ */
+PathfindingBenchmark::PathfindingBenchmark(unsigned int numberRequests, float lengthTolerance) :
+        numberRequests(numberRequests),
+        lengthTolerance(lengthTolerance)
+{
+
+}
+
+/**
+ * @param squaresBySide Number of squares by side of the grid
+ * @return True if all the paths found with incremental G score are in the length tolerance
+ */
+bool PathfindingBenchmark::run(unsigned int squaresBySide, std::ostream &stream) const
+{
+    std::vector<bool> obstacleSquares = buildObstacleSquares(squaresBySide);
+    std::shared_ptr<NavMesh> navMesh = NavMeshTestHelper::buildGridNavMesh(squaresBySide, obstacleSquares);
+    std::vector<PathRequestPoints> pathRequests = buildPathRequests(squaresBySide, obstacleSquares);
+
+    PathfindingAStar incrementalPathfinding(navMesh);
+    std::vector<float> incrementalLengths;
+    double incrementalTime = findPaths(incrementalPathfinding, pathRequests, incrementalLengths);
+
+    PathfindingAStar exactPathfinding(navMesh);
+    exactPathfinding.setExactGScore(true);
+    std::vector<float> exactLengths;
+    double exactTime = findPaths(exactPathfinding, pathRequests, exactLengths);
+
+    unsigned int comparedPaths = 0, pathsOutOfTolerance = 0;
+    float sumLengthRatio = 0.0f, maxLengthRatio = 0.0f;
+    for(std::size_t i=0; i<pathRequests.size(); ++i)
+    {
+        if(incrementalLengths[i] > 0.0f && exactLengths[i] > 0.0f)
+        {
+            float lengthRatio = incrementalLengths[i] / exactLengths[i];
+            sumLengthRatio += lengthRatio;
+            maxLengthRatio = std::max(maxLengthRatio, lengthRatio);
+            comparedPaths++;
+            if(lengthRatio > lengthTolerance)
+            {
+                pathsOutOfTolerance++;
+            }
+        }
+    }
+
+    stream << "    {" << std::endl;
+    stream << "      \"squaresBySide\": " << squaresBySide << "," << std::endl;
+    stream << "      \"triangles\": " << navMesh->getCompiledNavMesh()->getTrianglesCount() << "," << std::endl;
+    stream << "      \"requests\": " << pathRequests.size() << "," << std::endl;
+    stream << "      \"comparedPaths\": " << comparedPaths << "," << std::endl;
+    stream << "      \"incrementalTimeMs\": " << incrementalTime << "," << std::endl;
+    stream << "      \"exactTimeMs\": " << exactTime << "," << std::endl;
+    stream << "      \"meanLengthRatio\": " << (comparedPaths == 0 ? 1.0f : sumLengthRatio / (float)comparedPaths) << "," << std::endl;
+    stream << "      \"maxLengthRatio\": " << maxLengthRatio << "," << std::endl;
+    stream << "      \"pathsOutOfTolerance\": " << pathsOutOfTolerance << std::endl;
+    stream << "    }";
+
+    return pathsOutOfTolerance == 0;
+}
+
+/**
+ * @return Squares of the grid not walkable
+ */
+std::vector<bool> PathfindingBenchmark::buildObstacleSquares(unsigned int squaresBySide) const
+{
+    std::mt19937 randomGenerator(squaresBySide);
+    std::bernoulli_distribution obstacleDistribution(OBSTACLE_SQUARES_RATIO);
+    std::vector<bool> obstacleSquares(squaresBySide * squaresBySide);
+    for(std::size_t i=0; i<obstacleSquares.size(); ++i)
+    {
+        obstacleSquares[i] = obstacleDistribution(randomGenerator);
+    }
+    return obstacleSquares;
+}
+
+std::vector<PathfindingBenchmark::PathRequestPoints> PathfindingBenchmark::buildPathRequests(unsigned int squaresBySide, const std::vector<bool> &obstacleSquares) const
+{
+    std::mt19937 randomGenerator(squaresBySide + 1);
+    std::uniform_int_distribution<unsigned int> squareDistribution(0, squaresBySide - 1);
+    auto randomFreePoint = [&]() {
+        while(true)
+        {
+            unsigned int x = squareDistribution(randomGenerator);
+            unsigned int z = squareDistribution(randomGenerator);
+            if(!obstacleSquares[x * squaresBySide + z])
+            {
+                return Point3<float>((float)x + 0.3f, 0.0f, (float)z + 0.3f);
+            }
+        }
+    };
+
+    std::vector<PathRequestPoints> pathRequests;
+    for(unsigned int i=0; i<numberRequests; ++i)
+    {
+        PathRequestPoints pathRequestPoints = {};
+        pathRequestPoints.startPoint = randomFreePoint();
+        pathRequestPoints.endPoint = randomFreePoint();
+        pathRequests.push_back(pathRequestPoints);
+    }
+    return pathRequests;
+}
+
+/**
+ * @param pathLengths [out] Length of the path found for each request (0.0 when no path exists)
+ * @return Execution time (ms) of all the path requests
+ */
+double PathfindingBenchmark::findPaths(PathfindingAStar &pathfindingAStar, const std::vector<PathRequestPoints> &pathRequests, std::vector<float> &pathLengths) const
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for(const auto &pathRequest : pathRequests)
+    {
+        pathLengths.push_back(computePathLength(pathfindingAStar.findPath(pathRequest.startPoint, pathRequest.endPoint)));
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(endTime - startTime).count();
+}
+
+float PathfindingBenchmark::computePathLength(const std::vector<PathPoint> &path)
+{
+    float pathLength = 0.0f;
+    for(std::size_t i=1; i<path.size(); ++i)
+    {
+        pathLength += path[i - 1].getPoint().distance(path[i].getPoint());
+    }
+    return pathLength;
+}
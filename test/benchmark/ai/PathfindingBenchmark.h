@@ -0,0 +1,36 @@
+#ifndef URCHINENGINE_PATHFINDINGBENCHMARK_H
+#define URCHINENGINE_PATHFINDINGBENCHMARK_H
+
+#include <memory>
+#include <vector>
+#include <ostream>
+#include "UrchinAIEngine.h"
+
+/**
+* Compare the path finding with incremental G score to the path finding with exact G score (funnel algorithm applied from the start
+* point at each node expansion) on grids with obstacles: search times and lengths of the found paths.
+*/
+class PathfindingBenchmark
+{
+    public:
+        PathfindingBenchmark(unsigned int, float);
+
+        bool run(unsigned int, std::ostream &) const;
+
+    private:
+        struct PathRequestPoints
+        {
+            urchin::Point3<float> startPoint;
+            urchin::Point3<float> endPoint;
+        };
+
+        std::vector<bool> buildObstacleSquares(unsigned int) const;
+        std::vector<PathRequestPoints> buildPathRequests(unsigned int, const std::vector<bool> &) const;
+        double findPaths(urchin::PathfindingAStar &, const std::vector<PathRequestPoints> &, std::vector<float> &) const;
+        static float computePathLength(const std::vector<urchin::PathPoint> &);
+
+        const unsigned int numberRequests;
+        const float lengthTolerance;
+};
+
+#endif
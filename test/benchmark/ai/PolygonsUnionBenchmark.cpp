@@ -0,0 +1,82 @@
+#include <chrono>
+#include <random>
+#include <cmath>
+
+#include "ai/PolygonsUnionBenchmark.h"
+using namespace urchin;
+
+#define FOOTPRINT_HALF_SIZE 1.0f
+#define FOOTPRINTS_DENSITY 0.5f
+
+/**
+ * @param numberIterations Number of unions computed for each footprints count: the mean time is reported
+ */
+PolygonsUnionBenchmark::PolygonsUnionBenchmark(unsigned int numberIterations) :
+        numberIterations(numberIterations)
+{
+
+}
+
+/**
+ * @param footprintsCount Number of footprints to merge
+ */
+void PolygonsUnionBenchmark::run(unsigned int footprintsCount, std::ostream &stream) const
+{
+    std::vector<CSGPolygon<float>> footprints = buildFootprints(footprintsCount);
+
+    ClipperLib::Paths unionPaths;
+    std::vector<CSGPolygon<float>> mergedPolygons;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for(unsigned int i=0; i<numberIterations; ++i)
+    {
+        mergedPolygons = PolygonsUnion<float>::instance()->unionPolygons(footprints, unionPaths);
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double unionTime = std::chrono::duration<double, std::milli>(endTime - startTime).count() / (double)numberIterations;
+
+    std::size_t mergedPointsCount = 0;
+    float mergedArea = 0.0f;
+    for(const auto &mergedPolygon : mergedPolygons)
+    {
+        mergedPointsCount += mergedPolygon.getCwPoints().size();
+        mergedArea += mergedPolygon.computeArea();
+    }
+
+    stream << "    {" << std::endl;
+    stream << "      \"footprints\": " << footprintsCount << "," << std::endl;
+    stream << "      \"mergedPolygons\": " << mergedPolygons.size() << "," << std::endl;
+    stream << "      \"mergedPoints\": " << mergedPointsCount << "," << std::endl;
+    stream << "      \"mergedArea\": " << mergedArea << "," << std::endl;
+    stream << "      \"unionTimeMs\": " << unionTime << std::endl;
+    stream << "    }";
+}
+
+/**
+ * @return Rotated squares randomly placed in an area sized to have most of the squares overlapping other squares
+ */
+std::vector<CSGPolygon<float>> PolygonsUnionBenchmark::buildFootprints(unsigned int footprintsCount) const
+{
+    float areaSize = std::sqrt((float)footprintsCount / FOOTPRINTS_DENSITY) * FOOTPRINT_HALF_SIZE;
+    std::mt19937 randomGenerator(footprintsCount);
+    std::uniform_real_distribution<float> positionDistribution(0.0f, areaSize);
+    std::uniform_real_distribution<float> angleDistribution(0.0f, (float)PI_VALUE / 2.0f);
+
+    std::vector<CSGPolygon<float>> footprints;
+    footprints.reserve(footprintsCount);
+    for(unsigned int i=0; i<footprintsCount; ++i)
+    {
+        Point2<float> center(positionDistribution(randomGenerator), positionDistribution(randomGenerator));
+        float angle = angleDistribution(randomGenerator);
+
+        std::vector<Point2<float>> cwPoints;
+        cwPoints.reserve(4);
+        for(unsigned int cornerIndex=0; cornerIndex<4; ++cornerIndex)
+        { //corners in clockwise order
+            float cornerAngle = angle - (float)cornerIndex * ((float)PI_VALUE / 2.0f);
+            cwPoints.emplace_back(Point2<float>(center.X + std::cos(cornerAngle) * FOOTPRINT_HALF_SIZE, center.Y + std::sin(cornerAngle) * FOOTPRINT_HALF_SIZE));
+        }
+        footprints.emplace_back(CSGPolygon<float>("footprint" + std::to_string(i), std::move(cwPoints)));
+    }
+
+    return footprints;
+}
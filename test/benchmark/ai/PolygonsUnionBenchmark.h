@@ -0,0 +1,24 @@
+#ifndef URCHINENGINE_POLYGONSUNIONBENCHMARK_H
+#define URCHINENGINE_POLYGONSUNIONBENCHMARK_H
+
+#include <vector>
+#include <ostream>
+#include "UrchinAIEngine.h"
+
+/**
+* Measure the union of overlapping obstacle footprints as done by the navigation mesh generator around a walkable surface
+*/
+class PolygonsUnionBenchmark
+{
+    public:
+        explicit PolygonsUnionBenchmark(unsigned int);
+
+        void run(unsigned int, std::ostream &) const;
+
+    private:
+        std::vector<urchin::CSGPolygon<float>> buildFootprints(unsigned int) const;
+
+        const unsigned int numberIterations;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <utility>
+
+#include "physics/BenchmarkResult.h"
+using namespace urchin;
+
+BenchmarkResult::BenchmarkResult(std::string sceneName, std::string broadPhaseAlgorithmName, float timeStep) :
+        sceneName(std::move(sceneName)),
+        broadPhaseAlgorithmName(std::move(broadPhaseAlgorithmName)),
+        timeStep(timeStep)
+{
+
+}
+
+/**
+ * @param stepTime Total execution time (ms) of the step
+ * @param stageTimings Execution times of the stages of the step
+ * @param stepCounters Counters of the step
+ * @param numberHeapAllocations Number of narrow phase allocations done outside pools and arenas during the step
+ */
+void BenchmarkResult::addStep(double stepTime, const StageTimings &stageTimings, const StepCounters &stepCounters, std::size_t numberHeapAllocations)
+{
+    stepResults.push_back({stepTime, stageTimings, stepCounters, numberHeapAllocations});
+}
+
+void BenchmarkResult::writeJson(std::ostream &stream) const
+{
+    stream << "    {" << std::endl;
+    stream << "      \"scene\": \"" << sceneName << "\"," << std::endl;
+    stream << "      \"broadPhaseAlgorithm\": \"" << broadPhaseAlgorithmName << "\"," << std::endl;
+    stream << "      \"steps\": " << stepResults.size() << "," << std::endl;
+    stream << "      \"timeStep\": " << timeStep << "," << std::endl;
+
+    stream << "      \"timingsMs\": {" << std::endl;
+    writeStatistics(stream, "step", &StepResult::stepTime);
+    stream << "," << std::endl;
+    writeStageStatistics(stream, "broadPhase", &StageTimings::broadPhase);
+    stream << "," << std::endl;
+    writeStageStatistics(stream, "narrowPhase", &StageTimings::narrowPhase);
+    stream << "," << std::endl;
+    writeStageStatistics(stream, "constraintSolver", &StageTimings::constraintSolver);
+    stream << "," << std::endl;
+    writeStageStatistics(stream, "island", &StageTimings::island);
+    stream << "," << std::endl;
+    writeStageStatistics(stream, "integration", &StageTimings::integration);
+    stream << std::endl << "      }," << std::endl;
+
+    stream << "      \"counters\": {" << std::endl;
+    writeCounterStatistics(stream, "bodies", &StepCounters::bodies);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "activeBodies", &StepCounters::activeBodies);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "sleepingBodies", &StepCounters::sleepingBodies);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "overlappingPairs", &StepCounters::overlappingPairs);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "newPairs", &StepCounters::newPairs);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "removedPairs", &StepCounters::removedPairs);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "manifolds", &StepCounters::manifolds);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "contactPoints", &StepCounters::contactPoints);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "gjkIterations", &StepCounters::gjkIterations);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "epaIterations", &StepCounters::epaIterations);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "continuousCollisionSweeps", &StepCounters::continuousCollisionSweeps);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "solverConstraints", &StepCounters::solverConstraints);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "solverIterations", &StepCounters::solverIterations);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "solverIslandIterations", &StepCounters::solverIslandIterations);
+    stream << "," << std::endl;
+    writeCounterStatistics(stream, "algorithmPoolHighWaterMark", &StepCounters::algorithmPoolHighWaterMark);
+    stream << "," << std::endl;
+    writeStatistics(stream, "narrowPhaseHeapAllocations", &StepResult::numberHeapAllocations);
+    stream << std::endl << "      }" << std::endl;
+
+    stream << "    }";
+}
+
+/**
+ * Write average, maximum and last values of a step result member
+ */
+template<class T> void BenchmarkResult::writeStatistics(std::ostream &stream, const std::string &name, T StepResult::*member) const
+{
+    double total = 0.0;
+    T maxValue = T();
+    for(const auto &stepResult : stepResults)
+    {
+        total += static_cast<double>(stepResult.*member);
+        maxValue = std::max(maxValue, stepResult.*member);
+    }
+    double average = stepResults.empty() ? 0.0 : total / static_cast<double>(stepResults.size());
+    T lastValue = stepResults.empty() ? T() : stepResults.back().*member;
+
+    stream << "        \"" << name << "\": {\"average\": " << average << ", \"max\": " << maxValue << ", \"last\": " << lastValue << "}";
+}
+
+void BenchmarkResult::writeStageStatistics(std::ostream &stream, const std::string &name, double StageTimings::*member) const
+{
+    double total = 0.0;
+    double maxValue = 0.0;
+    for(const auto &stepResult : stepResults)
+    {
+        total += stepResult.stageTimings.*member;
+        maxValue = std::max(maxValue, stepResult.stageTimings.*member);
+    }
+    double average = stepResults.empty() ? 0.0 : total / static_cast<double>(stepResults.size());
+
+    stream << "        \"" << name << "\": {\"average\": " << average << ", \"max\": " << maxValue << ", \"total\": " << total << "}";
+}
+
+void BenchmarkResult::writeCounterStatistics(std::ostream &stream, const std::string &name, unsigned int StepCounters::*member) const
+{
+    double total = 0.0;
+    unsigned int maxValue = 0;
+    for(const auto &stepResult : stepResults)
+    {
+        total += static_cast<double>(stepResult.stepCounters.*member);
+        maxValue = std::max(maxValue, stepResult.stepCounters.*member);
+    }
+    double average = stepResults.empty() ? 0.0 : total / static_cast<double>(stepResults.size());
+    unsigned int lastValue = stepResults.empty() ? 0 : stepResults.back().stepCounters.*member;
+
+    stream << "        \"" << name << "\": {\"average\": " << average << ", \"max\": " << maxValue << ", \"last\": " << lastValue << "}";
+}
@@ -0,0 +1,40 @@
+#ifndef URCHINENGINE_BENCHMARKRESULT_H
+#define URCHINENGINE_BENCHMARKRESULT_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "UrchinPhysicsEngine.h"
+
+/**
+* Timings and counters collected at each step of a benchmark scene
+*/
+class BenchmarkResult
+{
+    public:
+        BenchmarkResult(std::string, std::string, float);
+
+        void addStep(double, const urchin::StageTimings &, const urchin::StepCounters &, std::size_t);
+
+        void writeJson(std::ostream &) const;
+
+    private:
+        struct StepResult
+        {
+            double stepTime;
+            urchin::StageTimings stageTimings;
+            urchin::StepCounters stepCounters;
+            std::size_t numberHeapAllocations;
+        };
+
+        template<class T> void writeStatistics(std::ostream &, const std::string &, T StepResult::*) const;
+        void writeStageStatistics(std::ostream &, const std::string &, double urchin::StageTimings::*) const;
+        void writeCounterStatistics(std::ostream &, const std::string &, unsigned int urchin::StepCounters::*) const;
+
+        std::string sceneName;
+        std::string broadPhaseAlgorithmName;
+        float timeStep;
+        std::vector<StepResult> stepResults;
+};
+
+#endif
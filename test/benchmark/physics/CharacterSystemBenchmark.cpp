@@ -0,0 +1,103 @@
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "physics/CharacterSystemBenchmark.h"
+using namespace urchin;
+
+#define CHARACTERS_SPACING 3.0f
+#define HEIGHTFIELD_SPACING 1.0f
+
+/**
+ * @param numberSteps Number of simulation steps to execute
+ * @param timeStep Delta of time (sec.) between two simulation steps
+ */
+CharacterSystemBenchmark::CharacterSystemBenchmark(unsigned int numberSteps, float timeStep) :
+        numberSteps(numberSteps),
+        timeStep(timeStep)
+{
+
+}
+
+/**
+ * @param groundType Type of the static ground shared by all the characters: "box" or "heightfield"
+ */
+void CharacterSystemBenchmark::run(unsigned int numberCharacters, const std::string &groundType, std::ostream &stream) const
+{
+    auto charactersBySide = static_cast<unsigned int>(std::ceil(std::sqrt((float)numberCharacters)));
+    float groundHalfSize = (float)charactersBySide * CHARACTERS_SPACING;
+
+    auto physicsWorld = std::make_unique<PhysicsWorld>();
+    physicsWorld->addBody(new RigidBody("ground", Transform<float>(), buildGroundShape(groundType, groundHalfSize)));
+
+    auto characterSystem = std::make_shared<PhysicsCharacterSystem>();
+    physicsWorld->addProcessable(characterSystem);
+    auto characterShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    for(unsigned int i=0; i<numberCharacters; ++i)
+    {
+        float xPosition = -groundHalfSize + CHARACTERS_SPACING * (0.5f + (float)(i % charactersBySide));
+        float zPosition = -groundHalfSize + CHARACTERS_SPACING * (0.5f + (float)(i / charactersBySide));
+        PhysicsTransform characterTransform(Point3<float>(xPosition, 3.0f, zPosition), Quaternion<float>());
+        auto character = std::make_shared<PhysicsCharacter>("character" + std::to_string(i), 80.0f, characterShape, characterTransform);
+        characterSystem->addCharacterController(std::make_shared<PhysicsCharacterController>(character, physicsWorld.get()));
+    }
+
+    Vector3<float> gravity(0.0f, -9.81f, 0.0f);
+    std::vector<double> updateTimes;
+    unsigned int manifoldCount = 0;
+    for(unsigned int step=0; step<numberSteps; ++step)
+    {
+        physicsWorld->getCollisionWorld()->process(timeStep, gravity);
+        characterSystem->execute(timeStep, gravity);
+        updateTimes.push_back(characterSystem->getLastUpdateDuration());
+        manifoldCount += characterSystem->getLastUpdateManifoldCount();
+    }
+    physicsWorld->removeProcessable(characterSystem);
+
+    double sumUpdateTime = 0.0;
+    for(double updateTime : updateTimes)
+    {
+        sumUpdateTime += updateTime;
+    }
+    std::sort(updateTimes.begin(), updateTimes.end());
+
+    stream << "    {" << std::endl;
+    stream << "      \"characters\": " << numberCharacters << "," << std::endl;
+    stream << "      \"ground\": \"" << groundType << "\"," << std::endl;
+    stream << "      \"workerThreads\": " << ConfigService::instance()->getUnsignedIntValue("parallelProcessing.physicsWorkerThreads") << "," << std::endl;
+    stream << "      \"steps\": " << numberSteps << "," << std::endl;
+    stream << "      \"meanManifolds\": " << (numberSteps == 0 ? 0.0 : (double)manifoldCount / numberSteps) << "," << std::endl;
+    stream << "      \"meanUpdateTimeMs\": " << (updateTimes.empty() ? 0.0 : sumUpdateTime / (double)updateTimes.size()) << "," << std::endl;
+    stream << "      \"medianUpdateTimeMs\": " << (updateTimes.empty() ? 0.0 : updateTimes[updateTimes.size() / 2]) << std::endl;
+    stream << "    }";
+}
+
+/**
+ * @param halfSize Half size of the ground on X and Z axis. The top of the ground is near Y=0.
+ */
+std::shared_ptr<CollisionShape3D> CharacterSystemBenchmark::buildGroundShape(const std::string &groundType, float halfSize)
+{
+    if(groundType == "box")
+    {
+        return std::make_shared<CollisionBoxShape>(Vector3<float>(halfSize, 0.01f, halfSize));
+    }else if(groundType == "heightfield")
+    { //heightfield: vertices are sorted by lines (X axis) and centered on origin
+        auto length = static_cast<unsigned int>(2.0f * halfSize / HEIGHTFIELD_SPACING) + 1;
+        float heightfieldHalfSize = ((float)(length - 1) * HEIGHTFIELD_SPACING) / 2.0f;
+        std::vector<Point3<float>> vertices;
+        vertices.reserve(length * length);
+        for(unsigned int z=0; z<length; ++z)
+        {
+            for(unsigned int x=0; x<length; ++x)
+            {
+                float xPosition = -heightfieldHalfSize + (float)x * HEIGHTFIELD_SPACING;
+                float zPosition = -heightfieldHalfSize + (float)z * HEIGHTFIELD_SPACING;
+                vertices.emplace_back(Point3<float>(xPosition, 0.2f * std::sin(xPosition * 0.3f) * std::cos(zPosition * 0.3f), zPosition));
+            }
+        }
+        return std::make_shared<CollisionHeightfieldShape>(vertices, length, length);
+    }
+
+    throw std::invalid_argument("Unknown ground type: " + groundType);
+}
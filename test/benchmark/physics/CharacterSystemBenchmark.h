@@ -0,0 +1,27 @@
+#ifndef URCHINENGINE_CHARACTERSYSTEMBENCHMARK_H
+#define URCHINENGINE_CHARACTERSYSTEMBENCHMARK_H
+
+#include <memory>
+#include <string>
+#include <ostream>
+#include "UrchinPhysicsEngine.h"
+
+/**
+* Measure the update time of the character system: characters standing on a shared static ground (box or heightfield) are updated in
+* parallel and must not be serialized by the ground.
+*/
+class CharacterSystemBenchmark
+{
+    public:
+        CharacterSystemBenchmark(unsigned int, float);
+
+        void run(unsigned int, const std::string &, std::ostream &) const;
+
+    private:
+        static std::shared_ptr<urchin::CollisionShape3D> buildGroundShape(const std::string &, float);
+
+        const unsigned int numberSteps;
+        const float timeStep;
+};
+
+#endif
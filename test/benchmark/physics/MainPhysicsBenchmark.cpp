@@ -0,0 +1,89 @@
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "UrchinPhysicsEngine.h"
+#include "physics/PhysicsBenchmark.h"
+#include "physics/CharacterSystemBenchmark.h"
+#include "physics/scene/BodiesPileScene.h"
+#include "physics/scene/BoxPyramidsScene.h"
+#include "physics/scene/HeightfieldSpheresScene.h"
+#include "physics/scene/CompoundDebrisScene.h"
+#include "physics/scene/CcdBulletsScene.h"
+
+#define DEFAULT_NUMBER_STEPS 300
+#define TIME_STEP (1.0f / 60.0f)
+#define CHARACTER_SYSTEM_SCENE_NAME "characterSystem"
+
+/**
+ * Usage: physicsBenchmark [numberSteps] [sceneName|all] [broadPhaseAlgorithm|all]
+ * Without broad phase algorithm, each scene is executed with all broad phase algorithms to compare them. The character system is measured on
+ * the scene "characterSystem" with the default broad phase algorithm.
+ * Result is written in JSON format on the standard output.
+ */
+int main(int argc, char *argv[])
+{
+    unsigned int numberSteps = (argc > 1) ? static_cast<unsigned int>(std::stoul(argv[1])) : DEFAULT_NUMBER_STEPS;
+    std::string sceneNameFilter = (argc > 2) ? argv[2] : "all";
+    std::string broadPhaseAlgorithmFilter = (argc > 3) ? argv[3] : "all";
+
+    urchin::ConfigService::instance()->loadProperties("resources/engine.properties");
+
+    std::vector<std::unique_ptr<BenchmarkScene>> benchmarkScenes;
+    benchmarkScenes.push_back(std::make_unique<BodiesPileScene>());
+    benchmarkScenes.push_back(std::make_unique<BoxPyramidsScene>());
+    benchmarkScenes.push_back(std::make_unique<HeightfieldSpheresScene>());
+    benchmarkScenes.push_back(std::make_unique<CompoundDebrisScene>());
+    benchmarkScenes.push_back(std::make_unique<CcdBulletsScene>());
+
+    std::vector<std::string> broadPhaseAlgorithmNames = {"aabbTree", "sweepAndPrune", "spatialHash"};
+
+    PhysicsBenchmark physicsBenchmark(numberSteps, TIME_STEP);
+    bool firstResult = true;
+    std::cout << "{" << std::endl << "  \"results\": [" << std::endl;
+    for(const auto &benchmarkScene : benchmarkScenes)
+    {
+        if(sceneNameFilter != "all" && sceneNameFilter != benchmarkScene->getName())
+        {
+            continue;
+        }
+
+        for(const auto &broadPhaseAlgorithmName : broadPhaseAlgorithmNames)
+        {
+            if(broadPhaseAlgorithmFilter == "all" || broadPhaseAlgorithmFilter == broadPhaseAlgorithmName)
+            {
+                if(!firstResult)
+                {
+                    std::cout << "," << std::endl;
+                }
+                physicsBenchmark.run(*benchmarkScene, broadPhaseAlgorithmName).writeJson(std::cout);
+                firstResult = false;
+            }
+        }
+    }
+    std::cout << std::endl << "  ]";
+
+    if(sceneNameFilter == "all" || sceneNameFilter == CHARACTER_SYSTEM_SCENE_NAME)
+    {
+        CharacterSystemBenchmark characterSystemBenchmark(numberSteps, TIME_STEP);
+        std::cout << "," << std::endl << "  \"" << CHARACTER_SYSTEM_SCENE_NAME << "\": [" << std::endl;
+        bool firstCharacterResult = true;
+        for(const char *groundType : {"box", "heightfield"})
+        {
+            for(unsigned int numberCharacters : {40u, 400u})
+            {
+                if(!firstCharacterResult)
+                {
+                    std::cout << "," << std::endl;
+                }
+                characterSystemBenchmark.run(numberCharacters, groundType, std::cout);
+                firstCharacterResult = false;
+            }
+        }
+        std::cout << std::endl << "  ]";
+    }
+    std::cout << std::endl << "}" << std::endl;
+
+    urchin::SingletonManager::destroyAllSingletons();
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <chrono>
+
+#include "physics/PhysicsBenchmark.h"
+using namespace urchin;
+
+/**
+ * @param numberSteps Number of simulation steps to execute
+ * @param timeStep Delta of time (sec.) between two simulation steps
+ */
+PhysicsBenchmark::PhysicsBenchmark(unsigned int numberSteps, float timeStep) :
+        numberSteps(numberSteps),
+        timeStep(timeStep)
+{
+
+}
+
+/**
+ * @param broadPhaseAlgorithmName Name of the broad phase algorithm used to run the scene
+ */
+BenchmarkResult PhysicsBenchmark::run(const BenchmarkScene &benchmarkScene, const std::string &broadPhaseAlgorithmName) const
+{
+    auto *bodyManager = new BodyManager();
+    benchmarkScene.buildScene(bodyManager);
+    auto *collisionWorld = new CollisionWorld(bodyManager, broadPhaseAlgorithmName);
+
+    BenchmarkResult benchmarkResult(benchmarkScene.getName(), broadPhaseAlgorithmName, timeStep);
+    for(unsigned int step=0; step<numberSteps; ++step)
+    {
+        unsigned int heapAllocationCount = collisionWorld->getNarrowPhaseManager()->getHeapAllocationCount();
+        auto stepStartTime = std::chrono::high_resolution_clock::now();
+        collisionWorld->process(timeStep, Vector3<float>(0.0f, -9.81f, 0.0f));
+        auto stepEndTime = std::chrono::high_resolution_clock::now();
+        double stepTime = std::chrono::duration<double, std::milli>(stepEndTime - stepStartTime).count();
+
+        benchmarkResult.addStep(stepTime, collisionWorld->getLastStageTimings(), collisionWorld->getLastStepCounters(),
+                collisionWorld->getNarrowPhaseManager()->getHeapAllocationCount() - heapAllocationCount);
+    }
+
+    delete collisionWorld;
+    delete bodyManager;
+
+    return benchmarkResult;
+}
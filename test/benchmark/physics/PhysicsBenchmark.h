@@ -0,0 +1,24 @@
+#ifndef URCHINENGINE_PHYSICSBENCHMARK_H
+#define URCHINENGINE_PHYSICSBENCHMARK_H
+
+#include <string>
+
+#include "physics/scene/BenchmarkScene.h"
+#include "physics/BenchmarkResult.h"
+
+/**
+* Run a benchmark scene headless (without physics thread) during a fixed number of steps
+*/
+class PhysicsBenchmark
+{
+    public:
+        PhysicsBenchmark(unsigned int, float);
+
+        BenchmarkResult run(const BenchmarkScene &, const std::string &) const;
+
+    private:
+        const unsigned int numberSteps;
+        const float timeStep;
+};
+
+#endif
@@ -0,0 +1,27 @@
+#include <utility>
+
+#include "physics/scene/BenchmarkScene.h"
+using namespace urchin;
+
+BenchmarkScene::BenchmarkScene(std::string name) :
+        name(std::move(name))
+{
+
+}
+
+const std::string &BenchmarkScene::getName() const
+{
+    return name;
+}
+
+/**
+ * @param halfSize Half size of the ground on X and Z axis. The top of the ground is at Y=0.
+ */
+RigidBody *BenchmarkScene::buildGround(BodyManager *bodyManager, float halfSize)
+{
+    auto groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(halfSize, 0.5f, halfSize));
+    auto *groundBody = new RigidBody("ground", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), groundShape);
+    bodyManager->addBody(groundBody);
+
+    return groundBody;
+}
@@ -0,0 +1,27 @@
+#ifndef URCHINENGINE_BENCHMARKSCENE_H
+#define URCHINENGINE_BENCHMARKSCENE_H
+
+#include <string>
+#include "UrchinPhysicsEngine.h"
+
+/**
+* Scene used to measure the performance of the physics engine
+*/
+class BenchmarkScene
+{
+    public:
+        explicit BenchmarkScene(std::string);
+        virtual ~BenchmarkScene() = default;
+
+        const std::string &getName() const;
+
+        virtual void buildScene(urchin::BodyManager *) const = 0;
+
+    protected:
+        static urchin::RigidBody *buildGround(urchin::BodyManager *, float);
+
+    private:
+        std::string name;
+};
+
+#endif
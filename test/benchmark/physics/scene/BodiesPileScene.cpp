@@ -0,0 +1,42 @@
+#include "physics/scene/BodiesPileScene.h"
+using namespace urchin;
+
+#define PILE_WIDTH 25
+#define PILE_LAYERS 16
+#define BODY_HALF_SIZE 0.4f
+#define BODY_SPACING 1.0f
+
+BodiesPileScene::BodiesPileScene() :
+        BenchmarkScene("bodiesPile")
+{
+
+}
+
+void BodiesPileScene::buildScene(BodyManager *bodyManager) const
+{
+    buildGround(bodyManager, 100.0f);
+
+    auto boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(BODY_HALF_SIZE, BODY_HALF_SIZE, BODY_HALF_SIZE));
+    auto sphereShape = std::make_shared<CollisionSphereShape>(BODY_HALF_SIZE);
+
+    float startPosition = -(PILE_WIDTH * BODY_SPACING) / 2.0f;
+    for(unsigned int y=0; y<PILE_LAYERS; ++y)
+    {
+        for(unsigned int x=0; x<PILE_WIDTH; ++x)
+        {
+            for(unsigned int z=0; z<PILE_WIDTH; ++z)
+            {
+                unsigned int bodyIndex = (y * PILE_WIDTH + x) * PILE_WIDTH + z;
+                std::shared_ptr<const CollisionShape3D> bodyShape = (bodyIndex % 2 == 0) ? std::static_pointer_cast<const CollisionShape3D>(boxShape) : sphereShape;
+
+                //odd layers are shifted to avoid perfectly aligned stacks
+                float layerShift = (y % 2 == 0) ? 0.0f : BODY_SPACING * 0.25f;
+                Point3<float> position(startPosition + x * BODY_SPACING + layerShift, 1.0f + y * BODY_SPACING, startPosition + z * BODY_SPACING + layerShift);
+
+                auto *body = new RigidBody("pile_" + std::to_string(bodyIndex), Transform<float>(position, Quaternion<float>(), 1.0f), bodyShape);
+                body->setMass(1.0f);
+                bodyManager->addBody(body);
+            }
+        }
+    }
+}
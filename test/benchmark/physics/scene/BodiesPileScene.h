@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_BODIESPILESCENE_H
+#define URCHINENGINE_BODIESPILESCENE_H
+
+#include "physics/scene/BenchmarkScene.h"
+
+/**
+* Pile of 10k boxes and spheres falling on a ground
+*/
+class BodiesPileScene : public BenchmarkScene
+{
+    public:
+        BodiesPileScene();
+
+        void buildScene(urchin::BodyManager *) const override;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#include "physics/scene/BoxPyramidsScene.h"
+using namespace urchin;
+
+#define NUMBER_PYRAMIDS 5
+#define PYRAMID_BASE_SIZE 8
+#define PYRAMIDS_SPACING 12.0f
+#define BOX_HALF_SIZE 0.5f
+
+BoxPyramidsScene::BoxPyramidsScene() :
+        BenchmarkScene("boxPyramids")
+{
+
+}
+
+void BoxPyramidsScene::buildScene(BodyManager *bodyManager) const
+{
+    buildGround(bodyManager, 100.0f);
+
+    auto boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(BOX_HALF_SIZE, BOX_HALF_SIZE, BOX_HALF_SIZE));
+    float boxSize = BOX_HALF_SIZE * 2.0f;
+
+    unsigned int boxIndex = 0;
+    for(unsigned int pyramidIndex=0; pyramidIndex<NUMBER_PYRAMIDS; ++pyramidIndex)
+    {
+        Point3<float> pyramidCenter((pyramidIndex - (NUMBER_PYRAMIDS - 1) / 2.0f) * PYRAMIDS_SPACING, 0.0f, 0.0f);
+
+        for(unsigned int layer=0; layer<PYRAMID_BASE_SIZE; ++layer)
+        {
+            unsigned int layerSize = PYRAMID_BASE_SIZE - layer;
+            float layerStartPosition = -((layerSize - 1) * boxSize) / 2.0f;
+
+            for(unsigned int x=0; x<layerSize; ++x)
+            {
+                for(unsigned int z=0; z<layerSize; ++z)
+                {
+                    Point3<float> position = pyramidCenter.translate(Vector3<float>(layerStartPosition + x * boxSize, BOX_HALF_SIZE + layer * boxSize, layerStartPosition + z * boxSize));
+
+                    auto *body = new RigidBody("pyramidBox_" + std::to_string(boxIndex++), Transform<float>(position, Quaternion<float>(), 1.0f), boxShape);
+                    body->setMass(1.0f);
+                    bodyManager->addBody(body);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_BOXPYRAMIDSSCENE_H
+#define URCHINENGINE_BOXPYRAMIDSSCENE_H
+
+#include "physics/scene/BenchmarkScene.h"
+
+/**
+* Pyramids of stacked boxes resting on a ground
+*/
+class BoxPyramidsScene : public BenchmarkScene
+{
+    public:
+        BoxPyramidsScene();
+
+        void buildScene(urchin::BodyManager *) const override;
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "physics/scene/CcdBulletsScene.h"
+using namespace urchin;
+
+#define NUMBER_BULLETS_PER_LINE 25
+#define BULLET_RADIUS 0.05f
+#define BULLET_MASS 0.01f
+#define BULLET_SPEED 300.0f
+#define WALL_DISTANCE 50.0f
+
+CcdBulletsScene::CcdBulletsScene() :
+        BenchmarkScene("ccdBullets")
+{
+
+}
+
+void CcdBulletsScene::buildScene(BodyManager *bodyManager) const
+{
+    buildGround(bodyManager, 100.0f);
+
+    //thin static wall
+    auto wallShape = std::make_shared<CollisionBoxShape>(Vector3<float>(20.0f, 10.0f, 0.1f));
+    bodyManager->addBody(new RigidBody("wall", Transform<float>(Point3<float>(0.0f, 10.0f, -WALL_DISTANCE), Quaternion<float>(), 1.0f), wallShape));
+
+    //bullets shot toward the wall
+    auto bulletShape = std::make_shared<CollisionSphereShape>(BULLET_RADIUS);
+    float bulletSpacing = 0.5f;
+    float startPosition = -((NUMBER_BULLETS_PER_LINE - 1) * bulletSpacing) / 2.0f;
+    for(unsigned int y=0; y<NUMBER_BULLETS_PER_LINE; ++y)
+    {
+        for(unsigned int x=0; x<NUMBER_BULLETS_PER_LINE; ++x)
+        {
+            Point3<float> position(startPosition + x * bulletSpacing, 4.0f + y * bulletSpacing, 0.0f);
+
+            auto *body = new RigidBody("bullet_" + std::to_string(y * NUMBER_BULLETS_PER_LINE + x), Transform<float>(position, Quaternion<float>(), 1.0f), bulletShape);
+            body->setMass(BULLET_MASS);
+            body->applyCentralMomentum(Vector3<float>(0.0f, 0.0f, -BULLET_SPEED * BULLET_MASS));
+            bodyManager->addBody(body);
+        }
+    }
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_CCDBULLETSSCENE_H
+#define URCHINENGINE_CCDBULLETSSCENE_H
+
+#include "physics/scene/BenchmarkScene.h"
+
+/**
+* Fast bullets requiring continuous collision detection shot on a wall
+*/
+class CcdBulletsScene : public BenchmarkScene
+{
+    public:
+        CcdBulletsScene();
+
+        void buildScene(urchin::BodyManager *) const override;
+};
+
+#endif
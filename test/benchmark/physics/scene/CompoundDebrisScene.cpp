@@ -0,0 +1,45 @@
+#include <random>
+
+#include "physics/scene/CompoundDebrisScene.h"
+using namespace urchin;
+
+#define NUMBER_DEBRIS 1500
+#define DEBRIS_AREA_HALF_SIZE 20.0f
+
+CompoundDebrisScene::CompoundDebrisScene() :
+        BenchmarkScene("compoundDebris")
+{
+
+}
+
+void CompoundDebrisScene::buildScene(BodyManager *bodyManager) const
+{
+    buildGround(bodyManager, 100.0f);
+
+    //debris shape: three boxes forming a 'L' shape
+    std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
+    std::vector<Point3<float>> boxPositions = {Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(0.4f, 0.0f, 0.0f), Point3<float>(0.0f, 0.4f, 0.0f)};
+    for(std::size_t i=0; i<boxPositions.size(); ++i)
+    {
+        auto localizedShape = std::make_shared<LocalizedCollisionShape>();
+        localizedShape->position = i;
+        localizedShape->shape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.2f, 0.2f, 0.2f));
+        localizedShape->transform = PhysicsTransform(boxPositions[i]);
+        localizedShapes.push_back(localizedShape);
+    }
+    auto debrisShape = std::make_shared<CollisionCompoundShape>(localizedShapes);
+
+    std::mt19937 randomGenerator(42);
+    std::uniform_real_distribution<float> positionDistribution(-DEBRIS_AREA_HALF_SIZE, DEBRIS_AREA_HALF_SIZE);
+    std::uniform_real_distribution<float> heightDistribution(1.0f, 15.0f);
+    std::uniform_real_distribution<float> angleDistribution(0.0f, 2.0f * (float)PI_VALUE);
+    for(unsigned int i=0; i<NUMBER_DEBRIS; ++i)
+    {
+        Point3<float> position(positionDistribution(randomGenerator), heightDistribution(randomGenerator), positionDistribution(randomGenerator));
+        Quaternion<float> orientation(Vector3<float>(1.0f, 1.0f, 0.0f).normalize(), angleDistribution(randomGenerator));
+
+        auto *body = new RigidBody("debris_" + std::to_string(i), Transform<float>(position, orientation, 1.0f), debrisShape);
+        body->setMass(0.5f);
+        bodyManager->addBody(body);
+    }
+}
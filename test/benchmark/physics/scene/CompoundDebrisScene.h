@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_COMPOUNDDEBRISSCENE_H
+#define URCHINENGINE_COMPOUNDDEBRISSCENE_H
+
+#include "physics/scene/BenchmarkScene.h"
+
+/**
+* Debris built with compound shapes falling on a ground
+*/
+class CompoundDebrisScene : public BenchmarkScene
+{
+    public:
+        CompoundDebrisScene();
+
+        void buildScene(urchin::BodyManager *) const override;
+};
+
+#endif
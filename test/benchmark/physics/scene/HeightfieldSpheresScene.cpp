@@ -0,0 +1,51 @@
+#include <cmath>
+#include <random>
+
+#include "physics/scene/HeightfieldSpheresScene.h"
+using namespace urchin;
+
+#define HEIGHTFIELD_LENGTH 129
+#define HEIGHTFIELD_SPACING 1.0f
+#define NUMBER_SPHERES 2000
+#define SPHERE_RADIUS 0.3f
+
+HeightfieldSpheresScene::HeightfieldSpheresScene() :
+        BenchmarkScene("heightfieldSpheres")
+{
+
+}
+
+void HeightfieldSpheresScene::buildScene(BodyManager *bodyManager) const
+{
+    //heightfield: vertices are sorted by lines (X axis) and centered on origin
+    std::vector<Point3<float>> vertices;
+    vertices.reserve(HEIGHTFIELD_LENGTH * HEIGHTFIELD_LENGTH);
+    float halfSize = ((HEIGHTFIELD_LENGTH - 1) * HEIGHTFIELD_SPACING) / 2.0f;
+    for(unsigned int z=0; z<HEIGHTFIELD_LENGTH; ++z)
+    {
+        for(unsigned int x=0; x<HEIGHTFIELD_LENGTH; ++x)
+        {
+            float xPosition = -halfSize + x * HEIGHTFIELD_SPACING;
+            float zPosition = -halfSize + z * HEIGHTFIELD_SPACING;
+            float height = 2.0f * std::sin(xPosition * 0.1f) + 1.5f * std::cos(zPosition * 0.15f);
+            vertices.emplace_back(Point3<float>(xPosition, height, zPosition));
+        }
+    }
+    auto heightfieldShape = std::make_shared<CollisionHeightfieldShape>(vertices, HEIGHTFIELD_LENGTH, HEIGHTFIELD_LENGTH);
+    bodyManager->addBody(new RigidBody("heightfield", Transform<float>(), heightfieldShape));
+
+    //rolling spheres: random position and initial momentum with fixed seed for reproducibility
+    auto sphereShape = std::make_shared<CollisionSphereShape>(SPHERE_RADIUS);
+    std::mt19937 randomGenerator(42);
+    std::uniform_real_distribution<float> positionDistribution(-halfSize * 0.9f, halfSize * 0.9f);
+    std::uniform_real_distribution<float> momentumDistribution(-3.0f, 3.0f);
+    for(unsigned int i=0; i<NUMBER_SPHERES; ++i)
+    {
+        Point3<float> position(positionDistribution(randomGenerator), 6.0f, positionDistribution(randomGenerator));
+
+        auto *body = new RigidBody("sphere_" + std::to_string(i), Transform<float>(position, Quaternion<float>(), 1.0f), sphereShape);
+        body->setMass(1.0f);
+        body->applyCentralMomentum(Vector3<float>(momentumDistribution(randomGenerator), 0.0f, momentumDistribution(randomGenerator)));
+        bodyManager->addBody(body);
+    }
+}
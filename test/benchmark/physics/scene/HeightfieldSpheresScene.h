@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_HEIGHTFIELDSPHERESSCENE_H
+#define URCHINENGINE_HEIGHTFIELDSPHERESSCENE_H
+
+#include "physics/scene/BenchmarkScene.h"
+
+/**
+* 2k spheres rolling on a heightfield
+*/
+class HeightfieldSpheresScene : public BenchmarkScene
+{
+    public:
+        HeightfieldSpheresScene();
+
+        void buildScene(urchin::BodyManager *) const override;
+};
+
+#endif
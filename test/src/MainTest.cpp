@@ -3,6 +3,7 @@
 #include "common/io/StringUtilTest.h"
 #include "common/io/MapUtilTest.h"
 #include "common/system/FileHandlerTest.h"
+#include "common/tools/ThreadPoolTest.h"
 #include "common/math/algebra/QuaternionTest.h"
 #include "common/math/geometry/OrthogonalProjectionTest.h"
 #include "common/math/geometry/ClosestPointTest.h"
@@ -17,6 +18,7 @@
 #include "physics/object/SupportPointTest.h"
 #include "physics/body/InertiaCalculationTest.h"
 #include "physics/collision/broadphase/aabbtree/BodyAABBTreeTest.h"
+#include "physics/collision/broadphase/BroadPhaseAlgorithmTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKBoxTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKConvexHullTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKSphereTest.h"
@@ -25,8 +27,14 @@
 #include "physics/collision/narrowphase/algorithm/epa/EPASphereTest.h"
 #include "physics/collision/narrowphase/algorithm/epa/EPAConvexHullTest.h"
 #include "physics/collision/narrowphase/algorithm/epa/EPAConvexObjectTest.h"
+#include "physics/collision/ManifoldResultTest.h"
+#include "physics/collision/ManifoldResultArenaTest.h"
 #include "physics/collision/island/IslandContainerTest.h"
+#include "physics/collision/constraintsolver/ConstraintSolverManagerTest.h"
+#include "physics/utils/pool/FixedSizePoolTest.h"
+#include "physics/statistics/PhysicsStatisticsTest.h"
 #include "physics/it/FallingObjectIT.h"
+#include "physics/it/CharacterSystemIT.h"
 #include "ai/path/navmesh/csg/CSGPolygonTest.h"
 #include "ai/path/navmesh/csg/PolygonsUnionTest.h"
 #include "ai/path/navmesh/csg/PolygonsSubtractionTest.h"
@@ -35,8 +43,13 @@
 #include "ai/path/navmesh/polytope/services/TerrainObstacleServiceTest.h"
 #include "ai/path/navmesh/jump/EdgeLinkDetectionTest.h"
 #include "ai/path/navmesh/NavMeshGeneratorTest.h"
+#include "ai/path/navmesh/model/output/NavMeshTest.h"
+#include "ai/path/navmesh/bake/BakedNavMeshTest.h"
 #include "ai/path/pathfinding/FunnelAlgorithmTest.h"
+#include "ai/path/pathfinding/PathNodeHeapTest.h"
 #include "ai/path/pathfinding/PathfindingAStarTest.h"
+#include "ai/path/pathfinding/hierarchical/PolygonGraphTest.h"
+#include "ai/path/PathRequestsProcessorTest.h"
 
 void commonTests(CppUnit::TextUi::TestRunner &runner)
 {
@@ -47,6 +60,9 @@ void commonTests(CppUnit::TextUi::TestRunner &runner)
     //system - file
     runner.addTest(FileHandlerTest::suite());
 
+    //tools - thread
+    runner.addTest(ThreadPoolTest::suite());
+
     //math - algebra
     runner.addTest(QuaternionTest::suite());
 
@@ -75,6 +91,7 @@ void physicsTests(CppUnit::TextUi::TestRunner &runner)
 
     //broad phase
     runner.addTest(BodyAABBTreeTest::suite());
+    runner.addTest(BroadPhaseAlgorithmTest::suite());
 
     //narrow phase
     runner.addTest(GJKSphereTest::suite());
@@ -85,12 +102,24 @@ void physicsTests(CppUnit::TextUi::TestRunner &runner)
     runner.addTest(EPASphereTest::suite());
     runner.addTest(EPAConvexHullTest::suite());
     runner.addTest(EPAConvexObjectTest::suite());
+    runner.addTest(ManifoldResultTest::suite());
+    runner.addTest(ManifoldResultArenaTest::suite());
 
     //island
     runner.addTest(IslandContainerTest::suite());
 
+    //constraint solver
+    runner.addTest(ConstraintSolverManagerTest::suite());
+
+    //pool
+    runner.addTest(FixedSizePoolTest::suite());
+
+    //statistics
+    runner.addTest(PhysicsStatisticsTest::suite());
+
     //integration tests (IT)
     runner.addTest(FallingObjectIT::suite());
+    runner.addTest(CharacterSystemIT::suite());
 }
 
 void aiTests(CppUnit::TextUi::TestRunner &runner)
@@ -104,10 +133,15 @@ void aiTests(CppUnit::TextUi::TestRunner &runner)
     runner.addTest(TerrainObstacleServiceTest::suite());
     runner.addTest(EdgeLinkDetectionTest::suite());
     runner.addTest(NavMeshGeneratorTest::suite());
+    runner.addTest(NavMeshTest::suite());
+    runner.addTest(BakedNavMeshTest::suite());
 
     //pathfinding
     runner.addTest(FunnelAlgorithmTest::suite());
+    runner.addTest(PathNodeHeapTest::suite());
     runner.addTest(PathfindingAStarTest::suite());
+    runner.addTest(PolygonGraphTest::suite());
+    runner.addTest(PathRequestsProcessorTest::suite());
 }
 
 int main()
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <stdexcept>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinCommon.h"
+
+#include "PathRequestsProcessorTest.h"
+#include "AssertHelper.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
+using namespace urchin;
+
+#define EXPIRED_TIME_BUDGET 0.0001f
+#define LARGE_TIME_BUDGET 10000.0f
+
+void PathRequestsProcessorTest::timeBudgetCutOff()
+{
+    std::shared_ptr<NavMesh> navMesh = buildSquareNavMesh();
+    ThreadPool threadPool(4);
+    PathCache pathCache(16);
+    PolygonGraph polygonGraph;
+    std::vector<std::shared_ptr<PathRequest>> pathRequests;
+    for(int i=0; i<5; ++i)
+    {
+        pathRequests.push_back(buildPathRequest(0));
+    }
+
+    PathRequestsProcessor expiredBudgetProcessor(&threadPool, &pathCache, &polygonGraph, EXPIRED_TIME_BUDGET);
+    expiredBudgetProcessor.process(navMesh, pathRequests);
+    auto numberPathsReady = static_cast<int>(std::count_if(pathRequests.begin(), pathRequests.end(), [](const auto &r) { return r->isPathReady(); }));
+    AssertHelper::assertInt(numberPathsReady, 1); //at least one request is computed by update
+
+    PathRequestsProcessor largeBudgetProcessor(&threadPool, &pathCache, &polygonGraph, LARGE_TIME_BUDGET);
+    largeBudgetProcessor.process(navMesh, pathRequests);
+    numberPathsReady = static_cast<int>(std::count_if(pathRequests.begin(), pathRequests.end(), [](const auto &r) { return r->isPathReady(); }));
+    AssertHelper::assertInt(numberPathsReady, 5);
+}
+
+void PathRequestsProcessorTest::priorityOrder()
+{
+    std::shared_ptr<NavMesh> navMesh = buildSquareNavMesh();
+    ThreadPool threadPool(4);
+    PathCache pathCache(16);
+    PolygonGraph polygonGraph;
+    std::shared_ptr<PathRequest> lowPriorityRequest = buildPathRequest(0);
+    std::shared_ptr<PathRequest> highPriorityRequest = buildPathRequest(2);
+    std::shared_ptr<PathRequest> mediumPriorityRequest = buildPathRequest(1);
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = {lowPriorityRequest, highPriorityRequest, mediumPriorityRequest};
+    PathRequestsProcessor pathRequestsProcessor(&threadPool, &pathCache, &polygonGraph, EXPIRED_TIME_BUDGET);
+
+    pathRequestsProcessor.process(navMesh, pathRequests);
+    AssertHelper::assertTrue(highPriorityRequest->isPathReady());
+    AssertHelper::assertTrue(!mediumPriorityRequest->isPathReady());
+    AssertHelper::assertTrue(!lowPriorityRequest->isPathReady());
+
+    pathRequests = {lowPriorityRequest, mediumPriorityRequest}; //high priority request served and removed
+    pathRequestsProcessor.process(navMesh, pathRequests);
+    AssertHelper::assertTrue(mediumPriorityRequest->isPathReady());
+    AssertHelper::assertTrue(!lowPriorityRequest->isPathReady());
+}
+
+void PathRequestsProcessorTest::leastRecentlyProcessedFirst()
+{
+    std::shared_ptr<NavMesh> navMesh = buildSquareNavMesh();
+    ThreadPool threadPool(4);
+    PathCache pathCache(16);
+    PolygonGraph polygonGraph;
+    std::vector<std::shared_ptr<PathRequest>> initialPathRequests = {buildPathRequest(0), buildPathRequest(0), buildPathRequest(0)};
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = initialPathRequests;
+    PathRequestsProcessor pathRequestsProcessor(&threadPool, &pathCache, &polygonGraph, EXPIRED_TIME_BUDGET);
+
+    for(unsigned int updateNumber=1; updateNumber<=3; ++updateNumber)
+    {
+        pathRequestsProcessor.process(navMesh, pathRequests);
+        AssertHelper::assertUnsignedInt(initialPathRequests[updateNumber - 1]->getLastProcessingUpdate(), updateNumber);
+    }
+
+    pathRequestsProcessor.process(navMesh, pathRequests);
+    AssertHelper::assertUnsignedInt(initialPathRequests[0]->getLastProcessingUpdate(), 4);
+    AssertHelper::assertUnsignedInt(initialPathRequests[1]->getLastProcessingUpdate(), 2);
+    AssertHelper::assertUnsignedInt(initialPathRequests[2]->getLastProcessingUpdate(), 3);
+}
+
+void PathRequestsProcessorTest::nonPositiveTimeBudget()
+{
+    ThreadPool threadPool(1);
+    PathCache pathCache(16);
+    PolygonGraph polygonGraph;
+
+    try
+    {
+        PathRequestsProcessor pathRequestsProcessor(&threadPool, &pathCache, &polygonGraph, 0.0f);
+        AssertHelper::assertTrue(false, "Non positive time budget must be rejected");
+    }catch(const std::invalid_argument &)
+    {
+        //expected
+    }
+}
+
+std::shared_ptr<NavMesh> PathRequestsProcessorTest::buildSquareNavMesh()
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({NavMeshTestHelper::buildSquarePolygon("polyTestName", Point3<float>(0.0f, 0.0f, 0.0f), 4.0f)}, {});
+    return navMesh;
+}
+
+std::shared_ptr<PathRequest> PathRequestsProcessorTest::buildPathRequest(int priority)
+{
+    auto pathRequest = std::make_shared<PathRequest>(Point3<float>(1.0f, 0.0f, 1.0f), Point3<float>(3.0f, 0.0f, 3.0f));
+    pathRequest->setPriority(priority);
+    return pathRequest;
+}
+
+CppUnit::Test *PathRequestsProcessorTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PathRequestsProcessorTest");
+
+    suite->addTest(new CppUnit::TestCaller<PathRequestsProcessorTest>("timeBudgetCutOff", &PathRequestsProcessorTest::timeBudgetCutOff));
+    suite->addTest(new CppUnit::TestCaller<PathRequestsProcessorTest>("priorityOrder", &PathRequestsProcessorTest::priorityOrder));
+    suite->addTest(new CppUnit::TestCaller<PathRequestsProcessorTest>("leastRecentlyProcessedFirst", &PathRequestsProcessorTest::leastRecentlyProcessedFirst));
+    suite->addTest(new CppUnit::TestCaller<PathRequestsProcessorTest>("nonPositiveTimeBudget", &PathRequestsProcessorTest::nonPositiveTimeBudget));
+
+    return suite;
+}
@@ -0,0 +1,23 @@
+#ifndef URCHINENGINE_PATHREQUESTSPROCESSORTEST_H
+#define URCHINENGINE_PATHREQUESTSPROCESSORTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinAIEngine.h"
+
+class PathRequestsProcessorTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void timeBudgetCutOff();
+        void priorityOrder();
+        void leastRecentlyProcessedFirst();
+        void nonPositiveTimeBudget();
+
+    private:
+        std::shared_ptr<urchin::NavMesh> buildSquareNavMesh();
+        std::shared_ptr<urchin::PathRequest> buildPathRequest(int);
+};
+
+#endif
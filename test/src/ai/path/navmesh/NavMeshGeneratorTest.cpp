@@ -1,9 +1,13 @@
 #include <cppunit/TestSuite.h>
 #include <cppunit/TestCaller.h>
 #include <memory>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 #include "UrchinCommon.h"
 
 #include "NavMeshGeneratorTest.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
 #include "AssertHelper.h"
 using namespace urchin;
 
@@ -19,7 +23,7 @@ void NavMeshGeneratorTest::holeOnWalkableFace()
     NavMeshGenerator navMeshGenerator;
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
-    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 2);
     AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<walkableFace[2]> - <hole>");
@@ -42,7 +46,7 @@ void NavMeshGeneratorTest::holeOnWalkableFaceEdge()
     NavMeshGenerator navMeshGenerator;
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
-    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 2);
     AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<[walkableFace[2]] - [hole]>");
@@ -65,7 +69,7 @@ void NavMeshGeneratorTest::holeOverlapOnWalkableFace()
     NavMeshGenerator navMeshGenerator;
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
-    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 2);
     AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<[walkableFace[2]] - [hole]>");
@@ -102,7 +106,7 @@ void NavMeshGeneratorTest::holeAndCrossingHoleOnWalkableFace()
     NavMeshGenerator navMeshGenerator;
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
-    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 4);
     AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<hole[2]>");
@@ -119,19 +123,12 @@ void NavMeshGeneratorTest::holeAndCrossingHoleOnWalkableFace()
 
 void NavMeshGeneratorTest::moveHoleOnWalkableFace()
 {
-    auto walkableShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(2.0, 0.01, 2.0)).get());
-    auto walkableFaceObjectLeft = std::make_shared<AIObject>("walkableFaceLeft", Transform<float>(Point3<float>(0.0, 0.0, 0.0)), false, walkableShape);
-    auto walkableFaceObjectRight = std::make_shared<AIObject>("walkableFaceRight", Transform<float>(Point3<float>(5.0, 0.0, 0.0)), false, walkableShape);
-    auto holeShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(1.0, 0.01, 1.0)).get());
-    auto holeObject = std::make_shared<AIObject>("hole", Transform<float>(Point3<float>(0.0, 1.0, 0.0)), true, holeShape);
     AIWorld aiWorld;
-    aiWorld.addEntity(walkableFaceObjectLeft);
-    aiWorld.addEntity(walkableFaceObjectRight);
-    aiWorld.addEntity(holeObject);
+    std::shared_ptr<AIObject> holeObject = NavMeshTestHelper::addWalkableFacesAndHole(aiWorld, 0.0f);
     NavMeshGenerator navMeshGenerator;
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
-    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 3);
     AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<walkableFaceRight[2]>");
@@ -160,7 +157,7 @@ void NavMeshGeneratorTest::removeHoleFromWalkableFace()
     NavMeshGenerator navMeshGenerator;
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
-    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 2);
     AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<walkableFace[2]> - <hole>");
@@ -188,7 +185,7 @@ void NavMeshGeneratorTest::linksRecreatedAfterMove()
     NavMeshGenerator navMeshGenerator;
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
-    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
     auto cube1MovingPolygon = navMesh->getPolygons()[0];
     auto cube2AffectedByMovePolygon = navMesh->getPolygons()[1];
     auto cube3WitLinkToCube1Polygon = navMesh->getPolygons()[2];
@@ -197,7 +194,7 @@ void NavMeshGeneratorTest::linksRecreatedAfterMove()
     AssertHelper::assertString(cube1MovingPolygon->getName(), "<cube1[2]>");
     AssertHelper::assertString(cube2AffectedByMovePolygon->getName(), "<cube2[2]>");
     AssertHelper::assertString(cube3WitLinkToCube1Polygon->getName(), "<cube3[2]>");
-    AssertHelper::assertUnsignedInt(countPolygonLinks(cube3WitLinkToCube1Polygon, cube2AffectedByMovePolygon), 1);
+    AssertHelper::assertUnsignedInt(countPolygonLinks(*navMesh, cube3WitLinkToCube1Polygon, cube2AffectedByMovePolygon), 1);
 
     cube1Moving->updateTransform(Point3<float>(1.0, 1.5, 0.0), Quaternion<float>());
 
@@ -210,16 +207,134 @@ void NavMeshGeneratorTest::linksRecreatedAfterMove()
     AssertHelper::assertString(newCube1MovingPolygon->getName(), "<cube1[2]>");
     AssertHelper::assertString(newCube2AffectedByMovePolygon->getName(), "<cube2[2]>");
     AssertHelper::assertString(newCube3WitLinkToCube1Polygon->getName(), "<cube3[2]>");
-    AssertHelper::assertUnsignedInt(countPolygonLinks(newCube3WitLinkToCube1Polygon, newCube2AffectedByMovePolygon), 1);
-    AssertHelper::assertUnsignedInt(countPolygonLinks(newCube3WitLinkToCube1Polygon, cube2AffectedByMovePolygon), 0);
+    AssertHelper::assertUnsignedInt(countPolygonLinks(*navMesh, newCube3WitLinkToCube1Polygon, newCube2AffectedByMovePolygon), 1);
+    AssertHelper::assertUnsignedInt(countPolygonLinks(*navMesh, newCube3WitLinkToCube1Polygon, cube2AffectedByMovePolygon), 0);
+    AssertHelper::assertTrue(navMeshGenerator.generate(aiWorld) == navMesh); //no change: same navigation mesh version
+}
+
+void NavMeshGeneratorTest::onlyTouchedTilesRegenerated()
+{
+    auto walkableShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(20.0, 0.01, 20.0)).get());
+    auto walkableFaceObject = std::make_shared<AIObject>("walkableFace", Transform<float>(Point3<float>(0.0, 0.0, 0.0)), false, walkableShape);
+    auto cubeShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(0.5, 0.5, 0.5)).get());
+    auto cubeObject = std::make_shared<AIObject>("cube", Transform<float>(Point3<float>(-15.0, 0.5, -15.0)), true, cubeShape);
+    AIWorld aiWorld;
+    aiWorld.addEntity(walkableFaceObject);
+    aiWorld.addEntity(cubeObject);
+    NavMeshGenerator navMeshGenerator;
+    navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    navMeshGenerator.setTiledMode(true);
+
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    std::vector<unsigned int> polygonIds;
+    for(const auto &polygon : navMesh->getPolygons())
+    {
+        polygonIds.push_back(polygon->getId());
+    }
+
+    cubeObject->updateTransform(Point3<float>(-14.0, 0.5, -15.0), Quaternion<float>());
+
+    navMesh = navMeshGenerator.generate(aiWorld);
+    unsigned int keptPolygonsCount = 0;
+    for(const auto &polygon : navMesh->getPolygons())
+    {
+        if(std::find(polygonIds.begin(), polygonIds.end(), polygon->getId()) != polygonIds.end())
+        {
+            keptPolygonsCount++;
+        }
+    }
+
+    AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 17); //16 tiles of 10x10 and the cube
+    AssertHelper::assertUnsignedInt(keptPolygonsCount, 15); //tile under the cube and cube are regenerated
+    std::size_t tileUnderCubeIndex = navMesh->getCompiledNavMesh()->getTriangle(navMesh->getCompiledNavMesh()->findTriangle(Point3<float>(-18.0, 0.5, -18.0))).polygon;
+    std::size_t neighborTileIndex = navMesh->getCompiledNavMesh()->getTriangle(navMesh->getCompiledNavMesh()->findTriangle(Point3<float>(-5.0, 0.5, -15.0))).polygon;
+    AssertHelper::assertTrue(countPolygonLinks(*navMesh, navMesh->getPolygons()[neighborTileIndex], navMesh->getPolygons()[tileUnderCubeIndex]) > 0);
+    AssertHelper::assertTrue(countPolygonLinks(*navMesh, navMesh->getPolygons()[tileUnderCubeIndex], navMesh->getPolygons()[neighborTileIndex]) > 0);
+}
+
+void NavMeshGeneratorTest::parallelGeneration()
+{
+    AIWorld sequentialAIWorld;
+    addObjectsGrid(sequentialAIWorld);
+    NavMeshGenerator sequentialNavMeshGenerator;
+    sequentialNavMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    AIWorld parallelAIWorld;
+    addObjectsGrid(parallelAIWorld);
+    ThreadPool threadPool(4);
+    NavMeshGenerator parallelNavMeshGenerator;
+    parallelNavMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    parallelNavMeshGenerator.setThreadPool(&threadPool);
+
+    std::shared_ptr<const NavMesh> sequentialNavMesh = sequentialNavMeshGenerator.generate(sequentialAIWorld);
+    std::shared_ptr<const NavMesh> parallelNavMesh = parallelNavMeshGenerator.generate(parallelAIWorld);
+
+    NavMeshTestHelper::assertSameNavMesh(*parallelNavMesh, *sequentialNavMesh);
+}
+
+void NavMeshGeneratorTest::multipleAgents()
+{
+    AIWorld aiWorld;
+    std::shared_ptr<AIObject> holeObject = NavMeshTestHelper::addWalkableFaceAndHole(aiWorld);
+    AIWorld singleAgentAIWorld;
+    NavMeshTestHelper::addWalkableFaceAndHole(singleAgentAIWorld);
+    std::shared_ptr<NavMeshAgent> smallAgent = buildNavMeshAgent();
+    auto largeAgent = std::make_shared<NavMeshAgent>(2.0, 0.4);
+    NavMeshGenerator navMeshGenerator;
+    navMeshGenerator.setNavMeshAgent(smallAgent);
+    navMeshGenerator.addNavMeshAgent(largeAgent);
+    NavMeshGenerator singleAgentNavMeshGenerator;
+    singleAgentNavMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+
+    std::shared_ptr<const NavMesh> smallAgentNavMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> largeAgentNavMesh = navMeshGenerator.getLastGeneratedNavMesh(largeAgent);
+    std::shared_ptr<const NavMesh> singleAgentNavMesh = singleAgentNavMeshGenerator.generate(singleAgentAIWorld);
+
+    AssertHelper::assertTrue(navMeshGenerator.getLastGeneratedNavMesh(smallAgent) == smallAgentNavMesh);
+    NavMeshTestHelper::assertSameNavMesh(*smallAgentNavMesh, *singleAgentNavMesh);
+    AssertHelper::assertUnsignedInt(largeAgentNavMesh->getPolygons().size(), 2);
+    AssertHelper::assertTrue(largeAgentNavMesh->getPolygons()[0]->getName()=="<walkableFace[2]> - <hole>");
+    float smallAgentHoleHalfSize = computeHoleHalfSize(*smallAgentNavMesh->getPolygons()[0]);
+    float largeAgentHoleHalfSize = computeHoleHalfSize(*largeAgentNavMesh->getPolygons()[0]);
+    AssertHelper::assertTrue(largeAgentHoleHalfSize > smallAgentHoleHalfSize); //hole footprint is expanded by the agent radius
+
+    holeObject->updateTransform(Point3<float>(0.5, 1.0, 0.0), Quaternion<float>());
+    std::shared_ptr<const NavMesh> movedSmallAgentNavMesh = navMeshGenerator.generate(aiWorld);
+    std::shared_ptr<const NavMesh> movedLargeAgentNavMesh = navMeshGenerator.getLastGeneratedNavMesh(largeAgent);
+
+    AssertHelper::assertTrue(movedSmallAgentNavMesh->getUpdateId() != smallAgentNavMesh->getUpdateId());
+    AssertHelper::assertTrue(movedLargeAgentNavMesh->getUpdateId() != largeAgentNavMesh->getUpdateId());
+    AssertHelper::assertUnsignedInt(movedLargeAgentNavMesh->getPolygons().size(), 2);
+    AssertHelper::assertTrue(movedLargeAgentNavMesh->getPolygons()[0]->getName()=="<walkableFace[2]> - <hole>");
+}
+
+/**
+ * Add a walkable face with a grid of cubes on it
+ */
+void NavMeshGeneratorTest::addObjectsGrid(AIWorld &aiWorld)
+{
+    auto walkableShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(10.0, 0.01, 10.0)).get());
+    aiWorld.addEntity(std::make_shared<AIObject>("walkableFace", Transform<float>(Point3<float>(0.0, 0.0, 0.0)), true, walkableShape));
+
+    auto cubeShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(0.5, 0.5, 0.5)).get());
+    for(int x=0; x<4; ++x)
+    {
+        for(int z=0; z<4; ++z)
+        {
+            Point3<float> cubePosition(-6.0f + 4.0f * (float)x, 0.5f, -6.0f + 4.0f * (float)z);
+            aiWorld.addEntity(std::make_shared<AIObject>("cube" + std::to_string(x) + std::to_string(z), Transform<float>(cubePosition), false, cubeShape));
+        }
+    }
 }
 
-unsigned int NavMeshGeneratorTest::countPolygonLinks(const std::shared_ptr<NavPolygon> &sourcePolygon, const std::shared_ptr<NavPolygon> &targetPolygon)
+unsigned int NavMeshGeneratorTest::countPolygonLinks(const NavMesh &navMesh, const std::shared_ptr<NavPolygon> &sourcePolygon, const std::shared_ptr<NavPolygon> &targetPolygon)
 {
+    auto itSourcePolygon = std::find(navMesh.getPolygons().begin(), navMesh.getPolygons().end(), sourcePolygon);
+    auto sourcePolygonIndex = static_cast<std::size_t>(std::distance(navMesh.getPolygons().begin(), itSourcePolygon));
+
     unsigned int countLinks = 0;
     for(const auto &triangle : sourcePolygon->getTriangles())
     {
-        for(const auto &link : triangle->getLinks())
+        for(const auto &link : navMesh.getTriangleLinks(sourcePolygonIndex, triangle->getPolygonTriangleIndex()))
         {
             if(link->getTargetTriangle()->getNavPolygon() == targetPolygon)
             {
@@ -230,6 +345,19 @@ unsigned int NavMeshGeneratorTest::countPolygonLinks(const std::shared_ptr<NavPo
     return countLinks;
 }
 
+/**
+ * @return Half size of the square hole centered on (0, 0) in the polygon
+ */
+float NavMeshGeneratorTest::computeHoleHalfSize(const NavPolygon &navPolygon)
+{
+    float holeHalfSize = std::numeric_limits<float>::max();
+    for(const auto &point : navPolygon.getPoints())
+    {
+        holeHalfSize = std::min(holeHalfSize, std::max(std::abs(point.X), std::abs(point.Z)));
+    }
+    return holeHalfSize;
+}
+
 std::shared_ptr<NavMeshAgent> NavMeshGeneratorTest::buildNavMeshAgent()
 {
     NavMeshAgent navMeshAgent(2.0, 0.2);
@@ -251,5 +379,10 @@ CppUnit::Test *NavMeshGeneratorTest::suite()
 
     suite->addTest(new CppUnit::TestCaller<NavMeshGeneratorTest>("linksRecreatedAfterMove", &NavMeshGeneratorTest::linksRecreatedAfterMove));
 
+    suite->addTest(new CppUnit::TestCaller<NavMeshGeneratorTest>("onlyTouchedTilesRegenerated", &NavMeshGeneratorTest::onlyTouchedTilesRegenerated));
+
+    suite->addTest(new CppUnit::TestCaller<NavMeshGeneratorTest>("parallelGeneration", &NavMeshGeneratorTest::parallelGeneration));
+    suite->addTest(new CppUnit::TestCaller<NavMeshGeneratorTest>("multipleAgents", &NavMeshGeneratorTest::multipleAgents));
+
     return suite;
 }
@@ -22,8 +22,15 @@ class NavMeshGeneratorTest : public CppUnit::TestFixture
 
         void linksRecreatedAfterMove();
 
+        void onlyTouchedTilesRegenerated();
+
+        void parallelGeneration();
+        void multipleAgents();
+
     private:
-        unsigned int countPolygonLinks(const std::shared_ptr<urchin::NavPolygon> &sourcePolygon, const std::shared_ptr<urchin::NavPolygon> &targetPolygon);
+        void addObjectsGrid(urchin::AIWorld &);
+        unsigned int countPolygonLinks(const urchin::NavMesh &, const std::shared_ptr<urchin::NavPolygon> &sourcePolygon, const std::shared_ptr<urchin::NavPolygon> &targetPolygon);
+        float computeHoleHalfSize(const urchin::NavPolygon &);
         std::shared_ptr<urchin::NavMeshAgent> buildNavMeshAgent();
 };
 
@@ -0,0 +1,144 @@
+#include "AssertHelper.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
+using namespace urchin;
+
+/**
+ * Add two walkable faces and a hole
+ * @param holeXPosition X position of the hole: 0 for the left walkable face, 5 for the right walkable face
+ * @return Hole object
+ */
+std::shared_ptr<AIObject> NavMeshTestHelper::addWalkableFacesAndHole(AIWorld &aiWorld, float holeXPosition)
+{
+    auto walkableShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(2.0, 0.01, 2.0)).get());
+    aiWorld.addEntity(std::make_shared<AIObject>("walkableFaceLeft", Transform<float>(Point3<float>(0.0, 0.0, 0.0)), false, walkableShape));
+    aiWorld.addEntity(std::make_shared<AIObject>("walkableFaceRight", Transform<float>(Point3<float>(5.0, 0.0, 0.0)), false, walkableShape));
+
+    auto holeShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(1.0, 0.01, 1.0)).get());
+    auto holeObject = std::make_shared<AIObject>("hole", Transform<float>(Point3<float>(holeXPosition, 1.0, 0.0)), true, holeShape);
+    aiWorld.addEntity(holeObject);
+
+    return holeObject;
+}
+
+/**
+ * Add a walkable face with a hole at its center
+ * @return Hole object
+ */
+std::shared_ptr<AIObject> NavMeshTestHelper::addWalkableFaceAndHole(AIWorld &aiWorld)
+{
+    auto walkableShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(2.0, 0.01, 2.0)).get());
+    aiWorld.addEntity(std::make_shared<AIObject>("walkableFace", Transform<float>(Point3<float>(0.0, 0.0, 0.0)), true, walkableShape));
+
+    auto holeShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(1.0, 0.01, 1.0)).get());
+    auto holeObject = std::make_shared<AIObject>("hole", Transform<float>(Point3<float>(0.0, 1.0, 0.0)), true, holeShape);
+    aiWorld.addEntity(holeObject);
+
+    return holeObject;
+}
+
+/**
+ * @param minPoint Point of the square having the minimum X and Z coordinates
+ * @return Square polygon on XZ plane composed of triangle (a, b, d) and triangle (b, c, d)
+ */
+std::shared_ptr<NavPolygon> NavMeshTestHelper::buildSquarePolygon(const std::string &name, const Point3<float> &minPoint, float size)
+{
+    std::vector<Point3<float>> polygonPoints = {minPoint, minPoint.translate(Vector3<float>(0.0f, 0.0f, size)),
+            minPoint.translate(Vector3<float>(size, 0.0f, size)), minPoint.translate(Vector3<float>(size, 0.0f, 0.0f))};
+    auto navPolygon = std::make_shared<NavPolygon>(name, std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+
+    navTriangle1->addStandardLink(1, navTriangle2);
+    navTriangle2->addStandardLink(2, navTriangle1);
+    return navPolygon;
+}
+
+/**
+ * @param obstacleSquares Squares of the grid not walkable (index: x * squaresBySide + z). Empty when all squares are walkable.
+ * @return Navigation mesh of one polygon composed of squares (two triangles by square) on XZ plane
+ */
+std::shared_ptr<NavMesh> NavMeshTestHelper::buildGridNavMesh(unsigned int squaresBySide, const std::vector<bool> &obstacleSquares)
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({buildGridPolygon(squaresBySide, obstacleSquares)}, {});
+    return navMesh;
+}
+
+/**
+ * @param obstacleSquares Squares of the grid not walkable (index: x * squaresBySide + z). Empty when all squares are walkable.
+ * @return Polygon composed of squares (two triangles by square) on XZ plane. Obstacle squares have no link.
+ */
+std::shared_ptr<NavPolygon> NavMeshTestHelper::buildGridPolygon(unsigned int squaresBySide, const std::vector<bool> &obstacleSquares)
+{
+    auto pointIndex = [squaresBySide](std::size_t x, std::size_t z) {return x * (squaresBySide + 1) + z;};
+    auto squareIndex = [squaresBySide](std::size_t x, std::size_t z) {return x * squaresBySide + z;};
+    auto isObstacle = [&](std::size_t x, std::size_t z) {return !obstacleSquares.empty() && obstacleSquares[squareIndex(x, z)];};
+
+    std::vector<Point3<float>> polygonPoints;
+    for(unsigned int x=0; x<=squaresBySide; ++x)
+    {
+        for(unsigned int z=0; z<=squaresBySide; ++z)
+        {
+            polygonPoints.emplace_back(Point3<float>((float)x, 0.0f, (float)z));
+        }
+    }
+    auto navPolygon = std::make_shared<NavPolygon>("gridPolygon", std::move(polygonPoints), nullptr);
+
+    std::vector<std::shared_ptr<NavTriangle>> triangles; //for each square: triangle (a, b, d) then triangle (b, c, d)
+    for(unsigned int x=0; x<squaresBySide; ++x)
+    {
+        for(unsigned int z=0; z<squaresBySide; ++z)
+        {
+            triangles.push_back(std::make_shared<NavTriangle>(pointIndex(x, z), pointIndex(x, z + 1), pointIndex(x + 1, z)));
+            triangles.push_back(std::make_shared<NavTriangle>(pointIndex(x, z + 1), pointIndex(x + 1, z + 1), pointIndex(x + 1, z)));
+        }
+    }
+    navPolygon->addTriangles(triangles, navPolygon);
+
+    auto squareTriangle = [&](std::size_t x, std::size_t z, std::size_t triangleIndex) {return triangles[squareIndex(x, z) * 2 + triangleIndex];};
+    for(unsigned int x=0; x<squaresBySide; ++x)
+    {
+        for(unsigned int z=0; z<squaresBySide; ++z)
+        {
+            if(isObstacle(x, z))
+            {
+                continue;
+            }
+
+            squareTriangle(x, z, 0)->addStandardLink(1, squareTriangle(x, z, 1));
+            squareTriangle(x, z, 1)->addStandardLink(2, squareTriangle(x, z, 0));
+            if(x > 0 && !isObstacle(x - 1, z))
+            {
+                squareTriangle(x, z, 0)->addStandardLink(0, squareTriangle(x - 1, z, 1));
+                squareTriangle(x - 1, z, 1)->addStandardLink(1, squareTriangle(x, z, 0));
+            }
+            if(z > 0 && !isObstacle(x, z - 1))
+            {
+                squareTriangle(x, z, 0)->addStandardLink(2, squareTriangle(x, z - 1, 1));
+                squareTriangle(x, z - 1, 1)->addStandardLink(0, squareTriangle(x, z, 0));
+            }
+        }
+    }
+    return navPolygon;
+}
+
+/**
+ * Assert the navigation meshes have the same polygons: same names, points and number of triangles
+ */
+void NavMeshTestHelper::assertSameNavMesh(const NavMesh &navMesh, const NavMesh &expectedNavMesh)
+{
+    AssertHelper::assertUnsignedInt(navMesh.getPolygons().size(), expectedNavMesh.getPolygons().size());
+    for(std::size_t i=0; i<expectedNavMesh.getPolygons().size(); ++i)
+    {
+        const std::shared_ptr<NavPolygon> &polygon = navMesh.getPolygons()[i];
+        const std::shared_ptr<NavPolygon> &expectedPolygon = expectedNavMesh.getPolygons()[i];
+        AssertHelper::assertString(polygon->getName(), expectedPolygon->getName());
+        AssertHelper::assertUnsignedInt(polygon->getPoints().size(), expectedPolygon->getPoints().size());
+        for(std::size_t j=0; j<expectedPolygon->getPoints().size(); ++j)
+        {
+            AssertHelper::assertPoint3FloatEquals(polygon->getPoints()[j], expectedPolygon->getPoints()[j]);
+        }
+        AssertHelper::assertUnsignedInt(polygon->getTriangles().size(), expectedPolygon->getTriangles().size());
+    }
+}
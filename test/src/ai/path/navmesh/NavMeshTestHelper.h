@@ -0,0 +1,27 @@
+#ifndef URCHINENGINE_NAVMESHTESTHELPER_H
+#define URCHINENGINE_NAVMESHTESTHELPER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "UrchinAIEngine.h"
+
+class NavMeshTestHelper
+{
+    public:
+        static std::shared_ptr<urchin::AIObject> addWalkableFacesAndHole(urchin::AIWorld &, float);
+        static std::shared_ptr<urchin::AIObject> addWalkableFaceAndHole(urchin::AIWorld &);
+
+        static std::shared_ptr<urchin::NavPolygon> buildSquarePolygon(const std::string &, const urchin::Point3<float> &, float);
+        static std::shared_ptr<urchin::NavMesh> buildGridNavMesh(unsigned int, const std::vector<bool> &);
+        static std::shared_ptr<urchin::NavPolygon> buildGridPolygon(unsigned int, const std::vector<bool> &);
+
+        static void assertSameNavMesh(const urchin::NavMesh &, const urchin::NavMesh &);
+
+    private:
+        NavMeshTestHelper() = default;
+        ~NavMeshTestHelper() = default;
+};
+
+#endif
@@ -0,0 +1,164 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+#include "UrchinCommon.h"
+
+#include "BakedNavMeshTest.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void BakedNavMeshTest::tearDown()
+{
+    for(const auto &bakedFilename : bakedFilenames)
+    {
+        std::filesystem::remove(bakedFilename);
+    }
+    bakedFilenames.clear();
+}
+
+void BakedNavMeshTest::restoreBakedNavMesh()
+{
+    std::string bakedFilename = computeBakedFilename("restoreBakedNavMesh.navmesh");
+    AIWorld bakeAIWorld;
+    NavMeshTestHelper::addWalkableFacesAndHole(bakeAIWorld, 0.0f);
+    NavMeshGenerator bakeNavMeshGenerator;
+    bakeNavMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    bakeNavMeshGenerator.bake(bakeAIWorld, bakedFilename);
+    std::shared_ptr<const NavMesh> bakeNavMesh = bakeNavMeshGenerator.getLastGeneratedNavMesh();
+
+    AIWorld aiWorld;
+    std::shared_ptr<AIObject> holeObject = NavMeshTestHelper::addWalkableFacesAndHole(aiWorld, 0.0f);
+    NavMeshGenerator navMeshGenerator;
+    navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    navMeshGenerator.setBakedNavMesh(std::make_shared<BakedNavMesh>(bakedFilename));
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+
+    NavMeshTestHelper::assertSameNavMesh(*navMesh, *bakeNavMesh);
+    for(std::size_t i=0; i<bakeNavMesh->getPolygons().size(); ++i)
+    {
+        AssertHelper::assertUnsignedInt(countLinks(*navMesh, i), countLinks(*bakeNavMesh, i));
+    }
+
+    holeObject->updateTransform(Point3<float>(5.0, 1.0, 0.0), Quaternion<float>()); //generation continues from the baked navigation mesh
+    navMesh = navMeshGenerator.generate(aiWorld);
+
+    AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 3);
+    AssertHelper::assertString(navMesh->getPolygons()[0]->getName(), "<walkableFaceLeft[2]>");
+    AssertHelper::assertString(navMesh->getPolygons()[1]->getName(), "<walkableFaceRight[2]> - <hole>");
+    AssertHelper::assertString(navMesh->getPolygons()[2]->getName(), "<hole[2]>");
+    AssertHelper::assertTrue(countLinks(*navMesh, 0) > 0);
+}
+
+void BakedNavMeshTest::ignoreBakedNavMeshOfChangedWorld()
+{
+    std::string bakedFilename = computeBakedFilename("ignoreBakedNavMeshOfChangedWorld.navmesh");
+    AIWorld bakeAIWorld;
+    NavMeshTestHelper::addWalkableFacesAndHole(bakeAIWorld, 0.0f);
+    NavMeshGenerator bakeNavMeshGenerator;
+    bakeNavMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    bakeNavMeshGenerator.bake(bakeAIWorld, bakedFilename);
+
+    AIWorld aiWorld;
+    NavMeshTestHelper::addWalkableFacesAndHole(aiWorld, 5.0f);
+    NavMeshGenerator navMeshGenerator;
+    navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    navMeshGenerator.setBakedNavMesh(std::make_shared<BakedNavMesh>(bakedFilename));
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+
+    AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 3);
+    AssertHelper::assertString(navMesh->getPolygons()[0]->getName(), "<walkableFaceLeft[2]>");
+    AssertHelper::assertString(navMesh->getPolygons()[1]->getName(), "<walkableFaceRight[2]> - <hole>");
+    AssertHelper::assertString(navMesh->getPolygons()[2]->getName(), "<hole[2]>");
+}
+
+void BakedNavMeshTest::ignoreUnknownWalkableSurface()
+{
+    AIWorld otherAIWorld;
+    auto walkableShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(2.0, 0.01, 2.0)).get());
+    otherAIWorld.addEntity(std::make_shared<AIObject>("otherWalkableFace", Transform<float>(Point3<float>(0.0, 0.0, 0.0)), false, walkableShape));
+    NavMeshGenerator otherNavMeshGenerator;
+    otherNavMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    std::shared_ptr<const NavMesh> otherNavMesh = otherNavMeshGenerator.generate(otherAIWorld);
+
+    AIWorld aiWorld;
+    NavMeshTestHelper::addWalkableFacesAndHole(aiWorld, 5.0f);
+    NavMeshGenerator navMeshGenerator;
+    navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    std::string bakedFilename = computeBakedFilename("ignoreUnknownWalkableSurface.navmesh");
+    NavMeshBakeService navMeshBakeService; //baked file with the key of the AI world but walkable surfaces of another world
+    navMeshBakeService.writeBakedNavMesh(bakedFilename, navMeshBakeService.computeWorldKey(aiWorld.getEntities(), *navMeshGenerator.getNavMeshAgent(),
+            navMeshGenerator.isTiledMode()), *otherNavMesh);
+    navMeshGenerator.setBakedNavMesh(std::make_shared<BakedNavMesh>(bakedFilename));
+    std::shared_ptr<const NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+
+    AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 3);
+    AssertHelper::assertString(navMesh->getPolygons()[0]->getName(), "<walkableFaceLeft[2]>");
+    AssertHelper::assertString(navMesh->getPolygons()[1]->getName(), "<walkableFaceRight[2]> - <hole>");
+    AssertHelper::assertString(navMesh->getPolygons()[2]->getName(), "<hole[2]>");
+}
+
+void BakedNavMeshTest::rejectCorruptedFile()
+{
+    std::string bakedFilename = computeBakedFilename("rejectCorruptedFile.navmesh");
+    AIWorld bakeAIWorld;
+    NavMeshTestHelper::addWalkableFacesAndHole(bakeAIWorld, 0.0f);
+    NavMeshGenerator bakeNavMeshGenerator;
+    bakeNavMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    bakeNavMeshGenerator.bake(bakeAIWorld, bakedFilename);
+
+    std::fstream bakedFile(bakedFilename, std::ios::in | std::ios::out | std::ios::binary);
+    bakedFile.seekp(sizeof(BakedNavMeshHeader)); //content of the first polygon
+    bakedFile.put(0x7F);
+    bakedFile.close();
+
+    try
+    {
+        BakedNavMesh bakedNavMesh(bakedFilename);
+        AssertHelper::assertTrue(false, "Corrupted baked navigation mesh must be rejected");
+    }catch(const std::runtime_error &)
+    {
+        //expected
+    }
+}
+
+/**
+ * @return Filename in the temporary directory. The file is removed at the end of the test.
+ */
+std::string BakedNavMeshTest::computeBakedFilename(const std::string &filename)
+{
+    bakedFilenames.push_back((std::filesystem::temp_directory_path() / filename).string());
+    return bakedFilenames.back();
+}
+
+unsigned int BakedNavMeshTest::countLinks(const NavMesh &navMesh, std::size_t polygonIndex)
+{
+    unsigned int countLinks = 0;
+    for(std::size_t triangleIndex=0; triangleIndex<navMesh.getPolygons()[polygonIndex]->getTriangles().size(); ++triangleIndex)
+    {
+        countLinks += static_cast<unsigned int>(navMesh.getTriangleLinks(polygonIndex, triangleIndex).size());
+    }
+    return countLinks;
+}
+
+std::shared_ptr<NavMeshAgent> BakedNavMeshTest::buildNavMeshAgent()
+{
+    NavMeshAgent navMeshAgent(2.0, 0.2);
+    navMeshAgent.setJumpDistance(1.5);
+    return std::make_shared<NavMeshAgent>(navMeshAgent);
+}
+
+CppUnit::Test *BakedNavMeshTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("BakedNavMeshTest");
+
+    suite->addTest(new CppUnit::TestCaller<BakedNavMeshTest>("restoreBakedNavMesh", &BakedNavMeshTest::restoreBakedNavMesh));
+    suite->addTest(new CppUnit::TestCaller<BakedNavMeshTest>("ignoreBakedNavMeshOfChangedWorld", &BakedNavMeshTest::ignoreBakedNavMeshOfChangedWorld));
+    suite->addTest(new CppUnit::TestCaller<BakedNavMeshTest>("ignoreUnknownWalkableSurface", &BakedNavMeshTest::ignoreUnknownWalkableSurface));
+    suite->addTest(new CppUnit::TestCaller<BakedNavMeshTest>("rejectCorruptedFile", &BakedNavMeshTest::rejectCorruptedFile));
+
+    return suite;
+}
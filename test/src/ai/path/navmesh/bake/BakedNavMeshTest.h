@@ -0,0 +1,31 @@
+#ifndef URCHINENGINE_BAKEDNAVMESHTEST_H
+#define URCHINENGINE_BAKEDNAVMESHTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "UrchinAIEngine.h"
+
+class BakedNavMeshTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+        void tearDown() override;
+
+        void restoreBakedNavMesh();
+        void ignoreBakedNavMeshOfChangedWorld();
+        void ignoreUnknownWalkableSurface();
+        void rejectCorruptedFile();
+
+    private:
+        std::string computeBakedFilename(const std::string &);
+        unsigned int countLinks(const urchin::NavMesh &, std::size_t);
+        std::shared_ptr<urchin::NavMeshAgent> buildNavMeshAgent();
+
+        std::vector<std::string> bakedFilenames;
+};
+
+#endif
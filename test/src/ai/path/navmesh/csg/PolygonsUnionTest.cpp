@@ -395,6 +395,46 @@ void PolygonsUnionTest::twoPolygonsUnionAndSeparatePolygon()
                                                                            Point2<float>(1.0, 3.0), Point2<float>(1.4, 1.4), Point2<float>(3.0, 1.0)});
 }
 
+void PolygonsUnionTest::chainOfSquaresUnion()
+{
+    std::vector<CSGPolygon<float>> allPolygons;
+    for(unsigned int i = 0; i < 10; ++i)
+    { //squares shuffled: square 'i' overlaps squares 'i-1' and 'i+1' of the chain
+        auto x = (float)((i * 7) % 10);
+        std::vector<Point2<float>> polyPoints = {Point2<float>(x, 0.0), Point2<float>(x, 1.0), Point2<float>(x + 1.5f, 1.0), Point2<float>(x + 1.5f, 0.0)};
+        allPolygons.emplace_back(CSGPolygon<float>("p" + std::to_string(i), std::move(polyPoints)));
+    }
+    std::vector<Point2<float>> separatePolyPoints = {Point2<float>(0.0, 2.0), Point2<float>(0.0, 3.0), Point2<float>(1.0, 3.0), Point2<float>(1.0, 2.0)};
+    allPolygons.insert(allPolygons.begin(), CSGPolygon<float>("separate", std::move(separatePolyPoints)));
+
+    std::vector<CSGPolygon<float>> polygonUnion = PolygonsUnion<float>::instance()->unionPolygons(allPolygons);
+
+    AssertHelper::assertUnsignedInt(polygonUnion.size(), 2);
+    AssertHelper::assertTrue(polygonUnion[0].getName() == "separate");
+    AssertHelper::assertPolygonFloatEquals(polygonUnion[0].getCwPoints(), {Point2<float>(0.0, 2.0), Point2<float>(0.0, 3.0), Point2<float>(1.0, 3.0),
+                                                                           Point2<float>(1.0, 2.0)});
+    AssertHelper::assertTrue(polygonUnion[1].getName().find("{p0} ∪ {p1}") == 0);
+    AssertHelper::assertFloatEquals(polygonUnion[1].computeArea(), 10.5f);
+}
+
+void PolygonsUnionTest::polygonInsideUnionHole()
+{
+    std::vector<Point2<float>> polyPoints1 = {Point2<float>(0.0, 0.0), Point2<float>(0.0, 1.0), Point2<float>(3.0, 1.0), Point2<float>(3.0, 0.0)};
+    std::vector<Point2<float>> polyPoints2 = {Point2<float>(0.0, 2.0), Point2<float>(0.0, 3.0), Point2<float>(3.0, 3.0), Point2<float>(3.0, 2.0)};
+    std::vector<Point2<float>> polyPoints3 = {Point2<float>(0.0, 0.0), Point2<float>(0.0, 3.0), Point2<float>(1.0, 3.0), Point2<float>(1.0, 0.0)};
+    std::vector<Point2<float>> polyPoints4 = {Point2<float>(2.0, 0.0), Point2<float>(2.0, 3.0), Point2<float>(3.0, 3.0), Point2<float>(3.0, 0.0)};
+    std::vector<Point2<float>> polyPoints5 = {Point2<float>(1.25, 1.25), Point2<float>(1.25, 1.75), Point2<float>(1.75, 1.75), Point2<float>(1.75, 1.25)};
+
+    std::vector<CSGPolygon<float>> allPolygons = {CSGPolygon<float>("p1", std::move(polyPoints1)), CSGPolygon<float>("p2", std::move(polyPoints2)),
+                                                  CSGPolygon<float>("p3", std::move(polyPoints3)), CSGPolygon<float>("p4", std::move(polyPoints4)),
+                                                  CSGPolygon<float>("p5", std::move(polyPoints5))};
+    std::vector<CSGPolygon<float>> polygonUnion = PolygonsUnion<float>::instance()->unionPolygons(allPolygons);
+
+    AssertHelper::assertUnsignedInt(polygonUnion.size(), 1);
+    AssertHelper::assertTrue(polygonUnion[0].getName() == "{p1} ∪ {p2} ∪ {p3} ∪ {p4} ∪ {p5}");
+    AssertHelper::assertFloatEquals(polygonUnion[0].computeArea(), 9.0f);
+}
+
 CppUnit::Test *PolygonsUnionTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("PolygonsUnionTest");
@@ -430,6 +470,8 @@ CppUnit::Test *PolygonsUnionTest::suite()
 
     suite->addTest(new CppUnit::TestCaller<PolygonsUnionTest>("threePolygonsUnion", &PolygonsUnionTest::threePolygonsUnion));
     suite->addTest(new CppUnit::TestCaller<PolygonsUnionTest>("twoPolygonsUnionAndSeparatePolygon", &PolygonsUnionTest::twoPolygonsUnionAndSeparatePolygon));
+    suite->addTest(new CppUnit::TestCaller<PolygonsUnionTest>("chainOfSquaresUnion", &PolygonsUnionTest::chainOfSquaresUnion));
+    suite->addTest(new CppUnit::TestCaller<PolygonsUnionTest>("polygonInsideUnionHole", &PolygonsUnionTest::polygonInsideUnionHole));
 
     return suite;
 }
@@ -40,6 +40,8 @@ class PolygonsUnionTest : public CppUnit::TestFixture
 
         void threePolygonsUnion();
         void twoPolygonsUnionAndSeparatePolygon();
+        void chainOfSquaresUnion();
+        void polygonInsideUnionHole();
 };
 
 #endif
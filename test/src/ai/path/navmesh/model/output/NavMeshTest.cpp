@@ -0,0 +1,127 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinCommon.h"
+
+#include "NavMeshTest.h"
+#include "AssertHelper.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
+using namespace urchin;
+
+void NavMeshTest::findTriangleOnLevels()
+{
+    std::shared_ptr<NavMesh> navMesh = buildTwoLevelsNavMesh();
+    const CompiledNavMesh &compiledNavMesh = *navMesh->getCompiledNavMesh();
+
+    std::uint32_t upperTriangle = compiledNavMesh.findTriangle(Point3<float>(2.0f, 3.0f, 2.5f));
+    std::uint32_t groundTriangle = compiledNavMesh.findTriangle(Point3<float>(2.0f, 1.0f, 2.5f));
+
+    AssertHelper::assertUnsignedInt(compiledNavMesh.getTrianglesCount(), 4);
+    AssertHelper::assertUnsignedInt(compiledNavMesh.getTriangle(upperTriangle).polygon, 1);
+    AssertHelper::assertUnsignedInt(compiledNavMesh.getTriangle(groundTriangle).polygon, 0);
+    AssertHelper::assertUnsignedInt(compiledNavMesh.findTriangle(Point3<float>(2.0f, -1.0f, 2.5f)), CompiledNavMesh::NO_INDEX);
+    AssertHelper::assertUnsignedInt(compiledNavMesh.findTriangle(Point3<float>(5.0f, 1.0f, 2.5f)), CompiledNavMesh::NO_INDEX);
+}
+
+void NavMeshTest::findNearestTriangle()
+{
+    std::shared_ptr<NavMesh> navMesh = buildTwoLevelsNavMesh();
+    const CompiledNavMesh &compiledNavMesh = *navMesh->getCompiledNavMesh();
+
+    std::uint32_t insideTriangle = compiledNavMesh.findNearestTriangle(Point3<float>(2.0f, 3.0f, 2.5f), 1.0f);
+    std::uint32_t outsideTriangle = compiledNavMesh.findNearestTriangle(Point3<float>(5.0f, 1.0f, 2.5f), 1.5f);
+
+    AssertHelper::assertUnsignedInt(compiledNavMesh.getTriangle(insideTriangle).polygon, 1);
+    AssertHelper::assertUnsignedInt(compiledNavMesh.getTriangle(outsideTriangle).polygon, 0);
+    AssertHelper::assertUnsignedInt(compiledNavMesh.findNearestTriangle(Point3<float>(5.0f, 1.0f, 2.5f), 0.5f), CompiledNavMesh::NO_INDEX);
+}
+
+void NavMeshTest::compiledLinks()
+{
+    std::shared_ptr<NavMesh> navMesh = buildTwoLevelsNavMesh();
+    std::shared_ptr<const CompiledNavMesh> compiledNavMesh = navMesh->getCompiledNavMesh();
+
+    const CompiledNavPolygon &upperPolygon = compiledNavMesh->getPolygon(compiledNavMesh->findPolygon(navMesh->getPolygons()[1]->getId()));
+    const CompiledNavTriangle &upperTriangle = compiledNavMesh->getTriangle(upperPolygon.firstTriangle);
+    const CompiledNavLink &link = compiledNavMesh->getLink(upperTriangle.firstLink);
+    LineSegment3D<float> linkEdge = compiledNavMesh->computeLinkSourceEdge(upperPolygon.firstTriangle, link);
+
+    AssertHelper::assertUnsignedInt(upperPolygon.trianglesCount, 2);
+    AssertHelper::assertUnsignedInt(upperTriangle.linksCount, 1);
+    AssertHelper::assertUnsignedInt(link.targetTriangle, upperPolygon.firstTriangle + 1);
+    AssertHelper::assertPoint3FloatEquals(linkEdge.getA(), Point3<float>(1.0f, 2.0f, 3.0f));
+    AssertHelper::assertPoint3FloatEquals(linkEdge.getB(), Point3<float>(3.0f, 2.0f, 1.0f));
+
+    navMesh->copyAllPolygons({NavMeshTestHelper::buildSquarePolygon("ground", Point3<float>(0.0f, 0.0f, 0.0f), 4.0f)}, {});
+    AssertHelper::assertUnsignedInt(navMesh->getCompiledNavMesh()->getTrianglesCount(), 2);
+    AssertHelper::assertUnsignedInt(compiledNavMesh->getTrianglesCount(), 4); //previous compiled navigation mesh unchanged
+}
+
+void NavMeshTest::sharedUnchangedPolygons()
+{
+    std::shared_ptr<NavPolygon> groundPolygon = NavMeshTestHelper::buildSquarePolygon("ground", Point3<float>(0.0f, 0.0f, 0.0f), 4.0f);
+    std::shared_ptr<NavPolygon> upperPolygon = NavMeshTestHelper::buildSquarePolygon("upper", Point3<float>(1.0f, 2.0f, 1.0f), 2.0f);
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({groundPolygon, upperPolygon}, {});
+
+    auto newNavMesh = std::make_shared<NavMesh>(*navMesh);
+    newNavMesh->copyAllPolygons({groundPolygon, NavMeshTestHelper::buildSquarePolygon("newUpper", Point3<float>(1.0f, 2.5f, 1.0f), 2.0f)}, {upperPolygon->getId()});
+
+    AssertHelper::assertUnsignedInt(navMesh->getLastCopiedPolygonsCount(), 2);
+    AssertHelper::assertUnsignedInt(newNavMesh->getLastCopiedPolygonsCount(), 1);
+    AssertHelper::assertTrue(newNavMesh->getPolygons()[0] == navMesh->getPolygons()[0]);
+    AssertHelper::assertTrue(&newNavMesh->getTriangleLinks(0, 0) == &navMesh->getTriangleLinks(0, 0));
+    AssertHelper::assertTrue(newNavMesh->getTriangleLinks(1, 0)[0]->getTargetTriangle() == newNavMesh->getPolygons()[1]->getTriangle(1));
+    AssertHelper::assertString(navMesh->getPolygons()[1]->getName(), "upper"); //previous version unchanged
+    AssertHelper::assertString(newNavMesh->getPolygons()[1]->getName(), "newUpper");
+}
+
+void NavMeshTest::compileChangedPolygons()
+{
+    std::shared_ptr<NavPolygon> gridPolygon = NavMeshTestHelper::buildGridPolygon(20, {});
+    std::shared_ptr<NavPolygon> upperPolygon = NavMeshTestHelper::buildSquarePolygon("upper", Point3<float>(1.0f, 2.0f, 1.0f), 2.0f);
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({gridPolygon, upperPolygon}, {});
+    std::shared_ptr<const CompiledNavMesh> compiledNavMesh = navMesh->getCompiledNavMesh();
+
+    std::shared_ptr<NavPolygon> newUpperPolygon = NavMeshTestHelper::buildSquarePolygon("newUpper", Point3<float>(1.0f, 2.5f, 1.0f), 2.0f);
+    navMesh->copyAllPolygons({gridPolygon, newUpperPolygon}, {upperPolygon->getId()});
+    std::shared_ptr<const CompiledNavMesh> newCompiledNavMesh = navMesh->getCompiledNavMesh();
+
+    AssertHelper::assertUnsignedInt(newCompiledNavMesh->getLastCompiledPolygonsCount(), 1);
+    AssertHelper::assertUnsignedInt(newCompiledNavMesh->findPolygon(gridPolygon->getId()), compiledNavMesh->findPolygon(gridPolygon->getId()));
+    AssertHelper::assertTrue(&newCompiledNavMesh->getTriangle(0) == &compiledNavMesh->getTriangle(0)); //untouched polygon data reused
+    AssertHelper::assertTrue(&newCompiledNavMesh->getLink(0) == &compiledNavMesh->getLink(0));
+    AssertHelper::assertTrue(&newCompiledNavMesh->getVertex(0) == &compiledNavMesh->getVertex(0));
+    AssertHelper::assertUnsignedInt(newCompiledNavMesh->getPolygon(compiledNavMesh->findPolygon(upperPolygon->getId())).id, CompiledNavMesh::REMOVED_POLYGON_ID);
+
+    std::uint32_t upperTriangle = compiledNavMesh->findTriangle(Point3<float>(2.0f, 3.0f, 2.5f));
+    std::uint32_t newUpperTriangle = newCompiledNavMesh->findTriangle(Point3<float>(2.0f, 3.0f, 2.5f));
+    std::uint32_t groundTriangle = newCompiledNavMesh->findTriangle(Point3<float>(2.0f, 1.0f, 2.5f));
+    AssertHelper::assertUnsignedInt(compiledNavMesh->getPolygon(compiledNavMesh->getTriangle(upperTriangle).polygon).id, upperPolygon->getId()); //previous compiled navigation mesh unchanged
+    AssertHelper::assertUnsignedInt(newCompiledNavMesh->getPolygon(newCompiledNavMesh->getTriangle(newUpperTriangle).polygon).id, newUpperPolygon->getId());
+    AssertHelper::assertUnsignedInt(newCompiledNavMesh->getPolygon(newCompiledNavMesh->getTriangle(groundTriangle).polygon).id, gridPolygon->getId());
+
+    const CompiledNavPolygon &newUpperCompiledPolygon = newCompiledNavMesh->getPolygon(newCompiledNavMesh->findPolygon(newUpperPolygon->getId()));
+    const CompiledNavTriangle &newUpperFirstTriangle = newCompiledNavMesh->getTriangle(newUpperCompiledPolygon.firstTriangle);
+    AssertHelper::assertUnsignedInt(newCompiledNavMesh->getLink(newUpperFirstTriangle.firstLink).targetTriangle, newUpperCompiledPolygon.firstTriangle + 1);
+}
+
+std::shared_ptr<NavMesh> NavMeshTest::buildTwoLevelsNavMesh()
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({NavMeshTestHelper::buildSquarePolygon("ground", Point3<float>(0.0f, 0.0f, 0.0f), 4.0f), NavMeshTestHelper::buildSquarePolygon("upper", Point3<float>(1.0f, 2.0f, 1.0f), 2.0f)}, {});
+    return navMesh;
+}
+
+CppUnit::Test *NavMeshTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("NavMeshTest");
+
+    suite->addTest(new CppUnit::TestCaller<NavMeshTest>("findTriangleOnLevels", &NavMeshTest::findTriangleOnLevels));
+    suite->addTest(new CppUnit::TestCaller<NavMeshTest>("findNearestTriangle", &NavMeshTest::findNearestTriangle));
+    suite->addTest(new CppUnit::TestCaller<NavMeshTest>("compiledLinks", &NavMeshTest::compiledLinks));
+    suite->addTest(new CppUnit::TestCaller<NavMeshTest>("sharedUnchangedPolygons", &NavMeshTest::sharedUnchangedPolygons));
+    suite->addTest(new CppUnit::TestCaller<NavMeshTest>("compileChangedPolygons", &NavMeshTest::compileChangedPolygons));
+
+    return suite;
+}
@@ -0,0 +1,23 @@
+#ifndef URCHINENGINE_NAVMESHTEST_H
+#define URCHINENGINE_NAVMESHTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinAIEngine.h"
+
+class NavMeshTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void findTriangleOnLevels();
+        void findNearestTriangle();
+        void compiledLinks();
+        void sharedUnchangedPolygons();
+        void compileChangedPolygons();
+
+    private:
+        std::shared_ptr<urchin::NavMesh> buildTwoLevelsNavMesh();
+};
+
+#endif
@@ -16,7 +16,7 @@ void TerrainObstacleServiceTest::oneSquare()
     };
     TerrainObstacleService terrainObstacleService("terrain", Point3<float>(0.0, 0.0, 0.0), localVertices, 3, 3);
 
-    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01);
+    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01, 0.0);
 
     AssertHelper::assertUnsignedInt(selfObstacles.size(), 1);
     AssertHelper::assertTrue(selfObstacles[0].getName()=="terrain_obstacle0");
@@ -36,7 +36,7 @@ void TerrainObstacleServiceTest::twoAlignedSquares()
     };
     TerrainObstacleService terrainObstacleService("terrain", Point3<float>(0.0, 0.0, 0.0), localVertices, 3, 3);
 
-    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01);
+    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01, 0.0);
 
     AssertHelper::assertUnsignedInt(selfObstacles.size(), 1);
     AssertHelper::assertTrue(selfObstacles[0].getName()=="terrain_obstacle0");
@@ -56,7 +56,7 @@ void TerrainObstacleServiceTest::twoSquaresSamePoint()
     };
     TerrainObstacleService terrainObstacleService("terrain", Point3<float>(0.0, 0.0, 0.0), localVertices, 3, 3);
 
-    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01);
+    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01, 0.0);
 
     AssertHelper::assertUnsignedInt(selfObstacles.size(), 2);
     AssertHelper::assertTrue(selfObstacles[0].getName()=="terrain_obstacle0");
@@ -82,7 +82,7 @@ void TerrainObstacleServiceTest::squaresInUForm()
     };
     TerrainObstacleService terrainObstacleService("terrain", Point3<float>(0.0, 0.0, 0.0), localVertices, 4, 3);
 
-    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01);
+    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01, 0.0);
 
     AssertHelper::assertUnsignedInt(selfObstacles.size(), 1);
     AssertHelper::assertTrue(selfObstacles[0].getName()=="terrain_obstacle0");
@@ -97,6 +97,39 @@ void TerrainObstacleServiceTest::squaresInUForm()
     AssertHelper::assertPoint2FloatEquals(selfObstacles[0].getCwPoints()[7], Point2<float>(0.0f, -2.0f));
 }
 
+void TerrainObstacleServiceTest::diagonalSquaresSimplified()
+{
+    std::vector<Point3<float>> localVertices;
+    for(unsigned int z = 0; z < 6; ++z)
+    {
+        for(unsigned int x = 0; x < 6; ++x)
+        { //diagonal points raised: inaccessible squares form a staircase
+            localVertices.emplace_back(Point3<float>((float)x, (x == z) ? 100.0f : 0.0f, (float)z));
+        }
+    }
+    TerrainObstacleService terrainObstacleService("terrain", Point3<float>(0.0, 0.0, 0.0), localVertices, 6, 6);
+
+    std::vector<CSGPolygon<float>> selfObstacles = terrainObstacleService.computeSelfObstacles(0.01, 0.0);
+    std::vector<CSGPolygon<float>> simplifiedSelfObstacles = terrainObstacleService.computeSelfObstacles(0.01, 0.75);
+
+    AssertHelper::assertUnsignedInt(selfObstacles.size(), 1);
+    AssertHelper::assertUnsignedInt(simplifiedSelfObstacles.size(), 1);
+    AssertHelper::assertTrue(simplifiedSelfObstacles[0].getName()=="terrain_obstacle0");
+    AssertHelper::assertUnsignedInt(selfObstacles[0].getCwPoints().size(), 16);
+    AssertHelper::assertUnsignedInt(simplifiedSelfObstacles[0].getCwPoints().size(), 6);
+    const std::vector<Point2<float>> &simplifiedCwPoints = simplifiedSelfObstacles[0].getCwPoints();
+    for(const auto &point : selfObstacles[0].getCwPoints())
+    { //simplified polygon remains close to the original outline
+        float minSquareDistance = std::numeric_limits<float>::max();
+        for(std::size_t i = 0; i < simplifiedCwPoints.size(); ++i)
+        {
+            LineSegment2D<float> edge(simplifiedCwPoints[i], simplifiedCwPoints[(i + 1) % simplifiedCwPoints.size()]);
+            minSquareDistance = std::min(minSquareDistance, edge.squareDistance(point));
+        }
+        AssertHelper::assertTrue(minSquareDistance <= 0.75f * 0.75f);
+    }
+}
+
 CppUnit::Test *TerrainObstacleServiceTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("TerrainObstacleServiceTest");
@@ -105,6 +138,7 @@ CppUnit::Test *TerrainObstacleServiceTest::suite()
     suite->addTest(new CppUnit::TestCaller<TerrainObstacleServiceTest>("twoAlignedSquares", &TerrainObstacleServiceTest::twoAlignedSquares));
     suite->addTest(new CppUnit::TestCaller<TerrainObstacleServiceTest>("twoSquaresSamePoint", &TerrainObstacleServiceTest::twoSquaresSamePoint));
     suite->addTest(new CppUnit::TestCaller<TerrainObstacleServiceTest>("squaresInUForm", &TerrainObstacleServiceTest::squaresInUForm));
+    suite->addTest(new CppUnit::TestCaller<TerrainObstacleServiceTest>("diagonalSquaresSimplified", &TerrainObstacleServiceTest::diagonalSquaresSimplified));
 
     return suite;
 }
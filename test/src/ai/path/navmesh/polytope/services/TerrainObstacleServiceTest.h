@@ -13,6 +13,7 @@ class TerrainObstacleServiceTest : public CppUnit::TestFixture
         void twoAlignedSquares();
         void twoSquaresSamePoint();
         void squaresInUForm();
+        void diagonalSquaresSimplified();
 };
 
 #endif
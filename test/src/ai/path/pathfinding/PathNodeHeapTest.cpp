@@ -0,0 +1,59 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinCommon.h"
+
+#include "PathNodeHeapTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void PathNodeHeapTest::popSmallestFScore()
+{
+    std::vector<float> gScores = {5.0f, 1.0f, 4.0f, 2.0f, 3.0f};
+    std::vector<PathNode> pathNodes(gScores.size());
+    PathNodeHeap pathNodeHeap(pathNodes);
+    pathNodeHeap.clear(pathNodes.size());
+    for(std::size_t i=0; i<gScores.size(); ++i)
+    {
+        pathNodes[i].setGScore(gScores[i]);
+        pathNodeHeap.push(i);
+    }
+
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 1);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 3);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 4);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 2);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 0);
+    AssertHelper::assertTrue(pathNodeHeap.isEmpty());
+}
+
+void PathNodeHeapTest::decreaseKey()
+{
+    std::vector<PathNode> pathNodes(4);
+    PathNodeHeap pathNodeHeap(pathNodes);
+    pathNodeHeap.clear(pathNodes.size());
+    for(std::size_t i=0; i<pathNodes.size(); ++i)
+    {
+        pathNodes[i].setGScore(10.0f + (float)i);
+        pathNodeHeap.push(i);
+    }
+
+    pathNodes[3].setGScore(1.0f);
+    pathNodeHeap.decreaseKey(3);
+    pathNodes[2].setGScore(5.0f);
+    pathNodeHeap.decreaseKey(2);
+
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 3);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 2);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 0);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 1);
+}
+
+CppUnit::Test *PathNodeHeapTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PathNodeHeapTest");
+
+    suite->addTest(new CppUnit::TestCaller<PathNodeHeapTest>("popSmallestFScore", &PathNodeHeapTest::popSmallestFScore));
+    suite->addTest(new CppUnit::TestCaller<PathNodeHeapTest>("decreaseKey", &PathNodeHeapTest::decreaseKey));
+
+    return suite;
+}
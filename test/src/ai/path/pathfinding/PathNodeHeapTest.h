@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_PATHNODEHEAPTEST_H
+#define URCHINENGINE_PATHNODEHEAPTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinAIEngine.h"
+
+class PathNodeHeapTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void popSmallestFScore();
+        void decreaseKey();
+};
+
+#endif
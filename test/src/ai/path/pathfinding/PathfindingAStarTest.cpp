@@ -4,6 +4,7 @@
 
 #include "PathfindingAStarTest.h"
 #include "AssertHelper.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
 using namespace urchin;
 
 void PathfindingAStarTest::straightPath()
@@ -16,7 +17,7 @@ void PathfindingAStarTest::straightPath()
 
     navTriangle1->addStandardLink(1, navTriangle2);
     auto navMesh = std::make_shared<NavMesh>();
-    navMesh->copyAllPolygons({navPolygon});
+    navMesh->copyAllPolygons({navPolygon}, {});
     PathfindingAStar pathfindingAStar(navMesh);
 
     std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(Point3<float>(1.0f, 0.0f, 1.0f), Point3<float>(3.0f, 0.0f, 3.0f));
@@ -42,7 +43,7 @@ void PathfindingAStarTest::joinPolygonsPath()
 
     navPolygon1Triangle1->addJoinPolygonsLink(2, navPolygon2Triangle1, new NavLinkConstraint(0.25f, 0.0f, 2));
     auto navMesh = std::make_shared<NavMesh>();
-    navMesh->copyAllPolygons({navPolygon1, navPolygon2});
+    navMesh->copyAllPolygons({navPolygon1, navPolygon2}, {});
     PathfindingAStar pathfindingAStar(navMesh);
 
     std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(Point3<float>(3.0f, 0.0f, 0.5f), Point3<float>(0.0f, 0.0f, -2.0f));
@@ -86,6 +87,52 @@ void PathfindingAStarTest::jumpWithBigConstraint()
     AssertHelper::assertTrue(!pathPoints[3].isJumpPoint());
 }
 
+void PathfindingAStarTest::gridPathSearchesReuse()
+{
+    std::shared_ptr<NavMesh> navMesh = NavMeshTestHelper::buildGridNavMesh(20, {});
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(Point3<float>(0.5f, 0.0f, 0.5f), Point3<float>(19.5f, 0.0f, 19.5f));
+    std::vector<PathPoint> reversePathPoints = pathfindingAStar.findPath(Point3<float>(19.5f, 0.0f, 19.5f), Point3<float>(0.5f, 0.0f, 0.5f));
+    std::vector<PathPoint> samePathPoints = pathfindingAStar.findPath(Point3<float>(0.5f, 0.0f, 0.5f), Point3<float>(19.5f, 0.0f, 19.5f));
+    std::vector<PathPoint> newSearchReversePathPoints = PathfindingAStar(navMesh).findPath(Point3<float>(19.5f, 0.0f, 19.5f), Point3<float>(0.5f, 0.0f, 0.5f));
+
+    AssertHelper::assertUnsignedInt(navMesh->getCompiledNavMesh()->getTrianglesCount(), 800);
+    AssertHelper::assertUnsignedInt(pathPoints.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints[0].getPoint(), Point3<float>(0.5f, 0.0f, 0.5f));
+    AssertHelper::assertPoint3FloatEquals(pathPoints[1].getPoint(), Point3<float>(19.5f, 0.0f, 19.5f));
+    AssertHelper::assertUnsignedInt(reversePathPoints.size(), newSearchReversePathPoints.size());
+    for(std::size_t i=0; i<reversePathPoints.size(); ++i)
+    { //nodes of previous search don't impact the next search
+        AssertHelper::assertPoint3FloatEquals(reversePathPoints[i].getPoint(), newSearchReversePathPoints[i].getPoint());
+    }
+    AssertHelper::assertPoint3FloatEquals(reversePathPoints.back().getPoint(), Point3<float>(0.5f, 0.0f, 0.5f));
+    AssertHelper::assertUnsignedInt(samePathPoints.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(samePathPoints[1].getPoint(), Point3<float>(19.5f, 0.0f, 19.5f));
+}
+
+void PathfindingAStarTest::incrementalGScorePathLength()
+{
+    std::shared_ptr<NavMesh> navMesh = NavMeshTestHelper::buildGridNavMesh(10, {});
+    PathfindingAStar pathfindingAStar(navMesh);
+    PathfindingAStar exactGScorePathfindingAStar(navMesh);
+    exactGScorePathfindingAStar.setExactGScore(true);
+
+    std::vector<std::pair<Point3<float>, Point3<float>>> startEndPoints = {
+            {Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f)},
+            {Point3<float>(0.5f, 0.0f, 9.5f), Point3<float>(9.5f, 0.0f, 0.5f)},
+            {Point3<float>(0.1f, 0.0f, 4.3f), Point3<float>(9.9f, 0.0f, 6.1f)}};
+    for(const auto &startEndPoint : startEndPoints)
+    {
+        float pathLength = computePathLength(pathfindingAStar.findPath(startEndPoint.first, startEndPoint.second));
+        float exactGScorePathLength = computePathLength(exactGScorePathfindingAStar.findPath(startEndPoint.first, startEndPoint.second));
+
+        AssertHelper::assertTrue(exactGScorePathLength > 0.0f);
+        AssertHelper::assertTrue(pathLength <= exactGScorePathLength * 1.1f, "Path with incremental G score too long: " + std::to_string(pathLength)
+                + ", exact G score: " + std::to_string(exactGScorePathLength));
+    }
+}
+
 std::vector<PathPoint> PathfindingAStarTest::pathWithJump(NavLinkConstraint *navLinkConstraint)
 {
     std::vector<Point3<float>> polygon1Points = {Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 0.0f)};
@@ -100,12 +147,94 @@ std::vector<PathPoint> PathfindingAStarTest::pathWithJump(NavLinkConstraint *nav
 
     navPolygon1Triangle1->addJumpLink(1, navPolygon2Triangle1, navLinkConstraint);
     auto navMesh = std::make_shared<NavMesh>();
-    navMesh->copyAllPolygons({navPolygon1, navPolygon2});
+    navMesh->copyAllPolygons({navPolygon1, navPolygon2}, {});
     PathfindingAStar pathfindingAStar(navMesh);
 
     return pathfindingAStar.findPath(Point3<float>(1.0f, 0.0f, 1.0f), Point3<float>(3.0f, 0.0f, 4.0f));
 }
 
+void PathfindingAStarTest::cachedCorridorReuse()
+{
+    std::shared_ptr<NavMesh> navMesh = NavMeshTestHelper::buildGridNavMesh(10, {});
+    PathCache pathCache(16);
+    PathfindingAStar pathfindingAStar(navMesh);
+    pathfindingAStar.setPathCache(&pathCache);
+
+    std::vector<PathPoint> searchedPath = pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+    std::vector<PathPoint> cachedPath = pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+    std::vector<PathPoint> movedEndPointPath = pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.1f, 0.0f, 9.3f));
+
+    AssertHelper::assertUnsignedInt(pathCache.getMissCount(), 1);
+    AssertHelper::assertUnsignedInt(pathCache.getHitCount(), 2);
+    AssertHelper::assertUnsignedInt(cachedPath.size(), searchedPath.size());
+    for(std::size_t i=0; i<searchedPath.size(); ++i)
+    {
+        AssertHelper::assertPoint3FloatEquals(cachedPath[i].getPoint(), searchedPath[i].getPoint());
+    }
+    AssertHelper::assertPoint3FloatEquals(movedEndPointPath.back().getPoint(), Point3<float>(9.1f, 0.0f, 9.3f));
+}
+
+void PathfindingAStarTest::cachedCorridorInvalidation()
+{
+    std::vector<std::shared_ptr<NavPolygon>> polygons = {NavMeshTestHelper::buildGridPolygon(10, {})};
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons(polygons, {});
+    PathCache pathCache(16);
+    PathfindingAStar pathfindingAStar(navMesh);
+    pathfindingAStar.setPathCache(&pathCache);
+    pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+
+    navMesh->copyAllPolygons(polygons, {}); //no polygon changed
+    pathCache.refresh(*navMesh);
+    std::vector<PathPoint> cachedPath = pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+    AssertHelper::assertUnsignedInt(pathCache.getHitCount(), 1);
+    AssertHelper::assertTrue(!cachedPath.empty());
+
+    navMesh->copyAllPolygons(polygons, {polygons[0]->getId()});
+    pathCache.refresh(*navMesh);
+    AssertHelper::assertUnsignedInt(pathCache.getSize(), 0);
+    AssertHelper::assertUnsignedInt(pathCache.getInvalidationCount(), 1);
+    pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+    AssertHelper::assertUnsignedInt(pathCache.getMissCount(), 2);
+}
+
+void PathfindingAStarTest::cachedCorridorByNavMesh()
+{
+    std::vector<std::shared_ptr<NavPolygon>> polygons = {NavMeshTestHelper::buildGridPolygon(10, {})};
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons(polygons, {});
+    auto otherAgentNavMesh = std::make_shared<NavMesh>(); //navigation mesh of another agent with same polygon identifiers
+    otherAgentNavMesh->copyAllPolygons(polygons, {});
+    PathCache pathCache(16);
+    PathfindingAStar pathfindingAStar(navMesh);
+    pathfindingAStar.setPathCache(&pathCache);
+    PathfindingAStar otherAgentPathfindingAStar(otherAgentNavMesh);
+    otherAgentPathfindingAStar.setPathCache(&pathCache);
+
+    pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+    otherAgentPathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+    pathfindingAStar.findPath(Point3<float>(0.2f, 0.0f, 0.1f), Point3<float>(9.2f, 0.0f, 9.1f));
+
+    AssertHelper::assertTrue(navMesh->getId() != otherAgentNavMesh->getId());
+    AssertHelper::assertUnsignedInt(pathCache.getMissCount(), 2);
+    AssertHelper::assertUnsignedInt(pathCache.getHitCount(), 1);
+    AssertHelper::assertUnsignedInt(pathCache.getSize(), 2);
+
+    otherAgentNavMesh->copyAllPolygons(polygons, {polygons[0]->getId()});
+    pathCache.refresh(*otherAgentNavMesh);
+    AssertHelper::assertUnsignedInt(pathCache.getSize(), 1); //only corridor of the other agent navigation mesh is invalidated
+}
+
+float PathfindingAStarTest::computePathLength(const std::vector<PathPoint> &pathPoints)
+{
+    float pathLength = 0.0f;
+    for(std::size_t i=1; i<pathPoints.size(); ++i)
+    {
+        pathLength += pathPoints[i - 1].getPoint().distance(pathPoints[i].getPoint());
+    }
+    return pathLength;
+}
+
 CppUnit::Test *PathfindingAStarTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("PathfindingAStarTest");
@@ -117,5 +246,12 @@ CppUnit::Test *PathfindingAStarTest::suite()
     suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("jumpWithSmallConstraint", &PathfindingAStarTest::jumpWithSmallConstraint));
     suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("jumpWithBigConstraint", &PathfindingAStarTest::jumpWithBigConstraint));
 
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("gridPathSearchesReuse", &PathfindingAStarTest::gridPathSearchesReuse));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("incrementalGScorePathLength", &PathfindingAStarTest::incrementalGScorePathLength));
+
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("cachedCorridorReuse", &PathfindingAStarTest::cachedCorridorReuse));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("cachedCorridorInvalidation", &PathfindingAStarTest::cachedCorridorInvalidation));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("cachedCorridorByNavMesh", &PathfindingAStarTest::cachedCorridorByNavMesh));
+
     return suite;
 }
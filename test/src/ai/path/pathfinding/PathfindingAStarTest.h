@@ -17,8 +17,16 @@ class PathfindingAStarTest : public CppUnit::TestFixture
         void jumpWithSmallConstraint();
         void jumpWithBigConstraint();
 
+        void gridPathSearchesReuse();
+        void incrementalGScorePathLength();
+
+        void cachedCorridorReuse();
+        void cachedCorridorInvalidation();
+        void cachedCorridorByNavMesh();
+
     private:
         std::vector<urchin::PathPoint> pathWithJump(urchin::NavLinkConstraint *);
+        float computePathLength(const std::vector<urchin::PathPoint> &);
 };
 
 
@@ -0,0 +1,108 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinCommon.h"
+
+#include "PolygonGraphTest.h"
+#include "AssertHelper.h"
+#include "ai/path/navmesh/NavMeshTestHelper.h"
+using namespace urchin;
+
+void PolygonGraphTest::polygonCorridor()
+{
+    std::shared_ptr<NavMesh> navMesh = buildSquaresNavMesh();
+    PolygonGraph polygonGraph;
+    polygonGraph.refresh(*navMesh);
+
+    PolygonCorridorFinder polygonCorridorFinder;
+    std::vector<unsigned int> corridorPolygonIds;
+    const CompiledNavMesh &compiledNavMesh = *navMesh->getCompiledNavMesh();
+    bool corridorFound = polygonCorridorFinder.findCorridor(compiledNavMesh, polygonGraph, compiledNavMesh.findTriangle(Point3<float>(0.2f, 0.0f, 0.3f)),
+            compiledNavMesh.findTriangle(Point3<float>(4.8f, 0.0f, 0.7f)), Point3<float>(4.8f, 0.0f, 0.7f), corridorPolygonIds);
+
+    AssertHelper::assertTrue(corridorFound);
+    AssertHelper::assertUnsignedInt(corridorPolygonIds.size(), 5); //branch polygon excluded
+    for(std::size_t i=0; i<corridorPolygonIds.size(); ++i)
+    {
+        AssertHelper::assertUnsignedInt(corridorPolygonIds[i], navMesh->getPolygons()[i]->getId());
+    }
+}
+
+void PolygonGraphTest::corridorPathSearch()
+{
+    std::shared_ptr<NavMesh> navMesh = buildSquaresNavMesh();
+    PolygonGraph polygonGraph;
+    polygonGraph.refresh(*navMesh);
+    PathfindingAStar hierarchicalPathfinding(navMesh);
+    hierarchicalPathfinding.setPolygonGraph(&polygonGraph);
+    PathfindingAStar pathfinding(navMesh);
+
+    std::vector<PathPoint> hierarchicalPath = hierarchicalPathfinding.findPath(Point3<float>(0.2f, 0.0f, 0.3f), Point3<float>(1.5f, 0.0f, 1.8f));
+    std::vector<PathPoint> path = pathfinding.findPath(Point3<float>(0.2f, 0.0f, 0.3f), Point3<float>(1.5f, 0.0f, 1.8f));
+
+    AssertHelper::assertUnsignedInt(hierarchicalPath.size(), path.size());
+    for(std::size_t i=0; i<path.size(); ++i)
+    {
+        AssertHelper::assertPoint3FloatEquals(hierarchicalPath[i].getPoint(), path[i].getPoint());
+    }
+}
+
+void PolygonGraphTest::incrementalRefresh()
+{
+    std::vector<std::shared_ptr<NavPolygon>> polygons = buildSquarePolygons();
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons(polygons, {});
+    PolygonGraph polygonGraph;
+    polygonGraph.refresh(*navMesh);
+    AssertHelper::assertUnsignedInt(polygonGraph.getLastRefreshComputedClusters(), 6);
+
+    navMesh->copyAllPolygons(polygons, {}); //no polygon changed
+    polygonGraph.refresh(*navMesh);
+    AssertHelper::assertUnsignedInt(polygonGraph.getLastRefreshComputedClusters(), 0);
+
+    navMesh->copyAllPolygons(polygons, {polygons[4]->getId()});
+    polygonGraph.refresh(*navMesh);
+    AssertHelper::assertUnsignedInt(polygonGraph.getLastRefreshComputedClusters(), 1);
+}
+
+std::shared_ptr<NavMesh> PolygonGraphTest::buildSquaresNavMesh()
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons(buildSquarePolygons(), {});
+    return navMesh;
+}
+
+/**
+ * @return Five squares polygons along X axis and one dead end square polygon above the second square
+ */
+std::vector<std::shared_ptr<NavPolygon>> PolygonGraphTest::buildSquarePolygons()
+{
+    std::vector<std::shared_ptr<NavPolygon>> polygons;
+    for(unsigned int i=0; i<5; ++i)
+    {
+        polygons.push_back(NavMeshTestHelper::buildSquarePolygon("square" + std::to_string(i), Point3<float>((float)i, 0.0f, 0.0f), 1.0f));
+        if(i > 0)
+        { //right edge of previous square joins left edge of square
+            joinSquares(polygons[i - 1]->getTriangle(1), 1, polygons[i]->getTriangle(0), 0);
+        }
+    }
+    polygons.push_back(NavMeshTestHelper::buildSquarePolygon("deadEndSquare", Point3<float>(1.0f, 0.0f, 1.0f), 1.0f));
+    joinSquares(polygons[1]->getTriangle(1), 0, polygons[5]->getTriangle(0), 2);
+    return polygons;
+}
+
+void PolygonGraphTest::joinSquares(const std::shared_ptr<NavTriangle> &triangle1, std::size_t edgeIndex1, const std::shared_ptr<NavTriangle> &triangle2, std::size_t edgeIndex2)
+{
+    triangle1->addJoinPolygonsLink(edgeIndex1, triangle2, new NavLinkConstraint(1.0f, 0.0f, edgeIndex2));
+    triangle2->addJoinPolygonsLink(edgeIndex2, triangle1, new NavLinkConstraint(1.0f, 0.0f, edgeIndex1));
+}
+
+CppUnit::Test *PolygonGraphTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PolygonGraphTest");
+
+    suite->addTest(new CppUnit::TestCaller<PolygonGraphTest>("polygonCorridor", &PolygonGraphTest::polygonCorridor));
+    suite->addTest(new CppUnit::TestCaller<PolygonGraphTest>("corridorPathSearch", &PolygonGraphTest::corridorPathSearch));
+    suite->addTest(new CppUnit::TestCaller<PolygonGraphTest>("incrementalRefresh", &PolygonGraphTest::incrementalRefresh));
+
+    return suite;
+}
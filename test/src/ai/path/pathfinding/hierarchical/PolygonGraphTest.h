@@ -0,0 +1,23 @@
+#ifndef URCHINENGINE_POLYGONGRAPHTEST_H
+#define URCHINENGINE_POLYGONGRAPHTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinAIEngine.h"
+
+class PolygonGraphTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void polygonCorridor();
+        void corridorPathSearch();
+        void incrementalRefresh();
+
+    private:
+        std::shared_ptr<urchin::NavMesh> buildSquaresNavMesh();
+        std::vector<std::shared_ptr<urchin::NavPolygon>> buildSquarePolygons();
+        void joinSquares(const std::shared_ptr<urchin::NavTriangle> &, std::size_t, const std::shared_ptr<urchin::NavTriangle> &, std::size_t);
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <stdexcept>
+#include "UrchinCommon.h"
+
+#include "ThreadPoolTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void ThreadPoolTest::parallelForCoverRange()
+{
+    ThreadPool threadPool(3);
+    std::vector<unsigned int> values(1000, 0);
+
+    for(unsigned int run=0; run<10; ++run)
+    {
+        threadPool.parallelFor(values.size(), 16, [&values](std::size_t beginIndex, std::size_t endIndex) {
+            for(std::size_t i=beginIndex; i<endIndex; ++i)
+            {
+                values[i]++;
+            }
+        });
+    }
+
+    AssertHelper::assertUnsignedInt(threadPool.getNumberThreads(), 4);
+    for(unsigned int value : values)
+    {
+        AssertHelper::assertUnsignedInt(value, 10);
+    }
+}
+
+void ThreadPoolTest::parallelForWithoutWorker()
+{
+    ThreadPool threadPool(0);
+    std::size_t numberCalls = 0;
+
+    threadPool.parallelFor(100, 1, [&numberCalls](std::size_t beginIndex, std::size_t endIndex) {
+        AssertHelper::assertUnsignedInt(beginIndex, 0);
+        AssertHelper::assertUnsignedInt(endIndex, 100);
+        numberCalls++;
+    });
+
+    AssertHelper::assertUnsignedInt(numberCalls, 1);
+}
+
+void ThreadPoolTest::parallelForRethrowException()
+{
+    ThreadPool threadPool(2);
+    bool exceptionRethrown = false;
+
+    try
+    {
+        threadPool.parallelFor(100, 1, [](std::size_t beginIndex, std::size_t) {
+            if(beginIndex == 0)
+            {
+                throw std::runtime_error("Task failure");
+            }
+        });
+    }catch(const std::runtime_error &)
+    {
+        exceptionRethrown = true;
+    }
+
+    AssertHelper::assertTrue(exceptionRethrown);
+}
+
+CppUnit::Test *ThreadPoolTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("ThreadPoolTest");
+
+    suite->addTest(new CppUnit::TestCaller<ThreadPoolTest>("parallelForCoverRange", &ThreadPoolTest::parallelForCoverRange));
+    suite->addTest(new CppUnit::TestCaller<ThreadPoolTest>("parallelForWithoutWorker", &ThreadPoolTest::parallelForWithoutWorker));
+    suite->addTest(new CppUnit::TestCaller<ThreadPoolTest>("parallelForRethrowException", &ThreadPoolTest::parallelForRethrowException));
+
+    return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_THREADPOOLTEST_H
+#define URCHINENGINE_THREADPOOLTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class ThreadPoolTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void parallelForCoverRange();
+        void parallelForWithoutWorker();
+        void parallelForRethrowException();
+};
+
+#endif
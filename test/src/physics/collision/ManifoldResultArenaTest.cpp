@@ -0,0 +1,53 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/collision/ManifoldResultArenaTest.h"
+using namespace urchin;
+
+void ManifoldResultArenaTest::pointersValidOnNewChunk()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(), cubeShape);
+    ManifoldResultArena manifoldResultArena(2);
+
+    ManifoldResult *firstManifoldResult = manifoldResultArena.newManifoldResult(bodyA.get(), bodyB.get());
+    firstManifoldResult->addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.0f, 0.5f, 0.0f), -0.1f, false);
+    manifoldResultArena.newManifoldResult(bodyA.get(), bodyB.get());
+    manifoldResultArena.newManifoldResult(bodyB.get(), bodyA.get()); //new chunk
+
+    AssertHelper::assertUnsignedInt(manifoldResultArena.getChunkAllocationCount(), 2);
+    AssertHelper::assertString(firstManifoldResult->getBody1()->getId(), "bodyA");
+    AssertHelper::assertUnsignedInt(firstManifoldResult->getNumContactPoints(), 1);
+}
+
+void ManifoldResultArenaTest::noAllocationAfterClear()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(), cubeShape);
+    ManifoldResultArena manifoldResultArena(4);
+
+    for(unsigned int step=0; step<3; ++step)
+    {
+        manifoldResultArena.clear();
+        for(unsigned int i=0; i<10; ++i)
+        {
+            manifoldResultArena.newManifoldResult(bodyA.get(), bodyB.get());
+        }
+    }
+
+    AssertHelper::assertUnsignedInt(manifoldResultArena.getChunkAllocationCount(), 3);
+}
+
+CppUnit::Test *ManifoldResultArenaTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("ManifoldResultArenaTest");
+
+    suite->addTest(new CppUnit::TestCaller<ManifoldResultArenaTest>("pointersValidOnNewChunk", &ManifoldResultArenaTest::pointersValidOnNewChunk));
+    suite->addTest(new CppUnit::TestCaller<ManifoldResultArenaTest>("noAllocationAfterClear", &ManifoldResultArenaTest::noAllocationAfterClear));
+
+    return suite;
+}
@@ -0,0 +1,16 @@
+#ifndef URCHINENGINE_MANIFOLDRESULTARENATEST_H
+#define URCHINENGINE_MANIFOLDRESULTARENATEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class ManifoldResultArenaTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void pointersValidOnNewChunk();
+        void noAllocationAfterClear();
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/collision/ManifoldResultTest.h"
+using namespace urchin;
+
+void ManifoldResultTest::keepAccumulatedImpulses()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.5f, 0.0f)), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(0.0f, -0.5f, 0.0f)), cubeShape);
+    ManifoldResult manifoldResult(bodyA.get(), bodyB.get());
+
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.5f, 0.0f, 0.5f), -0.01f, false);
+    manifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accNormalImpulse = 2.0f;
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.501f, 0.0f, 0.5f), -0.012f, false); //same contact in next step
+
+    AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 1);
+    AssertHelper::assertFloatEquals(manifoldResult.getManifoldContactPoint(0).getDepth(), -0.012f);
+    AssertHelper::assertFloatEquals(manifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accNormalImpulse, 2.0f);
+}
+
+void ManifoldResultTest::resetAccumulatedImpulsesOnNormalChange()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.5f, 0.0f)), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(0.0f, -0.5f, 0.0f)), cubeShape);
+    ManifoldResult manifoldResult(bodyA.get(), bodyB.get());
+
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.5f, 0.0f, 0.5f), -0.01f, false);
+    manifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accNormalImpulse = 2.0f;
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 0.7071f, 0.7071f), Point3<float>(0.5f, 0.0f, 0.5f), -0.01f, false); //other triangle normal
+
+    AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 1);
+    AssertHelper::assertFloatEquals(manifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accNormalImpulse, 0.0f);
+}
+
+void ManifoldResultTest::reduceToFourPoints()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.5f, 0.0f)), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(0.0f, -0.5f, 0.0f)), cubeShape);
+    ManifoldResult manifoldResult(bodyA.get(), bodyB.get());
+
+    //contact points coming from several triangles of a terrain
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.1f, 0.0f, 0.1f), -0.015f, false);
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(-0.5f, 0.0f, -0.5f), -0.01f, false);
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.5f, 0.0f, -0.5f), -0.01f, false);
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.0f, 0.0f, 0.0f), -0.01f, false);
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.5f, 0.0f, 0.5f), -0.01f, false);
+    manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(-0.5f, 0.0f, 0.5f), -0.01f, false);
+
+    AssertHelper::assertUnsignedInt(manifoldResult.getNumContactPoints(), 4);
+    bool hasDeepestPoint = false;
+    for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
+    {
+        hasDeepestPoint = hasDeepestPoint || manifoldResult.getManifoldContactPoint(i).getDepth() < -0.014f;
+    }
+    AssertHelper::assertTrue(hasDeepestPoint, "Deepest point must be kept");
+}
+
+CppUnit::Test *ManifoldResultTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("ManifoldResultTest");
+
+    suite->addTest(new CppUnit::TestCaller<ManifoldResultTest>("keepAccumulatedImpulses", &ManifoldResultTest::keepAccumulatedImpulses));
+    suite->addTest(new CppUnit::TestCaller<ManifoldResultTest>("resetAccumulatedImpulsesOnNormalChange", &ManifoldResultTest::resetAccumulatedImpulsesOnNormalChange));
+    suite->addTest(new CppUnit::TestCaller<ManifoldResultTest>("reduceToFourPoints", &ManifoldResultTest::reduceToFourPoints));
+
+    return suite;
+}
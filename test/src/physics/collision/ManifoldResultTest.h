@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_MANIFOLDRESULTTEST_H
+#define URCHINENGINE_MANIFOLDRESULTTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class ManifoldResultTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void keepAccumulatedImpulses();
+        void resetAccumulatedImpulsesOnNormalChange();
+        void reduceToFourPoints();
+};
+
+#endif
@@ -0,0 +1,242 @@
+#include <set>
+#include <cmath>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "AssertHelper.h"
+#include "BroadPhaseAlgorithmTest.h"
+using namespace urchin;
+
+void BroadPhaseAlgorithmTest::sweepAndPruneMovingBodies()
+{
+    movingBodies(std::make_unique<SweepAndPruneAlgorithm>());
+}
+
+void BroadPhaseAlgorithmTest::sweepAndPruneAlternativePair()
+{
+    alternativePair(std::make_unique<SweepAndPruneAlgorithm>());
+}
+
+void BroadPhaseAlgorithmTest::sweepAndPruneRayTest()
+{
+    rayTest(std::make_unique<SweepAndPruneAlgorithm>());
+}
+
+void BroadPhaseAlgorithmTest::sweepAndPruneSweepAxis()
+{
+    //bodies spread out along Z axis: Z axis is selected as sweep axis
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<std::unique_ptr<WorkRigidBody>> bodies;
+    for(std::size_t i=0; i<5; ++i)
+    {
+        float positionZ = (i==0) ? 1.0f : 10.0f * (float)i;
+        bodies.push_back(std::make_unique<WorkRigidBody>("body" + std::to_string(i), PhysicsTransform(Point3<float>(0.0f, 0.0f, positionZ), Quaternion<float>()), cubeShape));
+    }
+    auto bodyOrigin = std::make_unique<WorkRigidBody>("bodyOrigin", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    SweepAndPruneAlgorithm sweepAndPruneAlgorithm;
+    sweepAndPruneAlgorithm.addBody(bodyOrigin.get(), nullptr);
+    for(const auto &body : bodies)
+    {
+        sweepAndPruneAlgorithm.addBody(body.get(), nullptr);
+    }
+    sweepAndPruneAlgorithm.updateBodies();
+
+    AssertHelper::assertUnsignedInt(sweepAndPruneAlgorithm.getOverlappingPairs().size(), 1);
+
+    bodies[4]->setIsStatic(false);
+    bodies[4]->setIsActive(true);
+    bodies[4]->setPosition(Point3<float>(0.0f, 0.0f, 20.5f));
+    sweepAndPruneAlgorithm.updateBodies();
+    AssertHelper::assertUnsignedInt(sweepAndPruneAlgorithm.getOverlappingPairs().size(), 2);
+
+    std::vector<AbstractWorkBody *> bodiesHitAABBox = sweepAndPruneAlgorithm.aabboxTest(AABBox<float>(Point3<float>(-1.0f, -1.0f, 19.0f), Point3<float>(1.0f, 1.0f, 22.0f)));
+    AssertHelper::assertUnsignedInt(bodiesHitAABBox.size(), 2);
+    std::vector<AbstractWorkBody *> bodiesHitRay = sweepAndPruneAlgorithm.rayTest(Ray<float>(Point3<float>(0.0f, 0.0f, 5.0f), Point3<float>(0.0f, 0.0f, 15.0f)));
+    AssertHelper::assertUnsignedInt(bodiesHitRay.size(), 1);
+    AssertHelper::assertString(bodiesHitRay[0]->getId(), "body1");
+}
+
+void BroadPhaseAlgorithmTest::sweepAndPruneBodyMovingAmongStaticBodies()
+{
+    //static cubes on a grid: fat AABBoxes (margin: 0.2) of the cubes don't overlap
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<std::unique_ptr<WorkRigidBody>> staticBodies;
+    for(std::size_t i=0; i<100; ++i)
+    {
+        Point3<float> position(3.0f * (float)(i / 10), 0.0f, 3.0f * (float)(i % 10));
+        staticBodies.push_back(std::make_unique<WorkRigidBody>("static" + std::to_string(i), PhysicsTransform(position, Quaternion<float>()), cubeShape));
+    }
+    auto movingBody = std::make_unique<WorkRigidBody>("moving", PhysicsTransform(Point3<float>(-10.0f, 0.5f, -10.0f), Quaternion<float>()), cubeShape);
+    SweepAndPruneAlgorithm sweepAndPruneAlgorithm;
+    for(const auto &staticBody : staticBodies)
+    {
+        sweepAndPruneAlgorithm.addBody(staticBody.get(), nullptr);
+    }
+    sweepAndPruneAlgorithm.addBody(movingBody.get(), nullptr);
+    sweepAndPruneAlgorithm.updateBodies();
+    AssertHelper::assertUnsignedInt(sweepAndPruneAlgorithm.getOverlappingPairs().size(), 0);
+
+    //moving body crosses the grid and comes back: each step moves its fat AABBox (steps greater than the margin) and centers are never
+    //at 1.4 on an axis (overlap limit)
+    movingBody->setIsStatic(false);
+    movingBody->setIsActive(true);
+    for(int step=0; step<80; ++step)
+    {
+        int positionIndex = step < 40 ? step : 79 - step;
+        Point3<float> position(0.25f + 0.5f * (float)positionIndex, 0.5f, 0.15f + 0.4f * (float)positionIndex);
+        movingBody->setPosition(position);
+        sweepAndPruneAlgorithm.updateBodies();
+
+        std::set<std::string> expectedPairBodies; //fat AABBoxes overlap when centers are closer than 1.4 on each axis
+        for(const auto &staticBody : staticBodies)
+        {
+            Vector3<float> distance = staticBody->getPosition().vector(position);
+            if(std::abs(distance.X) < 1.4f && std::abs(distance.Y) < 1.4f && std::abs(distance.Z) < 1.4f)
+            {
+                expectedPairBodies.insert(staticBody->getId());
+            }
+        }
+        std::set<std::string> pairBodies;
+        for(const auto &overlappingPair : sweepAndPruneAlgorithm.getOverlappingPairs())
+        {
+            AssertHelper::assertTrue(overlappingPair->getBody1() == movingBody.get() || overlappingPair->getBody2() == movingBody.get());
+            pairBodies.insert(overlappingPair->getBody1() == movingBody.get() ? overlappingPair->getBody2()->getId() : overlappingPair->getBody1()->getId());
+        }
+        AssertHelper::assertUnsignedInt(sweepAndPruneAlgorithm.getOverlappingPairs().size(), expectedPairBodies.size());
+        AssertHelper::assertTrue(pairBodies == expectedPairBodies);
+    }
+}
+
+void BroadPhaseAlgorithmTest::spatialHashMovingBodies()
+{
+    movingBodies(std::make_unique<SpatialHashAlgorithm>());
+}
+
+void BroadPhaseAlgorithmTest::spatialHashAlternativePair()
+{
+    alternativePair(std::make_unique<SpatialHashAlgorithm>());
+}
+
+void BroadPhaseAlgorithmTest::spatialHashLargeBody()
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::shared_ptr<CollisionBoxShape> groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(100.0f, 0.5f, 100.0f));
+    auto ground = std::make_unique<WorkRigidBody>("ground", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), groundShape);
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(50.0f, 1.0f, 50.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(-50.0f, 5.0f, -50.0f), Quaternion<float>()), cubeShape);
+    SpatialHashAlgorithm spatialHashAlgorithm;
+    spatialHashAlgorithm.addBody(ground.get(), nullptr);
+    spatialHashAlgorithm.addBody(bodyA.get(), nullptr);
+    spatialHashAlgorithm.addBody(bodyB.get(), nullptr);
+    spatialHashAlgorithm.updateBodies();
+
+    AssertHelper::assertUnsignedInt(spatialHashAlgorithm.getOverlappingPairs().size(), 1);
+    AssertHelper::assertUnsignedInt(spatialHashAlgorithm.bodyTest(bodyB.get(), bodyB->getPhysicsTransform(),
+            PhysicsTransform(Point3<float>(-50.0f, 0.0f, -50.0f), Quaternion<float>())).size(), 1);
+
+    spatialHashAlgorithm.removeBody(ground.get());
+    AssertHelper::assertUnsignedInt(spatialHashAlgorithm.getOverlappingPairs().size(), 0);
+}
+
+void BroadPhaseAlgorithmTest::spatialHashRayTest()
+{
+    rayTest(std::make_unique<SpatialHashAlgorithm>());
+}
+
+void BroadPhaseAlgorithmTest::movingBodies(std::unique_ptr<BroadPhaseAlgorithm> broadPhaseAlgorithm)
+{
+    //add bodies test:
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(10.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyC = std::make_unique<WorkRigidBody>("bodyC", PhysicsTransform(Point3<float>(0.0f, 1.0f, 0.0f), Quaternion<float>()), cubeShape);
+    broadPhaseAlgorithm->addBody(bodyA.get(), nullptr);
+    broadPhaseAlgorithm->addBody(bodyB.get(), nullptr);
+    broadPhaseAlgorithm->addBody(bodyC.get(), nullptr);
+    broadPhaseAlgorithm->updateBodies();
+
+    AssertHelper::assertUnsignedInt(broadPhaseAlgorithm->getOverlappingPairs().size(), 1);
+
+    //move body test:
+    bodyB->setIsStatic(false);
+    bodyB->setIsActive(true);
+    bodyB->setPosition(Point3<float>(1.0f, 0.0f, 0.0f));
+    broadPhaseAlgorithm->updateBodies();
+    AssertHelper::assertUnsignedInt(broadPhaseAlgorithm->getOverlappingPairs().size(), 3);
+
+    bodyB->setPosition(Point3<float>(-10.0f, 0.0f, 0.0f));
+    broadPhaseAlgorithm->updateBodies();
+    AssertHelper::assertUnsignedInt(broadPhaseAlgorithm->getOverlappingPairs().size(), 1);
+
+    //remove a body test:
+    broadPhaseAlgorithm->removeBody(bodyC.get());
+    AssertHelper::assertUnsignedInt(broadPhaseAlgorithm->getOverlappingPairs().size(), 0);
+}
+
+void BroadPhaseAlgorithmTest::alternativePair(std::unique_ptr<BroadPhaseAlgorithm> broadPhaseAlgorithm)
+{
+    //add bodies test:
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkGhostBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyC = std::make_unique<WorkGhostBody>("bodyC", PhysicsTransform(Point3<float>(0.0f, 1.0f, 0.0f), Quaternion<float>()), cubeShape);
+    broadPhaseAlgorithm->addBody(bodyA.get(), nullptr);
+    broadPhaseAlgorithm->addBody(bodyB.get(), bodyB->getPairContainer());
+    broadPhaseAlgorithm->addBody(bodyC.get(), bodyC->getPairContainer());
+    broadPhaseAlgorithm->updateBodies();
+
+    AssertHelper::assertUnsignedInt(broadPhaseAlgorithm->getOverlappingPairs().size(), 0);
+    AssertHelper::assertUnsignedInt(bodyB->getPairContainer()->retrieveCopyOverlappingPairs().size(), 2);
+    AssertHelper::assertUnsignedInt(bodyC->getPairContainer()->retrieveCopyOverlappingPairs().size(), 2);
+
+    //remove a body test:
+    broadPhaseAlgorithm->removeBody(bodyB.get());
+    AssertHelper::assertUnsignedInt(bodyB->getPairContainer()->retrieveCopyOverlappingPairs().size(), 0);
+    AssertHelper::assertUnsignedInt(bodyC->getPairContainer()->retrieveCopyOverlappingPairs().size(), 1);
+    broadPhaseAlgorithm->removeBody(bodyA.get());
+    AssertHelper::assertUnsignedInt(bodyC->getPairContainer()->retrieveCopyOverlappingPairs().size(), 0);
+    broadPhaseAlgorithm->removeBody(bodyC.get());
+    AssertHelper::assertUnsignedInt(bodyC->getPairContainer()->retrieveCopyOverlappingPairs().size(), 0);
+}
+
+void BroadPhaseAlgorithmTest::rayTest(std::unique_ptr<BroadPhaseAlgorithm> broadPhaseAlgorithm)
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(5.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyC = std::make_unique<WorkRigidBody>("bodyC", PhysicsTransform(Point3<float>(5.0f, 5.0f, 0.0f), Quaternion<float>()), cubeShape);
+    broadPhaseAlgorithm->addBody(bodyA.get(), nullptr);
+    broadPhaseAlgorithm->addBody(bodyB.get(), nullptr);
+    broadPhaseAlgorithm->addBody(bodyC.get(), nullptr);
+    broadPhaseAlgorithm->updateBodies();
+
+    std::vector<AbstractWorkBody *> bodiesHitRay = broadPhaseAlgorithm->rayTest(Ray<float>(Point3<float>(-3.0f, 0.0f, 0.0f), Point3<float>(3.0f, 0.0f, 0.0f)));
+    AssertHelper::assertUnsignedInt(bodiesHitRay.size(), 1);
+    AssertHelper::assertString(bodiesHitRay[0]->getId(), "bodyA");
+
+    std::vector<AbstractWorkBody *> bodiesHitBody = broadPhaseAlgorithm->bodyTest(bodyA.get(), bodyA->getPhysicsTransform(),
+            PhysicsTransform(Point3<float>(5.0f, 4.0f, 0.0f), Quaternion<float>()));
+    AssertHelper::assertUnsignedInt(bodiesHitBody.size(), 1);
+    AssertHelper::assertString(bodiesHitBody[0]->getId(), "bodyC");
+
+    std::vector<AbstractWorkBody *> bodiesHitAABBox = broadPhaseAlgorithm->aabboxTest(AABBox<float>(Point3<float>(4.0f, -1.0f, -1.0f), Point3<float>(6.0f, 6.0f, 1.0f)));
+    AssertHelper::assertUnsignedInt(bodiesHitAABBox.size(), 2);
+}
+
+CppUnit::Test *BroadPhaseAlgorithmTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("BroadPhaseAlgorithmTest");
+
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("sweepAndPruneMovingBodies", &BroadPhaseAlgorithmTest::sweepAndPruneMovingBodies));
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("sweepAndPruneAlternativePair", &BroadPhaseAlgorithmTest::sweepAndPruneAlternativePair));
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("sweepAndPruneRayTest", &BroadPhaseAlgorithmTest::sweepAndPruneRayTest));
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("sweepAndPruneSweepAxis", &BroadPhaseAlgorithmTest::sweepAndPruneSweepAxis));
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("sweepAndPruneBodyMovingAmongStaticBodies", &BroadPhaseAlgorithmTest::sweepAndPruneBodyMovingAmongStaticBodies));
+
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("spatialHashMovingBodies", &BroadPhaseAlgorithmTest::spatialHashMovingBodies));
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("spatialHashAlternativePair", &BroadPhaseAlgorithmTest::spatialHashAlternativePair));
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("spatialHashLargeBody", &BroadPhaseAlgorithmTest::spatialHashLargeBody));
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseAlgorithmTest>("spatialHashRayTest", &BroadPhaseAlgorithmTest::spatialHashRayTest));
+
+    return suite;
+}
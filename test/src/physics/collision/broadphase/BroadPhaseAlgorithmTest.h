@@ -0,0 +1,31 @@
+#ifndef URCHINENGINE_BROADPHASEALGORITHMTEST_H
+#define URCHINENGINE_BROADPHASEALGORITHMTEST_H
+
+#include <memory>
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinPhysicsEngine.h"
+
+class BroadPhaseAlgorithmTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void sweepAndPruneMovingBodies();
+        void sweepAndPruneAlternativePair();
+        void sweepAndPruneRayTest();
+        void sweepAndPruneSweepAxis();
+        void sweepAndPruneBodyMovingAmongStaticBodies();
+
+        void spatialHashMovingBodies();
+        void spatialHashAlternativePair();
+        void spatialHashLargeBody();
+        void spatialHashRayTest();
+
+    private:
+        void movingBodies(std::unique_ptr<urchin::BroadPhaseAlgorithm>);
+        void alternativePair(std::unique_ptr<urchin::BroadPhaseAlgorithm>);
+        void rayTest(std::unique_ptr<urchin::BroadPhaseAlgorithm>);
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "AssertHelper.h"
+#include "physics/collision/constraintsolver/ConstraintSolverManagerTest.h"
+using namespace urchin;
+
+void ConstraintSolverManagerTest::restingBodyConvergence()
+{
+    BodyManager bodyManager;
+    IslandManager islandManager(&bodyManager);
+    RigidBody *ground = buildCube(bodyManager, "ground", Point3<float>(0.0f, -0.5f, 0.0f));
+    RigidBody *cube = buildCube(bodyManager, "cube", Point3<float>(0.0f, 0.5f, 0.0f));
+    bodyManager.setupWorkBodies();
+    WorkRigidBody *workCube = setupWorkCube(cube, Vector3<float>(0.0f, 0.0f, 0.0f), 1.0f);
+    std::unique_ptr<ManifoldResult> contact = buildContact(workCube, WorkRigidBody::upCast(ground->getWorkBody()), 0.0f);
+    islandManager.updateIslands({contact.get()});
+
+    ConstraintSolverManager constraintSolverManager(&islandManager);
+    constraintSolverManager.solveConstraints(1.0f / 60.0f, {contact.get()});
+
+    AssertHelper::assertUnsignedInt(constraintSolverManager.getConstraintCount(), 4);
+    AssertHelper::assertUnsignedInt(constraintSolverManager.getIterationCount(), 4); //converged: min iterations
+    AssertHelper::assertUnsignedInt(constraintSolverManager.getIslandIterationCount(), 4);
+}
+
+void ConstraintSolverManagerTest::independentIslands()
+{
+    BodyManager bodyManager;
+    IslandManager islandManager(&bodyManager);
+    RigidBody *ground = buildCube(bodyManager, "ground", Point3<float>(0.0f, -0.5f, 0.0f));
+    RigidBody *restingCube = buildCube(bodyManager, "restingCube", Point3<float>(5.0f, 0.5f, 0.0f));
+    RigidBody *stackCube1 = buildCube(bodyManager, "stackCube1", Point3<float>(0.0f, 0.5f, 0.0f));
+    RigidBody *stackCube2 = buildCube(bodyManager, "stackCube2", Point3<float>(0.0f, 1.5f, 0.0f));
+    bodyManager.setupWorkBodies();
+    WorkRigidBody *workGround = WorkRigidBody::upCast(ground->getWorkBody());
+    WorkRigidBody *workRestingCube = setupWorkCube(restingCube, Vector3<float>(0.0f, 0.0f, 0.0f), 0.16f);
+    WorkRigidBody *workStackCube1 = setupWorkCube(stackCube1, Vector3<float>(0.0f, 0.0f, 0.0f), 0.16f);
+    WorkRigidBody *workStackCube2 = setupWorkCube(stackCube2, Vector3<float>(0.2f, -8.0f, 0.1f), 0.16f);
+    std::unique_ptr<ManifoldResult> restingContact = buildContact(workRestingCube, workGround, 0.0f);
+    std::unique_ptr<ManifoldResult> stackContact1 = buildContact(workStackCube1, workGround, -0.01f);
+    std::unique_ptr<ManifoldResult> stackContact2 = buildContact(workStackCube2, workStackCube1, -0.01f);
+    std::vector<ManifoldResult *> manifoldResults = {stackContact1.get(), restingContact.get(), stackContact2.get()};
+    islandManager.updateIslands(manifoldResults);
+
+    ConstraintSolverManager constraintSolverManager(&islandManager);
+    constraintSolverManager.solveConstraints(1.0f / 60.0f, manifoldResults);
+
+    AssertHelper::assertUnsignedInt(constraintSolverManager.getConstraintCount(), 12);
+    AssertHelper::assertTrue(constraintSolverManager.getIterationCount() > 4); //stack island requires more iterations
+    AssertHelper::assertUnsignedInt(constraintSolverManager.getIslandIterationCount(), constraintSolverManager.getIterationCount() + 4);
+    AssertHelper::assertTrue(workStackCube2->getLinearVelocity().Y > -0.5f);
+}
+
+RigidBody *ConstraintSolverManagerTest::buildCube(BodyManager &bodyManager, const std::string &id, const Point3<float> &position) const
+{
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto *cube = new RigidBody(id, Transform<float>(position, Quaternion<float>(), 1.0f), cubeShape);
+    bodyManager.addBody(cube);
+    return cube;
+}
+
+/**
+ * @return Work body of the cube with a mass of 1 and the provided velocity
+ */
+WorkRigidBody *ConstraintSolverManagerTest::setupWorkCube(const RigidBody *cube, const Vector3<float> &velocity, float inertia) const
+{
+    WorkRigidBody *workCube = WorkRigidBody::upCast(cube->getWorkBody());
+    workCube->setMassProperties(1.0f, Vector3<float>(inertia, inertia, inertia));
+    workCube->refreshInvWorldInertia();
+    workCube->setLinearVelocity(velocity);
+    return workCube;
+}
+
+/**
+ * @return Contact of four points on the bottom face of body1
+ */
+std::unique_ptr<ManifoldResult> ConstraintSolverManagerTest::buildContact(WorkRigidBody *body1, WorkRigidBody *body2, float depth) const
+{
+    auto manifoldResult = std::make_unique<ManifoldResult>(body1, body2);
+    Point3<float> bottomCenter = body1->getPosition().translate(Vector3<float>(0.0f, -0.5f, 0.0f));
+    for(const auto &offset : {Vector3<float>(-0.5f, 0.0f, -0.5f), Vector3<float>(0.5f, 0.0f, -0.5f), Vector3<float>(0.5f, 0.0f, 0.5f), Vector3<float>(-0.5f, 0.0f, 0.5f)})
+    {
+        manifoldResult->addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), bottomCenter.translate(offset).translate(Vector3<float>(0.0f, -depth, 0.0f)), depth, false);
+    }
+    return manifoldResult;
+}
+
+CppUnit::Test *ConstraintSolverManagerTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("ConstraintSolverManagerTest");
+
+    suite->addTest(new CppUnit::TestCaller<ConstraintSolverManagerTest>("restingBodyConvergence", &ConstraintSolverManagerTest::restingBodyConvergence));
+    suite->addTest(new CppUnit::TestCaller<ConstraintSolverManagerTest>("independentIslands", &ConstraintSolverManagerTest::independentIslands));
+
+    return suite;
+}
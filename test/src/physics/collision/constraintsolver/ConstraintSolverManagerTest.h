@@ -0,0 +1,23 @@
+#ifndef URCHINENGINE_CONSTRAINTSOLVERMANAGERTEST_H
+#define URCHINENGINE_CONSTRAINTSOLVERMANAGERTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <memory>
+#include "UrchinPhysicsEngine.h"
+
+class ConstraintSolverManagerTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void restingBodyConvergence();
+        void independentIslands();
+
+    private:
+        urchin::RigidBody *buildCube(urchin::BodyManager &, const std::string &, const urchin::Point3<float> &) const;
+        urchin::WorkRigidBody *setupWorkCube(const urchin::RigidBody *, const urchin::Vector3<float> &, float) const;
+        std::unique_ptr<urchin::ManifoldResult> buildContact(urchin::WorkRigidBody *, urchin::WorkRigidBody *, float) const;
+};
+
+#endif
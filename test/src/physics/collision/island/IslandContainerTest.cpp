@@ -12,21 +12,24 @@ using namespace urchin;
 void IslandContainerTest::cascadeMergeIslands()
 {
     TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody(), new TestBody()};
-    std::vector<IslandElement *> bodiesVector(bodies, bodies + (sizeof(bodies) / sizeof(TestBody*)));
-
     IslandContainer islandContainer;
-    islandContainer.reset(bodiesVector);
+    for(auto body : bodies)
+    {
+        islandContainer.addElement(body);
+    }
     islandContainer.mergeIsland(bodies[0], bodies[1]); //body 0 is in contact with body 1
     islandContainer.mergeIsland(bodies[1], bodies[2]); //body 1 is in contact with body 2
     islandContainer.mergeIsland(bodies[2], bodies[3]); //body 2 is in contact with body 3
-    const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveSortedIslandElements();
 
-    AssertHelper::assertUnsignedInt(islandElementsLink.size(), 4);
-    unsigned int islandId = islandElementsLink[0].islandIdRef;
-    for(std::size_t i=1; i<islandElementsLink.size(); ++i)
+    AssertHelper::assertUnsignedInt(islandContainer.getSize(), 4);
+    unsigned int islandId = islandContainer.findIslandId(bodies[0]);
+    for(auto body : bodies)
     {
-        AssertHelper::assertUnsignedInt(islandElementsLink[i].islandIdRef, islandId);
+        AssertHelper::assertUnsignedInt(islandContainer.findIslandId(body), islandId);
     }
+    std::vector<IslandElementLink *> islandElementsLink;
+    islandContainer.retrieveIslandElementsLink(islandId, islandElementsLink);
+    AssertHelper::assertUnsignedInt(islandElementsLink.size(), 4);
 
     delete bodies[0]; delete bodies[1]; delete bodies[2]; delete bodies[3];
 }
@@ -38,20 +41,20 @@ void IslandContainerTest::cascadeMergeIslands()
 void IslandContainerTest::mergeAllIslands()
 {
     TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody()};
-    std::vector<IslandElement *> bodiesVector(bodies, bodies + (sizeof(bodies) / sizeof(TestBody*)));
-
     IslandContainer islandContainer;
-    islandContainer.reset(bodiesVector);
+    for(auto body : bodies)
+    {
+        islandContainer.addElement(body);
+    }
     islandContainer.mergeIsland(bodies[0], bodies[1]); //body 0 is in contact with body 1
     islandContainer.mergeIsland(bodies[0], bodies[2]); //body 0 is in contact with body 2
     islandContainer.mergeIsland(bodies[1], bodies[2]); //body 1 is in contact with body 2
-    const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveSortedIslandElements();
 
-    AssertHelper::assertUnsignedInt(islandElementsLink.size(), 3);
-    unsigned int islandId = islandElementsLink[0].islandIdRef;
-    for(std::size_t i=1; i<islandElementsLink.size(); ++i)
+    AssertHelper::assertUnsignedInt(islandContainer.getSize(), 3);
+    unsigned int islandId = islandContainer.findIslandId(bodies[0]);
+    for(auto body : bodies)
     {
-        AssertHelper::assertUnsignedInt(islandElementsLink[i].islandIdRef, islandId);
+        AssertHelper::assertUnsignedInt(islandContainer.findIslandId(body), islandId);
     }
 
     delete bodies[0]; delete bodies[1]; delete bodies[2];
@@ -64,22 +67,79 @@ void IslandContainerTest::mergeAllIslands()
 void IslandContainerTest::createTwoSeparateIslands()
 {
     TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody(), new TestBody()};
-    std::vector<IslandElement *> bodiesVector(bodies, bodies + (sizeof(bodies) / sizeof(TestBody*)));
-
     IslandContainer islandContainer;
-    islandContainer.reset(bodiesVector);
+    for(auto body : bodies)
+    {
+        islandContainer.addElement(body);
+    }
     islandContainer.mergeIsland(bodies[0], bodies[3]); //body 0 is in contact with body 3
     islandContainer.mergeIsland(bodies[2], bodies[1]); //body 2 is in contact with body 1
-    const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveSortedIslandElements();
 
-    AssertHelper::assertUnsignedInt(islandElementsLink.size(), 4);
-    AssertHelper::assertUnsignedInt(islandElementsLink[0].islandIdRef, islandElementsLink[1].islandIdRef);
-    AssertHelper::assertUnsignedInt(islandElementsLink[2].islandIdRef, islandElementsLink[3].islandIdRef);
-    AssertHelper::assertTrue(islandElementsLink[0].islandIdRef != islandElementsLink[2].islandIdRef);
+    AssertHelper::assertUnsignedInt(islandContainer.getSize(), 4);
+    AssertHelper::assertUnsignedInt(islandContainer.findIslandId(bodies[0]), islandContainer.findIslandId(bodies[3]));
+    AssertHelper::assertUnsignedInt(islandContainer.findIslandId(bodies[1]), islandContainer.findIslandId(bodies[2]));
+    AssertHelper::assertTrue(islandContainer.findIslandId(bodies[0]) != islandContainer.findIslandId(bodies[1]));
 
     delete bodies[0]; delete bodies[1]; delete bodies[2]; delete bodies[3];
 }
 
+/**
+ * Create 3 bodies in contact: body 0 with body 1 and body 1 with body 2. Contact between body 1 and body 2 is broken.
+ * Once the island split and the remaining contacts merged again: body 2 should be alone in its island.
+ */
+void IslandContainerTest::splitIsland()
+{
+    TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody()};
+    IslandContainer islandContainer;
+    for(auto body : bodies)
+    {
+        islandContainer.addElement(body);
+    }
+    islandContainer.mergeIsland(bodies[0], bodies[1]); //body 0 is in contact with body 1
+    islandContainer.mergeIsland(bodies[1], bodies[2]); //body 1 is in contact with body 2
+    AssertHelper::assertTrue(!islandContainer.splitMarkedIslands());
+
+    islandContainer.markIslandToSplit(bodies[2]); //contact between body 1 and body 2 is broken
+    AssertHelper::assertTrue(islandContainer.splitMarkedIslands());
+    islandContainer.mergeIsland(bodies[0], bodies[1]); //body 0 is still in contact with body 1
+
+    AssertHelper::assertUnsignedInt(islandContainer.findIslandId(bodies[0]), islandContainer.findIslandId(bodies[1]));
+    AssertHelper::assertTrue(islandContainer.findIslandId(bodies[0]) != islandContainer.findIslandId(bodies[2]));
+    std::vector<IslandElementLink *> islandElementsLink;
+    islandContainer.retrieveIslandElementsLink(islandContainer.findIslandId(bodies[2]), islandElementsLink);
+    AssertHelper::assertUnsignedInt(islandElementsLink.size(), 1);
+
+    delete bodies[0]; delete bodies[1]; delete bodies[2];
+}
+
+/**
+ * Create 3 bodies in contact and remove the body in the middle. Link of removed body must be reused once the island split.
+ */
+void IslandContainerTest::removeElement()
+{
+    TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody()};
+    IslandContainer islandContainer;
+    for(auto body : bodies)
+    {
+        islandContainer.addElement(body);
+    }
+    islandContainer.mergeIsland(bodies[0], bodies[1]); //body 0 is in contact with body 1
+    islandContainer.mergeIsland(bodies[1], bodies[2]); //body 1 is in contact with body 2
+
+    unsigned int removedElementId = bodies[1]->getIslandElementId();
+    islandContainer.removeElement(bodies[1]);
+    AssertHelper::assertUnsignedInt(islandContainer.getSize(), 2);
+    islandContainer.splitMarkedIslands();
+    AssertHelper::assertTrue(islandContainer.findIslandId(bodies[0]) != islandContainer.findIslandId(bodies[2]));
+
+    auto *newBody = new TestBody();
+    islandContainer.addElement(newBody);
+    AssertHelper::assertUnsignedInt(newBody->getIslandElementId(), removedElementId);
+    AssertHelper::assertUnsignedInt(islandContainer.getSize(), 3);
+
+    delete bodies[0]; delete bodies[1]; delete bodies[2]; delete newBody;
+}
+
 CppUnit::Test *IslandContainerTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("IslandContainerTest");
@@ -87,6 +147,8 @@ CppUnit::Test *IslandContainerTest::suite()
     suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("cascadeMergeIslands", &IslandContainerTest::cascadeMergeIslands));
     suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("mergeAllIslands", &IslandContainerTest::mergeAllIslands));
     suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("createTwoSeparateIslands", &IslandContainerTest::createTwoSeparateIslands));
+    suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("splitIsland", &IslandContainerTest::splitIsland));
+    suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("removeElement", &IslandContainerTest::removeElement));
 
     return suite;
 }
@@ -15,6 +15,8 @@ class IslandContainerTest : public CppUnit::TestFixture
         void cascadeMergeIslands();
         void mergeAllIslands();
         void createTwoSeparateIslands();
+        void splitIsland();
+        void removeElement();
 };
 
 class TestBody : public urchin::IslandElement
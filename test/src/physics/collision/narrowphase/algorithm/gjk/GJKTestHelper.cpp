@@ -4,5 +4,5 @@ using namespace urchin;
 std::shared_ptr<GJKResult<float>> GJKTestHelper::executeGJK(const CollisionConvexObject3D &object1, const CollisionConvexObject3D &object2)
 {
     GJKAlgorithm<float> gjk;
-    return gjk.processGJK(object1, object2, true);
+    return gjk.processGJK(object1, object2, true, nullptr);
 }
@@ -0,0 +1,51 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+
+#include "physics/it/CharacterSystemIT.h"
+#include "AssertHelper.h"
+#include "UrchinPhysicsEngine.h"
+using namespace urchin;
+
+void CharacterSystemIT::charactersFallOnPlane()
+{
+    auto physicsWorld = std::make_unique<PhysicsWorld>();
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    auto *planeBody = new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape);
+    physicsWorld->addBody(planeBody);
+
+    auto characterSystem = std::make_shared<PhysicsCharacterSystem>();
+    physicsWorld->addProcessable(characterSystem);
+    std::vector<std::shared_ptr<PhysicsCharacter>> characters;
+    for(unsigned int i=0; i<40; ++i)
+    {
+        std::shared_ptr<CollisionBoxShape> characterShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+        PhysicsTransform characterTransform(Point3<float>(static_cast<float>(i % 8) * 3.0f, 2.0f, static_cast<float>(i / 8) * 3.0f), Quaternion<float>());
+        characters.push_back(std::make_shared<PhysicsCharacter>("character" + std::to_string(i), 80.0f, characterShape, characterTransform));
+        characterSystem->addCharacterController(std::make_shared<PhysicsCharacterController>(characters.back(), physicsWorld.get()));
+    }
+
+    Vector3<float> gravity(0.0f, -9.81f, 0.0f);
+    for(std::size_t i=0; i<150; ++i)
+    {
+        physicsWorld->getCollisionWorld()->process(1.0f / 60.0f, gravity);
+        characterSystem->execute(1.0f / 60.0f, gravity);
+    }
+
+    for(const auto &character : characters)
+    {
+        AssertHelper::assertFloatEquals(character->getTransform().getPosition().Y, 0.5f, 0.05f);
+    }
+    AssertHelper::assertTrue(characterSystem->getLastUpdateManifoldCount() >= characters.size(), "Characters must be in contact with the plane");
+
+    physicsWorld->removeProcessable(characterSystem);
+}
+
+CppUnit::Test *CharacterSystemIT::suite()
+{
+    auto *suite = new CppUnit::TestSuite("CharacterSystemIT");
+
+    suite->addTest(new CppUnit::TestCaller<CharacterSystemIT>("charactersFallOnPlane", &CharacterSystemIT::charactersFallOnPlane));
+
+    return suite;
+}
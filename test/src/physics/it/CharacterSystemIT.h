@@ -0,0 +1,15 @@
+#ifndef URCHINENGINE_CHARACTERSYSTEMIT_H
+#define URCHINENGINE_CHARACTERSYSTEMIT_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class CharacterSystemIT : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void charactersFallOnPlane();
+};
+
+#endif
@@ -0,0 +1,105 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <sstream>
+
+#include "AssertHelper.h"
+#include "physics/statistics/PhysicsStatisticsTest.h"
+#include "UrchinPhysicsEngine.h"
+using namespace urchin;
+
+void PhysicsStatisticsTest::keepLastSteps()
+{
+    PhysicsStatistics physicsStatistics(2);
+    for(unsigned int i=0; i<3; ++i)
+    {
+        StepCounters stepCounters;
+        stepCounters.bodies = i;
+        physicsStatistics.addStep(1.0, StageTimings(), stepCounters);
+    }
+
+    std::stringstream csvStream;
+    physicsStatistics.writeCsv(csvStream);
+    std::vector<std::string> csvLines;
+    for(std::string line; std::getline(csvStream, line);)
+    {
+        csvLines.push_back(line);
+    }
+
+    AssertHelper::assertUnsignedInt(physicsStatistics.getStepCount(), 3);
+    AssertHelper::assertUnsignedInt(physicsStatistics.getLastStepCounters().bodies, 2);
+    AssertHelper::assertUnsignedInt(csvLines.size(), 3); //header + 2 steps
+    AssertHelper::assertString(csvLines[0].substr(0, 23), "stepIndex,stepMs,broadP");
+    AssertHelper::assertString(csvLines[1].substr(0, 2), "1,");
+    AssertHelper::assertString(csvLines[2].substr(0, 2), "2,");
+}
+
+void PhysicsStatisticsTest::stageHistograms()
+{
+    PhysicsStatistics physicsStatistics(10);
+    StageTimings stageTimings;
+    stageTimings.narrowPhase = 3.0;
+    physicsStatistics.addStep(0.01, stageTimings, StepCounters());
+    physicsStatistics.addStep(100.0, stageTimings, StepCounters());
+
+    std::stringstream jsonStream;
+    physicsStatistics.writeJson(jsonStream);
+    std::string json = jsonStream.str();
+
+    AssertHelper::assertTrue(json.find("\"step\": [1, 0, 0, 0, 0, 0, 0, 0, 0, 1]") != std::string::npos);
+    AssertHelper::assertTrue(json.find("\"narrowPhase\": [0, 0, 0, 0, 0, 0, 2, 0, 0, 0]") != std::string::npos);
+
+    physicsStatistics.clear();
+    AssertHelper::assertUnsignedInt(physicsStatistics.getStepCount(), 0);
+}
+
+void PhysicsStatisticsTest::collisionWorldCounters()
+{
+    auto *bodyManager = new BodyManager();
+    std::shared_ptr<CollisionBoxShape> groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(10.0f, 0.5f, 10.0f));
+    bodyManager->addBody(new RigidBody("ground", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), groundShape));
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto *cubeBody = new RigidBody("cube", Transform<float>(Point3<float>(0.0f, 0.55f, 0.0f), Quaternion<float>(), 1.0f), cubeShape);
+    cubeBody->setMass(1.0f);
+    bodyManager->addBody(cubeBody);
+    auto *collisionWorld = new CollisionWorld(bodyManager);
+    auto *otherBodyManager = new BodyManager();
+    auto *otherCollisionWorld = new CollisionWorld(otherBodyManager); //world without collision: GJK iterations of first world not counted
+
+    unsigned int newPairs = 0, gjkIterations = 0, solverConstraints = 0, otherGjkIterations = 0;
+    for(unsigned int i=0; i<20; ++i)
+    {
+        collisionWorld->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        newPairs += collisionWorld->getLastStepCounters().newPairs;
+        gjkIterations += collisionWorld->getLastStepCounters().gjkIterations;
+        solverConstraints += collisionWorld->getLastStepCounters().solverConstraints;
+
+        otherCollisionWorld->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+        otherGjkIterations += otherCollisionWorld->getLastStepCounters().gjkIterations;
+    }
+
+    const StepCounters &stepCounters = collisionWorld->getLastStepCounters();
+    AssertHelper::assertUnsignedInt(stepCounters.bodies, 2);
+    AssertHelper::assertUnsignedInt(stepCounters.activeBodies + stepCounters.sleepingBodies, 1);
+    AssertHelper::assertUnsignedInt(stepCounters.overlappingPairs, 1);
+    AssertHelper::assertUnsignedInt(newPairs, 1);
+    AssertHelper::assertTrue(gjkIterations > 0);
+    AssertHelper::assertUnsignedInt(otherGjkIterations, 0);
+    AssertHelper::assertTrue(solverConstraints > 0);
+    AssertHelper::assertTrue(stepCounters.algorithmPoolHighWaterMark > 0);
+
+    delete otherCollisionWorld;
+    delete otherBodyManager;
+    delete collisionWorld;
+    delete bodyManager;
+}
+
+CppUnit::Test *PhysicsStatisticsTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PhysicsStatisticsTest");
+
+    suite->addTest(new CppUnit::TestCaller<PhysicsStatisticsTest>("keepLastSteps", &PhysicsStatisticsTest::keepLastSteps));
+    suite->addTest(new CppUnit::TestCaller<PhysicsStatisticsTest>("stageHistograms", &PhysicsStatisticsTest::stageHistograms));
+    suite->addTest(new CppUnit::TestCaller<PhysicsStatisticsTest>("collisionWorldCounters", &PhysicsStatisticsTest::collisionWorldCounters));
+
+    return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_PHYSICSSTATISTICSTEST_H
+#define URCHINENGINE_PHYSICSSTATISTICSTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class PhysicsStatisticsTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void keepLastSteps();
+        void stageHistograms();
+        void collisionWorldCounters();
+};
+
+#endif
@@ -0,0 +1,139 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <thread>
+#include <set>
+#include "UrchinPhysicsEngine.h"
+#include "utils/pool/SyncFixedSizePool.h"
+
+#include "AssertHelper.h"
+#include "physics/utils/pool/FixedSizePoolTest.h"
+using namespace urchin;
+
+struct PoolElement
+{
+    explicit PoolElement(unsigned int value) :
+        value(value)
+    {
+
+    }
+
+    unsigned int value;
+};
+
+void FixedSizePoolTest::growByPages()
+{
+    FixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 4);
+
+    std::vector<PoolElement *> elements;
+    for(unsigned int i=0; i<10; ++i)
+    {
+        elements.push_back(new(pool.allocate(sizeof(PoolElement))) PoolElement(i));
+    }
+
+    AssertHelper::assertUnsignedInt(pool.getHeapAllocationCount(), 2);
+    std::set<PoolElement *> distinctElements(elements.begin(), elements.end());
+    AssertHelper::assertUnsignedInt(distinctElements.size(), 10);
+    for(unsigned int i=0; i<10; ++i)
+    {
+        AssertHelper::assertUnsignedInt(elements[i]->value, i);
+        pool.free(elements[i]);
+    }
+    AssertHelper::assertUnsignedInt(pool.getHighWaterMark(), 10);
+}
+
+void FixedSizePoolTest::reuseFreedElements()
+{
+    FixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 4);
+
+    for(unsigned int step=0; step<5; ++step)
+    {
+        std::vector<PoolElement *> elements;
+        for(unsigned int i=0; i<6; ++i)
+        {
+            elements.push_back(new(pool.allocate(sizeof(PoolElement))) PoolElement(i));
+        }
+        for(auto element : elements)
+        {
+            pool.free(element);
+        }
+    }
+
+    AssertHelper::assertUnsignedInt(pool.getHeapAllocationCount(), 1);
+}
+
+void FixedSizePoolTest::syncPoolMultiThreads()
+{
+    SyncFixedSizePool<PoolElement> pool("testSyncPool", sizeof(PoolElement), 256);
+
+    std::vector<PoolElement *> sharedElements[4];
+    std::vector<std::thread> threads;
+    for(unsigned int threadIndex=0; threadIndex<4; ++threadIndex)
+    {
+        threads.emplace_back([&pool, &sharedElements, threadIndex]() {
+            for(unsigned int i=0; i<1000; ++i)
+            {
+                auto *element = new(pool.allocate(sizeof(PoolElement))) PoolElement(i);
+                if(i % 2 == 0)
+                {
+                    pool.free(element);
+                }else
+                {
+                    sharedElements[threadIndex].push_back(element);
+                }
+            }
+        });
+    }
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<PoolElement *> distinctElements;
+    for(auto &threadElements : sharedElements)
+    {
+        distinctElements.insert(threadElements.begin(), threadElements.end());
+    }
+    AssertHelper::assertUnsignedInt(distinctElements.size(), 2000);
+
+    for(auto &threadElements : sharedElements)
+    { //free elements from another thread than the allocation one
+        for(auto element : threadElements)
+        {
+            pool.free(element);
+        }
+    }
+}
+
+void FixedSizePoolTest::syncPoolThreadExit()
+{
+    SyncFixedSizePool<PoolElement> pool("testSyncPool", sizeof(PoolElement), 2 * SYNC_POOL_THREAD_CACHE_BATCH_SIZE);
+
+    std::thread thread([&pool]() { //thread cache refilled with a batch of elements
+        pool.free(new(pool.allocate(sizeof(PoolElement))) PoolElement(0));
+    });
+    thread.join();
+
+    std::vector<PoolElement *> elements;
+    for(unsigned int i=0; i<2 * SYNC_POOL_THREAD_CACHE_BATCH_SIZE; ++i)
+    { //elements of the exited thread cache are available
+        elements.push_back(new(pool.allocate(sizeof(PoolElement))) PoolElement(i));
+    }
+    AssertHelper::assertUnsignedInt(pool.getHeapAllocationCount(), 0);
+
+    for(auto element : elements)
+    {
+        pool.free(element);
+    }
+}
+
+CppUnit::Test *FixedSizePoolTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("FixedSizePoolTest");
+
+    suite->addTest(new CppUnit::TestCaller<FixedSizePoolTest>("growByPages", &FixedSizePoolTest::growByPages));
+    suite->addTest(new CppUnit::TestCaller<FixedSizePoolTest>("reuseFreedElements", &FixedSizePoolTest::reuseFreedElements));
+    suite->addTest(new CppUnit::TestCaller<FixedSizePoolTest>("syncPoolMultiThreads", &FixedSizePoolTest::syncPoolMultiThreads));
+    suite->addTest(new CppUnit::TestCaller<FixedSizePoolTest>("syncPoolThreadExit", &FixedSizePoolTest::syncPoolThreadExit));
+
+    return suite;
+}
@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_FIXEDSIZEPOOLTEST_H
+#define URCHINENGINE_FIXEDSIZEPOOLTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class FixedSizePoolTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void growByPages();
+        void reuseFreedElements();
+        void syncPoolMultiThreads();
+        void syncPoolThreadExit();
+};
+
+#endif